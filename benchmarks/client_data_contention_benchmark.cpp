@@ -0,0 +1,99 @@
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "spdlog/spdlog.h"
+
+#include "session_manager.hpp"
+#include "client_data_manager.hpp"
+#include "time_order_utils.hpp"
+
+#define BENCHMARK_ACCOUNTS_COUNT 1024
+#define BENCHMARK_MAX_READERS_COUNT 16
+#define DEFAULT_BENCHMARK_DURATION_MS 1000
+
+//*INFO: One writer emulates core thread filling orders of all accounts,
+//*INFO: readers poll balances as sessions do. Result is balance reads per second of all readers
+double run_contention_benchmark(size_t shards_count, int readers_count, int duration_ms) {
+    auto session_manager = std::make_shared<SessionManager>();
+    auto client_data_manager = std::make_shared<ClientDataManager>(session_manager, shards_count);
+
+    std::vector<std::string> usernames;
+    std::vector<Serialize::TradeOrder> orders;
+    for (int account_num = 0; account_num < BENCHMARK_ACCOUNTS_COUNT; ++account_num) {
+        std::string username = "client_" + std::to_string(account_num);
+        client_data_manager->create_new_client_fund_data(username);
+
+        Serialize::TradeOrder order;
+        order.set_order_id(TimeOrderUtils::generate_id());
+        order.set_username(username);
+        order.set_type(Serialize::TradeOrder::BUY);
+        order.set_usd_cost(70.0);
+        order.set_usd_amount(std::numeric_limits<int32_t>::max());
+        client_data_manager->push_order_to_active_orders(order);
+
+        usernames.push_back(username);
+        orders.push_back(order);
+    }
+
+    std::atomic<bool> is_running(true);
+    std::atomic<int64_t> reads_count(0);
+
+    std::thread writer_thread([&] {
+        size_t account_num = 0;
+        while (is_running.load(std::memory_order_relaxed)) {
+            client_data_manager->update_active_order_usd_amount(orders[account_num], 1);
+            account_num = (account_num + 1) % orders.size();
+        }
+    });
+
+    std::vector<std::thread> readers_threads;
+    for (int reader_num = 0; reader_num < readers_count; ++reader_num) {
+        readers_threads.emplace_back([&, reader_num] {
+            int64_t thread_reads_count = 0;
+            size_t account_num = reader_num;
+            while (is_running.load(std::memory_order_relaxed)) {
+                client_data_manager->get_client_balance(usernames[account_num]);
+                account_num = (account_num + readers_count) % usernames.size();
+                ++thread_reads_count;
+            }
+            reads_count.fetch_add(thread_reads_count);
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(duration_ms));
+    is_running.store(false);
+
+    writer_thread.join();
+    for (auto& reader_thread : readers_threads) {
+        reader_thread.join();
+    }
+
+    return reads_count.load() * 1000.0 / duration_ms;
+}
+
+int main(int argc, char* argv[]) {
+    int duration_ms = (argc > 1) ? std::stoi(argv[1]) : DEFAULT_BENCHMARK_DURATION_MS;
+    spdlog::set_level(spdlog::level::off);
+
+    std::cout << "Balance reads/sec with one concurrent writer, " << BENCHMARK_ACCOUNTS_COUNT << " accounts\n";
+    std::cout << std::setw(8) << "readers"
+              << std::setw(20) << "1 shard"
+              << std::setw(20) << (std::to_string(CLIENT_DATA_SHARDS_COUNT) + " shards") << std::endl;
+
+    for (int readers_count = 1; readers_count <= BENCHMARK_MAX_READERS_COUNT; readers_count *= 2) {
+        double single_lock_reads = run_contention_benchmark(1, readers_count, duration_ms);
+        double sharded_reads = run_contention_benchmark(CLIENT_DATA_SHARDS_COUNT, readers_count, duration_ms);
+
+        std::cout << std::setw(8) << readers_count
+                  << std::setw(20) << std::fixed << std::setprecision(0) << single_lock_reads
+                  << std::setw(20) << sharded_reads << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+#ifndef NULL_DATABASE_HPP
+#define NULL_DATABASE_HPP
+
+#include <string>
+#include <vector>
+
+#include "database.hpp"
+#include "trade_market_protocol.pb.h"
+
+//*INFO: IDatabase that drops all writes and loads nothing, benchmarks measure engine without persistence
+class NullDatabase : public IDatabase {
+public:
+    bool is_user_exists(const std::string& username) override {
+        return false;
+    }
+
+    void add_user(const std::string& username, const std::string& password) override {
+    }
+
+    bool authenticate_user(const std::string& username, const std::string& password) override {
+        return false;
+    }
+
+    void save_active_order_to_db(const Serialize::TradeOrder& order) override {
+    }
+
+    std::vector<Serialize::TradeOrder> load_active_orders_from_db(Serialize::TradeOrder::TradeType type) override {
+        return {};
+    }
+
+    void update_actual_client_balance_in_db(const Serialize::ClientBalance& client_balance) override {
+    }
+
+    std::vector<Serialize::ClientBalance> load_clients_balances_from_db() override {
+        return {};
+    }
+
+    void save_completed_order_to_db(const Serialize::TradeOrder& order, int64_t completion_timestamp) override {
+    }
+
+    std::vector<Serialize::TradeOrder> load_last_completed_orders(int number) override {
+        return {};
+    }
+
+    void save_qoute_to_db(const Serialize::Quote& qoute) override {
+    }
+
+    std::vector<Serialize::Quote> load_quote_history(int number) override {
+        return {};
+    }
+
+    void save_candle_to_db(Serialize::CandleResolution resolution, const Serialize::Candle& candle) override {
+    }
+
+    std::vector<Serialize::Candle> load_candles_from_db(Serialize::CandleResolution resolution, int number) override {
+        return {};
+    }
+
+    void save_executions_to_db(const std::vector<Serialize::Execution>& executions) override {
+    }
+
+    std::vector<Serialize::Execution> load_last_executions(int number) override {
+        return {};
+    }
+
+    void truncate_active_orders_table() override {
+    }
+};
+
+#endif // NULL_DATABASE_HPP
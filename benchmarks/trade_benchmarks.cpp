@@ -0,0 +1,311 @@
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "spdlog/spdlog.h"
+
+#include "session_manager.hpp"
+#include "client_data_manager.hpp"
+#include "core.hpp"
+#include "null_database.hpp"
+
+#define BENCHMARK_ACCOUNTS_COUNT 1024
+#define BENCHMARK_MIN_DEPTH (1 << 10)
+#define BENCHMARK_MAX_DEPTH (1 << 20)
+#define BENCHMARK_DEPTH_MULTIPLIER 32
+//*INFO: Resting orders of prefilled book are spread over this many price levels of each side
+#define BENCHMARK_PRICE_LEVELS_COUNT 1000
+#define BENCHMARK_PRICE_TICK 0.01
+//*INFO: Book is restored to its depth after this many inserted or canceled orders
+#define BENCHMARK_RESTORE_BATCH_SIZE 1024
+#define BENCHMARK_RANDOM_SEED 42
+
+//*INFO: Prefilled book sits around mid price: buys at BEST_BUY and below, sells at BEST_SELL and above.
+//*INFO: Orders of match benchmarks are placed inside the spread, so they never trade with prefilled orders
+#define BENCHMARK_BEST_BUY_PRICE 69.0
+#define BENCHMARK_MID_PRICE 70.0
+#define BENCHMARK_BEST_SELL_PRICE 71.0
+#define BENCHMARK_ORDER_AMOUNT 10
+
+//*INFO: Engine of one server without network and persistence. Orders go the same way as from session:
+//*INFO: risk check and reservation, active orders of client data manager, then core on this thread
+class BenchmarkMarket {
+public:
+    struct RestingOrder {
+        int64_t order_id;
+        trade_type_t trade_type;
+        size_t account_num;
+    };
+
+    BenchmarkMarket(size_t depth, size_t accounts_count) : depth_(depth),
+                                                           next_order_id_(1),
+                                                           random_engine_(BENCHMARK_RANDOM_SEED),
+                                                           session_manager_(std::make_shared<SessionManager>()) {
+        session_manager_->init_mockdb(std::make_shared<NullDatabase>());
+        session_manager_->init_core();
+        session_manager_->init_client_data_manager();
+
+        client_data_manager_ = session_manager_->get_client_data_manager();
+        core_ = session_manager_->get_core();
+
+        for (size_t account_num = 0; account_num < accounts_count; ++account_num) {
+            usernames_.push_back("client_" + std::to_string(account_num));
+            client_data_manager_->create_new_client_fund_data(usernames_.back());
+        }
+
+        resting_orders_.reserve(depth + BENCHMARK_RESTORE_BATCH_SIZE);
+        restore_depth();
+    }
+
+    size_t get_depth() const {
+        return depth_;
+    }
+
+    size_t get_accounts_count() const {
+        return usernames_.size();
+    }
+
+    const std::string& get_username(size_t account_num) const {
+        return usernames_[account_num];
+    }
+
+    std::shared_ptr<ClientDataManager> get_client_data_manager() const {
+        return client_data_manager_;
+    }
+
+    int64_t submit_order(Serialize::TradeOrder::TradeType type, double usd_cost, int32_t usd_amount, size_t account_num) {
+        Serialize::TradeOrder order;
+        order.set_order_id(next_order_id_++);
+        order.set_username(usernames_[account_num]);
+        order.set_type(type);
+        order.set_usd_cost(usd_cost);
+        order.set_usd_amount(usd_amount);
+        order.set_usd_volume(usd_amount);
+        order.set_timestamp(order.order_id());
+
+        if (client_data_manager_->check_and_reserve_order(order) != RISK_ACCEPTED) {
+            return 0;
+        }
+        client_data_manager_->push_order_to_active_orders(order);
+        core_->accept_incoming_order(order);
+        core_->process_orders();
+        return order.order_id();
+    }
+
+    //*INFO: Random side, level and account, order never crosses the book
+    void add_resting_order() {
+        std::uniform_int_distribution<int> side_distribution(0, 1);
+        std::uniform_int_distribution<int> level_distribution(0, BENCHMARK_PRICE_LEVELS_COUNT - 1);
+        std::uniform_int_distribution<size_t> account_distribution(0, usernames_.size() - 1);
+
+        bool is_buy = side_distribution(random_engine_) == 0;
+        double level_offset = level_distribution(random_engine_) * BENCHMARK_PRICE_TICK;
+        size_t account_num = account_distribution(random_engine_);
+
+        int64_t order_id = is_buy ? submit_order(Serialize::TradeOrder::BUY, BENCHMARK_BEST_BUY_PRICE - level_offset,
+                                                 BENCHMARK_ORDER_AMOUNT, account_num)
+                                  : submit_order(Serialize::TradeOrder::SELL, BENCHMARK_BEST_SELL_PRICE + level_offset,
+                                                 BENCHMARK_ORDER_AMOUNT, account_num);
+        resting_orders_.push_back(RestingOrder{order_id, is_buy ? BUY : SELL, account_num});
+    }
+
+    bool cancel_order(int64_t order_id, trade_type_t trade_type, size_t account_num) {
+        return client_data_manager_->cancel_active_order(trade_type, order_id, usernames_[account_num]);
+    }
+
+    //*INFO: Order is taken from random place of book, so cancel touches different levels and queue positions
+    bool cancel_random_resting_order() {
+        std::uniform_int_distribution<size_t> order_distribution(0, resting_orders_.size() - 1);
+        size_t order_num = order_distribution(random_engine_);
+
+        RestingOrder resting_order = resting_orders_[order_num];
+        resting_orders_[order_num] = resting_orders_.back();
+        resting_orders_.pop_back();
+        return cancel_order(resting_order.order_id, resting_order.trade_type, resting_order.account_num);
+    }
+
+    //*INFO: Benchmarks leave book with depth orders, next benchmark may reuse it
+    void restore_depth() {
+        while (resting_orders_.size() < depth_) {
+            add_resting_order();
+        }
+        while (resting_orders_.size() > depth_) {
+            const RestingOrder& resting_order = resting_orders_.back();
+            cancel_order(resting_order.order_id, resting_order.trade_type, resting_order.account_num);
+            resting_orders_.pop_back();
+        }
+    }
+
+private:
+    size_t depth_;
+    int64_t next_order_id_;
+    std::mt19937 random_engine_;
+    std::vector<std::string> usernames_;
+    std::vector<RestingOrder> resting_orders_;
+
+    std::shared_ptr<SessionManager> session_manager_;
+    std::shared_ptr<ClientDataManager> client_data_manager_;
+    std::shared_ptr<Core> core_;
+};
+
+//*INFO: Filling 1M orders takes seconds, so last market is kept while benchmarks ask for same depth.
+//*INFO: Only one market lives at a time
+BenchmarkMarket& get_market(size_t depth, size_t accounts_count = BENCHMARK_ACCOUNTS_COUNT) {
+    static std::unique_ptr<BenchmarkMarket> market;
+    if (!market || market->get_depth() != depth || market->get_accounts_count() != accounts_count) {
+        market.reset();
+        market = std::make_unique<BenchmarkMarket>(depth, accounts_count);
+    }
+    return *market;
+}
+
+void depth_and_levels_arguments(benchmark::internal::Benchmark* benchmark) {
+    for (int64_t depth = BENCHMARK_MIN_DEPTH; depth <= BENCHMARK_MAX_DEPTH; depth *= BENCHMARK_DEPTH_MULTIPLIER) {
+        for (int64_t levels_count : {1, 10, 100}) {
+            benchmark->Args({depth, levels_count});
+        }
+    }
+}
+
+//*INFO: New resting limit order joins existing level of book with depth orders
+void BM_InsertOrder(benchmark::State& state) {
+    BenchmarkMarket& market = get_market(state.range(0));
+
+    size_t inserted_count = 0;
+    for (auto _ : state) {
+        market.add_resting_order();
+
+        if (++inserted_count % BENCHMARK_RESTORE_BATCH_SIZE == 0) {
+            state.PauseTiming();
+            market.restore_depth();
+            state.ResumeTiming();
+        }
+    }
+    market.restore_depth();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_InsertOrder)->RangeMultiplier(BENCHMARK_DEPTH_MULTIPLIER)->Range(BENCHMARK_MIN_DEPTH, BENCHMARK_MAX_DEPTH);
+
+void BM_CancelOrder(benchmark::State& state) {
+    BenchmarkMarket& market = get_market(state.range(0));
+
+    size_t canceled_count = 0;
+    for (auto _ : state) {
+        if (!market.cancel_random_resting_order()) {
+            state.SkipWithError("Resting order was not canceled");
+            break;
+        }
+
+        if (++canceled_count % BENCHMARK_RESTORE_BATCH_SIZE == 0) {
+            state.PauseTiming();
+            market.restore_depth();
+            state.ResumeTiming();
+        }
+    }
+    market.restore_depth();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CancelOrder)->RangeMultiplier(BENCHMARK_DEPTH_MULTIPLIER)->Range(BENCHMARK_MIN_DEPTH, BENCHMARK_MAX_DEPTH);
+
+//*INFO: Buy order sweeps levels_count sell levels of one order each, placed inside the spread before every iteration
+void BM_MatchThroughLevels(benchmark::State& state) {
+    BenchmarkMarket& market = get_market(state.range(0));
+    int32_t levels_count = static_cast<int32_t>(state.range(1));
+    size_t maker_account_num = 0;
+    size_t taker_account_num = 1;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (int32_t level_num = 0; level_num < levels_count; ++level_num) {
+            market.submit_order(Serialize::TradeOrder::SELL, BENCHMARK_MID_PRICE + level_num * BENCHMARK_PRICE_TICK,
+                                BENCHMARK_ORDER_AMOUNT, maker_account_num);
+        }
+        state.ResumeTiming();
+
+        market.submit_order(Serialize::TradeOrder::BUY, BENCHMARK_MID_PRICE + (levels_count - 1) * BENCHMARK_PRICE_TICK,
+                            levels_count * BENCHMARK_ORDER_AMOUNT, taker_account_num);
+    }
+    state.SetItemsProcessed(state.iterations() * levels_count);
+}
+BENCHMARK(BM_MatchThroughLevels)->Apply(depth_and_levels_arguments)->ArgNames({"depth", "levels"});
+
+//*INFO: Small buy orders partially fill one large resting sell order, maker stays at top of book
+void BM_PartialFill(benchmark::State& state) {
+    BenchmarkMarket& market = get_market(state.range(0));
+    size_t maker_account_num = 0;
+    size_t taker_account_num = 1;
+
+    int64_t maker_order_id = market.submit_order(Serialize::TradeOrder::SELL, BENCHMARK_MID_PRICE,
+                                                 std::numeric_limits<int32_t>::max(), maker_account_num);
+    for (auto _ : state) {
+        market.submit_order(Serialize::TradeOrder::BUY, BENCHMARK_MID_PRICE, 1, taker_account_num);
+    }
+    market.cancel_order(maker_order_id, SELL, maker_account_num);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PartialFill)->RangeMultiplier(BENCHMARK_DEPTH_MULTIPLIER)->Range(BENCHMARK_MIN_DEPTH, BENCHMARK_MAX_DEPTH);
+
+void BM_GetAllActiveOrders(benchmark::State& state) {
+    BenchmarkMarket& market = get_market(state.range(0));
+    auto client_data_manager = market.get_client_data_manager();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(client_data_manager->get_all_active_oreders());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GetAllActiveOrders)->RangeMultiplier(BENCHMARK_DEPTH_MULTIPLIER)->Range(BENCHMARK_MIN_DEPTH, BENCHMARK_MAX_DEPTH)
+                                ->Unit(benchmark::kMicrosecond);
+
+//*INFO: Quote history keeps AMOUNT_QUOTE_HISTORY last quotes whatever book depth is, so it is filled once and not parameterized
+void BM_GetQuoteHistory(benchmark::State& state) {
+    BenchmarkMarket& market = get_market(BENCHMARK_MIN_DEPTH);
+    auto client_data_manager = market.get_client_data_manager();
+    size_t maker_account_num = 0;
+    size_t taker_account_num = 1;
+
+    for (int trade_num = 0; trade_num < AMOUNT_QUOTE_HISTORY; ++trade_num) {
+        market.submit_order(Serialize::TradeOrder::SELL, BENCHMARK_MID_PRICE, 1, maker_account_num);
+        market.submit_order(Serialize::TradeOrder::BUY, BENCHMARK_MID_PRICE, 1, taker_account_num);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(client_data_manager->get_quote_history());
+    }
+    state.SetItemsProcessed(state.iterations() * AMOUNT_QUOTE_HISTORY);
+}
+BENCHMARK(BM_GetQuoteHistory)->Unit(benchmark::kMicrosecond);
+
+//*INFO: Balances of both sides of match changed by core thread, number of accounts is parameter instead of book depth
+void BM_BalanceUpdate(benchmark::State& state) {
+    BenchmarkMarket& market = get_market(0, state.range(0));
+    auto client_data_manager = market.get_client_data_manager();
+
+    size_t account_num = 0;
+    for (auto _ : state) {
+        size_t counterparty_account_num = (account_num + 1) % market.get_accounts_count();
+        client_data_manager->change_client_balances_according_match(market.get_username(account_num),
+                                                                    market.get_username(counterparty_account_num),
+                                                                    1, BENCHMARK_MID_PRICE, BENCHMARK_MID_PRICE, BENCHMARK_MID_PRICE);
+        account_num = counterparty_account_num;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BalanceUpdate)->RangeMultiplier(BENCHMARK_DEPTH_MULTIPLIER)->Range(BENCHMARK_MIN_DEPTH, BENCHMARK_MAX_DEPTH);
+
+int main(int argc, char* argv[]) {
+    spdlog::set_level(spdlog::level::off);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -15,12 +15,20 @@ void Client::connect_to_server(const boost::asio::ip::tcp::resolver::results_typ
     }
 }
 
-Serialize::TradeOrder Client::form_order(trade_type_t trade_type, double usd_cost, int usd_amount) {
+Serialize::TradeOrder Client::form_order(trade_type_t trade_type, double usd_cost, int usd_amount,
+                                         Serialize::TradeOrder::OrderType order_type,
+                                         Serialize::TradeOrder::TimeInForce time_in_force,
+                                         double stop_price, int peak_amount, int64_t expire_time) {
     Serialize::TradeOrder order;
 
     order.set_usd_cost(usd_cost);
     order.set_usd_amount(usd_amount);
     order.set_usd_volume(usd_amount);
+    order.set_order_type(order_type);
+    order.set_time_in_force(time_in_force);
+    order.set_stop_price(stop_price);
+    order.set_peak_amount(peak_amount);
+    order.set_expire_time(expire_time);
 
     order.set_username(get_username());
 
@@ -62,6 +70,20 @@ Serialize::CancelTradeOrder Client::cancel_order(trade_type_t trade_type, int64_
     return cancel_order;
 }
 
+Serialize::ModifyTradeOrder Client::modify_order(trade_type_t trade_type, int64_t order_id, double usd_cost, int usd_amount) {
+    Serialize::ModifyTradeOrder modify_order;
+
+    modify_order.set_type((trade_type == BUY) ? Serialize::TradeOrder::BUY : Serialize::TradeOrder::SELL);
+    modify_order.set_order_id(order_id);
+    modify_order.set_usd_cost(usd_cost);
+    modify_order.set_usd_amount(usd_amount);
+
+    spdlog::info("Request to modify order formed: id={}, type={}, cost={}, amount={}", 
+                 order_id, (trade_type == BUY) ? "BUY" : "SELL", usd_cost, usd_amount);
+
+    return modify_order;
+}
+
 bool Client::send_request_to_stock(Serialize::TradeRequest& request) {
     if (request.command() !=  Serialize::TradeRequest::SIGN_UP &&
         request.command() != Serialize::TradeRequest::SIGN_IN) {
@@ -90,7 +112,22 @@ void Client::write_data_to_socket(const std::string& serialized_request) {
 }
 
 bool Client::get_response_from_stock() {
-    boost::asio::streambuf response_buf;
+    Serialize::TradeResponse response;
+
+    //*INFO Execution reports are pushed by server at any time, skip them until actual response
+    do {
+        if (!read_response_from_socket(response)) {
+            return false;
+        }
+        if (response.response_msg() == Serialize::TradeResponse::ORDER_MATCHED) {
+            print_execution_report(response.execution_report());
+        }
+    } while (response.response_msg() == Serialize::TradeResponse::ORDER_MATCHED);
+
+    return handle_received_response_from_stock(response);
+}
+
+bool Client::read_response_from_socket(Serialize::TradeResponse& response) {
     boost::system::error_code error_code;
 
     boost::asio::read(socket_, boost::asio::buffer(data_length_, sizeof(uint32_t)), error_code);
@@ -108,10 +145,26 @@ bool Client::get_response_from_stock() {
         return false;
     }
 
-    Serialize::TradeResponse response;
     response.ParseFromArray(response_data.data(), msg_length);
+    return true;
+}
 
-    return handle_received_response_from_stock(response);
+void Client::print_execution_report(const Serialize::ExecutionReport& report) {
+    if (report.canceled_amount() > 0) {
+        std::cout << "\nOrder " << report.order_id()
+                  << " (" << ((report.type() == Serialize::TradeOrder::BUY) ? "buy" : "sell") << ") canceled by exchange: "
+                  << report.canceled_amount() << " USD, remaining " << report.remaining_amount() << " USD"
+                  << ", Timestamp: " << timestamp_to_readable(report.timestamp()) << std::endl;
+        return;
+    }
+
+    std::cout << "\nOrder " << report.order_id()
+              << " (" << ((report.type() == Serialize::TradeOrder::BUY) ? "buy" : "sell") << ") executed: "
+              << report.fill_amount() << " USD at " << report.price() << " RUB"
+              << ", remaining: " << report.remaining_amount() << " USD"
+              << ", balance change: " << report.usd_balance_delta() << " USD, "
+              << report.rub_balance_delta() << " RUB"
+              << ", Timestamp: " << timestamp_to_readable(report.timestamp()) << std::endl;
 }
 
 bool Client::handle_received_response_from_stock(const Serialize::TradeResponse& response) {
@@ -148,9 +201,15 @@ bool Client::handle_received_response_from_stock(const Serialize::TradeResponse&
                       << response.account_balance().rub_balance() << " RUB, "
                       << response.account_balance().usd_balance() << " USD."
                       << std::endl;
+            std::cout << "Reserved by active orders: "
+                      << response.account_balance().rub_reserved() << " RUB, "
+                      << response.account_balance().usd_reserved() << " USD."
+                      << std::endl;
             return true;
         }   
 
+        case Serialize::TradeResponse::SUCCESS_VIEW_MY_ACTIVE_ORDERS:
+            [[fallthrough]];
         case Serialize::TradeResponse::SUCCESS_VIEW_ALL_ACTIVE_ORDERS: {
             const auto& active_orders = response.active_orders();
 
@@ -160,6 +219,9 @@ bool Client::handle_received_response_from_stock(const Serialize::TradeResponse&
                           << ", USD Cost: " << order.usd_cost()
                           << ", USD Amount: " << order.usd_amount()
                           << ", USD Volume: " << order.usd_volume()
+                          << ((order.stop_price() > 0) ? ", Stop Price: " + std::to_string(order.stop_price()) : "")
+                          << ((order.peak_amount() > 0) ? ", Shown USD Amount: " + std::to_string(order.peak_amount()) : "")
+                          << ((order.expire_time() > 0) ? ", Expires: " + timestamp_to_readable(order.expire_time()) : "")
                           << ", Timestamp: " <<  timestamp_to_readable(order.timestamp())
                           << ", Username: " << order.username() << std::endl;
             }
@@ -170,6 +232,9 @@ bool Client::handle_received_response_from_stock(const Serialize::TradeResponse&
                           << ", USD Cost: " << order.usd_cost()
                           << ", USD Amount: " << order.usd_amount()
                           << ", USD Volume: " << order.usd_volume()
+                          << ((order.stop_price() > 0) ? ", Stop Price: " + std::to_string(order.stop_price()) : "")
+                          << ((order.peak_amount() > 0) ? ", Shown USD Amount: " + std::to_string(order.peak_amount()) : "")
+                          << ((order.expire_time() > 0) ? ", Expires: " + timestamp_to_readable(order.expire_time()) : "")
                           << ", Timestamp: " <<  timestamp_to_readable(order.timestamp())
                           << ", Username: " << order.username() << std::endl;
             }
@@ -212,6 +277,60 @@ bool Client::handle_received_response_from_stock(const Serialize::TradeResponse&
             return true;
         }
 
+        case Serialize::TradeResponse::SUCCESS_VIEW_CANDLES: {
+            const auto& candles = response.candles();
+
+            std::cout << "\nCandles:\n";
+            for (const auto& candle : candles.candles()) {
+                std::cout << "Open time: " << timestamp_to_readable(candle.open_time())
+                          << ", O: " << candle.open()
+                          << ", H: " << candle.high()
+                          << ", L: " << candle.low()
+                          << ", C: " << candle.close()
+                          << ", USD Volume: " << candle.usd_volume()
+                          << ", Trades: " << candle.trades_count() << std::endl;
+            }
+
+            return true;
+        }
+
+        case Serialize::TradeResponse::SUCCESS_VIEW_TRADES: {
+            const auto& trades = response.trades();
+
+            std::cout << "\nTrades:\n";
+            for (const auto& execution : trades.executions()) {
+                std::cout << "Timestamp: " << timestamp_to_readable(execution.timestamp())
+                          << ", Trade ID: " << execution.trade_id()
+                          << ", Price: " << execution.price()
+                          << ", USD Amount: " << execution.usd_amount()
+                          << ", Aggressor: " << (execution.aggressor_side() == Serialize::TradeOrder::BUY ? "buy" : "sell")
+                          << ", Maker order ID: " << execution.maker_order_id()
+                          << ", Taker order ID: " << execution.taker_order_id() << std::endl;
+            }
+
+            return true;
+        }
+
+        case Serialize::TradeResponse::SUCCESS_VIEW_DEPTH: {
+            const auto& market_depth = response.market_depth();
+
+            std::cout << "\nMarket depth at " << timestamp_to_readable(market_depth.timestamp()) << "\n";
+            std::cout << "Asks:\n";
+            for (auto ask_iterator = market_depth.asks().rbegin(); ask_iterator != market_depth.asks().rend(); ++ask_iterator) {
+                std::cout << "Price: " << ask_iterator->price()
+                          << ", USD Amount: " << ask_iterator->usd_amount()
+                          << ", Orders: " << ask_iterator->orders_count() << std::endl;
+            }
+            std::cout << "Bids:\n";
+            for (const auto& bid : market_depth.bids()) {
+                std::cout << "Price: " << bid.price()
+                          << ", USD Amount: " << bid.usd_amount()
+                          << ", Orders: " << bid.orders_count() << std::endl;
+            }
+
+            return true;
+        }
+
         case Serialize::TradeResponse::SUCCESS_CANCEL_ACTIVE_ORDER : {
             std::cout << "\nOrder successfully canceled" << std::endl;
             return true;
@@ -220,7 +339,26 @@ bool Client::handle_received_response_from_stock(const Serialize::TradeResponse&
             std::cout << "\nYou can't cancel this order" << std::endl;
             return true;
         }
+
+        case Serialize::TradeResponse::SUCCESS_CANCEL_ALL : {
+            std::cout << "\nCanceled orders: " << response.canceled_orders_count() << std::endl;
+            return true;
+        }
+
+        case Serialize::TradeResponse::SUCCESS_MODIFY_ORDER : {
+            std::cout << "\nOrder successfully modified" << std::endl;
+            return true;
+        }
+        case Serialize::TradeResponse::ERROR_MODIFY_ORDER : {
+            std::cout << "\nYou can't modify this order" << std::endl;
+            return true;
+        }
         
+        case Serialize::TradeResponse::ORDER_REJECTED_BY_RISK : {
+            std::cout << "\nOrder rejected: " << response.error_response() << std::endl;
+            return true;
+        }
+
         case Serialize::TradeResponse::ERROR : {
             std::cout << "\nUnkown error" << std::endl;
             return true;
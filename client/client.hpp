@@ -15,8 +15,12 @@ class Client {
 public:
    Client(boost::asio::io_context& io_context, const boost::asio::ip::tcp::resolver::results_type& endpoints);
 
-   Serialize::TradeOrder form_order(trade_type_t trade_type, double usd_cost, int usd_amount);
+   Serialize::TradeOrder form_order(trade_type_t trade_type, double usd_cost, int usd_amount,
+                                    Serialize::TradeOrder::OrderType order_type = Serialize::TradeOrder::LIMIT,
+                                    Serialize::TradeOrder::TimeInForce time_in_force = Serialize::TradeOrder::GTC,
+                                    double stop_price = 0.0, int peak_amount = 0, int64_t expire_time = 0);
    Serialize::CancelTradeOrder cancel_order(trade_type_t trade_type, int64_t order_id);
+   Serialize::ModifyTradeOrder modify_order(trade_type_t trade_type, int64_t order_id, double usd_cost, int usd_amount);
    
    bool send_request_to_stock(Serialize::TradeRequest& request);
 
@@ -28,6 +32,8 @@ public:
 private:
    void connect_to_server(const boost::asio::ip::tcp::resolver::results_type& endpoints);
    bool get_response_from_stock();
+   bool read_response_from_socket(Serialize::TradeResponse& response);
+   void print_execution_report(const Serialize::ExecutionReport& report);
    void write_data_to_socket(const std::string& serialized_order);
    bool handle_received_response_from_stock(const Serialize::TradeResponse& response);
    void manage_server_socket_error(const boost::system::error_code& error_code);
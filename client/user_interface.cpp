@@ -36,14 +36,20 @@ void UserInterface::auth_menu() {
                     "Error: Password must be one word without spaces and not exceed 20 characters."
                 );
 
+                std::string cancel_on_disconnect_msg = "Cancel your active orders when this session is closed:\n"
+                                                       "1) no\n"
+                                                       "2) yes\n";
+                bool is_cancel_on_disconnect = (valid_menu_option_num_choice(cancel_on_disconnect_msg, 1, 2) == 2);
+
                 Serialize::TradeRequest::CommandType command = (auth_menu_option_num == 1) ? 
                     Serialize::TradeRequest::SIGN_UP : Serialize::TradeRequest::SIGN_IN;
 
-                if (perform_auth_request(client_username, client_password, command)) {
+                if (perform_auth_request(client_username, client_password, command, is_cancel_on_disconnect)) {
                     if (auth_menu_option_num == 1) {
                         std::cout << "Account created successfully. Attempting to sign in..." << std::endl;
                         //*INFO If registration was successful, attempt to sign in
-                        if (perform_auth_request(client_username, client_password, Serialize::TradeRequest::SIGN_IN)) {
+                        if (perform_auth_request(client_username, client_password, Serialize::TradeRequest::SIGN_IN,
+                                                 is_cancel_on_disconnect)) {
                             std::cout << "Signed in successfully." << std::endl;
                             return;
                         }
@@ -111,7 +117,8 @@ std::string UserInterface::get_valid_auth_input(const std::string& prompt, const
     }
 }
 
-bool UserInterface::perform_auth_request(const std::string& username, const std::string& password, Serialize::TradeRequest::CommandType command) {
+bool UserInterface::perform_auth_request(const std::string& username, const std::string& password, Serialize::TradeRequest::CommandType command,
+                                         bool is_cancel_on_disconnect) {
     Serialize::TradeRequest request;
     request.set_command(command); 
 
@@ -121,6 +128,7 @@ bool UserInterface::perform_auth_request(const std::string& username, const std:
     } else if (command == Serialize::TradeRequest::SIGN_IN) {
         request.mutable_sign_in_request()->set_username(username);
         request.mutable_sign_in_request()->set_password(password);
+        request.mutable_sign_in_request()->set_cancel_on_disconnect(is_cancel_on_disconnect);
     } else {
         return false;
     }
@@ -143,8 +151,14 @@ void UserInterface::stock_menu() {
                                    "4) View last completed trades\n"
                                    "5) View qoute histiry\n"
                                    "6) Cancel active order\n"
-                                   "7) Exit\n";
-        short main_menu_option_num = valid_menu_option_num_choice(menu_message, 1, 7);
+                                   "7) View market depth\n"
+                                   "8) View my active orders\n"
+                                   "9) View candles\n"
+                                   "10) View trades\n"
+                                   "11) Modify active order\n"
+                                   "12) Cancel all my orders\n"
+                                   "13) Exit\n";
+        short main_menu_option_num = valid_menu_option_num_choice(menu_message, 1, 13);
 
         switch (main_menu_option_num) {
                 case 1: {
@@ -172,6 +186,30 @@ void UserInterface::stock_menu() {
                     break;
                 }
                 case 7: {
+                    handle_view_depth();
+                    break;
+                }
+                case 8: {
+                    handle_view_my_active_orders();
+                    break;
+                }
+                case 9: {
+                    handle_view_candles();
+                    break;
+                }
+                case 10: {
+                    handle_view_trades();
+                    break;
+                }
+                case 11: {
+                    handle_modify_order();
+                    break;
+                }
+                case 12: {
+                    handle_cancel_all_orders();
+                    break;
+                }
+                case 13: {
                     handle_exit();
                     return;
                 }
@@ -190,11 +228,58 @@ void UserInterface::handle_make_order() {
                                                       "2) sell $\n";
     short menu_order_type = valid_menu_option_num_choice(menu_order_type_msg, 1, 2);
 
-    double usd_cost = get_valid_numeric_input<double>("Enter USD cost (RUB)", 0.01, 1000.0);
+    std::string menu_order_kind_msg = "Enter order kind:\n"
+                                      "1) limit, rests until filled\n"
+                                      "2) limit, immediate or cancel\n"
+                                      "3) limit, fill or kill\n"
+                                      "4) market\n"
+                                      "5) stop, market order at stop price\n"
+                                      "6) stop-limit, limit order at stop price\n"
+                                      "7) iceberg, limit order showing only part of amount\n"
+                                      "8) limit, good till date\n"
+                                      "9) limit, good for day\n";
+    short menu_order_kind = valid_menu_option_num_choice(menu_order_kind_msg, 1, 9);
+
+    auto order_kind = Serialize::TradeOrder::LIMIT;
+    auto time_in_force = Serialize::TradeOrder::GTC;
+    switch (menu_order_kind) {
+        case 2: time_in_force = Serialize::TradeOrder::IOC; break;
+        case 3: time_in_force = Serialize::TradeOrder::FOK; break;
+        case 4: order_kind = Serialize::TradeOrder::MARKET; break;
+        case 5: order_kind = Serialize::TradeOrder::STOP; break;
+        case 6: order_kind = Serialize::TradeOrder::STOP_LIMIT; break;
+        case 8: time_in_force = Serialize::TradeOrder::GTD; break;
+        case 9: time_in_force = Serialize::TradeOrder::DAY; break;
+    }
+
+    double stop_price = 0.0;
+    if (order_kind == Serialize::TradeOrder::STOP || order_kind == Serialize::TradeOrder::STOP_LIMIT) {
+        stop_price = get_valid_numeric_input<double>("Enter stop price (RUB)", 0.01, 1000.0);
+    }
+
+    //*INFO: Market and stop order price is set by exchange
+    double usd_cost = 0.0;
+    if (order_kind == Serialize::TradeOrder::LIMIT || order_kind == Serialize::TradeOrder::STOP_LIMIT) {
+        usd_cost = get_valid_numeric_input<double>("Enter USD cost (RUB)", 0.01, 1000.0);
+    }
     int usd_amount = get_valid_numeric_input<int>("Enter USD amount", 1, 1000000); 
 
+    int peak_amount = 0;
+    if (menu_order_kind == 7) {
+        peak_amount = get_valid_numeric_input<int>("Enter shown USD amount", 1, usd_amount);
+    }
+
+    //*INFO: DAY order expiry is set by exchange
+    int64_t expire_time = 0;
+    if (time_in_force == Serialize::TradeOrder::GTD) {
+        int minutes_to_live = get_valid_numeric_input<int>("Enter order lifetime (minutes)", 1, 60 * 24 * 30);
+        auto expire_time_point = std::chrono::system_clock::now() + std::chrono::minutes(minutes_to_live);
+        expire_time = std::chrono::duration_cast<std::chrono::milliseconds>(expire_time_point.time_since_epoch()).count();
+    }
+
     trade_type_t trade_type = (menu_order_type == 1) ? BUY : SELL;
-    Serialize::TradeOrder order = client_.form_order(trade_type, usd_cost, usd_amount);
+    Serialize::TradeOrder order = client_.form_order(trade_type, usd_cost, usd_amount, order_kind, time_in_force,
+                                                     stop_price, peak_amount, expire_time);
                     
     trade_request.set_command(Serialize::TradeRequest::MAKE_ORDER);
     trade_request.mutable_order()->CopyFrom(order);
@@ -245,6 +330,88 @@ void UserInterface::handle_cancel_order() {
     client_.send_request_to_stock(trade_request);
 }
 
+void UserInterface::handle_cancel_all_orders() {
+    Serialize::TradeRequest trade_request;
+    std::string menu_side_msg = "Cancel orders of side:\n"
+                                "1) buy and sell\n"
+                                "2) buy $\n"
+                                "3) sell $\n";
+    short menu_side = valid_menu_option_num_choice(menu_side_msg, 1, 3);
+
+    auto side = Serialize::CancelAllOrders::BOTH;
+    if (menu_side == 2) {
+        side = Serialize::CancelAllOrders::BUY;
+    } else if (menu_side == 3) {
+        side = Serialize::CancelAllOrders::SELL;
+    }
+
+    trade_request.set_command(Serialize::TradeRequest::CANCEL_ALL);
+    trade_request.mutable_cancel_all()->set_side(side);
+
+    client_.send_request_to_stock(trade_request);
+}
+
+void UserInterface::handle_modify_order() {
+    Serialize::TradeRequest trade_request;
+    std::string menu_order_type_msg = "Enter modify order type:\n"
+                                      "1) buy $\n"
+                                      "2) sell $\n";
+    short menu_order_type = valid_menu_option_num_choice(menu_order_type_msg, 1, 2);
+
+    int64_t modify_order_id = get_valid_numeric_input<int64_t>("Enter "
+                " order_id you want to modify. [Tip - copy/paste] \n", 1LL, std::numeric_limits<int64_t>::max());
+    double usd_cost = get_valid_numeric_input<double>("Enter new USD cost (RUB)", 0.01, 1000.0);
+    int usd_amount = get_valid_numeric_input<int>("Enter new open USD amount", 1, 1000000);
+
+    trade_type_t trade_type = (menu_order_type == 1) ? BUY : SELL;
+    Serialize::ModifyTradeOrder modify_order = client_.modify_order(trade_type, modify_order_id, usd_cost, usd_amount);
+
+    trade_request.set_command(Serialize::TradeRequest::MODIFY_ORDER);
+    trade_request.mutable_modify_order()->CopyFrom(modify_order);
+
+    client_.send_request_to_stock(trade_request);
+}
+
+void UserInterface::handle_view_my_active_orders() {
+    Serialize::TradeRequest trade_request;
+    trade_request.set_command(Serialize::TradeRequest::VIEW_MY_ACTIVE_ORDERS);
+    client_.send_request_to_stock(trade_request);
+}
+
+void UserInterface::handle_view_candles() {
+    Serialize::TradeRequest trade_request;
+
+    std::string menu_resolution_msg = "Enter candle resolution:\n"
+                                      "1) 1 second\n"
+                                      "2) 1 minute\n"
+                                      "3) 5 minutes\n"
+                                      "4) 1 hour\n"
+                                      "5) 1 day\n";
+    short menu_resolution = valid_menu_option_num_choice(menu_resolution_msg, 1, 5);
+
+    trade_request.set_command(Serialize::TradeRequest::VIEW_CANDLES);
+    trade_request.mutable_candles_request()->set_resolution(static_cast<Serialize::CandleResolution>(menu_resolution - 1));
+
+    client_.send_request_to_stock(trade_request);
+}
+
+void UserInterface::handle_view_trades() {
+    Serialize::TradeRequest trade_request;
+    trade_request.set_command(Serialize::TradeRequest::VIEW_TRADES);
+    client_.send_request_to_stock(trade_request);
+}
+
+void UserInterface::handle_view_depth() {
+    Serialize::TradeRequest trade_request;
+
+    int levels = get_valid_numeric_input<int>("Enter number of price levels", 1, MAX_DEPTH_LEVELS);
+
+    trade_request.set_command(Serialize::TradeRequest::VIEW_DEPTH);
+    trade_request.mutable_depth_request()->set_levels(levels);
+
+    client_.send_request_to_stock(trade_request);
+}
+
 void UserInterface::handle_exit() {
     client_.close();
     if (io_context_thread_.joinable()) {
@@ -4,10 +4,12 @@
 #include <string>
 #include <thread>
 #include <limits>
+#include <chrono>
 
 #include <boost/asio.hpp>
 
 #include "client.hpp"
+#include "common.hpp"
 
 #define MAX_AUTH_CHAR_LENGTH 20
 
@@ -25,10 +27,17 @@ public:
     void handle_view_completed_trades();
     void handle_view_quote_history();
     void handle_cancel_order();
+    void handle_cancel_all_orders();
+    void handle_modify_order();
+    void handle_view_depth();
+    void handle_view_my_active_orders();
+    void handle_view_candles();
+    void handle_view_trades();
     void handle_exit();
 
     std::string get_valid_auth_input(const std::string& prompt, const std::string& error_message);
-    bool perform_auth_request(const std::string& username, const std::string& password, Serialize::TradeRequest::CommandType command);
+    bool perform_auth_request(const std::string& username, const std::string& password, Serialize::TradeRequest::CommandType command,
+                              bool is_cancel_on_disconnect = false);
 
     short valid_menu_option_num_choice(const std::string& menu_message, short lower_bound, short upper_bound);
     template<typename T>
@@ -3,6 +3,7 @@
 
 #define LOGS_FILE_SIZE 524285 // ~5 MB
 #define AMOUNT_OF_ARCHIVED_FILES 5
+#define MAX_DEPTH_LEVELS 50 //*INFO: Depth levels server publishes and client may request
 
 #include <string>
 #include <cstdint>
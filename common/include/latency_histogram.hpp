@@ -0,0 +1,79 @@
+#ifndef LATENCY_HISTOGRAM_HPP
+#define LATENCY_HISTOGRAM_HPP
+
+#include <atomic>
+#include <memory>
+#include <ostream>
+#include <cstdint>
+
+//*INFO: 1 hour in nanoseconds, larger values are recorded as this one
+#define DEFAULT_HISTOGRAM_HIGHEST_VALUE 3600000000000LL
+#define DEFAULT_HISTOGRAM_SIGNIFICANT_DIGITS 3
+
+//*INFO: HDR histogram: values from 1 to highest_value are counted in log-linear buckets, so any recorded value
+//*INFO: is reported with relative error below 10^-significant_digits. Memory is fixed, record is O(1) without allocations.
+//*INFO: One writer thread records, any thread may read or merge it concurrently and gets slightly stale counts
+class LatencyHistogram {
+public:
+    LatencyHistogram(int64_t highest_value = DEFAULT_HISTOGRAM_HIGHEST_VALUE,
+                     int significant_digits = DEFAULT_HISTOGRAM_SIGNIFICANT_DIGITS);
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    //*INFO: Avalible only on writer thread
+    void record(int64_t value);
+    //*INFO: Adds counts of other histogram, this one is written as in record. Both must have same settings
+    void merge(const LatencyHistogram& other);
+    void reset();
+
+    int64_t get_total_count() const;
+    int64_t get_min() const;
+    int64_t get_max() const;
+    double get_mean() const;
+    //*INFO: Highest value that is equivalent to the value at percentile (0..100)
+    int64_t get_value_at_percentile(double percentile) const;
+    //*INFO: Calls on_bucket(highest_equivalent_value, count) for every non-empty bucket in ascending order
+    template<typename F>
+    void for_each_bucket(F on_bucket) const {
+        for (size_t index = 0; index < counts_length_; ++index) {
+            int64_t count = counts_[index].load(std::memory_order_relaxed);
+            if (count > 0) {
+                on_bucket(get_highest_equivalent_value(get_value_from_index(index)), count);
+            }
+        }
+    }
+
+    //*INFO: Same layout as HdrHistogram percentile output, values are divided by value_scale (1000 - ns to us)
+    void print_percentile_distribution(std::ostream& out, double value_scale = 1.0, int ticks_per_half_distance = 5) const;
+
+private:
+    size_t get_counts_index(int64_t value) const;
+    int64_t get_value_from_index(size_t index) const;
+    int64_t get_highest_equivalent_value(int64_t value) const;
+    //*INFO: Returns index of bucket where cumulative count reaches percentile, cumulative_count is count up to it
+    size_t find_percentile_index(double percentile, int64_t& cumulative_count) const;
+
+    static void add_relaxed(std::atomic<int64_t>& counter, int64_t value) {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+private:
+    int64_t highest_value_;
+    int significant_digits_;
+    int sub_bucket_half_count_magnitude_;
+    int64_t sub_bucket_count_;
+    int64_t sub_bucket_half_count_;
+    int64_t sub_bucket_mask_;
+    int buckets_count_;
+    size_t counts_length_;
+    std::unique_ptr<std::atomic<int64_t>[]> counts_;
+
+    std::atomic<int64_t> total_count_;
+    std::atomic<int64_t> min_;
+    std::atomic<int64_t> max_;
+    //*INFO: Sum of recorded values for mean, int64 holds ~290 years of summed nanoseconds
+    std::atomic<int64_t> sum_;
+};
+
+#endif // LATENCY_HISTOGRAM_HPP
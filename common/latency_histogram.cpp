@@ -0,0 +1,190 @@
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+LatencyHistogram::LatencyHistogram(int64_t highest_value, int significant_digits) : highest_value_(std::max<int64_t>(highest_value, 2)),
+                                                                                    significant_digits_(std::clamp(significant_digits, 1, 5)),
+                                                                                    total_count_(0),
+                                                                                    min_(std::numeric_limits<int64_t>::max()),
+                                                                                    max_(0),
+                                                                                    sum_(0) {
+    //*INFO: Values below 2 * 10^digits are counted exactly, every next bucket doubles the unit of previous one
+    int64_t largest_value_with_single_unit_resolution = 2;
+    for (int digit_num = 0; digit_num < significant_digits_; ++digit_num) {
+        largest_value_with_single_unit_resolution *= 10;
+    }
+
+    int sub_bucket_count_magnitude = static_cast<int>(std::ceil(std::log2(static_cast<double>(largest_value_with_single_unit_resolution))));
+    sub_bucket_half_count_magnitude_ = sub_bucket_count_magnitude - 1;
+    sub_bucket_count_ = int64_t(1) << sub_bucket_count_magnitude;
+    sub_bucket_half_count_ = sub_bucket_count_ / 2;
+    sub_bucket_mask_ = sub_bucket_count_ - 1;
+
+    int64_t smallest_untrackable_value = sub_bucket_count_;
+    buckets_count_ = 1;
+    while (smallest_untrackable_value <= highest_value_) {
+        if (smallest_untrackable_value > std::numeric_limits<int64_t>::max() / 2) {
+            ++buckets_count_;
+            break;
+        }
+        smallest_untrackable_value <<= 1;
+        ++buckets_count_;
+    }
+
+    counts_length_ = static_cast<size_t>(buckets_count_ + 1) * static_cast<size_t>(sub_bucket_half_count_);
+    counts_.reset(new std::atomic<int64_t>[counts_length_]());
+}
+
+void LatencyHistogram::record(int64_t value) {
+    value = std::clamp<int64_t>(value, 0, highest_value_);
+
+    add_relaxed(counts_[get_counts_index(value)], 1);
+    add_relaxed(total_count_, 1);
+    add_relaxed(sum_, value);
+    if (value < min_.load(std::memory_order_relaxed)) {
+        min_.store(value, std::memory_order_relaxed);
+    }
+    if (value > max_.load(std::memory_order_relaxed)) {
+        max_.store(value, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    size_t counts_length = std::min(counts_length_, other.counts_length_);
+    for (size_t index = 0; index < counts_length; ++index) {
+        int64_t count = other.counts_[index].load(std::memory_order_relaxed);
+        if (count > 0) {
+            add_relaxed(counts_[index], count);
+        }
+    }
+
+    add_relaxed(total_count_, other.total_count_.load(std::memory_order_relaxed));
+    add_relaxed(sum_, other.sum_.load(std::memory_order_relaxed));
+    min_.store(std::min(min_.load(std::memory_order_relaxed), other.min_.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+    max_.store(std::max(max_.load(std::memory_order_relaxed), other.max_.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+}
+
+void LatencyHistogram::reset() {
+    for (size_t index = 0; index < counts_length_; ++index) {
+        counts_[index].store(0, std::memory_order_relaxed);
+    }
+    total_count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    min_.store(std::numeric_limits<int64_t>::max(), std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+int64_t LatencyHistogram::get_total_count() const {
+    return total_count_.load(std::memory_order_relaxed);
+}
+
+int64_t LatencyHistogram::get_min() const {
+    return (get_total_count() > 0) ? min_.load(std::memory_order_relaxed) : 0;
+}
+
+int64_t LatencyHistogram::get_max() const {
+    return max_.load(std::memory_order_relaxed);
+}
+
+double LatencyHistogram::get_mean() const {
+    int64_t total_count = get_total_count();
+    return (total_count > 0) ? static_cast<double>(sum_.load(std::memory_order_relaxed)) / total_count : 0.0;
+}
+
+int64_t LatencyHistogram::get_value_at_percentile(double percentile) const {
+    if (get_total_count() == 0) {
+        return 0;
+    }
+
+    int64_t cumulative_count = 0;
+    size_t index = find_percentile_index(percentile, cumulative_count);
+    return std::min(get_highest_equivalent_value(get_value_from_index(index)), get_max());
+}
+
+size_t LatencyHistogram::find_percentile_index(double percentile, int64_t& cumulative_count) const {
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    int64_t count_at_percentile = std::max<int64_t>(1, std::llround(percentile / 100.0 * get_total_count()));
+
+    cumulative_count = 0;
+    for (size_t index = 0; index < counts_length_; ++index) {
+        cumulative_count += counts_[index].load(std::memory_order_relaxed);
+        if (cumulative_count >= count_at_percentile) {
+            return index;
+        }
+    }
+    return counts_length_ - 1;
+}
+
+//*INFO: Bucket is the power of two range of value, sub bucket is position inside it
+size_t LatencyHistogram::get_counts_index(int64_t value) const {
+    int pow2_ceiling = 64 - __builtin_clzll(static_cast<uint64_t>(value | sub_bucket_mask_));
+    int bucket_index = pow2_ceiling - (sub_bucket_half_count_magnitude_ + 1);
+    int64_t sub_bucket_index = value >> bucket_index;
+
+    return (static_cast<size_t>(bucket_index + 1) << sub_bucket_half_count_magnitude_) +
+           static_cast<size_t>(sub_bucket_index - sub_bucket_half_count_);
+}
+
+int64_t LatencyHistogram::get_value_from_index(size_t index) const {
+    int bucket_index = static_cast<int>(index >> sub_bucket_half_count_magnitude_) - 1;
+    int64_t sub_bucket_index = static_cast<int64_t>(index & (sub_bucket_half_count_ - 1)) + sub_bucket_half_count_;
+    if (bucket_index < 0) {
+        sub_bucket_index -= sub_bucket_half_count_;
+        bucket_index = 0;
+    }
+    return sub_bucket_index << bucket_index;
+}
+
+int64_t LatencyHistogram::get_highest_equivalent_value(int64_t value) const {
+    int pow2_ceiling = 64 - __builtin_clzll(static_cast<uint64_t>(value | sub_bucket_mask_));
+    int bucket_index = pow2_ceiling - (sub_bucket_half_count_magnitude_ + 1);
+    int64_t lowest_equivalent_value = (value >> bucket_index) << bucket_index;
+
+    return lowest_equivalent_value + (int64_t(1) << bucket_index) - 1;
+}
+
+//*INFO: Percentiles are stepped ticks_per_half_distance times per halving of distance to 100%, so tail gets more lines
+void LatencyHistogram::print_percentile_distribution(std::ostream& out, double value_scale, int ticks_per_half_distance) const {
+    char line[128];
+    int64_t total_count = get_total_count();
+
+    out << "       Value     Percentile TotalCount 1/(1-Percentile)\n\n";
+
+    double percentile = 0.0;
+    while (total_count > 0) {
+        int64_t cumulative_count = 0;
+        size_t index = find_percentile_index(percentile, cumulative_count);
+        if (cumulative_count >= total_count) {
+            break;
+        }
+
+        int64_t value = std::min(get_highest_equivalent_value(get_value_from_index(index)), get_max());
+        std::snprintf(line, sizeof(line), "%12.3f %14.12f %10lld %14.2f\n", value / value_scale, percentile / 100.0,
+                      static_cast<long long>(cumulative_count), 1.0 / (1.0 - percentile / 100.0));
+        out << line;
+
+        double half_distance = std::pow(2.0, std::floor(std::log2(100.0 / (100.0 - percentile))) + 1.0);
+        percentile += 100.0 / (ticks_per_half_distance * half_distance);
+    }
+    std::snprintf(line, sizeof(line), "%12.3f %14.12f %10lld\n", get_max() / value_scale, 1.0, static_cast<long long>(total_count));
+    out << line;
+
+    double mean = get_mean();
+    double squared_deviations_sum = 0.0;
+    for_each_bucket([&](int64_t value, int64_t count) {
+        double deviation = static_cast<double>(value) - mean;
+        squared_deviations_sum += deviation * deviation * count;
+    });
+    double standard_deviation = (total_count > 0) ? std::sqrt(squared_deviations_sum / total_count) : 0.0;
+
+    std::snprintf(line, sizeof(line), "#[Mean    = %12.3f, StdDeviation   = %12.3f]\n", mean / value_scale, standard_deviation / value_scale);
+    out << line;
+    std::snprintf(line, sizeof(line), "#[Max     = %12.3f, Total count    = %12lld]\n", get_max() / value_scale,
+                  static_cast<long long>(total_count));
+    out << line;
+    std::snprintf(line, sizeof(line), "#[Buckets = %12d, SubBuckets     = %12lld]\n", buckets_count_, static_cast<long long>(sub_bucket_count_));
+    out << line;
+}
@@ -8,6 +8,7 @@ Config read_config(const std::string& filename) {
 
     config.host = pt.get<std::string>("server.host");
     config.port = pt.get<short>("server.port");
+    config.acceptors = pt.get<uint32_t>("server.acceptors", 1);
     config.log_level = pt.get<std::string>("server.log_level");
 
     config.dbname = pt.get<std::string>("database.dbname");
@@ -18,5 +19,23 @@ Config read_config(const std::string& filename) {
 
     config.jwt_secret_key = pt.get<std::string>("jwt.secret_key");
 
+    config.max_sessions = pt.get<uint32_t>("admission.max_sessions", 0);
+    config.max_accept_rate = pt.get<uint32_t>("admission.max_accept_rate", 0);
+    config.max_sessions_per_ip = pt.get<uint32_t>("admission.max_sessions_per_ip", 0);
+
+    config.risk_balance_check = pt.get<bool>("risk.balance_check", false);
+    config.risk_usd_credit_limit = pt.get<double>("risk.usd_credit_limit", 0.0);
+    config.risk_rub_credit_limit = pt.get<double>("risk.rub_credit_limit", 0.0);
+    config.risk_max_order_usd_amount = pt.get<int32_t>("risk.max_order_usd_amount", 0);
+    config.risk_price_band_percent = pt.get<double>("risk.price_band_percent", 0.0);
+    config.risk_max_open_orders_per_client = pt.get<uint32_t>("risk.max_open_orders_per_client", 0);
+
+    config.matching_self_trade_prevention = pt.get<std::string>("matching.self_trade_prevention", "none");
+    config.matching_auction_interval_ms = pt.get<uint32_t>("matching.auction_interval_ms", 0);
+    config.matching_opening_auction_ms = pt.get<uint32_t>("matching.opening_auction_ms", 0);
+
+    config.metrics_host = pt.get<std::string>("metrics.host", "127.0.0.1");
+    config.metrics_port = pt.get<short>("metrics.port", 0);
+
     return config;
 }
@@ -2,12 +2,14 @@
 #define CONFIG_HPP
 
 #include <string>
+#include <cstdint>
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/ini_parser.hpp>
 
 struct Config {
     std::string host;
     short port;
+    uint32_t acceptors;     //*INFO: > 1 opens acceptors with SO_REUSEPORT, each on own thread
 
     std::string log_level;
 
@@ -18,6 +20,25 @@ struct Config {
     short dbport;
 
     std::string jwt_secret_key;
+
+    //*INFO: 0 means unlimited
+    uint32_t max_sessions;
+    uint32_t max_accept_rate;
+    uint32_t max_sessions_per_ip;
+
+    bool risk_balance_check;             //*INFO: false - balances may go negative without limit
+    double risk_usd_credit_limit;
+    double risk_rub_credit_limit;
+    int32_t risk_max_order_usd_amount;
+    double risk_price_band_percent;
+    uint32_t risk_max_open_orders_per_client;
+
+    std::string matching_self_trade_prevention;  //*INFO: none, cancel_newest, cancel_oldest, decrement_both
+    uint32_t matching_auction_interval_ms;       //*INFO: 0 - continuous matching, otherwise periodic call auction
+    uint32_t matching_opening_auction_ms;        //*INFO: 0 - no opening auction after start
+
+    std::string metrics_host;
+    short metrics_port;     //*INFO: 0 - metrics listener is not opened
 };
 
 Config read_config(const std::string& filename);
@@ -0,0 +1,103 @@
+#include "load_generator.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+LoadGenerator::LoadGenerator(const LoadOptions& options) : options_(options),
+                                                           pending_sign_ins_count_(options.connections_count),
+                                                           signed_in_count_(0) {
+    options_.threads_count = std::max<uint32_t>(options_.threads_count, 1);
+    for (uint32_t thread_num = 0; thread_num < options_.threads_count; ++thread_num) {
+        io_contexts_.push_back(std::make_unique<boost::asio::io_context>());
+        workers_stats_.push_back(std::make_unique<LoadStats>());
+    }
+}
+
+void LoadGenerator::run() {
+    boost::asio::ip::tcp::resolver resolver(*io_contexts_.front());
+    auto endpoints = resolver.resolve(options_.host, options_.port);
+
+    for (uint32_t session_num = 0; session_num < options_.connections_count; ++session_num) {
+        uint32_t thread_num = session_num % options_.threads_count;
+        auto session = std::make_shared<LoadSession>(*io_contexts_[thread_num], options_, session_num, *workers_stats_[thread_num],
+                                                     [this](bool is_signed_in) { on_session_signed_in(is_signed_in); });
+        session->connect(endpoints);
+        sessions_.push_back(session);
+    }
+
+    std::vector<std::thread> workers_threads;
+    for (auto& io_context : io_contexts_) {
+        workers_threads.emplace_back([&io_context]() {
+            io_context->run();
+        });
+    }
+    for (auto& worker_thread : workers_threads) {
+        worker_thread.join();
+    }
+
+    for (const auto& worker_stats : workers_stats_) {
+        total_stats_.merge(*worker_stats);
+    }
+}
+
+//*INFO: Called once by every session on its worker thread, the last one starts the run
+void LoadGenerator::on_session_signed_in(bool is_signed_in) {
+    if (is_signed_in) {
+        signed_in_count_.fetch_add(1);
+    }
+    if (pending_sign_ins_count_.fetch_sub(1) == 1) {
+        start_sessions();
+    }
+}
+
+void LoadGenerator::start_sessions() {
+    start_time_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(LOAD_START_DELAY_MS);
+    end_time_ = start_time_ + std::chrono::seconds(options_.duration_s);
+
+    std::cout << "Signed in " << signed_in_count_.load() << " of " << options_.connections_count
+              << " connections, running for " << options_.duration_s << " s" << std::endl;
+    for (auto& session : sessions_) {
+        session->start(start_time_, end_time_);
+    }
+}
+
+void LoadGenerator::print_report(std::ostream& out) const {
+    static const char* request_kinds_names[LOAD_REQUEST_KINDS_COUNT] = {"NEW_ORDER", "CANCEL", "QUERY"};
+
+    LatencyHistogram all_latencies;
+    int64_t responses_count = 0;
+    for (int kind = 0; kind < LOAD_REQUEST_KINDS_COUNT; ++kind) {
+        all_latencies.merge(total_stats_.latencies[kind]);
+        responses_count += total_stats_.responses_count[kind];
+    }
+
+    out << "Connections: " << signed_in_count_.load() << " of " << options_.connections_count << " signed in, "
+        << total_stats_.disconnected_sessions_count << " disconnected during run\n";
+    out << std::fixed << std::setprecision(0)
+        << "Target rate: " << options_.requests_per_second << " requests/s, achieved: "
+        << responses_count / static_cast<double>(std::max<uint32_t>(options_.duration_s, 1)) << " responses/s\n";
+    out << "Responses: " << responses_count << ", failed: " << total_stats_.failed_responses_count
+        << ", unanswered: " << total_stats_.unanswered_requests_count
+        << ", execution reports: " << total_stats_.execution_reports_count << "\n";
+
+    out << "Latency from intended send time, us:\n";
+    out << std::setw(12) << "request" << std::setw(10) << "count"
+        << std::setw(12) << "p50" << std::setw(12) << "p90" << std::setw(12) << "p99"
+        << std::setw(12) << "p99.9" << std::setw(12) << "max" << "\n";
+
+    auto print_latency_row = [&out](const char* name, const LatencyHistogram& latencies) {
+        out << std::setw(12) << name << std::setw(10) << latencies.get_total_count() << std::setprecision(1);
+        for (double percentile : {50.0, 90.0, 99.0, 99.9}) {
+            out << std::setw(12) << latencies.get_value_at_percentile(percentile) / 1000.0;
+        }
+        out << std::setw(12) << latencies.get_max() / 1000.0 << "\n";
+    };
+    for (int kind = 0; kind < LOAD_REQUEST_KINDS_COUNT; ++kind) {
+        print_latency_row(request_kinds_names[kind], total_stats_.latencies[kind]);
+    }
+    print_latency_row("ALL", all_latencies);
+
+    out << "\nPercentile distribution of all requests, us:\n";
+    all_latencies.print_percentile_distribution(out, 1000.0);
+}
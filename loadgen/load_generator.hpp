@@ -0,0 +1,46 @@
+#ifndef LOAD_GENERATOR_HPP
+#define LOAD_GENERATOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include "load_session.hpp"
+
+//*INFO: Delay between last sign-in and first scheduled request, start is posted to all sessions in it
+#define LOAD_START_DELAY_MS 100
+
+//*INFO: Connections are spread round-robin over worker threads, each runs own io_context and keeps own stats.
+//*INFO: Run starts for all sessions at once after every connection has signed in or failed, stats are merged after join
+class LoadGenerator {
+public:
+    LoadGenerator(const LoadOptions& options);
+
+    //*INFO: Blocks until all sessions are finished
+    void run();
+    void print_report(std::ostream& out) const;
+
+private:
+    void on_session_signed_in(bool is_signed_in);
+    void start_sessions();
+
+private:
+    LoadOptions options_;
+    std::vector<std::unique_ptr<boost::asio::io_context>> io_contexts_;
+    std::vector<std::unique_ptr<LoadStats>> workers_stats_;
+    std::vector<std::shared_ptr<LoadSession>> sessions_;
+
+    std::atomic<uint32_t> pending_sign_ins_count_;
+    std::atomic<uint32_t> signed_in_count_;
+    std::chrono::steady_clock::time_point start_time_;
+    std::chrono::steady_clock::time_point end_time_;
+
+    LoadStats total_stats_;
+};
+
+#endif // LOAD_GENERATOR_HPP
@@ -0,0 +1,393 @@
+#include "load_session.hpp"
+
+#include <arpa/inet.h>
+
+void LoadStats::merge(const LoadStats& other) {
+    for (int kind = 0; kind < LOAD_REQUEST_KINDS_COUNT; ++kind) {
+        latencies[kind].merge(other.latencies[kind]);
+        responses_count[kind] += other.responses_count[kind];
+    }
+    failed_responses_count += other.failed_responses_count;
+    unanswered_requests_count += other.unanswered_requests_count;
+    execution_reports_count += other.execution_reports_count;
+    disconnected_sessions_count += other.disconnected_sessions_count;
+}
+
+LoadSession::LoadSession(boost::asio::io_context& io_context, const LoadOptions& options, uint32_t session_num,
+                         LoadStats& stats, std::function<void(bool)> on_signed_in)
+    : socket_(io_context),
+      request_timer_(io_context),
+      drain_timer_(io_context),
+      options_(options),
+      stats_(stats),
+      on_signed_in_(std::move(on_signed_in)),
+      state_(SESSION_CONNECTING),
+      username_(options.username_prefix + std::to_string(session_num)),
+      random_engine_(options.seed + session_num),
+      is_waiting_response_(false),
+      request_kind_(LOAD_NEW_ORDER),
+      query_num_(0) {
+
+    //*INFO: Every session sends connections / rate requests per second, phases spread them evenly inside interval
+    request_interval_ = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(options.connections_count / options.requests_per_second));
+    phase_ = request_interval_ * session_num / options.connections_count;
+}
+
+//                                                                                //
+//                            Connect and sign in functions                       //
+//                                                                                //
+
+void LoadSession::connect(const boost::asio::ip::tcp::resolver::results_type& endpoints) {
+    auto self_ptr(shared_from_this());
+
+    boost::asio::async_connect(socket_, endpoints,
+        [this, self_ptr](boost::system::error_code error_code, const boost::asio::ip::tcp::endpoint& endpoint) {
+            if (error_code) {
+                handle_socket_error(error_code);
+                return;
+            }
+            socket_.set_option(boost::asio::ip::tcp::no_delay(true));
+
+            async_read_response();
+            send_sign_up();
+        });
+}
+
+void LoadSession::send_sign_up() {
+    state_ = SESSION_SIGNING_UP;
+
+    Serialize::TradeRequest request;
+    request.set_command(Serialize::TradeRequest::SIGN_UP);
+    request.mutable_sign_up_request()->set_username(username_);
+    request.mutable_sign_up_request()->set_password(options_.password);
+    write_request(request);
+}
+
+//*INFO: Orders of synthetic user are cancelled when loadgen disconnects, book does not grow from run to run
+void LoadSession::send_sign_in() {
+    state_ = SESSION_SIGNING_IN;
+
+    Serialize::TradeRequest request;
+    request.set_command(Serialize::TradeRequest::SIGN_IN);
+    request.mutable_sign_in_request()->set_username(username_);
+    request.mutable_sign_in_request()->set_password(options_.password);
+    request.mutable_sign_in_request()->set_cancel_on_disconnect(true);
+    write_request(request);
+}
+
+void LoadSession::handle_sign_in_response(const Serialize::TradeResponse& response) {
+    if (response.response_msg() != Serialize::TradeResponse::SIGN_IN_SUCCESSFUL) {
+        finish();
+        on_signed_in_(false);
+        return;
+    }
+
+    jwt_ = response.jwt();
+    state_ = SESSION_READY;
+    on_signed_in_(true);
+}
+
+//                                                                                //
+//                             Socket read-write functions                        //
+//                                                                                //
+
+void LoadSession::async_read_response() {
+    auto self_ptr(shared_from_this());
+
+    boost::asio::async_read(socket_, boost::asio::buffer(data_length_, sizeof(uint32_t)),
+        [this, self_ptr](boost::system::error_code error_code, std::size_t length) {
+            if (error_code) {
+                handle_socket_error(error_code);
+                return;
+            }
+
+            uint32_t msg_length = ntohl(*reinterpret_cast<uint32_t*>(data_length_));
+            response_data_.resize(msg_length);
+
+            boost::asio::async_read(socket_, boost::asio::buffer(response_data_),
+                [this, self_ptr](boost::system::error_code error_code, std::size_t length) {
+                    if (error_code) {
+                        handle_socket_error(error_code);
+                        return;
+                    }
+
+                    Serialize::TradeResponse response;
+                    response.ParseFromArray(response_data_.data(), static_cast<int>(length));
+                    handle_response(response);
+
+                    if (state_ != SESSION_FINISHED) {
+                        async_read_response();
+                    }
+                });
+        });
+}
+
+//*INFO: Only one request is in flight, so previous write is always completed
+void LoadSession::write_request(Serialize::TradeRequest& request) {
+    auto self_ptr(shared_from_this());
+
+    std::string serialized_request;
+    request.SerializeToString(&serialized_request);
+
+    uint32_t msg_length = htonl(static_cast<uint32_t>(serialized_request.size()));
+    outgoing_message_.assign(reinterpret_cast<const char*>(&msg_length), sizeof(uint32_t));
+    outgoing_message_ += serialized_request;
+
+    boost::asio::async_write(socket_, boost::asio::buffer(outgoing_message_),
+        [this, self_ptr](boost::system::error_code error_code, std::size_t length) {
+            if (error_code) {
+                handle_socket_error(error_code);
+            }
+        });
+}
+
+void LoadSession::handle_socket_error(const boost::system::error_code& error_code) {
+    if (state_ == SESSION_FINISHED) {
+        return;
+    }
+
+    bool is_signed_in = (state_ == SESSION_READY || state_ == SESSION_RUNNING);
+    if (is_signed_in) {
+        ++stats_.disconnected_sessions_count;
+    }
+    if (is_waiting_response_) {
+        ++stats_.unanswered_requests_count;
+    }
+
+    finish();
+    if (!is_signed_in) {
+        on_signed_in_(false);
+    }
+}
+
+void LoadSession::finish() {
+    state_ = SESSION_FINISHED;
+    is_waiting_response_ = false;
+    request_timer_.cancel();
+    drain_timer_.cancel();
+
+    boost::system::error_code error_code;
+    socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both, error_code);
+    socket_.close(error_code);
+}
+
+//                                                                                //
+//                                Request functions                               //
+//                                                                                //
+
+void LoadSession::start(Clock::time_point start_time, Clock::time_point end_time) {
+    auto self_ptr(shared_from_this());
+
+    boost::asio::post(socket_.get_executor(), [this, self_ptr, start_time, end_time]() {
+        begin_run(start_time, end_time);
+    });
+}
+
+void LoadSession::begin_run(Clock::time_point start_time, Clock::time_point end_time) {
+    if (state_ != SESSION_READY) {
+        return;
+    }
+    state_ = SESSION_RUNNING;
+    end_time_ = end_time;
+    next_intended_time_ = start_time + phase_;
+
+    //*INFO: Response that has not come in drain time is counted with latency it has reached
+    auto self_ptr(shared_from_this());
+    drain_timer_.expires_at(end_time + std::chrono::milliseconds(LOAD_DRAIN_TIMEOUT_MS));
+    drain_timer_.async_wait([this, self_ptr](boost::system::error_code error_code) {
+        if (error_code || state_ == SESSION_FINISHED) {
+            return;
+        }
+        if (is_waiting_response_) {
+            stats_.latencies[request_kind_].record(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - request_intended_time_).count());
+            ++stats_.unanswered_requests_count;
+        }
+        finish();
+    });
+
+    wait_for_next_request_time();
+}
+
+//*INFO: Request that is already late is sent at once and keeps its intended time
+void LoadSession::wait_for_next_request_time() {
+    if (next_intended_time_ >= end_time_) {
+        finish();
+        return;
+    }
+
+    if (Clock::now() >= next_intended_time_) {
+        send_next_request();
+        return;
+    }
+
+    auto self_ptr(shared_from_this());
+    request_timer_.expires_at(next_intended_time_);
+    request_timer_.async_wait([this, self_ptr](boost::system::error_code error_code) {
+        if (error_code || state_ != SESSION_RUNNING) {
+            return;
+        }
+        send_next_request();
+    });
+}
+
+void LoadSession::send_next_request() {
+    Serialize::TradeRequest request;
+    request.set_username(username_);
+    request.set_jwt(jwt_);
+
+    request_kind_ = choose_request_kind();
+    switch (request_kind_) {
+        case LOAD_NEW_ORDER: {
+            form_new_order_request(request);
+            break;
+        }
+        case LOAD_CANCEL_ORDER: {
+            //*INFO: Without known own orders cancel turns into active orders query, it refreshes them
+            if (!form_cancel_order_request(request)) {
+                request_kind_ = LOAD_QUERY;
+                request.set_command(Serialize::TradeRequest::VIEW_MY_ACTIVE_ORDERS);
+            }
+            break;
+        }
+        default: {
+            form_query_request(request);
+            break;
+        }
+    }
+
+    request_intended_time_ = next_intended_time_;
+    is_waiting_response_ = true;
+    write_request(request);
+}
+
+load_request_kind_t LoadSession::choose_request_kind() {
+    uint32_t percents_sum = 0;
+    for (uint32_t mix_percent : options_.mix_percents) {
+        percents_sum += mix_percent;
+    }
+
+    std::uniform_int_distribution<uint32_t> percent_distribution(0, percents_sum - 1);
+    uint32_t percent = percent_distribution(random_engine_);
+    for (int kind = 0; kind < LOAD_REQUEST_KINDS_COUNT; ++kind) {
+        if (percent < options_.mix_percents[kind]) {
+            return static_cast<load_request_kind_t>(kind);
+        }
+        percent -= options_.mix_percents[kind];
+    }
+    return LOAD_QUERY;
+}
+
+void LoadSession::form_new_order_request(Serialize::TradeRequest& request) {
+    std::uniform_int_distribution<int> side_distribution(0, 1);
+    std::uniform_int_distribution<int> ticks_distribution(-LOAD_PRICE_SPREAD_TICKS, LOAD_PRICE_SPREAD_TICKS);
+    std::uniform_int_distribution<int> amount_distribution(1, LOAD_MAX_ORDER_AMOUNT);
+
+    request.set_command(Serialize::TradeRequest::MAKE_ORDER);
+    Serialize::TradeOrder* order = request.mutable_order();
+    order->set_username(username_);
+    order->set_type(side_distribution(random_engine_) == 0 ? Serialize::TradeOrder::BUY : Serialize::TradeOrder::SELL);
+    order->set_usd_cost(options_.mid_price + ticks_distribution(random_engine_) * LOAD_PRICE_TICK);
+    order->set_usd_amount(amount_distribution(random_engine_));
+    order->set_usd_volume(order->usd_amount());
+    order->set_order_type(Serialize::TradeOrder::LIMIT);
+    order->set_time_in_force(Serialize::TradeOrder::GTC);
+}
+
+bool LoadSession::form_cancel_order_request(Serialize::TradeRequest& request) {
+    if (known_order_ids_.empty()) {
+        return false;
+    }
+
+    std::uniform_int_distribution<size_t> order_distribution(0, known_order_ids_.size() - 1);
+    size_t order_num = order_distribution(random_engine_);
+    auto [order_id, type] = known_order_ids_[order_num];
+    known_order_ids_[order_num] = known_order_ids_.back();
+    known_order_ids_.pop_back();
+
+    request.set_command(Serialize::TradeRequest::CANCEL_ACTIVE_ORDER);
+    request.mutable_cancel_order()->set_order_id(order_id);
+    request.mutable_cancel_order()->set_type(type);
+    return true;
+}
+
+void LoadSession::form_query_request(Serialize::TradeRequest& request) {
+    switch (query_num_++ % 3) {
+        case 0: {
+            request.set_command(Serialize::TradeRequest::VIEW_BALANCE);
+            break;
+        }
+        case 1: {
+            request.set_command(Serialize::TradeRequest::VIEW_DEPTH);
+            request.mutable_depth_request()->set_levels(LOAD_DEPTH_LEVELS);
+            break;
+        }
+        default: {
+            request.set_command(Serialize::TradeRequest::VIEW_MY_ACTIVE_ORDERS);
+            break;
+        }
+    }
+}
+
+//                                                                                //
+//                               Response functions                               //
+//                                                                                //
+
+void LoadSession::handle_response(const Serialize::TradeResponse& response) {
+    if (response.response_msg() == Serialize::TradeResponse::ORDER_MATCHED) {
+        ++stats_.execution_reports_count;
+        return;
+    }
+
+    switch (state_) {
+        case SESSION_SIGNING_UP: {
+            if (response.response_msg() != Serialize::TradeResponse::SIGN_UP_SUCCESSFUL &&
+                response.response_msg() != Serialize::TradeResponse::USERNAME_ALREADY_TAKEN) {
+                finish();
+                on_signed_in_(false);
+                return;
+            }
+            send_sign_in();
+            break;
+        }
+        case SESSION_SIGNING_IN: {
+            handle_sign_in_response(response);
+            break;
+        }
+        case SESSION_RUNNING: {
+            if (is_waiting_response_) {
+                handle_request_response(response);
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
+void LoadSession::handle_request_response(const Serialize::TradeResponse& response) {
+    stats_.latencies[request_kind_].record(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - request_intended_time_).count());
+    ++stats_.responses_count[request_kind_];
+    is_waiting_response_ = false;
+
+    if (response.response_msg() == Serialize::TradeResponse::ERROR ||
+        response.response_msg() == Serialize::TradeResponse::ORDER_REJECTED_BY_RISK) {
+        ++stats_.failed_responses_count;
+    }
+
+    if (response.response_msg() == Serialize::TradeResponse::SUCCESS_VIEW_MY_ACTIVE_ORDERS) {
+        known_order_ids_.clear();
+        for (const auto& order : response.active_orders().active_buy_orders()) {
+            known_order_ids_.emplace_back(order.order_id(), Serialize::CancelTradeOrder::BUY);
+        }
+        for (const auto& order : response.active_orders().active_sell_orders()) {
+            known_order_ids_.emplace_back(order.order_id(), Serialize::CancelTradeOrder::SELL);
+        }
+    }
+
+    next_intended_time_ += request_interval_;
+    wait_for_next_request_time();
+}
@@ -0,0 +1,134 @@
+#ifndef LOAD_SESSION_HPP
+#define LOAD_SESSION_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include "latency_histogram.hpp"
+#include "trade_market_protocol.pb.h"
+
+//*INFO: Latency of late response is counted until LOAD_DRAIN_TIMEOUT_MS after end of run, then session is closed
+#define LOAD_DRAIN_TIMEOUT_MS 5000
+#define LOAD_PRICE_TICK 0.01
+//*INFO: Orders are spread around mid price by this many ticks to each side, so about half of them cross
+#define LOAD_PRICE_SPREAD_TICKS 20
+#define LOAD_MAX_ORDER_AMOUNT 10
+#define LOAD_DEPTH_LEVELS 10
+
+enum load_request_kind_t {
+    LOAD_NEW_ORDER,
+    LOAD_CANCEL_ORDER,
+    LOAD_QUERY,             //*INFO: Balance, depth and own active orders in turn
+    LOAD_REQUEST_KINDS_COUNT
+};
+
+struct LoadOptions {
+    std::string host;
+    std::string port;
+    uint32_t connections_count = 100;
+    uint32_t threads_count = 4;
+    double requests_per_second = 1000.0;    //*INFO: Target rate of all connections together
+    uint32_t duration_s = 10;
+    uint32_t mix_percents[LOAD_REQUEST_KINDS_COUNT] = {60, 20, 20};
+    std::string username_prefix = "loadgen_";
+    std::string password = "loadgen";
+    double mid_price = 70.0;
+    uint32_t seed = 42;
+};
+
+//*INFO: Results of sessions of one worker thread, touched only by that thread until it is joined
+struct LoadStats {
+    LatencyHistogram latencies[LOAD_REQUEST_KINDS_COUNT];
+    int64_t responses_count[LOAD_REQUEST_KINDS_COUNT] = {};
+    int64_t failed_responses_count = 0;     //*INFO: ERROR and risk rejects
+    int64_t unanswered_requests_count = 0;
+    int64_t execution_reports_count = 0;
+    uint32_t disconnected_sessions_count = 0;
+
+    void merge(const LoadStats& other);
+};
+
+//*INFO: One synthetic user on its own connection. Requests are sent open-loop on fixed schedule: latency is measured
+//*INFO: from intended send time, so request delayed by slow previous response is counted with the time it waited
+//*INFO: (no coordinated omission). Only one request is in flight, execution reports are read between responses
+class LoadSession : public std::enable_shared_from_this<LoadSession> {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    LoadSession(boost::asio::io_context& io_context, const LoadOptions& options, uint32_t session_num,
+                LoadStats& stats, std::function<void(bool)> on_signed_in);
+
+    //*INFO: Signs up (existing user is fine) and signs in, then on_signed_in is called once
+    void connect(const boost::asio::ip::tcp::resolver::results_type& endpoints);
+    //*INFO: Thread-safe. First request is due at start_time shifted by session phase, last one before end_time
+    void start(Clock::time_point start_time, Clock::time_point end_time);
+
+private:
+    enum session_state_t {
+        SESSION_CONNECTING,
+        SESSION_SIGNING_UP,
+        SESSION_SIGNING_IN,
+        SESSION_READY,
+        SESSION_RUNNING,
+        SESSION_FINISHED
+    };
+
+    void send_sign_up();
+    void send_sign_in();
+    void async_read_response();
+    void handle_response(const Serialize::TradeResponse& response);
+    void handle_sign_in_response(const Serialize::TradeResponse& response);
+    void handle_request_response(const Serialize::TradeResponse& response);
+
+    void begin_run(Clock::time_point start_time, Clock::time_point end_time);
+    void wait_for_next_request_time();
+    void send_next_request();
+    load_request_kind_t choose_request_kind();
+    void form_new_order_request(Serialize::TradeRequest& request);
+    bool form_cancel_order_request(Serialize::TradeRequest& request);
+    void form_query_request(Serialize::TradeRequest& request);
+    void write_request(Serialize::TradeRequest& request);
+
+    void handle_socket_error(const boost::system::error_code& error_code);
+    void finish();
+
+private:
+    boost::asio::ip::tcp::socket socket_;
+    boost::asio::steady_timer request_timer_;
+    boost::asio::steady_timer drain_timer_;
+    const LoadOptions& options_;
+    LoadStats& stats_;
+    std::function<void(bool)> on_signed_in_;
+
+    session_state_t state_;
+    std::string username_;
+    std::string jwt_;
+    std::mt19937 random_engine_;
+
+    Clock::duration request_interval_;
+    Clock::duration phase_;
+    Clock::time_point next_intended_time_;
+    Clock::time_point end_time_;
+    //*INFO: Request in flight and its schedule time
+    bool is_waiting_response_;
+    load_request_kind_t request_kind_;
+    Clock::time_point request_intended_time_;
+
+    //*INFO: Own resting orders known from last active orders listing, cancels are taken from here
+    std::vector<std::pair<int64_t, Serialize::CancelTradeOrder::TradeType>> known_order_ids_;
+    uint32_t query_num_;
+
+    char data_length_[sizeof(uint32_t)];
+    std::vector<char> response_data_;
+    std::string outgoing_message_;
+};
+
+#endif // LOAD_SESSION_HPP
@@ -0,0 +1,92 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "spdlog/spdlog.h"
+
+#include "config.hpp"
+#include "load_generator.hpp"
+
+void print_usage() {
+    std::cout << "Usage:\n"
+              << "  loadgen [--connections N] [--rate requests_per_second] [--duration seconds] [--threads N]\n"
+              << "          [--mix new,cancel,query] [--user-prefix prefix] [--password password]\n"
+              << "          [--price mid_price] [--seed seed] [--host host] [--port port]\n"
+              << "Host and port default to server_config.ini, mix is in percents (default 60,20,20)" << std::endl;
+}
+
+bool parse_mix(const std::string& mix, LoadOptions& options) {
+    std::istringstream mix_stream(mix);
+    std::string mix_percent;
+    uint32_t percents_sum = 0;
+    for (int kind = 0; kind < LOAD_REQUEST_KINDS_COUNT; ++kind) {
+        if (!std::getline(mix_stream, mix_percent, ',')) {
+            return false;
+        }
+        options.mix_percents[kind] = static_cast<uint32_t>(std::stoul(mix_percent));
+        percents_sum += options.mix_percents[kind];
+    }
+    return percents_sum > 0;
+}
+
+bool parse_options(int argc, char* argv[], LoadOptions& options) {
+    for (int arg_num = 1; arg_num + 1 < argc; arg_num += 2) {
+        std::string option = argv[arg_num];
+        std::string value = argv[arg_num + 1];
+
+        if (option == "--connections") {
+            options.connections_count = static_cast<uint32_t>(std::stoul(value));
+        } else if (option == "--rate") {
+            options.requests_per_second = std::stod(value);
+        } else if (option == "--duration") {
+            options.duration_s = static_cast<uint32_t>(std::stoul(value));
+        } else if (option == "--threads") {
+            options.threads_count = static_cast<uint32_t>(std::stoul(value));
+        } else if (option == "--mix") {
+            if (!parse_mix(value, options)) {
+                return false;
+            }
+        } else if (option == "--user-prefix") {
+            options.username_prefix = value;
+        } else if (option == "--password") {
+            options.password = value;
+        } else if (option == "--price") {
+            options.mid_price = std::stod(value);
+        } else if (option == "--seed") {
+            options.seed = static_cast<uint32_t>(std::stoul(value));
+        } else if (option == "--host") {
+            options.host = value;
+        } else if (option == "--port") {
+            options.port = value;
+        } else {
+            return false;
+        }
+    }
+    return (argc % 2 == 1) && options.connections_count > 0 && options.requests_per_second > 0.0;
+}
+
+int main(int argc, char* argv[]) {
+try {
+    spdlog::set_level(spdlog::level::off);
+
+    Config config = read_config("server_config.ini");
+    LoadOptions options;
+    options.host = config.host;
+    options.port = std::to_string(config.port);
+
+    if (!parse_options(argc, argv, options)) {
+        print_usage();
+        return 1;
+    }
+
+    LoadGenerator load_generator(options);
+    load_generator.run();
+    load_generator.print_report(std::cout);
+
+    } catch (std::exception& e) {
+        std::cerr << "Exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -39,6 +39,7 @@ PROTOBUF_CONSTEXPR SignInRequest::SignInRequest(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.password_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cancel_on_disconnect_)*/false
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct SignInRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR SignInRequestDefaultTypeInternal()
@@ -58,6 +59,13 @@ PROTOBUF_CONSTEXPR TradeOrder::TradeOrder(
   , /*decltype(_impl_.timestamp_)*/int64_t{0}
   , /*decltype(_impl_.order_id_)*/int64_t{0}
   , /*decltype(_impl_.usd_volume_)*/0
+  , /*decltype(_impl_.order_type_)*/0
+  , /*decltype(_impl_.stop_price_)*/0
+  , /*decltype(_impl_.time_in_force_)*/0
+  , /*decltype(_impl_.peak_amount_)*/0
+  , /*decltype(_impl_.displayed_amount_)*/0
+  , /*decltype(_impl_.account_id_)*/0u
+  , /*decltype(_impl_.expire_time_)*/int64_t{0}
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct TradeOrderDefaultTypeInternal {
   PROTOBUF_CONSTEXPR TradeOrderDefaultTypeInternal()
@@ -82,6 +90,63 @@ struct CancelTradeOrderDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CancelTradeOrderDefaultTypeInternal _CancelTradeOrder_default_instance_;
+PROTOBUF_CONSTEXPR CancelAllOrders::CancelAllOrders(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.side_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CancelAllOrdersDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CancelAllOrdersDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CancelAllOrdersDefaultTypeInternal() {}
+  union {
+    CancelAllOrders _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CancelAllOrdersDefaultTypeInternal _CancelAllOrders_default_instance_;
+PROTOBUF_CONSTEXPR ModifyTradeOrder::ModifyTradeOrder(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.order_id_)*/int64_t{0}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.usd_amount_)*/0
+  , /*decltype(_impl_.usd_cost_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ModifyTradeOrderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ModifyTradeOrderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ModifyTradeOrderDefaultTypeInternal() {}
+  union {
+    ModifyTradeOrder _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ModifyTradeOrderDefaultTypeInternal _ModifyTradeOrder_default_instance_;
+PROTOBUF_CONSTEXPR DepthRequest::DepthRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.levels_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DepthRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DepthRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DepthRequestDefaultTypeInternal() {}
+  union {
+    DepthRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DepthRequestDefaultTypeInternal _DepthRequest_default_instance_;
+PROTOBUF_CONSTEXPR CandlesRequest::CandlesRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.from_timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.to_timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.resolution_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CandlesRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CandlesRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CandlesRequestDefaultTypeInternal() {}
+  union {
+    CandlesRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CandlesRequestDefaultTypeInternal _CandlesRequest_default_instance_;
 PROTOBUF_CONSTEXPR TradeRequest::TradeRequest(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
@@ -114,6 +179,60 @@ struct TradeResponseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TradeResponseDefaultTypeInternal _TradeResponse_default_instance_;
+PROTOBUF_CONSTEXPR ExecutionReport::ExecutionReport(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.order_id_)*/int64_t{0}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.fill_amount_)*/0
+  , /*decltype(_impl_.price_)*/0
+  , /*decltype(_impl_.usd_balance_delta_)*/0
+  , /*decltype(_impl_.rub_balance_delta_)*/0
+  , /*decltype(_impl_.remaining_amount_)*/0
+  , /*decltype(_impl_.canceled_amount_)*/0
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.trade_id_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ExecutionReportDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExecutionReportDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExecutionReportDefaultTypeInternal() {}
+  union {
+    ExecutionReport _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExecutionReportDefaultTypeInternal _ExecutionReport_default_instance_;
+PROTOBUF_CONSTEXPR Execution::Execution(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.trade_id_)*/int64_t{0}
+  , /*decltype(_impl_.price_)*/0
+  , /*decltype(_impl_.usd_amount_)*/0
+  , /*decltype(_impl_.aggressor_side_)*/0
+  , /*decltype(_impl_.maker_order_id_)*/int64_t{0}
+  , /*decltype(_impl_.taker_order_id_)*/int64_t{0}
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ExecutionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExecutionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExecutionDefaultTypeInternal() {}
+  union {
+    Execution _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExecutionDefaultTypeInternal _Execution_default_instance_;
+PROTOBUF_CONSTEXPR Trades::Trades(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.executions_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TradesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TradesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TradesDefaultTypeInternal() {}
+  union {
+    Trades _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TradesDefaultTypeInternal _Trades_default_instance_;
 PROTOBUF_CONSTEXPR ClientBalance::ClientBalance(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
@@ -132,6 +251,8 @@ PROTOBUF_CONSTEXPR AccountBalance::AccountBalance(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.usd_balance_)*/0
   , /*decltype(_impl_.rub_balance_)*/0
+  , /*decltype(_impl_.usd_reserved_)*/0
+  , /*decltype(_impl_.rub_reserved_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct AccountBalanceDefaultTypeInternal {
   PROTOBUF_CONSTEXPR AccountBalanceDefaultTypeInternal()
@@ -197,9 +318,72 @@ struct QuoteDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QuoteDefaultTypeInternal _Quote_default_instance_;
+PROTOBUF_CONSTEXPR PriceLevel::PriceLevel(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.price_)*/0
+  , /*decltype(_impl_.usd_amount_)*/int64_t{0}
+  , /*decltype(_impl_.orders_count_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PriceLevelDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PriceLevelDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PriceLevelDefaultTypeInternal() {}
+  union {
+    PriceLevel _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PriceLevelDefaultTypeInternal _PriceLevel_default_instance_;
+PROTOBUF_CONSTEXPR MarketDepth::MarketDepth(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bids_)*/{}
+  , /*decltype(_impl_.asks_)*/{}
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MarketDepthDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MarketDepthDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MarketDepthDefaultTypeInternal() {}
+  union {
+    MarketDepth _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MarketDepthDefaultTypeInternal _MarketDepth_default_instance_;
+PROTOBUF_CONSTEXPR Candle::Candle(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.open_time_)*/int64_t{0}
+  , /*decltype(_impl_.open_)*/0
+  , /*decltype(_impl_.high_)*/0
+  , /*decltype(_impl_.low_)*/0
+  , /*decltype(_impl_.close_)*/0
+  , /*decltype(_impl_.usd_volume_)*/int64_t{0}
+  , /*decltype(_impl_.trades_count_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CandleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CandleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CandleDefaultTypeInternal() {}
+  union {
+    Candle _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CandleDefaultTypeInternal _Candle_default_instance_;
+PROTOBUF_CONSTEXPR Candles::Candles(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.candles_)*/{}
+  , /*decltype(_impl_.resolution_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CandlesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CandlesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CandlesDefaultTypeInternal() {}
+  union {
+    Candles _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CandlesDefaultTypeInternal _Candles_default_instance_;
 }  // namespace Serialize
-static ::_pb::Metadata file_level_metadata_trade_5fmarket_5fprotocol_2eproto[12];
-static const ::_pb::EnumDescriptor* file_level_enum_descriptors_trade_5fmarket_5fprotocol_2eproto[4];
+static ::_pb::Metadata file_level_metadata_trade_5fmarket_5fprotocol_2eproto[23];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_trade_5fmarket_5fprotocol_2eproto[8];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_trade_5fmarket_5fprotocol_2eproto = nullptr;
 
 const uint32_t TableStruct_trade_5fmarket_5fprotocol_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -219,6 +403,7 @@ const uint32_t TableStruct_trade_5fmarket_5fprotocol_2eproto::offsets[] PROTOBUF
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::Serialize::SignInRequest, _impl_.username_),
   PROTOBUF_FIELD_OFFSET(::Serialize::SignInRequest, _impl_.password_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::SignInRequest, _impl_.cancel_on_disconnect_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Serialize::TradeOrder, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -232,6 +417,13 @@ const uint32_t TableStruct_trade_5fmarket_5fprotocol_2eproto::offsets[] PROTOBUF
   PROTOBUF_FIELD_OFFSET(::Serialize::TradeOrder, _impl_.order_id_),
   PROTOBUF_FIELD_OFFSET(::Serialize::TradeOrder, _impl_.usd_volume_),
   PROTOBUF_FIELD_OFFSET(::Serialize::TradeOrder, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::TradeOrder, _impl_.order_type_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::TradeOrder, _impl_.time_in_force_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::TradeOrder, _impl_.stop_price_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::TradeOrder, _impl_.peak_amount_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::TradeOrder, _impl_.displayed_amount_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::TradeOrder, _impl_.account_id_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::TradeOrder, _impl_.expire_time_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Serialize::CancelTradeOrder, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -241,6 +433,39 @@ const uint32_t TableStruct_trade_5fmarket_5fprotocol_2eproto::offsets[] PROTOBUF
   PROTOBUF_FIELD_OFFSET(::Serialize::CancelTradeOrder, _impl_.type_),
   PROTOBUF_FIELD_OFFSET(::Serialize::CancelTradeOrder, _impl_.order_id_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Serialize::CancelAllOrders, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Serialize::CancelAllOrders, _impl_.side_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Serialize::ModifyTradeOrder, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Serialize::ModifyTradeOrder, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::ModifyTradeOrder, _impl_.order_id_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::ModifyTradeOrder, _impl_.usd_cost_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::ModifyTradeOrder, _impl_.usd_amount_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Serialize::DepthRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Serialize::DepthRequest, _impl_.levels_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Serialize::CandlesRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Serialize::CandlesRequest, _impl_.resolution_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::CandlesRequest, _impl_.from_timestamp_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::CandlesRequest, _impl_.to_timestamp_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Serialize::TradeRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   PROTOBUF_FIELD_OFFSET(::Serialize::TradeRequest, _impl_._oneof_case_[0]),
@@ -253,6 +478,10 @@ const uint32_t TableStruct_trade_5fmarket_5fprotocol_2eproto::offsets[] PROTOBUF
   ::_pbi::kInvalidFieldOffsetTag,
   ::_pbi::kInvalidFieldOffsetTag,
   ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
   PROTOBUF_FIELD_OFFSET(::Serialize::TradeRequest, _impl_.RequestData_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Serialize::TradeResponse, _internal_metadata_),
@@ -267,8 +496,49 @@ const uint32_t TableStruct_trade_5fmarket_5fprotocol_2eproto::offsets[] PROTOBUF
   ::_pbi::kInvalidFieldOffsetTag,
   ::_pbi::kInvalidFieldOffsetTag,
   ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
   PROTOBUF_FIELD_OFFSET(::Serialize::TradeResponse, _impl_.RequestData_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Serialize::ExecutionReport, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Serialize::ExecutionReport, _impl_.order_id_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::ExecutionReport, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::ExecutionReport, _impl_.fill_amount_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::ExecutionReport, _impl_.price_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::ExecutionReport, _impl_.remaining_amount_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::ExecutionReport, _impl_.usd_balance_delta_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::ExecutionReport, _impl_.rub_balance_delta_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::ExecutionReport, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::ExecutionReport, _impl_.trade_id_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::ExecutionReport, _impl_.canceled_amount_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Serialize::Execution, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Serialize::Execution, _impl_.trade_id_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::Execution, _impl_.price_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::Execution, _impl_.usd_amount_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::Execution, _impl_.aggressor_side_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::Execution, _impl_.maker_order_id_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::Execution, _impl_.taker_order_id_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::Execution, _impl_.timestamp_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Serialize::Trades, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Serialize::Trades, _impl_.executions_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Serialize::ClientBalance, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -284,6 +554,8 @@ const uint32_t TableStruct_trade_5fmarket_5fprotocol_2eproto::offsets[] PROTOBUF
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::Serialize::AccountBalance, _impl_.usd_balance_),
   PROTOBUF_FIELD_OFFSET(::Serialize::AccountBalance, _impl_.rub_balance_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::AccountBalance, _impl_.usd_reserved_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::AccountBalance, _impl_.rub_reserved_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Serialize::ActiveOrders, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -315,20 +587,70 @@ const uint32_t TableStruct_trade_5fmarket_5fprotocol_2eproto::offsets[] PROTOBUF
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::Serialize::Quote, _impl_.timestamp_),
   PROTOBUF_FIELD_OFFSET(::Serialize::Quote, _impl_.price_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Serialize::PriceLevel, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Serialize::PriceLevel, _impl_.price_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::PriceLevel, _impl_.usd_amount_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::PriceLevel, _impl_.orders_count_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Serialize::MarketDepth, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Serialize::MarketDepth, _impl_.bids_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::MarketDepth, _impl_.asks_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::MarketDepth, _impl_.timestamp_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Serialize::Candle, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Serialize::Candle, _impl_.open_time_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::Candle, _impl_.open_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::Candle, _impl_.high_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::Candle, _impl_.low_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::Candle, _impl_.close_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::Candle, _impl_.usd_volume_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::Candle, _impl_.trades_count_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Serialize::Candles, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Serialize::Candles, _impl_.resolution_),
+  PROTOBUF_FIELD_OFFSET(::Serialize::Candles, _impl_.candles_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::Serialize::SignUpRequest)},
   { 8, -1, -1, sizeof(::Serialize::SignInRequest)},
-  { 16, -1, -1, sizeof(::Serialize::TradeOrder)},
-  { 29, -1, -1, sizeof(::Serialize::CancelTradeOrder)},
-  { 37, -1, -1, sizeof(::Serialize::TradeRequest)},
-  { 51, -1, -1, sizeof(::Serialize::TradeResponse)},
-  { 65, -1, -1, sizeof(::Serialize::ClientBalance)},
-  { 73, -1, -1, sizeof(::Serialize::AccountBalance)},
-  { 81, -1, -1, sizeof(::Serialize::ActiveOrders)},
-  { 89, -1, -1, sizeof(::Serialize::CompletedOredrs)},
-  { 97, -1, -1, sizeof(::Serialize::QuoteHistory)},
-  { 104, -1, -1, sizeof(::Serialize::Quote)},
+  { 17, -1, -1, sizeof(::Serialize::TradeOrder)},
+  { 37, -1, -1, sizeof(::Serialize::CancelTradeOrder)},
+  { 45, -1, -1, sizeof(::Serialize::CancelAllOrders)},
+  { 52, -1, -1, sizeof(::Serialize::ModifyTradeOrder)},
+  { 62, -1, -1, sizeof(::Serialize::DepthRequest)},
+  { 69, -1, -1, sizeof(::Serialize::CandlesRequest)},
+  { 78, -1, -1, sizeof(::Serialize::TradeRequest)},
+  { 96, -1, -1, sizeof(::Serialize::TradeResponse)},
+  { 115, -1, -1, sizeof(::Serialize::ExecutionReport)},
+  { 131, -1, -1, sizeof(::Serialize::Execution)},
+  { 144, -1, -1, sizeof(::Serialize::Trades)},
+  { 151, -1, -1, sizeof(::Serialize::ClientBalance)},
+  { 159, -1, -1, sizeof(::Serialize::AccountBalance)},
+  { 169, -1, -1, sizeof(::Serialize::ActiveOrders)},
+  { 177, -1, -1, sizeof(::Serialize::CompletedOredrs)},
+  { 185, -1, -1, sizeof(::Serialize::QuoteHistory)},
+  { 192, -1, -1, sizeof(::Serialize::Quote)},
+  { 200, -1, -1, sizeof(::Serialize::PriceLevel)},
+  { 209, -1, -1, sizeof(::Serialize::MarketDepth)},
+  { 218, -1, -1, sizeof(::Serialize::Candle)},
+  { 231, -1, -1, sizeof(::Serialize::Candles)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -336,78 +658,152 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::Serialize::_SignInRequest_default_instance_._instance,
   &::Serialize::_TradeOrder_default_instance_._instance,
   &::Serialize::_CancelTradeOrder_default_instance_._instance,
+  &::Serialize::_CancelAllOrders_default_instance_._instance,
+  &::Serialize::_ModifyTradeOrder_default_instance_._instance,
+  &::Serialize::_DepthRequest_default_instance_._instance,
+  &::Serialize::_CandlesRequest_default_instance_._instance,
   &::Serialize::_TradeRequest_default_instance_._instance,
   &::Serialize::_TradeResponse_default_instance_._instance,
+  &::Serialize::_ExecutionReport_default_instance_._instance,
+  &::Serialize::_Execution_default_instance_._instance,
+  &::Serialize::_Trades_default_instance_._instance,
   &::Serialize::_ClientBalance_default_instance_._instance,
   &::Serialize::_AccountBalance_default_instance_._instance,
   &::Serialize::_ActiveOrders_default_instance_._instance,
   &::Serialize::_CompletedOredrs_default_instance_._instance,
   &::Serialize::_QuoteHistory_default_instance_._instance,
   &::Serialize::_Quote_default_instance_._instance,
+  &::Serialize::_PriceLevel_default_instance_._instance,
+  &::Serialize::_MarketDepth_default_instance_._instance,
+  &::Serialize::_Candle_default_instance_._instance,
+  &::Serialize::_Candles_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_trade_5fmarket_5fprotocol_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\033trade_market_protocol.proto\022\tSerialize"
   "\"3\n\rSignUpRequest\022\020\n\010username\030\001 \001(\t\022\020\n\010p"
-  "assword\030\002 \001(\t\"3\n\rSignInRequest\022\020\n\010userna"
-  "me\030\001 \001(\t\022\020\n\010password\030\002 \001(\t\"\314\001\n\nTradeOrde"
-  "r\022-\n\004type\030\001 \001(\0162\037.Serialize.TradeOrder.T"
-  "radeType\022\020\n\010usd_cost\030\002 \001(\001\022\022\n\nusd_amount"
-  "\030\003 \001(\005\022\021\n\ttimestamp\030\004 \001(\003\022\020\n\010order_id\030\005 "
-  "\001(\003\022\022\n\nusd_volume\030\006 \001(\005\022\020\n\010username\030\007 \001("
-  "\t\"\036\n\tTradeType\022\007\n\003BUY\020\000\022\010\n\004SELL\020\001\"y\n\020Can"
-  "celTradeOrder\0223\n\004type\030\001 \001(\0162%.Serialize."
-  "CancelTradeOrder.TradeType\022\020\n\010order_id\030\002"
-  " \001(\003\"\036\n\tTradeType\022\007\n\003BUY\020\000\022\010\n\004SELL\020\001\"\355\003\n"
-  "\014TradeRequest\0224\n\007command\030\001 \001(\0162#.Seriali"
-  "ze.TradeRequest.CommandType\022\020\n\010username\030"
-  "\002 \001(\t\022\013\n\003jwt\030\003 \001(\t\0223\n\017sign_up_request\030\004 "
-  "\001(\0132\030.Serialize.SignUpRequestH\000\0223\n\017sign_"
-  "in_request\030\005 \001(\0132\030.Serialize.SignInReque"
-  "stH\000\022&\n\005order\030\006 \001(\0132\025.Serialize.TradeOrd"
-  "erH\000\0223\n\014cancel_order\030\007 \001(\0132\033.Serialize.C"
-  "ancelTradeOrderH\000\"\261\001\n\013CommandType\022\013\n\007SIG"
-  "N_UP\020\000\022\013\n\007SIGN_IN\020\001\022\016\n\nMAKE_ORDER\020\002\022\020\n\014V"
-  "IEW_BALANCE\020\003\022\032\n\026VIEW_ALL_ACTIVE_ORDERS\020"
-  "\004\022\031\n\025VIEW_COMPLETED_TRADES\020\005\022\026\n\022VIEW_QUO"
-  "TE_HISTORY\020\006\022\027\n\023CANCEL_ACTIVE_ORDER\020\007B\r\n"
-  "\013RequestData\"\344\005\n\rTradeResponse\0225\n\014respon"
-  "se_msg\030\001 \001(\0162\037.Serialize.TradeResponse.s"
-  "tatus\022\r\n\003jwt\030\002 \001(\tH\000\0224\n\017account_balance\030"
-  "\003 \001(\0132\031.Serialize.AccountBalanceH\000\0220\n\rac"
-  "tive_orders\030\004 \001(\0132\027.Serialize.ActiveOrde"
-  "rsH\000\0226\n\020completed_orders\030\005 \001(\0132\032.Seriali"
-  "ze.CompletedOredrsH\000\0220\n\rquote_history\030\006 "
-  "\001(\0132\027.Serialize.QuoteHistoryH\000\022\030\n\016error_"
-  "response\030\007 \001(\tH\000\"\221\003\n\006status\022\t\n\005ERROR\020\000\022\026"
-  "\n\022SIGN_UP_SUCCESSFUL\020\001\022\032\n\026USERNAME_ALREA"
-  "DY_TAKEN\020\002\022\026\n\022SIGN_IN_SUCCESSFUL\020\003\022 \n\034IN"
-  "VALID_USERNAME_OR_PASSWORD\020\004\022\032\n\026USER_ALR"
-  "EADY_LOGGED_IN\020\005\022\036\n\032ORDER_SUCCESSFULLY_C"
-  "REATED\020\006\022\030\n\024SUCCESS_VIEW_BALANCE\020\007\022\"\n\036SU"
-  "CCESS_VIEW_ALL_ACTIVE_ORDERS\020\010\022!\n\035SUCCES"
-  "S_VIEW_COMPLETED_TRADES\020\n\022\036\n\032SUCCESS_VIE"
-  "W_QUOTE_HISTORY\020\013\022\037\n\033SUCCESS_CANCEL_ACTI"
-  "VE_ORDER\020\014\022\035\n\031ERROR_CANCEL_ACTIVE_ORDER\020"
-  "\r\022\021\n\rORDER_MATCHED\020\016B\r\n\013RequestData\"K\n\rC"
-  "lientBalance\022\020\n\010username\030\001 \001(\t\022(\n\005funds\030"
-  "\002 \001(\0132\031.Serialize.AccountBalance\":\n\016Acco"
-  "untBalance\022\023\n\013usd_balance\030\001 \001(\001\022\023\n\013rub_b"
-  "alance\030\002 \001(\001\"s\n\014ActiveOrders\0220\n\021active_b"
-  "uy_orders\030\001 \003(\0132\025.Serialize.TradeOrder\0221"
-  "\n\022active_sell_orders\030\002 \003(\0132\025.Serialize.T"
-  "radeOrder\"|\n\017CompletedOredrs\0223\n\024complete"
-  "d_buy_orders\030\001 \003(\0132\025.Serialize.TradeOrde"
-  "r\0224\n\025completed_sell_orders\030\002 \003(\0132\025.Seria"
-  "lize.TradeOrder\"0\n\014QuoteHistory\022 \n\006quote"
-  "s\030\001 \003(\0132\020.Serialize.Quote\")\n\005Quote\022\021\n\tti"
-  "mestamp\030\001 \001(\003\022\r\n\005price\030\002 \001(\001b\006proto3"
+  "assword\030\002 \001(\t\"Q\n\rSignInRequest\022\020\n\010userna"
+  "me\030\001 \001(\t\022\020\n\010password\030\002 \001(\t\022\034\n\024cancel_on_"
+  "disconnect\030\003 \001(\010\"\241\004\n\nTradeOrder\022-\n\004type\030"
+  "\001 \001(\0162\037.Serialize.TradeOrder.TradeType\022\020"
+  "\n\010usd_cost\030\002 \001(\001\022\022\n\nusd_amount\030\003 \001(\005\022\021\n\t"
+  "timestamp\030\004 \001(\003\022\020\n\010order_id\030\005 \001(\003\022\022\n\nusd"
+  "_volume\030\006 \001(\005\022\020\n\010username\030\007 \001(\t\0223\n\norder"
+  "_type\030\010 \001(\0162\037.Serialize.TradeOrder.Order"
+  "Type\0228\n\rtime_in_force\030\t \001(\0162!.Serialize."
+  "TradeOrder.TimeInForce\022\022\n\nstop_price\030\n \001"
+  "(\001\022\023\n\013peak_amount\030\013 \001(\005\022\030\n\020displayed_amo"
+  "unt\030\014 \001(\005\022\022\n\naccount_id\030\r \001(\r\022\023\n\013expire_"
+  "time\030\016 \001(\003\"\036\n\tTradeType\022\007\n\003BUY\020\000\022\010\n\004SELL"
+  "\020\001\"<\n\tOrderType\022\t\n\005LIMIT\020\000\022\n\n\006MARKET\020\001\022\010"
+  "\n\004STOP\020\002\022\016\n\nSTOP_LIMIT\020\003\":\n\013TimeInForce\022"
+  "\007\n\003GTC\020\000\022\007\n\003IOC\020\001\022\007\n\003FOK\020\002\022\007\n\003GTD\020\003\022\007\n\003D"
+  "AY\020\004\"y\n\020CancelTradeOrder\0223\n\004type\030\001 \001(\0162%"
+  ".Serialize.CancelTradeOrder.TradeType\022\020\n"
+  "\010order_id\030\002 \001(\003\"\036\n\tTradeType\022\007\n\003BUY\020\000\022\010\n"
+  "\004SELL\020\001\"e\n\017CancelAllOrders\022-\n\004side\030\001 \001(\016"
+  "2\037.Serialize.CancelAllOrders.Side\"#\n\004Sid"
+  "e\022\010\n\004BOTH\020\000\022\007\n\003BUY\020\001\022\010\n\004SELL\020\002\"y\n\020Modify"
+  "TradeOrder\022-\n\004type\030\001 \001(\0162\037.Serialize.Tra"
+  "deOrder.TradeType\022\020\n\010order_id\030\002 \001(\003\022\020\n\010u"
+  "sd_cost\030\003 \001(\001\022\022\n\nusd_amount\030\004 \001(\005\"\036\n\014Dep"
+  "thRequest\022\016\n\006levels\030\001 \001(\005\"o\n\016CandlesRequ"
+  "est\022/\n\nresolution\030\001 \001(\0162\033.Serialize.Cand"
+  "leResolution\022\026\n\016from_timestamp\030\002 \001(\003\022\024\n\014"
+  "to_timestamp\030\003 \001(\003\"\254\006\n\014TradeRequest\0224\n\007c"
+  "ommand\030\001 \001(\0162#.Serialize.TradeRequest.Co"
+  "mmandType\022\020\n\010username\030\002 \001(\t\022\013\n\003jwt\030\003 \001(\t"
+  "\0223\n\017sign_up_request\030\004 \001(\0132\030.Serialize.Si"
+  "gnUpRequestH\000\0223\n\017sign_in_request\030\005 \001(\0132\030"
+  ".Serialize.SignInRequestH\000\022&\n\005order\030\006 \001("
+  "\0132\025.Serialize.TradeOrderH\000\0223\n\014cancel_ord"
+  "er\030\007 \001(\0132\033.Serialize.CancelTradeOrderH\000\022"
+  "0\n\rdepth_request\030\010 \001(\0132\027.Serialize.Depth"
+  "RequestH\000\0224\n\017candles_request\030\t \001(\0132\031.Ser"
+  "ialize.CandlesRequestH\000\0223\n\014modify_order\030"
+  "\n \001(\0132\033.Serialize.ModifyTradeOrderH\000\0220\n\n"
+  "cancel_all\030\013 \001(\0132\032.Serialize.CancelAllOr"
+  "dersH\000\"\241\002\n\013CommandType\022\013\n\007SIGN_UP\020\000\022\013\n\007S"
+  "IGN_IN\020\001\022\016\n\nMAKE_ORDER\020\002\022\020\n\014VIEW_BALANCE"
+  "\020\003\022\032\n\026VIEW_ALL_ACTIVE_ORDERS\020\004\022\031\n\025VIEW_C"
+  "OMPLETED_TRADES\020\005\022\026\n\022VIEW_QUOTE_HISTORY\020"
+  "\006\022\027\n\023CANCEL_ACTIVE_ORDER\020\007\022\016\n\nVIEW_DEPTH"
+  "\020\010\022\031\n\025VIEW_MY_ACTIVE_ORDERS\020\t\022\020\n\014VIEW_CA"
+  "NDLES\020\n\022\017\n\013VIEW_TRADES\020\013\022\020\n\014MODIFY_ORDER"
+  "\020\014\022\016\n\nCANCEL_ALL\020\rB\r\n\013RequestData\"\215\t\n\rTr"
+  "adeResponse\0225\n\014response_msg\030\001 \001(\0162\037.Seri"
+  "alize.TradeResponse.status\022\r\n\003jwt\030\002 \001(\tH"
+  "\000\0224\n\017account_balance\030\003 \001(\0132\031.Serialize.A"
+  "ccountBalanceH\000\0220\n\ractive_orders\030\004 \001(\0132\027"
+  ".Serialize.ActiveOrdersH\000\0226\n\020completed_o"
+  "rders\030\005 \001(\0132\032.Serialize.CompletedOredrsH"
+  "\000\0220\n\rquote_history\030\006 \001(\0132\027.Serialize.Quo"
+  "teHistoryH\000\022\030\n\016error_response\030\007 \001(\tH\000\0226\n"
+  "\020execution_report\030\010 \001(\0132\032.Serialize.Exec"
+  "utionReportH\000\022.\n\014market_depth\030\t \001(\0132\026.Se"
+  "rialize.MarketDepthH\000\022%\n\007candles\030\n \001(\0132\022"
+  ".Serialize.CandlesH\000\022#\n\006trades\030\013 \001(\0132\021.S"
+  "erialize.TradesH\000\022\037\n\025canceled_orders_cou"
+  "nt\030\014 \001(\005H\000\"\345\004\n\006status\022\t\n\005ERROR\020\000\022\026\n\022SIGN"
+  "_UP_SUCCESSFUL\020\001\022\032\n\026USERNAME_ALREADY_TAK"
+  "EN\020\002\022\026\n\022SIGN_IN_SUCCESSFUL\020\003\022 \n\034INVALID_"
+  "USERNAME_OR_PASSWORD\020\004\022\032\n\026USER_ALREADY_L"
+  "OGGED_IN\020\005\022\036\n\032ORDER_SUCCESSFULLY_CREATED"
+  "\020\006\022\030\n\024SUCCESS_VIEW_BALANCE\020\007\022\"\n\036SUCCESS_"
+  "VIEW_ALL_ACTIVE_ORDERS\020\010\022!\n\035SUCCESS_VIEW"
+  "_COMPLETED_TRADES\020\n\022\036\n\032SUCCESS_VIEW_QUOT"
+  "E_HISTORY\020\013\022\037\n\033SUCCESS_CANCEL_ACTIVE_ORD"
+  "ER\020\014\022\035\n\031ERROR_CANCEL_ACTIVE_ORDER\020\r\022\021\n\rO"
+  "RDER_MATCHED\020\016\022\026\n\022SUCCESS_VIEW_DEPTH\020\017\022!"
+  "\n\035SUCCESS_VIEW_MY_ACTIVE_ORDERS\020\020\022\030\n\024SUC"
+  "CESS_VIEW_CANDLES\020\021\022\027\n\023SUCCESS_VIEW_TRAD"
+  "ES\020\022\022\032\n\026ORDER_REJECTED_BY_RISK\020\023\022\030\n\024SUCC"
+  "ESS_MODIFY_ORDER\020\024\022\026\n\022ERROR_MODIFY_ORDER"
+  "\020\025\022\026\n\022SUCCESS_CANCEL_ALL\020\026B\r\n\013RequestDat"
+  "a\"\204\002\n\017ExecutionReport\022\020\n\010order_id\030\001 \001(\003\022"
+  "-\n\004type\030\002 \001(\0162\037.Serialize.TradeOrder.Tra"
+  "deType\022\023\n\013fill_amount\030\003 \001(\005\022\r\n\005price\030\004 \001"
+  "(\001\022\030\n\020remaining_amount\030\005 \001(\005\022\031\n\021usd_bala"
+  "nce_delta\030\006 \001(\001\022\031\n\021rub_balance_delta\030\007 \001"
+  "(\001\022\021\n\ttimestamp\030\010 \001(\003\022\020\n\010trade_id\030\t \001(\003\022"
+  "\027\n\017canceled_amount\030\n \001(\005\"\274\001\n\tExecution\022\020"
+  "\n\010trade_id\030\001 \001(\003\022\r\n\005price\030\002 \001(\001\022\022\n\nusd_a"
+  "mount\030\003 \001(\005\0227\n\016aggressor_side\030\004 \001(\0162\037.Se"
+  "rialize.TradeOrder.TradeType\022\026\n\016maker_or"
+  "der_id\030\005 \001(\003\022\026\n\016taker_order_id\030\006 \001(\003\022\021\n\t"
+  "timestamp\030\007 \001(\003\"2\n\006Trades\022(\n\nexecutions\030"
+  "\001 \003(\0132\024.Serialize.Execution\"K\n\rClientBal"
+  "ance\022\020\n\010username\030\001 \001(\t\022(\n\005funds\030\002 \001(\0132\031."
+  "Serialize.AccountBalance\"f\n\016AccountBalan"
+  "ce\022\023\n\013usd_balance\030\001 \001(\001\022\023\n\013rub_balance\030\002"
+  " \001(\001\022\024\n\014usd_reserved\030\003 \001(\001\022\024\n\014rub_reserv"
+  "ed\030\004 \001(\001\"s\n\014ActiveOrders\0220\n\021active_buy_o"
+  "rders\030\001 \003(\0132\025.Serialize.TradeOrder\0221\n\022ac"
+  "tive_sell_orders\030\002 \003(\0132\025.Serialize.Trade"
+  "Order\"|\n\017CompletedOredrs\0223\n\024completed_bu"
+  "y_orders\030\001 \003(\0132\025.Serialize.TradeOrder\0224\n"
+  "\025completed_sell_orders\030\002 \003(\0132\025.Serialize"
+  ".TradeOrder\"0\n\014QuoteHistory\022 \n\006quotes\030\001 "
+  "\003(\0132\020.Serialize.Quote\")\n\005Quote\022\021\n\ttimest"
+  "amp\030\001 \001(\003\022\r\n\005price\030\002 \001(\001\"E\n\nPriceLevel\022\r"
+  "\n\005price\030\001 \001(\001\022\022\n\nusd_amount\030\002 \001(\003\022\024\n\014ord"
+  "ers_count\030\003 \001(\005\"j\n\013MarketDepth\022#\n\004bids\030\001"
+  " \003(\0132\025.Serialize.PriceLevel\022#\n\004asks\030\002 \003("
+  "\0132\025.Serialize.PriceLevel\022\021\n\ttimestamp\030\003 "
+  "\001(\003\"}\n\006Candle\022\021\n\topen_time\030\001 \001(\003\022\014\n\004open"
+  "\030\002 \001(\001\022\014\n\004high\030\003 \001(\001\022\013\n\003low\030\004 \001(\001\022\r\n\005clo"
+  "se\030\005 \001(\001\022\022\n\nusd_volume\030\006 \001(\003\022\024\n\014trades_c"
+  "ount\030\007 \001(\005\"^\n\007Candles\022/\n\nresolution\030\001 \001("
+  "\0162\033.Serialize.CandleResolution\022\"\n\007candle"
+  "s\030\002 \003(\0132\021.Serialize.Candle*S\n\020CandleReso"
+  "lution\022\014\n\010SECOND_1\020\000\022\014\n\010MINUTE_1\020\001\022\014\n\010MI"
+  "NUTE_5\020\002\022\n\n\006HOUR_1\020\003\022\t\n\005DAY_1\020\004b\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_trade_5fmarket_5fprotocol_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_trade_5fmarket_5fprotocol_2eproto = {
-    false, false, 2196, descriptor_table_protodef_trade_5fmarket_5fprotocol_2eproto,
+    false, false, 4719, descriptor_table_protodef_trade_5fmarket_5fprotocol_2eproto,
     "trade_market_protocol.proto",
-    &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once, nullptr, 0, 12,
+    &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once, nullptr, 0, 23,
     schemas, file_default_instances, TableStruct_trade_5fmarket_5fprotocol_2eproto::offsets,
     file_level_metadata_trade_5fmarket_5fprotocol_2eproto, file_level_enum_descriptors_trade_5fmarket_5fprotocol_2eproto,
     file_level_service_descriptors_trade_5fmarket_5fprotocol_2eproto,
@@ -440,10 +836,62 @@ constexpr TradeOrder_TradeType TradeOrder::TradeType_MIN;
 constexpr TradeOrder_TradeType TradeOrder::TradeType_MAX;
 constexpr int TradeOrder::TradeType_ARRAYSIZE;
 #endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CancelTradeOrder_TradeType_descriptor() {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TradeOrder_OrderType_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_trade_5fmarket_5fprotocol_2eproto);
   return file_level_enum_descriptors_trade_5fmarket_5fprotocol_2eproto[1];
 }
+bool TradeOrder_OrderType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr TradeOrder_OrderType TradeOrder::LIMIT;
+constexpr TradeOrder_OrderType TradeOrder::MARKET;
+constexpr TradeOrder_OrderType TradeOrder::STOP;
+constexpr TradeOrder_OrderType TradeOrder::STOP_LIMIT;
+constexpr TradeOrder_OrderType TradeOrder::OrderType_MIN;
+constexpr TradeOrder_OrderType TradeOrder::OrderType_MAX;
+constexpr int TradeOrder::OrderType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TradeOrder_TimeInForce_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_trade_5fmarket_5fprotocol_2eproto);
+  return file_level_enum_descriptors_trade_5fmarket_5fprotocol_2eproto[2];
+}
+bool TradeOrder_TimeInForce_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr TradeOrder_TimeInForce TradeOrder::GTC;
+constexpr TradeOrder_TimeInForce TradeOrder::IOC;
+constexpr TradeOrder_TimeInForce TradeOrder::FOK;
+constexpr TradeOrder_TimeInForce TradeOrder::GTD;
+constexpr TradeOrder_TimeInForce TradeOrder::DAY;
+constexpr TradeOrder_TimeInForce TradeOrder::TimeInForce_MIN;
+constexpr TradeOrder_TimeInForce TradeOrder::TimeInForce_MAX;
+constexpr int TradeOrder::TimeInForce_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CancelTradeOrder_TradeType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_trade_5fmarket_5fprotocol_2eproto);
+  return file_level_enum_descriptors_trade_5fmarket_5fprotocol_2eproto[3];
+}
 bool CancelTradeOrder_TradeType_IsValid(int value) {
   switch (value) {
     case 0:
@@ -461,9 +909,32 @@ constexpr CancelTradeOrder_TradeType CancelTradeOrder::TradeType_MIN;
 constexpr CancelTradeOrder_TradeType CancelTradeOrder::TradeType_MAX;
 constexpr int CancelTradeOrder::TradeType_ARRAYSIZE;
 #endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CancelAllOrders_Side_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_trade_5fmarket_5fprotocol_2eproto);
+  return file_level_enum_descriptors_trade_5fmarket_5fprotocol_2eproto[4];
+}
+bool CancelAllOrders_Side_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr CancelAllOrders_Side CancelAllOrders::BOTH;
+constexpr CancelAllOrders_Side CancelAllOrders::BUY;
+constexpr CancelAllOrders_Side CancelAllOrders::SELL;
+constexpr CancelAllOrders_Side CancelAllOrders::Side_MIN;
+constexpr CancelAllOrders_Side CancelAllOrders::Side_MAX;
+constexpr int CancelAllOrders::Side_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TradeRequest_CommandType_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_trade_5fmarket_5fprotocol_2eproto);
-  return file_level_enum_descriptors_trade_5fmarket_5fprotocol_2eproto[2];
+  return file_level_enum_descriptors_trade_5fmarket_5fprotocol_2eproto[5];
 }
 bool TradeRequest_CommandType_IsValid(int value) {
   switch (value) {
@@ -475,6 +946,12 @@ bool TradeRequest_CommandType_IsValid(int value) {
     case 5:
     case 6:
     case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
       return true;
     default:
       return false;
@@ -490,13 +967,19 @@ constexpr TradeRequest_CommandType TradeRequest::VIEW_ALL_ACTIVE_ORDERS;
 constexpr TradeRequest_CommandType TradeRequest::VIEW_COMPLETED_TRADES;
 constexpr TradeRequest_CommandType TradeRequest::VIEW_QUOTE_HISTORY;
 constexpr TradeRequest_CommandType TradeRequest::CANCEL_ACTIVE_ORDER;
+constexpr TradeRequest_CommandType TradeRequest::VIEW_DEPTH;
+constexpr TradeRequest_CommandType TradeRequest::VIEW_MY_ACTIVE_ORDERS;
+constexpr TradeRequest_CommandType TradeRequest::VIEW_CANDLES;
+constexpr TradeRequest_CommandType TradeRequest::VIEW_TRADES;
+constexpr TradeRequest_CommandType TradeRequest::MODIFY_ORDER;
+constexpr TradeRequest_CommandType TradeRequest::CANCEL_ALL;
 constexpr TradeRequest_CommandType TradeRequest::CommandType_MIN;
 constexpr TradeRequest_CommandType TradeRequest::CommandType_MAX;
 constexpr int TradeRequest::CommandType_ARRAYSIZE;
 #endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TradeResponse_status_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_trade_5fmarket_5fprotocol_2eproto);
-  return file_level_enum_descriptors_trade_5fmarket_5fprotocol_2eproto[3];
+  return file_level_enum_descriptors_trade_5fmarket_5fprotocol_2eproto[6];
 }
 bool TradeResponse_status_IsValid(int value) {
   switch (value) {
@@ -514,6 +997,14 @@ bool TradeResponse_status_IsValid(int value) {
     case 12:
     case 13:
     case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
       return true;
     default:
       return false;
@@ -535,10 +1026,35 @@ constexpr TradeResponse_status TradeResponse::SUCCESS_VIEW_QUOTE_HISTORY;
 constexpr TradeResponse_status TradeResponse::SUCCESS_CANCEL_ACTIVE_ORDER;
 constexpr TradeResponse_status TradeResponse::ERROR_CANCEL_ACTIVE_ORDER;
 constexpr TradeResponse_status TradeResponse::ORDER_MATCHED;
+constexpr TradeResponse_status TradeResponse::SUCCESS_VIEW_DEPTH;
+constexpr TradeResponse_status TradeResponse::SUCCESS_VIEW_MY_ACTIVE_ORDERS;
+constexpr TradeResponse_status TradeResponse::SUCCESS_VIEW_CANDLES;
+constexpr TradeResponse_status TradeResponse::SUCCESS_VIEW_TRADES;
+constexpr TradeResponse_status TradeResponse::ORDER_REJECTED_BY_RISK;
+constexpr TradeResponse_status TradeResponse::SUCCESS_MODIFY_ORDER;
+constexpr TradeResponse_status TradeResponse::ERROR_MODIFY_ORDER;
+constexpr TradeResponse_status TradeResponse::SUCCESS_CANCEL_ALL;
 constexpr TradeResponse_status TradeResponse::status_MIN;
 constexpr TradeResponse_status TradeResponse::status_MAX;
 constexpr int TradeResponse::status_ARRAYSIZE;
 #endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CandleResolution_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_trade_5fmarket_5fprotocol_2eproto);
+  return file_level_enum_descriptors_trade_5fmarket_5fprotocol_2eproto[7];
+}
+bool CandleResolution_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -811,6 +1327,7 @@ SignInRequest::SignInRequest(const SignInRequest& from)
   new (&_impl_) Impl_{
       decltype(_impl_.username_){}
     , decltype(_impl_.password_){}
+    , decltype(_impl_.cancel_on_disconnect_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -830,6 +1347,7 @@ SignInRequest::SignInRequest(const SignInRequest& from)
     _this->_impl_.password_.Set(from._internal_password(), 
       _this->GetArenaForAllocation());
   }
+  _this->_impl_.cancel_on_disconnect_ = from._impl_.cancel_on_disconnect_;
   // @@protoc_insertion_point(copy_constructor:Serialize.SignInRequest)
 }
 
@@ -840,6 +1358,7 @@ inline void SignInRequest::SharedCtor(
   new (&_impl_) Impl_{
       decltype(_impl_.username_){}
     , decltype(_impl_.password_){}
+    , decltype(_impl_.cancel_on_disconnect_){false}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.username_.InitDefault();
@@ -879,6 +1398,7 @@ void SignInRequest::Clear() {
 
   _impl_.username_.ClearToEmpty();
   _impl_.password_.ClearToEmpty();
+  _impl_.cancel_on_disconnect_ = false;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -908,6 +1428,14 @@ const char* SignInRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // bool cancel_on_disconnect = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.cancel_on_disconnect_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -957,6 +1485,12 @@ uint8_t* SignInRequest::_InternalSerialize(
         2, this->_internal_password(), target);
   }
 
+  // bool cancel_on_disconnect = 3;
+  if (this->_internal_cancel_on_disconnect() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_cancel_on_disconnect(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -987,6 +1521,11 @@ size_t SignInRequest::ByteSizeLong() const {
         this->_internal_password());
   }
 
+  // bool cancel_on_disconnect = 3;
+  if (this->_internal_cancel_on_disconnect() != 0) {
+    total_size += 1 + 1;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1011,6 +1550,9 @@ void SignInRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::
   if (!from._internal_password().empty()) {
     _this->_internal_set_password(from._internal_password());
   }
+  if (from._internal_cancel_on_disconnect() != 0) {
+    _this->_internal_set_cancel_on_disconnect(from._internal_cancel_on_disconnect());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1038,6 +1580,7 @@ void SignInRequest::InternalSwap(SignInRequest* other) {
       &_impl_.password_, lhs_arena,
       &other->_impl_.password_, rhs_arena
   );
+  swap(_impl_.cancel_on_disconnect_, other->_impl_.cancel_on_disconnect_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata SignInRequest::GetMetadata() const {
@@ -1069,6 +1612,13 @@ TradeOrder::TradeOrder(const TradeOrder& from)
     , decltype(_impl_.timestamp_){}
     , decltype(_impl_.order_id_){}
     , decltype(_impl_.usd_volume_){}
+    , decltype(_impl_.order_type_){}
+    , decltype(_impl_.stop_price_){}
+    , decltype(_impl_.time_in_force_){}
+    , decltype(_impl_.peak_amount_){}
+    , decltype(_impl_.displayed_amount_){}
+    , decltype(_impl_.account_id_){}
+    , decltype(_impl_.expire_time_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -1081,8 +1631,8 @@ TradeOrder::TradeOrder(const TradeOrder& from)
       _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.usd_cost_, &from._impl_.usd_cost_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.usd_volume_) -
-    reinterpret_cast<char*>(&_impl_.usd_cost_)) + sizeof(_impl_.usd_volume_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.expire_time_) -
+    reinterpret_cast<char*>(&_impl_.usd_cost_)) + sizeof(_impl_.expire_time_));
   // @@protoc_insertion_point(copy_constructor:Serialize.TradeOrder)
 }
 
@@ -1098,6 +1648,13 @@ inline void TradeOrder::SharedCtor(
     , decltype(_impl_.timestamp_){int64_t{0}}
     , decltype(_impl_.order_id_){int64_t{0}}
     , decltype(_impl_.usd_volume_){0}
+    , decltype(_impl_.order_type_){0}
+    , decltype(_impl_.stop_price_){0}
+    , decltype(_impl_.time_in_force_){0}
+    , decltype(_impl_.peak_amount_){0}
+    , decltype(_impl_.displayed_amount_){0}
+    , decltype(_impl_.account_id_){0u}
+    , decltype(_impl_.expire_time_){int64_t{0}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.username_.InitDefault();
@@ -1132,8 +1689,8 @@ void TradeOrder::Clear() {
 
   _impl_.username_.ClearToEmpty();
   ::memset(&_impl_.usd_cost_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.usd_volume_) -
-      reinterpret_cast<char*>(&_impl_.usd_cost_)) + sizeof(_impl_.usd_volume_));
+      reinterpret_cast<char*>(&_impl_.expire_time_) -
+      reinterpret_cast<char*>(&_impl_.usd_cost_)) + sizeof(_impl_.expire_time_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1202,6 +1759,64 @@ const char* TradeOrder::_InternalParse(const char* ptr, ::_pbi::ParseContext* ct
         } else
           goto handle_unusual;
         continue;
+      // .Serialize.TradeOrder.OrderType order_type = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_order_type(static_cast<::Serialize::TradeOrder_OrderType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.TradeOrder.TimeInForce time_in_force = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_time_in_force(static_cast<::Serialize::TradeOrder_TimeInForce>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // double stop_price = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _impl_.stop_price_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 peak_amount = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.peak_amount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 displayed_amount = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.displayed_amount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 account_id = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.account_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 expire_time = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _impl_.expire_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1282,8 +1897,56 @@ uint8_t* TradeOrder::_InternalSerialize(
         7, this->_internal_username(), target);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+  // .Serialize.TradeOrder.OrderType order_type = 8;
+  if (this->_internal_order_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      8, this->_internal_order_type(), target);
+  }
+
+  // .Serialize.TradeOrder.TimeInForce time_in_force = 9;
+  if (this->_internal_time_in_force() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      9, this->_internal_time_in_force(), target);
+  }
+
+  // double stop_price = 10;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_stop_price = this->_internal_stop_price();
+  uint64_t raw_stop_price;
+  memcpy(&raw_stop_price, &tmp_stop_price, sizeof(tmp_stop_price));
+  if (raw_stop_price != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_stop_price(), target);
+  }
+
+  // int32 peak_amount = 11;
+  if (this->_internal_peak_amount() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_peak_amount(), target);
+  }
+
+  // int32 displayed_amount = 12;
+  if (this->_internal_displayed_amount() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(12, this->_internal_displayed_amount(), target);
+  }
+
+  // uint32 account_id = 13;
+  if (this->_internal_account_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(13, this->_internal_account_id(), target);
+  }
+
+  // int64 expire_time = 14;
+  if (this->_internal_expire_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(14, this->_internal_expire_time(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Serialize.TradeOrder)
@@ -1340,6 +2003,47 @@ size_t TradeOrder::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_usd_volume());
   }
 
+  // .Serialize.TradeOrder.OrderType order_type = 8;
+  if (this->_internal_order_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_order_type());
+  }
+
+  // double stop_price = 10;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_stop_price = this->_internal_stop_price();
+  uint64_t raw_stop_price;
+  memcpy(&raw_stop_price, &tmp_stop_price, sizeof(tmp_stop_price));
+  if (raw_stop_price != 0) {
+    total_size += 1 + 8;
+  }
+
+  // .Serialize.TradeOrder.TimeInForce time_in_force = 9;
+  if (this->_internal_time_in_force() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_time_in_force());
+  }
+
+  // int32 peak_amount = 11;
+  if (this->_internal_peak_amount() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_peak_amount());
+  }
+
+  // int32 displayed_amount = 12;
+  if (this->_internal_displayed_amount() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_displayed_amount());
+  }
+
+  // uint32 account_id = 13;
+  if (this->_internal_account_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_account_id());
+  }
+
+  // int64 expire_time = 14;
+  if (this->_internal_expire_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_expire_time());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1383,6 +2087,31 @@ void TradeOrder::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PRO
   if (from._internal_usd_volume() != 0) {
     _this->_internal_set_usd_volume(from._internal_usd_volume());
   }
+  if (from._internal_order_type() != 0) {
+    _this->_internal_set_order_type(from._internal_order_type());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_stop_price = from._internal_stop_price();
+  uint64_t raw_stop_price;
+  memcpy(&raw_stop_price, &tmp_stop_price, sizeof(tmp_stop_price));
+  if (raw_stop_price != 0) {
+    _this->_internal_set_stop_price(from._internal_stop_price());
+  }
+  if (from._internal_time_in_force() != 0) {
+    _this->_internal_set_time_in_force(from._internal_time_in_force());
+  }
+  if (from._internal_peak_amount() != 0) {
+    _this->_internal_set_peak_amount(from._internal_peak_amount());
+  }
+  if (from._internal_displayed_amount() != 0) {
+    _this->_internal_set_displayed_amount(from._internal_displayed_amount());
+  }
+  if (from._internal_account_id() != 0) {
+    _this->_internal_set_account_id(from._internal_account_id());
+  }
+  if (from._internal_expire_time() != 0) {
+    _this->_internal_set_expire_time(from._internal_expire_time());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1407,8 +2136,8 @@ void TradeOrder::InternalSwap(TradeOrder* other) {
       &other->_impl_.username_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TradeOrder, _impl_.usd_volume_)
-      + sizeof(TradeOrder::_impl_.usd_volume_)
+      PROTOBUF_FIELD_OFFSET(TradeOrder, _impl_.expire_time_)
+      + sizeof(TradeOrder::_impl_.expire_time_)
       - PROTOBUF_FIELD_OFFSET(TradeOrder, _impl_.usd_cost_)>(
           reinterpret_cast<char*>(&_impl_.usd_cost_),
           reinterpret_cast<char*>(&other->_impl_.usd_cost_));
@@ -1636,179 +2365,40 @@ void CancelTradeOrder::InternalSwap(CancelTradeOrder* other) {
 
 // ===================================================================
 
-class TradeRequest::_Internal {
+class CancelAllOrders::_Internal {
  public:
-  static const ::Serialize::SignUpRequest& sign_up_request(const TradeRequest* msg);
-  static const ::Serialize::SignInRequest& sign_in_request(const TradeRequest* msg);
-  static const ::Serialize::TradeOrder& order(const TradeRequest* msg);
-  static const ::Serialize::CancelTradeOrder& cancel_order(const TradeRequest* msg);
 };
 
-const ::Serialize::SignUpRequest&
-TradeRequest::_Internal::sign_up_request(const TradeRequest* msg) {
-  return *msg->_impl_.RequestData_.sign_up_request_;
-}
-const ::Serialize::SignInRequest&
-TradeRequest::_Internal::sign_in_request(const TradeRequest* msg) {
-  return *msg->_impl_.RequestData_.sign_in_request_;
-}
-const ::Serialize::TradeOrder&
-TradeRequest::_Internal::order(const TradeRequest* msg) {
-  return *msg->_impl_.RequestData_.order_;
-}
-const ::Serialize::CancelTradeOrder&
-TradeRequest::_Internal::cancel_order(const TradeRequest* msg) {
-  return *msg->_impl_.RequestData_.cancel_order_;
-}
-void TradeRequest::set_allocated_sign_up_request(::Serialize::SignUpRequest* sign_up_request) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  clear_RequestData();
-  if (sign_up_request) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sign_up_request);
-    if (message_arena != submessage_arena) {
-      sign_up_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, sign_up_request, submessage_arena);
-    }
-    set_has_sign_up_request();
-    _impl_.RequestData_.sign_up_request_ = sign_up_request;
-  }
-  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.sign_up_request)
-}
-void TradeRequest::set_allocated_sign_in_request(::Serialize::SignInRequest* sign_in_request) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  clear_RequestData();
-  if (sign_in_request) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sign_in_request);
-    if (message_arena != submessage_arena) {
-      sign_in_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, sign_in_request, submessage_arena);
-    }
-    set_has_sign_in_request();
-    _impl_.RequestData_.sign_in_request_ = sign_in_request;
-  }
-  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.sign_in_request)
-}
-void TradeRequest::set_allocated_order(::Serialize::TradeOrder* order) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  clear_RequestData();
-  if (order) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(order);
-    if (message_arena != submessage_arena) {
-      order = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, order, submessage_arena);
-    }
-    set_has_order();
-    _impl_.RequestData_.order_ = order;
-  }
-  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.order)
-}
-void TradeRequest::set_allocated_cancel_order(::Serialize::CancelTradeOrder* cancel_order) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  clear_RequestData();
-  if (cancel_order) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cancel_order);
-    if (message_arena != submessage_arena) {
-      cancel_order = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, cancel_order, submessage_arena);
-    }
-    set_has_cancel_order();
-    _impl_.RequestData_.cancel_order_ = cancel_order;
-  }
-  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.cancel_order)
-}
-TradeRequest::TradeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+CancelAllOrders::CancelAllOrders(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:Serialize.TradeRequest)
+  // @@protoc_insertion_point(arena_constructor:Serialize.CancelAllOrders)
 }
-TradeRequest::TradeRequest(const TradeRequest& from)
+CancelAllOrders::CancelAllOrders(const CancelAllOrders& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  TradeRequest* const _this = this; (void)_this;
+  CancelAllOrders* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.username_){}
-    , decltype(_impl_.jwt_){}
-    , decltype(_impl_.command_){}
-    , decltype(_impl_.RequestData_){}
-    , /*decltype(_impl_._cached_size_)*/{}
-    , /*decltype(_impl_._oneof_case_)*/{}};
+      decltype(_impl_.side_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.username_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.username_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_username().empty()) {
-    _this->_impl_.username_.Set(from._internal_username(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.jwt_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.jwt_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_jwt().empty()) {
-    _this->_impl_.jwt_.Set(from._internal_jwt(), 
-      _this->GetArenaForAllocation());
-  }
-  _this->_impl_.command_ = from._impl_.command_;
-  clear_has_RequestData();
-  switch (from.RequestData_case()) {
-    case kSignUpRequest: {
-      _this->_internal_mutable_sign_up_request()->::Serialize::SignUpRequest::MergeFrom(
-          from._internal_sign_up_request());
-      break;
-    }
-    case kSignInRequest: {
-      _this->_internal_mutable_sign_in_request()->::Serialize::SignInRequest::MergeFrom(
-          from._internal_sign_in_request());
-      break;
-    }
-    case kOrder: {
-      _this->_internal_mutable_order()->::Serialize::TradeOrder::MergeFrom(
-          from._internal_order());
-      break;
-    }
-    case kCancelOrder: {
-      _this->_internal_mutable_cancel_order()->::Serialize::CancelTradeOrder::MergeFrom(
-          from._internal_cancel_order());
-      break;
-    }
-    case REQUESTDATA_NOT_SET: {
-      break;
-    }
-  }
-  // @@protoc_insertion_point(copy_constructor:Serialize.TradeRequest)
+  _this->_impl_.side_ = from._impl_.side_;
+  // @@protoc_insertion_point(copy_constructor:Serialize.CancelAllOrders)
 }
 
-inline void TradeRequest::SharedCtor(
+inline void CancelAllOrders::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.username_){}
-    , decltype(_impl_.jwt_){}
-    , decltype(_impl_.command_){0}
-    , decltype(_impl_.RequestData_){}
+      decltype(_impl_.side_){0}
     , /*decltype(_impl_._cached_size_)*/{}
-    , /*decltype(_impl_._oneof_case_)*/{}
   };
-  _impl_.username_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.username_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.jwt_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.jwt_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  clear_has_RequestData();
 }
 
-TradeRequest::~TradeRequest() {
-  // @@protoc_insertion_point(destructor:Serialize.TradeRequest)
+CancelAllOrders::~CancelAllOrders() {
+  // @@protoc_insertion_point(destructor:Serialize.CancelAllOrders)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1816,131 +2406,36 @@ TradeRequest::~TradeRequest() {
   SharedDtor();
 }
 
-inline void TradeRequest::SharedDtor() {
+inline void CancelAllOrders::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.username_.Destroy();
-  _impl_.jwt_.Destroy();
-  if (has_RequestData()) {
-    clear_RequestData();
-  }
 }
 
-void TradeRequest::SetCachedSize(int size) const {
+void CancelAllOrders::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void TradeRequest::clear_RequestData() {
-// @@protoc_insertion_point(one_of_clear_start:Serialize.TradeRequest)
-  switch (RequestData_case()) {
-    case kSignUpRequest: {
-      if (GetArenaForAllocation() == nullptr) {
-        delete _impl_.RequestData_.sign_up_request_;
-      }
-      break;
-    }
-    case kSignInRequest: {
-      if (GetArenaForAllocation() == nullptr) {
-        delete _impl_.RequestData_.sign_in_request_;
-      }
-      break;
-    }
-    case kOrder: {
-      if (GetArenaForAllocation() == nullptr) {
-        delete _impl_.RequestData_.order_;
-      }
-      break;
-    }
-    case kCancelOrder: {
-      if (GetArenaForAllocation() == nullptr) {
-        delete _impl_.RequestData_.cancel_order_;
-      }
-      break;
-    }
-    case REQUESTDATA_NOT_SET: {
-      break;
-    }
-  }
-  _impl_._oneof_case_[0] = REQUESTDATA_NOT_SET;
-}
-
-
-void TradeRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:Serialize.TradeRequest)
+void CancelAllOrders::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.CancelAllOrders)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.username_.ClearToEmpty();
-  _impl_.jwt_.ClearToEmpty();
-  _impl_.command_ = 0;
-  clear_RequestData();
+  _impl_.side_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TradeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CancelAllOrders::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .Serialize.TradeRequest.CommandType command = 1;
+      // .Serialize.CancelAllOrders.Side side = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
           uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          _internal_set_command(static_cast<::Serialize::TradeRequest_CommandType>(val));
-        } else
-          goto handle_unusual;
-        continue;
-      // string username = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_username();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "Serialize.TradeRequest.username"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string jwt = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_jwt();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "Serialize.TradeRequest.jwt"));
-        } else
-          goto handle_unusual;
-        continue;
-      // .Serialize.SignUpRequest sign_up_request = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_sign_up_request(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .Serialize.SignInRequest sign_in_request = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          ptr = ctx->ParseMessage(_internal_mutable_sign_in_request(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .Serialize.TradeOrder order = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
-          ptr = ctx->ParseMessage(_internal_mutable_order(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .Serialize.CancelTradeOrder cancel_order = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
-          ptr = ctx->ParseMessage(_internal_mutable_cancel_order(), ptr);
-          CHK_(ptr);
+          _internal_set_side(static_cast<::Serialize::CancelAllOrders_Side>(val));
         } else
           goto handle_unusual;
         continue;
@@ -1967,221 +2462,83 @@ failure:
 #undef CHK_
 }
 
-uint8_t* TradeRequest::_InternalSerialize(
+uint8_t* CancelAllOrders::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Serialize.TradeRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.CancelAllOrders)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .Serialize.TradeRequest.CommandType command = 1;
-  if (this->_internal_command() != 0) {
+  // .Serialize.CancelAllOrders.Side side = 1;
+  if (this->_internal_side() != 0) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_command(), target);
-  }
-
-  // string username = 2;
-  if (!this->_internal_username().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "Serialize.TradeRequest.username");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_username(), target);
-  }
-
-  // string jwt = 3;
-  if (!this->_internal_jwt().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_jwt().data(), static_cast<int>(this->_internal_jwt().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "Serialize.TradeRequest.jwt");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_jwt(), target);
-  }
-
-  // .Serialize.SignUpRequest sign_up_request = 4;
-  if (_internal_has_sign_up_request()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(4, _Internal::sign_up_request(this),
-        _Internal::sign_up_request(this).GetCachedSize(), target, stream);
-  }
-
-  // .Serialize.SignInRequest sign_in_request = 5;
-  if (_internal_has_sign_in_request()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, _Internal::sign_in_request(this),
-        _Internal::sign_in_request(this).GetCachedSize(), target, stream);
-  }
-
-  // .Serialize.TradeOrder order = 6;
-  if (_internal_has_order()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(6, _Internal::order(this),
-        _Internal::order(this).GetCachedSize(), target, stream);
-  }
-
-  // .Serialize.CancelTradeOrder cancel_order = 7;
-  if (_internal_has_cancel_order()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(7, _Internal::cancel_order(this),
-        _Internal::cancel_order(this).GetCachedSize(), target, stream);
+      1, this->_internal_side(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Serialize.TradeRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.CancelAllOrders)
   return target;
 }
 
-size_t TradeRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Serialize.TradeRequest)
+size_t CancelAllOrders::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.CancelAllOrders)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string username = 2;
-  if (!this->_internal_username().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_username());
-  }
-
-  // string jwt = 3;
-  if (!this->_internal_jwt().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_jwt());
-  }
-
-  // .Serialize.TradeRequest.CommandType command = 1;
-  if (this->_internal_command() != 0) {
+  // .Serialize.CancelAllOrders.Side side = 1;
+  if (this->_internal_side() != 0) {
     total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_command());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_side());
   }
 
-  switch (RequestData_case()) {
-    // .Serialize.SignUpRequest sign_up_request = 4;
-    case kSignUpRequest: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *_impl_.RequestData_.sign_up_request_);
-      break;
-    }
-    // .Serialize.SignInRequest sign_in_request = 5;
-    case kSignInRequest: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *_impl_.RequestData_.sign_in_request_);
-      break;
-    }
-    // .Serialize.TradeOrder order = 6;
-    case kOrder: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *_impl_.RequestData_.order_);
-      break;
-    }
-    // .Serialize.CancelTradeOrder cancel_order = 7;
-    case kCancelOrder: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *_impl_.RequestData_.cancel_order_);
-      break;
-    }
-    case REQUESTDATA_NOT_SET: {
-      break;
-    }
-  }
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TradeRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CancelAllOrders::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    TradeRequest::MergeImpl
+    CancelAllOrders::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TradeRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CancelAllOrders::GetClassData() const { return &_class_data_; }
 
 
-void TradeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<TradeRequest*>(&to_msg);
-  auto& from = static_cast<const TradeRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.TradeRequest)
+void CancelAllOrders::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CancelAllOrders*>(&to_msg);
+  auto& from = static_cast<const CancelAllOrders&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.CancelAllOrders)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_username().empty()) {
-    _this->_internal_set_username(from._internal_username());
-  }
-  if (!from._internal_jwt().empty()) {
-    _this->_internal_set_jwt(from._internal_jwt());
-  }
-  if (from._internal_command() != 0) {
-    _this->_internal_set_command(from._internal_command());
-  }
-  switch (from.RequestData_case()) {
-    case kSignUpRequest: {
-      _this->_internal_mutable_sign_up_request()->::Serialize::SignUpRequest::MergeFrom(
-          from._internal_sign_up_request());
-      break;
-    }
-    case kSignInRequest: {
-      _this->_internal_mutable_sign_in_request()->::Serialize::SignInRequest::MergeFrom(
-          from._internal_sign_in_request());
-      break;
-    }
-    case kOrder: {
-      _this->_internal_mutable_order()->::Serialize::TradeOrder::MergeFrom(
-          from._internal_order());
-      break;
-    }
-    case kCancelOrder: {
-      _this->_internal_mutable_cancel_order()->::Serialize::CancelTradeOrder::MergeFrom(
-          from._internal_cancel_order());
-      break;
-    }
-    case REQUESTDATA_NOT_SET: {
-      break;
-    }
+  if (from._internal_side() != 0) {
+    _this->_internal_set_side(from._internal_side());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void TradeRequest::CopyFrom(const TradeRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.TradeRequest)
+void CancelAllOrders::CopyFrom(const CancelAllOrders& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.CancelAllOrders)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TradeRequest::IsInitialized() const {
+bool CancelAllOrders::IsInitialized() const {
   return true;
 }
 
-void TradeRequest::InternalSwap(TradeRequest* other) {
+void CancelAllOrders::InternalSwap(CancelAllOrders* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.username_, lhs_arena,
-      &other->_impl_.username_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.jwt_, lhs_arena,
-      &other->_impl_.jwt_, rhs_arena
-  );
-  swap(_impl_.command_, other->_impl_.command_);
-  swap(_impl_.RequestData_, other->_impl_.RequestData_);
-  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+  swap(_impl_.side_, other->_impl_.side_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TradeRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata CancelAllOrders::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
       file_level_metadata_trade_5fmarket_5fprotocol_2eproto[4]);
@@ -2189,159 +2546,4052 @@ void TradeRequest::InternalSwap(TradeRequest* other) {
 
 // ===================================================================
 
-class TradeResponse::_Internal {
+class ModifyTradeOrder::_Internal {
  public:
-  static const ::Serialize::AccountBalance& account_balance(const TradeResponse* msg);
-  static const ::Serialize::ActiveOrders& active_orders(const TradeResponse* msg);
-  static const ::Serialize::CompletedOredrs& completed_orders(const TradeResponse* msg);
-  static const ::Serialize::QuoteHistory& quote_history(const TradeResponse* msg);
 };
 
-const ::Serialize::AccountBalance&
-TradeResponse::_Internal::account_balance(const TradeResponse* msg) {
-  return *msg->_impl_.RequestData_.account_balance_;
+ModifyTradeOrder::ModifyTradeOrder(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Serialize.ModifyTradeOrder)
 }
-const ::Serialize::ActiveOrders&
-TradeResponse::_Internal::active_orders(const TradeResponse* msg) {
-  return *msg->_impl_.RequestData_.active_orders_;
+ModifyTradeOrder::ModifyTradeOrder(const ModifyTradeOrder& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ModifyTradeOrder* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.order_id_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.usd_amount_){}
+    , decltype(_impl_.usd_cost_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.order_id_, &from._impl_.order_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.usd_cost_) -
+    reinterpret_cast<char*>(&_impl_.order_id_)) + sizeof(_impl_.usd_cost_));
+  // @@protoc_insertion_point(copy_constructor:Serialize.ModifyTradeOrder)
 }
-const ::Serialize::CompletedOredrs&
-TradeResponse::_Internal::completed_orders(const TradeResponse* msg) {
-  return *msg->_impl_.RequestData_.completed_orders_;
+
+inline void ModifyTradeOrder::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.order_id_){int64_t{0}}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.usd_amount_){0}
+    , decltype(_impl_.usd_cost_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
-const ::Serialize::QuoteHistory&
-TradeResponse::_Internal::quote_history(const TradeResponse* msg) {
+
+ModifyTradeOrder::~ModifyTradeOrder() {
+  // @@protoc_insertion_point(destructor:Serialize.ModifyTradeOrder)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ModifyTradeOrder::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ModifyTradeOrder::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ModifyTradeOrder::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.ModifyTradeOrder)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.order_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.usd_cost_) -
+      reinterpret_cast<char*>(&_impl_.order_id_)) + sizeof(_impl_.usd_cost_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ModifyTradeOrder::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .Serialize.TradeOrder.TradeType type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::Serialize::TradeOrder_TradeType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 order_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.order_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double usd_cost = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.usd_cost_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 usd_amount = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.usd_amount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ModifyTradeOrder::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.ModifyTradeOrder)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .Serialize.TradeOrder.TradeType type = 1;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // int64 order_id = 2;
+  if (this->_internal_order_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_order_id(), target);
+  }
+
+  // double usd_cost = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_usd_cost = this->_internal_usd_cost();
+  uint64_t raw_usd_cost;
+  memcpy(&raw_usd_cost, &tmp_usd_cost, sizeof(tmp_usd_cost));
+  if (raw_usd_cost != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_usd_cost(), target);
+  }
+
+  // int32 usd_amount = 4;
+  if (this->_internal_usd_amount() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_usd_amount(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.ModifyTradeOrder)
+  return target;
+}
+
+size_t ModifyTradeOrder::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.ModifyTradeOrder)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 order_id = 2;
+  if (this->_internal_order_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_order_id());
+  }
+
+  // .Serialize.TradeOrder.TradeType type = 1;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  // int32 usd_amount = 4;
+  if (this->_internal_usd_amount() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_usd_amount());
+  }
+
+  // double usd_cost = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_usd_cost = this->_internal_usd_cost();
+  uint64_t raw_usd_cost;
+  memcpy(&raw_usd_cost, &tmp_usd_cost, sizeof(tmp_usd_cost));
+  if (raw_usd_cost != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModifyTradeOrder::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ModifyTradeOrder::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModifyTradeOrder::GetClassData() const { return &_class_data_; }
+
+
+void ModifyTradeOrder::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ModifyTradeOrder*>(&to_msg);
+  auto& from = static_cast<const ModifyTradeOrder&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.ModifyTradeOrder)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_order_id() != 0) {
+    _this->_internal_set_order_id(from._internal_order_id());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_usd_amount() != 0) {
+    _this->_internal_set_usd_amount(from._internal_usd_amount());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_usd_cost = from._internal_usd_cost();
+  uint64_t raw_usd_cost;
+  memcpy(&raw_usd_cost, &tmp_usd_cost, sizeof(tmp_usd_cost));
+  if (raw_usd_cost != 0) {
+    _this->_internal_set_usd_cost(from._internal_usd_cost());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ModifyTradeOrder::CopyFrom(const ModifyTradeOrder& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.ModifyTradeOrder)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ModifyTradeOrder::IsInitialized() const {
+  return true;
+}
+
+void ModifyTradeOrder::InternalSwap(ModifyTradeOrder* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ModifyTradeOrder, _impl_.usd_cost_)
+      + sizeof(ModifyTradeOrder::_impl_.usd_cost_)
+      - PROTOBUF_FIELD_OFFSET(ModifyTradeOrder, _impl_.order_id_)>(
+          reinterpret_cast<char*>(&_impl_.order_id_),
+          reinterpret_cast<char*>(&other->_impl_.order_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ModifyTradeOrder::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[5]);
+}
+
+// ===================================================================
+
+class DepthRequest::_Internal {
+ public:
+};
+
+DepthRequest::DepthRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Serialize.DepthRequest)
+}
+DepthRequest::DepthRequest(const DepthRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DepthRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.levels_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.levels_ = from._impl_.levels_;
+  // @@protoc_insertion_point(copy_constructor:Serialize.DepthRequest)
+}
+
+inline void DepthRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.levels_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+DepthRequest::~DepthRequest() {
+  // @@protoc_insertion_point(destructor:Serialize.DepthRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DepthRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void DepthRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DepthRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.DepthRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.levels_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DepthRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 levels = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.levels_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DepthRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.DepthRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 levels = 1;
+  if (this->_internal_levels() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_levels(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.DepthRequest)
+  return target;
+}
+
+size_t DepthRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.DepthRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 levels = 1;
+  if (this->_internal_levels() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_levels());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DepthRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DepthRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DepthRequest::GetClassData() const { return &_class_data_; }
+
+
+void DepthRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DepthRequest*>(&to_msg);
+  auto& from = static_cast<const DepthRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.DepthRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_levels() != 0) {
+    _this->_internal_set_levels(from._internal_levels());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DepthRequest::CopyFrom(const DepthRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.DepthRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DepthRequest::IsInitialized() const {
+  return true;
+}
+
+void DepthRequest::InternalSwap(DepthRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.levels_, other->_impl_.levels_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DepthRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[6]);
+}
+
+// ===================================================================
+
+class CandlesRequest::_Internal {
+ public:
+};
+
+CandlesRequest::CandlesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Serialize.CandlesRequest)
+}
+CandlesRequest::CandlesRequest(const CandlesRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CandlesRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_timestamp_){}
+    , decltype(_impl_.to_timestamp_){}
+    , decltype(_impl_.resolution_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.from_timestamp_, &from._impl_.from_timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.resolution_) -
+    reinterpret_cast<char*>(&_impl_.from_timestamp_)) + sizeof(_impl_.resolution_));
+  // @@protoc_insertion_point(copy_constructor:Serialize.CandlesRequest)
+}
+
+inline void CandlesRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_timestamp_){int64_t{0}}
+    , decltype(_impl_.to_timestamp_){int64_t{0}}
+    , decltype(_impl_.resolution_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CandlesRequest::~CandlesRequest() {
+  // @@protoc_insertion_point(destructor:Serialize.CandlesRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CandlesRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CandlesRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CandlesRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.CandlesRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.from_timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.resolution_) -
+      reinterpret_cast<char*>(&_impl_.from_timestamp_)) + sizeof(_impl_.resolution_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CandlesRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .Serialize.CandleResolution resolution = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_resolution(static_cast<::Serialize::CandleResolution>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 from_timestamp = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.from_timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 to_timestamp = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.to_timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CandlesRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.CandlesRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .Serialize.CandleResolution resolution = 1;
+  if (this->_internal_resolution() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_resolution(), target);
+  }
+
+  // int64 from_timestamp = 2;
+  if (this->_internal_from_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_from_timestamp(), target);
+  }
+
+  // int64 to_timestamp = 3;
+  if (this->_internal_to_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_to_timestamp(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.CandlesRequest)
+  return target;
+}
+
+size_t CandlesRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.CandlesRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 from_timestamp = 2;
+  if (this->_internal_from_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_from_timestamp());
+  }
+
+  // int64 to_timestamp = 3;
+  if (this->_internal_to_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_to_timestamp());
+  }
+
+  // .Serialize.CandleResolution resolution = 1;
+  if (this->_internal_resolution() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_resolution());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CandlesRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CandlesRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CandlesRequest::GetClassData() const { return &_class_data_; }
+
+
+void CandlesRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CandlesRequest*>(&to_msg);
+  auto& from = static_cast<const CandlesRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.CandlesRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_from_timestamp() != 0) {
+    _this->_internal_set_from_timestamp(from._internal_from_timestamp());
+  }
+  if (from._internal_to_timestamp() != 0) {
+    _this->_internal_set_to_timestamp(from._internal_to_timestamp());
+  }
+  if (from._internal_resolution() != 0) {
+    _this->_internal_set_resolution(from._internal_resolution());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CandlesRequest::CopyFrom(const CandlesRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.CandlesRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CandlesRequest::IsInitialized() const {
+  return true;
+}
+
+void CandlesRequest::InternalSwap(CandlesRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CandlesRequest, _impl_.resolution_)
+      + sizeof(CandlesRequest::_impl_.resolution_)
+      - PROTOBUF_FIELD_OFFSET(CandlesRequest, _impl_.from_timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.from_timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.from_timestamp_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CandlesRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[7]);
+}
+
+// ===================================================================
+
+class TradeRequest::_Internal {
+ public:
+  static const ::Serialize::SignUpRequest& sign_up_request(const TradeRequest* msg);
+  static const ::Serialize::SignInRequest& sign_in_request(const TradeRequest* msg);
+  static const ::Serialize::TradeOrder& order(const TradeRequest* msg);
+  static const ::Serialize::CancelTradeOrder& cancel_order(const TradeRequest* msg);
+  static const ::Serialize::DepthRequest& depth_request(const TradeRequest* msg);
+  static const ::Serialize::CandlesRequest& candles_request(const TradeRequest* msg);
+  static const ::Serialize::ModifyTradeOrder& modify_order(const TradeRequest* msg);
+  static const ::Serialize::CancelAllOrders& cancel_all(const TradeRequest* msg);
+};
+
+const ::Serialize::SignUpRequest&
+TradeRequest::_Internal::sign_up_request(const TradeRequest* msg) {
+  return *msg->_impl_.RequestData_.sign_up_request_;
+}
+const ::Serialize::SignInRequest&
+TradeRequest::_Internal::sign_in_request(const TradeRequest* msg) {
+  return *msg->_impl_.RequestData_.sign_in_request_;
+}
+const ::Serialize::TradeOrder&
+TradeRequest::_Internal::order(const TradeRequest* msg) {
+  return *msg->_impl_.RequestData_.order_;
+}
+const ::Serialize::CancelTradeOrder&
+TradeRequest::_Internal::cancel_order(const TradeRequest* msg) {
+  return *msg->_impl_.RequestData_.cancel_order_;
+}
+const ::Serialize::DepthRequest&
+TradeRequest::_Internal::depth_request(const TradeRequest* msg) {
+  return *msg->_impl_.RequestData_.depth_request_;
+}
+const ::Serialize::CandlesRequest&
+TradeRequest::_Internal::candles_request(const TradeRequest* msg) {
+  return *msg->_impl_.RequestData_.candles_request_;
+}
+const ::Serialize::ModifyTradeOrder&
+TradeRequest::_Internal::modify_order(const TradeRequest* msg) {
+  return *msg->_impl_.RequestData_.modify_order_;
+}
+const ::Serialize::CancelAllOrders&
+TradeRequest::_Internal::cancel_all(const TradeRequest* msg) {
+  return *msg->_impl_.RequestData_.cancel_all_;
+}
+void TradeRequest::set_allocated_sign_up_request(::Serialize::SignUpRequest* sign_up_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (sign_up_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sign_up_request);
+    if (message_arena != submessage_arena) {
+      sign_up_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sign_up_request, submessage_arena);
+    }
+    set_has_sign_up_request();
+    _impl_.RequestData_.sign_up_request_ = sign_up_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.sign_up_request)
+}
+void TradeRequest::set_allocated_sign_in_request(::Serialize::SignInRequest* sign_in_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (sign_in_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sign_in_request);
+    if (message_arena != submessage_arena) {
+      sign_in_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sign_in_request, submessage_arena);
+    }
+    set_has_sign_in_request();
+    _impl_.RequestData_.sign_in_request_ = sign_in_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.sign_in_request)
+}
+void TradeRequest::set_allocated_order(::Serialize::TradeOrder* order) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (order) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(order);
+    if (message_arena != submessage_arena) {
+      order = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, order, submessage_arena);
+    }
+    set_has_order();
+    _impl_.RequestData_.order_ = order;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.order)
+}
+void TradeRequest::set_allocated_cancel_order(::Serialize::CancelTradeOrder* cancel_order) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (cancel_order) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cancel_order);
+    if (message_arena != submessage_arena) {
+      cancel_order = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cancel_order, submessage_arena);
+    }
+    set_has_cancel_order();
+    _impl_.RequestData_.cancel_order_ = cancel_order;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.cancel_order)
+}
+void TradeRequest::set_allocated_depth_request(::Serialize::DepthRequest* depth_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (depth_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(depth_request);
+    if (message_arena != submessage_arena) {
+      depth_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, depth_request, submessage_arena);
+    }
+    set_has_depth_request();
+    _impl_.RequestData_.depth_request_ = depth_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.depth_request)
+}
+void TradeRequest::set_allocated_candles_request(::Serialize::CandlesRequest* candles_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (candles_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(candles_request);
+    if (message_arena != submessage_arena) {
+      candles_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, candles_request, submessage_arena);
+    }
+    set_has_candles_request();
+    _impl_.RequestData_.candles_request_ = candles_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.candles_request)
+}
+void TradeRequest::set_allocated_modify_order(::Serialize::ModifyTradeOrder* modify_order) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (modify_order) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(modify_order);
+    if (message_arena != submessage_arena) {
+      modify_order = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, modify_order, submessage_arena);
+    }
+    set_has_modify_order();
+    _impl_.RequestData_.modify_order_ = modify_order;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.modify_order)
+}
+void TradeRequest::set_allocated_cancel_all(::Serialize::CancelAllOrders* cancel_all) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (cancel_all) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cancel_all);
+    if (message_arena != submessage_arena) {
+      cancel_all = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cancel_all, submessage_arena);
+    }
+    set_has_cancel_all();
+    _impl_.RequestData_.cancel_all_ = cancel_all;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.cancel_all)
+}
+TradeRequest::TradeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Serialize.TradeRequest)
+}
+TradeRequest::TradeRequest(const TradeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TradeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.jwt_){}
+    , decltype(_impl_.command_){}
+    , decltype(_impl_.RequestData_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.jwt_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.jwt_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_jwt().empty()) {
+    _this->_impl_.jwt_.Set(from._internal_jwt(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.command_ = from._impl_.command_;
+  clear_has_RequestData();
+  switch (from.RequestData_case()) {
+    case kSignUpRequest: {
+      _this->_internal_mutable_sign_up_request()->::Serialize::SignUpRequest::MergeFrom(
+          from._internal_sign_up_request());
+      break;
+    }
+    case kSignInRequest: {
+      _this->_internal_mutable_sign_in_request()->::Serialize::SignInRequest::MergeFrom(
+          from._internal_sign_in_request());
+      break;
+    }
+    case kOrder: {
+      _this->_internal_mutable_order()->::Serialize::TradeOrder::MergeFrom(
+          from._internal_order());
+      break;
+    }
+    case kCancelOrder: {
+      _this->_internal_mutable_cancel_order()->::Serialize::CancelTradeOrder::MergeFrom(
+          from._internal_cancel_order());
+      break;
+    }
+    case kDepthRequest: {
+      _this->_internal_mutable_depth_request()->::Serialize::DepthRequest::MergeFrom(
+          from._internal_depth_request());
+      break;
+    }
+    case kCandlesRequest: {
+      _this->_internal_mutable_candles_request()->::Serialize::CandlesRequest::MergeFrom(
+          from._internal_candles_request());
+      break;
+    }
+    case kModifyOrder: {
+      _this->_internal_mutable_modify_order()->::Serialize::ModifyTradeOrder::MergeFrom(
+          from._internal_modify_order());
+      break;
+    }
+    case kCancelAll: {
+      _this->_internal_mutable_cancel_all()->::Serialize::CancelAllOrders::MergeFrom(
+          from._internal_cancel_all());
+      break;
+    }
+    case REQUESTDATA_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:Serialize.TradeRequest)
+}
+
+inline void TradeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.jwt_){}
+    , decltype(_impl_.command_){0}
+    , decltype(_impl_.RequestData_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.jwt_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.jwt_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  clear_has_RequestData();
+}
+
+TradeRequest::~TradeRequest() {
+  // @@protoc_insertion_point(destructor:Serialize.TradeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TradeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+  _impl_.jwt_.Destroy();
+  if (has_RequestData()) {
+    clear_RequestData();
+  }
+}
+
+void TradeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TradeRequest::clear_RequestData() {
+// @@protoc_insertion_point(one_of_clear_start:Serialize.TradeRequest)
+  switch (RequestData_case()) {
+    case kSignUpRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.sign_up_request_;
+      }
+      break;
+    }
+    case kSignInRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.sign_in_request_;
+      }
+      break;
+    }
+    case kOrder: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.order_;
+      }
+      break;
+    }
+    case kCancelOrder: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.cancel_order_;
+      }
+      break;
+    }
+    case kDepthRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.depth_request_;
+      }
+      break;
+    }
+    case kCandlesRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.candles_request_;
+      }
+      break;
+    }
+    case kModifyOrder: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.modify_order_;
+      }
+      break;
+    }
+    case kCancelAll: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.cancel_all_;
+      }
+      break;
+    }
+    case REQUESTDATA_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = REQUESTDATA_NOT_SET;
+}
+
+
+void TradeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.TradeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.username_.ClearToEmpty();
+  _impl_.jwt_.ClearToEmpty();
+  _impl_.command_ = 0;
+  clear_RequestData();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TradeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .Serialize.TradeRequest.CommandType command = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_command(static_cast<::Serialize::TradeRequest_CommandType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string username = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Serialize.TradeRequest.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string jwt = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_jwt();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Serialize.TradeRequest.jwt"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.SignUpRequest sign_up_request = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sign_up_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.SignInRequest sign_in_request = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sign_in_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.TradeOrder order = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_order(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.CancelTradeOrder cancel_order = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cancel_order(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.DepthRequest depth_request = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_depth_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.CandlesRequest candles_request = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_candles_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.ModifyTradeOrder modify_order = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_modify_order(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.CancelAllOrders cancel_all = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cancel_all(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TradeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.TradeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .Serialize.TradeRequest.CommandType command = 1;
+  if (this->_internal_command() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_command(), target);
+  }
+
+  // string username = 2;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Serialize.TradeRequest.username");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_username(), target);
+  }
+
+  // string jwt = 3;
+  if (!this->_internal_jwt().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_jwt().data(), static_cast<int>(this->_internal_jwt().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Serialize.TradeRequest.jwt");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_jwt(), target);
+  }
+
+  // .Serialize.SignUpRequest sign_up_request = 4;
+  if (_internal_has_sign_up_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::sign_up_request(this),
+        _Internal::sign_up_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .Serialize.SignInRequest sign_in_request = 5;
+  if (_internal_has_sign_in_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::sign_in_request(this),
+        _Internal::sign_in_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .Serialize.TradeOrder order = 6;
+  if (_internal_has_order()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::order(this),
+        _Internal::order(this).GetCachedSize(), target, stream);
+  }
+
+  // .Serialize.CancelTradeOrder cancel_order = 7;
+  if (_internal_has_cancel_order()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::cancel_order(this),
+        _Internal::cancel_order(this).GetCachedSize(), target, stream);
+  }
+
+  // .Serialize.DepthRequest depth_request = 8;
+  if (_internal_has_depth_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::depth_request(this),
+        _Internal::depth_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .Serialize.CandlesRequest candles_request = 9;
+  if (_internal_has_candles_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::candles_request(this),
+        _Internal::candles_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .Serialize.ModifyTradeOrder modify_order = 10;
+  if (_internal_has_modify_order()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::modify_order(this),
+        _Internal::modify_order(this).GetCachedSize(), target, stream);
+  }
+
+  // .Serialize.CancelAllOrders cancel_all = 11;
+  if (_internal_has_cancel_all()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::cancel_all(this),
+        _Internal::cancel_all(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.TradeRequest)
+  return target;
+}
+
+size_t TradeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.TradeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string username = 2;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // string jwt = 3;
+  if (!this->_internal_jwt().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_jwt());
+  }
+
+  // .Serialize.TradeRequest.CommandType command = 1;
+  if (this->_internal_command() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_command());
+  }
+
+  switch (RequestData_case()) {
+    // .Serialize.SignUpRequest sign_up_request = 4;
+    case kSignUpRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.sign_up_request_);
+      break;
+    }
+    // .Serialize.SignInRequest sign_in_request = 5;
+    case kSignInRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.sign_in_request_);
+      break;
+    }
+    // .Serialize.TradeOrder order = 6;
+    case kOrder: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.order_);
+      break;
+    }
+    // .Serialize.CancelTradeOrder cancel_order = 7;
+    case kCancelOrder: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.cancel_order_);
+      break;
+    }
+    // .Serialize.DepthRequest depth_request = 8;
+    case kDepthRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.depth_request_);
+      break;
+    }
+    // .Serialize.CandlesRequest candles_request = 9;
+    case kCandlesRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.candles_request_);
+      break;
+    }
+    // .Serialize.ModifyTradeOrder modify_order = 10;
+    case kModifyOrder: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.modify_order_);
+      break;
+    }
+    // .Serialize.CancelAllOrders cancel_all = 11;
+    case kCancelAll: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.cancel_all_);
+      break;
+    }
+    case REQUESTDATA_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TradeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TradeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TradeRequest::GetClassData() const { return &_class_data_; }
+
+
+void TradeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TradeRequest*>(&to_msg);
+  auto& from = static_cast<const TradeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.TradeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (!from._internal_jwt().empty()) {
+    _this->_internal_set_jwt(from._internal_jwt());
+  }
+  if (from._internal_command() != 0) {
+    _this->_internal_set_command(from._internal_command());
+  }
+  switch (from.RequestData_case()) {
+    case kSignUpRequest: {
+      _this->_internal_mutable_sign_up_request()->::Serialize::SignUpRequest::MergeFrom(
+          from._internal_sign_up_request());
+      break;
+    }
+    case kSignInRequest: {
+      _this->_internal_mutable_sign_in_request()->::Serialize::SignInRequest::MergeFrom(
+          from._internal_sign_in_request());
+      break;
+    }
+    case kOrder: {
+      _this->_internal_mutable_order()->::Serialize::TradeOrder::MergeFrom(
+          from._internal_order());
+      break;
+    }
+    case kCancelOrder: {
+      _this->_internal_mutable_cancel_order()->::Serialize::CancelTradeOrder::MergeFrom(
+          from._internal_cancel_order());
+      break;
+    }
+    case kDepthRequest: {
+      _this->_internal_mutable_depth_request()->::Serialize::DepthRequest::MergeFrom(
+          from._internal_depth_request());
+      break;
+    }
+    case kCandlesRequest: {
+      _this->_internal_mutable_candles_request()->::Serialize::CandlesRequest::MergeFrom(
+          from._internal_candles_request());
+      break;
+    }
+    case kModifyOrder: {
+      _this->_internal_mutable_modify_order()->::Serialize::ModifyTradeOrder::MergeFrom(
+          from._internal_modify_order());
+      break;
+    }
+    case kCancelAll: {
+      _this->_internal_mutable_cancel_all()->::Serialize::CancelAllOrders::MergeFrom(
+          from._internal_cancel_all());
+      break;
+    }
+    case REQUESTDATA_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TradeRequest::CopyFrom(const TradeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.TradeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TradeRequest::IsInitialized() const {
+  return true;
+}
+
+void TradeRequest::InternalSwap(TradeRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.jwt_, lhs_arena,
+      &other->_impl_.jwt_, rhs_arena
+  );
+  swap(_impl_.command_, other->_impl_.command_);
+  swap(_impl_.RequestData_, other->_impl_.RequestData_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TradeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[8]);
+}
+
+// ===================================================================
+
+class TradeResponse::_Internal {
+ public:
+  static const ::Serialize::AccountBalance& account_balance(const TradeResponse* msg);
+  static const ::Serialize::ActiveOrders& active_orders(const TradeResponse* msg);
+  static const ::Serialize::CompletedOredrs& completed_orders(const TradeResponse* msg);
+  static const ::Serialize::QuoteHistory& quote_history(const TradeResponse* msg);
+  static const ::Serialize::ExecutionReport& execution_report(const TradeResponse* msg);
+  static const ::Serialize::MarketDepth& market_depth(const TradeResponse* msg);
+  static const ::Serialize::Candles& candles(const TradeResponse* msg);
+  static const ::Serialize::Trades& trades(const TradeResponse* msg);
+};
+
+const ::Serialize::AccountBalance&
+TradeResponse::_Internal::account_balance(const TradeResponse* msg) {
+  return *msg->_impl_.RequestData_.account_balance_;
+}
+const ::Serialize::ActiveOrders&
+TradeResponse::_Internal::active_orders(const TradeResponse* msg) {
+  return *msg->_impl_.RequestData_.active_orders_;
+}
+const ::Serialize::CompletedOredrs&
+TradeResponse::_Internal::completed_orders(const TradeResponse* msg) {
+  return *msg->_impl_.RequestData_.completed_orders_;
+}
+const ::Serialize::QuoteHistory&
+TradeResponse::_Internal::quote_history(const TradeResponse* msg) {
   return *msg->_impl_.RequestData_.quote_history_;
 }
-void TradeResponse::set_allocated_account_balance(::Serialize::AccountBalance* account_balance) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  clear_RequestData();
-  if (account_balance) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(account_balance);
-    if (message_arena != submessage_arena) {
-      account_balance = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, account_balance, submessage_arena);
-    }
-    set_has_account_balance();
-    _impl_.RequestData_.account_balance_ = account_balance;
+const ::Serialize::ExecutionReport&
+TradeResponse::_Internal::execution_report(const TradeResponse* msg) {
+  return *msg->_impl_.RequestData_.execution_report_;
+}
+const ::Serialize::MarketDepth&
+TradeResponse::_Internal::market_depth(const TradeResponse* msg) {
+  return *msg->_impl_.RequestData_.market_depth_;
+}
+const ::Serialize::Candles&
+TradeResponse::_Internal::candles(const TradeResponse* msg) {
+  return *msg->_impl_.RequestData_.candles_;
+}
+const ::Serialize::Trades&
+TradeResponse::_Internal::trades(const TradeResponse* msg) {
+  return *msg->_impl_.RequestData_.trades_;
+}
+void TradeResponse::set_allocated_account_balance(::Serialize::AccountBalance* account_balance) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (account_balance) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(account_balance);
+    if (message_arena != submessage_arena) {
+      account_balance = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, account_balance, submessage_arena);
+    }
+    set_has_account_balance();
+    _impl_.RequestData_.account_balance_ = account_balance;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.account_balance)
+}
+void TradeResponse::set_allocated_active_orders(::Serialize::ActiveOrders* active_orders) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (active_orders) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(active_orders);
+    if (message_arena != submessage_arena) {
+      active_orders = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, active_orders, submessage_arena);
+    }
+    set_has_active_orders();
+    _impl_.RequestData_.active_orders_ = active_orders;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.active_orders)
+}
+void TradeResponse::set_allocated_completed_orders(::Serialize::CompletedOredrs* completed_orders) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (completed_orders) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(completed_orders);
+    if (message_arena != submessage_arena) {
+      completed_orders = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, completed_orders, submessage_arena);
+    }
+    set_has_completed_orders();
+    _impl_.RequestData_.completed_orders_ = completed_orders;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.completed_orders)
+}
+void TradeResponse::set_allocated_quote_history(::Serialize::QuoteHistory* quote_history) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (quote_history) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(quote_history);
+    if (message_arena != submessage_arena) {
+      quote_history = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, quote_history, submessage_arena);
+    }
+    set_has_quote_history();
+    _impl_.RequestData_.quote_history_ = quote_history;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.quote_history)
+}
+void TradeResponse::set_allocated_execution_report(::Serialize::ExecutionReport* execution_report) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (execution_report) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(execution_report);
+    if (message_arena != submessage_arena) {
+      execution_report = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, execution_report, submessage_arena);
+    }
+    set_has_execution_report();
+    _impl_.RequestData_.execution_report_ = execution_report;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.execution_report)
+}
+void TradeResponse::set_allocated_market_depth(::Serialize::MarketDepth* market_depth) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (market_depth) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(market_depth);
+    if (message_arena != submessage_arena) {
+      market_depth = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, market_depth, submessage_arena);
+    }
+    set_has_market_depth();
+    _impl_.RequestData_.market_depth_ = market_depth;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.market_depth)
+}
+void TradeResponse::set_allocated_candles(::Serialize::Candles* candles) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (candles) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(candles);
+    if (message_arena != submessage_arena) {
+      candles = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, candles, submessage_arena);
+    }
+    set_has_candles();
+    _impl_.RequestData_.candles_ = candles;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.candles)
+}
+void TradeResponse::set_allocated_trades(::Serialize::Trades* trades) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_RequestData();
+  if (trades) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(trades);
+    if (message_arena != submessage_arena) {
+      trades = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, trades, submessage_arena);
+    }
+    set_has_trades();
+    _impl_.RequestData_.trades_ = trades;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.trades)
+}
+TradeResponse::TradeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Serialize.TradeResponse)
+}
+TradeResponse::TradeResponse(const TradeResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TradeResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.response_msg_){}
+    , decltype(_impl_.RequestData_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.response_msg_ = from._impl_.response_msg_;
+  clear_has_RequestData();
+  switch (from.RequestData_case()) {
+    case kJwt: {
+      _this->_internal_set_jwt(from._internal_jwt());
+      break;
+    }
+    case kAccountBalance: {
+      _this->_internal_mutable_account_balance()->::Serialize::AccountBalance::MergeFrom(
+          from._internal_account_balance());
+      break;
+    }
+    case kActiveOrders: {
+      _this->_internal_mutable_active_orders()->::Serialize::ActiveOrders::MergeFrom(
+          from._internal_active_orders());
+      break;
+    }
+    case kCompletedOrders: {
+      _this->_internal_mutable_completed_orders()->::Serialize::CompletedOredrs::MergeFrom(
+          from._internal_completed_orders());
+      break;
+    }
+    case kQuoteHistory: {
+      _this->_internal_mutable_quote_history()->::Serialize::QuoteHistory::MergeFrom(
+          from._internal_quote_history());
+      break;
+    }
+    case kErrorResponse: {
+      _this->_internal_set_error_response(from._internal_error_response());
+      break;
+    }
+    case kExecutionReport: {
+      _this->_internal_mutable_execution_report()->::Serialize::ExecutionReport::MergeFrom(
+          from._internal_execution_report());
+      break;
+    }
+    case kMarketDepth: {
+      _this->_internal_mutable_market_depth()->::Serialize::MarketDepth::MergeFrom(
+          from._internal_market_depth());
+      break;
+    }
+    case kCandles: {
+      _this->_internal_mutable_candles()->::Serialize::Candles::MergeFrom(
+          from._internal_candles());
+      break;
+    }
+    case kTrades: {
+      _this->_internal_mutable_trades()->::Serialize::Trades::MergeFrom(
+          from._internal_trades());
+      break;
+    }
+    case kCanceledOrdersCount: {
+      _this->_internal_set_canceled_orders_count(from._internal_canceled_orders_count());
+      break;
+    }
+    case REQUESTDATA_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:Serialize.TradeResponse)
+}
+
+inline void TradeResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.response_msg_){0}
+    , decltype(_impl_.RequestData_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_RequestData();
+}
+
+TradeResponse::~TradeResponse() {
+  // @@protoc_insertion_point(destructor:Serialize.TradeResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TradeResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_RequestData()) {
+    clear_RequestData();
+  }
+}
+
+void TradeResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TradeResponse::clear_RequestData() {
+// @@protoc_insertion_point(one_of_clear_start:Serialize.TradeResponse)
+  switch (RequestData_case()) {
+    case kJwt: {
+      _impl_.RequestData_.jwt_.Destroy();
+      break;
+    }
+    case kAccountBalance: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.account_balance_;
+      }
+      break;
+    }
+    case kActiveOrders: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.active_orders_;
+      }
+      break;
+    }
+    case kCompletedOrders: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.completed_orders_;
+      }
+      break;
+    }
+    case kQuoteHistory: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.quote_history_;
+      }
+      break;
+    }
+    case kErrorResponse: {
+      _impl_.RequestData_.error_response_.Destroy();
+      break;
+    }
+    case kExecutionReport: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.execution_report_;
+      }
+      break;
+    }
+    case kMarketDepth: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.market_depth_;
+      }
+      break;
+    }
+    case kCandles: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.candles_;
+      }
+      break;
+    }
+    case kTrades: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.RequestData_.trades_;
+      }
+      break;
+    }
+    case kCanceledOrdersCount: {
+      // No need to clear
+      break;
+    }
+    case REQUESTDATA_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = REQUESTDATA_NOT_SET;
+}
+
+
+void TradeResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.TradeResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.response_msg_ = 0;
+  clear_RequestData();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TradeResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .Serialize.TradeResponse.status response_msg = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_response_msg(static_cast<::Serialize::TradeResponse_status>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string jwt = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_jwt();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Serialize.TradeResponse.jwt"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.AccountBalance account_balance = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_account_balance(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.ActiveOrders active_orders = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_active_orders(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.CompletedOredrs completed_orders = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_completed_orders(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.QuoteHistory quote_history = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_quote_history(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string error_response = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_error_response();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Serialize.TradeResponse.error_response"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.ExecutionReport execution_report = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_execution_report(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.MarketDepth market_depth = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_market_depth(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.Candles candles = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_candles(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.Trades trades = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_trades(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 canceled_orders_count = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _internal_set_canceled_orders_count(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TradeResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.TradeResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .Serialize.TradeResponse.status response_msg = 1;
+  if (this->_internal_response_msg() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_response_msg(), target);
+  }
+
+  // string jwt = 2;
+  if (_internal_has_jwt()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_jwt().data(), static_cast<int>(this->_internal_jwt().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Serialize.TradeResponse.jwt");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_jwt(), target);
+  }
+
+  // .Serialize.AccountBalance account_balance = 3;
+  if (_internal_has_account_balance()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::account_balance(this),
+        _Internal::account_balance(this).GetCachedSize(), target, stream);
+  }
+
+  // .Serialize.ActiveOrders active_orders = 4;
+  if (_internal_has_active_orders()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::active_orders(this),
+        _Internal::active_orders(this).GetCachedSize(), target, stream);
+  }
+
+  // .Serialize.CompletedOredrs completed_orders = 5;
+  if (_internal_has_completed_orders()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::completed_orders(this),
+        _Internal::completed_orders(this).GetCachedSize(), target, stream);
+  }
+
+  // .Serialize.QuoteHistory quote_history = 6;
+  if (_internal_has_quote_history()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::quote_history(this),
+        _Internal::quote_history(this).GetCachedSize(), target, stream);
+  }
+
+  // string error_response = 7;
+  if (_internal_has_error_response()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_response().data(), static_cast<int>(this->_internal_error_response().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Serialize.TradeResponse.error_response");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_error_response(), target);
+  }
+
+  // .Serialize.ExecutionReport execution_report = 8;
+  if (_internal_has_execution_report()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::execution_report(this),
+        _Internal::execution_report(this).GetCachedSize(), target, stream);
+  }
+
+  // .Serialize.MarketDepth market_depth = 9;
+  if (_internal_has_market_depth()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::market_depth(this),
+        _Internal::market_depth(this).GetCachedSize(), target, stream);
+  }
+
+  // .Serialize.Candles candles = 10;
+  if (_internal_has_candles()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::candles(this),
+        _Internal::candles(this).GetCachedSize(), target, stream);
+  }
+
+  // .Serialize.Trades trades = 11;
+  if (_internal_has_trades()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::trades(this),
+        _Internal::trades(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 canceled_orders_count = 12;
+  if (_internal_has_canceled_orders_count()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(12, this->_internal_canceled_orders_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.TradeResponse)
+  return target;
+}
+
+size_t TradeResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.TradeResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .Serialize.TradeResponse.status response_msg = 1;
+  if (this->_internal_response_msg() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_response_msg());
+  }
+
+  switch (RequestData_case()) {
+    // string jwt = 2;
+    case kJwt: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_jwt());
+      break;
+    }
+    // .Serialize.AccountBalance account_balance = 3;
+    case kAccountBalance: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.account_balance_);
+      break;
+    }
+    // .Serialize.ActiveOrders active_orders = 4;
+    case kActiveOrders: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.active_orders_);
+      break;
+    }
+    // .Serialize.CompletedOredrs completed_orders = 5;
+    case kCompletedOrders: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.completed_orders_);
+      break;
+    }
+    // .Serialize.QuoteHistory quote_history = 6;
+    case kQuoteHistory: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.quote_history_);
+      break;
+    }
+    // string error_response = 7;
+    case kErrorResponse: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error_response());
+      break;
+    }
+    // .Serialize.ExecutionReport execution_report = 8;
+    case kExecutionReport: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.execution_report_);
+      break;
+    }
+    // .Serialize.MarketDepth market_depth = 9;
+    case kMarketDepth: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.market_depth_);
+      break;
+    }
+    // .Serialize.Candles candles = 10;
+    case kCandles: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.candles_);
+      break;
+    }
+    // .Serialize.Trades trades = 11;
+    case kTrades: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.RequestData_.trades_);
+      break;
+    }
+    // int32 canceled_orders_count = 12;
+    case kCanceledOrdersCount: {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_canceled_orders_count());
+      break;
+    }
+    case REQUESTDATA_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TradeResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TradeResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TradeResponse::GetClassData() const { return &_class_data_; }
+
+
+void TradeResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TradeResponse*>(&to_msg);
+  auto& from = static_cast<const TradeResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.TradeResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_response_msg() != 0) {
+    _this->_internal_set_response_msg(from._internal_response_msg());
+  }
+  switch (from.RequestData_case()) {
+    case kJwt: {
+      _this->_internal_set_jwt(from._internal_jwt());
+      break;
+    }
+    case kAccountBalance: {
+      _this->_internal_mutable_account_balance()->::Serialize::AccountBalance::MergeFrom(
+          from._internal_account_balance());
+      break;
+    }
+    case kActiveOrders: {
+      _this->_internal_mutable_active_orders()->::Serialize::ActiveOrders::MergeFrom(
+          from._internal_active_orders());
+      break;
+    }
+    case kCompletedOrders: {
+      _this->_internal_mutable_completed_orders()->::Serialize::CompletedOredrs::MergeFrom(
+          from._internal_completed_orders());
+      break;
+    }
+    case kQuoteHistory: {
+      _this->_internal_mutable_quote_history()->::Serialize::QuoteHistory::MergeFrom(
+          from._internal_quote_history());
+      break;
+    }
+    case kErrorResponse: {
+      _this->_internal_set_error_response(from._internal_error_response());
+      break;
+    }
+    case kExecutionReport: {
+      _this->_internal_mutable_execution_report()->::Serialize::ExecutionReport::MergeFrom(
+          from._internal_execution_report());
+      break;
+    }
+    case kMarketDepth: {
+      _this->_internal_mutable_market_depth()->::Serialize::MarketDepth::MergeFrom(
+          from._internal_market_depth());
+      break;
+    }
+    case kCandles: {
+      _this->_internal_mutable_candles()->::Serialize::Candles::MergeFrom(
+          from._internal_candles());
+      break;
+    }
+    case kTrades: {
+      _this->_internal_mutable_trades()->::Serialize::Trades::MergeFrom(
+          from._internal_trades());
+      break;
+    }
+    case kCanceledOrdersCount: {
+      _this->_internal_set_canceled_orders_count(from._internal_canceled_orders_count());
+      break;
+    }
+    case REQUESTDATA_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TradeResponse::CopyFrom(const TradeResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.TradeResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TradeResponse::IsInitialized() const {
+  return true;
+}
+
+void TradeResponse::InternalSwap(TradeResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.response_msg_, other->_impl_.response_msg_);
+  swap(_impl_.RequestData_, other->_impl_.RequestData_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TradeResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[9]);
+}
+
+// ===================================================================
+
+class ExecutionReport::_Internal {
+ public:
+};
+
+ExecutionReport::ExecutionReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Serialize.ExecutionReport)
+}
+ExecutionReport::ExecutionReport(const ExecutionReport& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ExecutionReport* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.order_id_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.fill_amount_){}
+    , decltype(_impl_.price_){}
+    , decltype(_impl_.usd_balance_delta_){}
+    , decltype(_impl_.rub_balance_delta_){}
+    , decltype(_impl_.remaining_amount_){}
+    , decltype(_impl_.canceled_amount_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.trade_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.order_id_, &from._impl_.order_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.trade_id_) -
+    reinterpret_cast<char*>(&_impl_.order_id_)) + sizeof(_impl_.trade_id_));
+  // @@protoc_insertion_point(copy_constructor:Serialize.ExecutionReport)
+}
+
+inline void ExecutionReport::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.order_id_){int64_t{0}}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.fill_amount_){0}
+    , decltype(_impl_.price_){0}
+    , decltype(_impl_.usd_balance_delta_){0}
+    , decltype(_impl_.rub_balance_delta_){0}
+    , decltype(_impl_.remaining_amount_){0}
+    , decltype(_impl_.canceled_amount_){0}
+    , decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.trade_id_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ExecutionReport::~ExecutionReport() {
+  // @@protoc_insertion_point(destructor:Serialize.ExecutionReport)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ExecutionReport::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ExecutionReport::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ExecutionReport::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.ExecutionReport)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.order_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.trade_id_) -
+      reinterpret_cast<char*>(&_impl_.order_id_)) + sizeof(_impl_.trade_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ExecutionReport::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 order_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.order_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.TradeOrder.TradeType type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::Serialize::TradeOrder_TradeType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 fill_amount = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.fill_amount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double price = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.price_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 remaining_amount = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.remaining_amount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double usd_balance_delta = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.usd_balance_delta_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double rub_balance_delta = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _impl_.rub_balance_delta_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 timestamp = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 trade_id = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.trade_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 canceled_amount = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.canceled_amount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ExecutionReport::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.ExecutionReport)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 order_id = 1;
+  if (this->_internal_order_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_order_id(), target);
+  }
+
+  // .Serialize.TradeOrder.TradeType type = 2;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
+  }
+
+  // int32 fill_amount = 3;
+  if (this->_internal_fill_amount() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_fill_amount(), target);
+  }
+
+  // double price = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_price = this->_internal_price();
+  uint64_t raw_price;
+  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
+  if (raw_price != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_price(), target);
+  }
+
+  // int32 remaining_amount = 5;
+  if (this->_internal_remaining_amount() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_remaining_amount(), target);
+  }
+
+  // double usd_balance_delta = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_usd_balance_delta = this->_internal_usd_balance_delta();
+  uint64_t raw_usd_balance_delta;
+  memcpy(&raw_usd_balance_delta, &tmp_usd_balance_delta, sizeof(tmp_usd_balance_delta));
+  if (raw_usd_balance_delta != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_usd_balance_delta(), target);
+  }
+
+  // double rub_balance_delta = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rub_balance_delta = this->_internal_rub_balance_delta();
+  uint64_t raw_rub_balance_delta;
+  memcpy(&raw_rub_balance_delta, &tmp_rub_balance_delta, sizeof(tmp_rub_balance_delta));
+  if (raw_rub_balance_delta != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_rub_balance_delta(), target);
+  }
+
+  // int64 timestamp = 8;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_timestamp(), target);
+  }
+
+  // int64 trade_id = 9;
+  if (this->_internal_trade_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(9, this->_internal_trade_id(), target);
+  }
+
+  // int32 canceled_amount = 10;
+  if (this->_internal_canceled_amount() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_canceled_amount(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.ExecutionReport)
+  return target;
+}
+
+size_t ExecutionReport::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.ExecutionReport)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 order_id = 1;
+  if (this->_internal_order_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_order_id());
+  }
+
+  // .Serialize.TradeOrder.TradeType type = 2;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  // int32 fill_amount = 3;
+  if (this->_internal_fill_amount() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_fill_amount());
+  }
+
+  // double price = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_price = this->_internal_price();
+  uint64_t raw_price;
+  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
+  if (raw_price != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double usd_balance_delta = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_usd_balance_delta = this->_internal_usd_balance_delta();
+  uint64_t raw_usd_balance_delta;
+  memcpy(&raw_usd_balance_delta, &tmp_usd_balance_delta, sizeof(tmp_usd_balance_delta));
+  if (raw_usd_balance_delta != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double rub_balance_delta = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rub_balance_delta = this->_internal_rub_balance_delta();
+  uint64_t raw_rub_balance_delta;
+  memcpy(&raw_rub_balance_delta, &tmp_rub_balance_delta, sizeof(tmp_rub_balance_delta));
+  if (raw_rub_balance_delta != 0) {
+    total_size += 1 + 8;
+  }
+
+  // int32 remaining_amount = 5;
+  if (this->_internal_remaining_amount() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_remaining_amount());
+  }
+
+  // int32 canceled_amount = 10;
+  if (this->_internal_canceled_amount() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_canceled_amount());
+  }
+
+  // int64 timestamp = 8;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
+  }
+
+  // int64 trade_id = 9;
+  if (this->_internal_trade_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_trade_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExecutionReport::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ExecutionReport::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExecutionReport::GetClassData() const { return &_class_data_; }
+
+
+void ExecutionReport::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ExecutionReport*>(&to_msg);
+  auto& from = static_cast<const ExecutionReport&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.ExecutionReport)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_order_id() != 0) {
+    _this->_internal_set_order_id(from._internal_order_id());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_fill_amount() != 0) {
+    _this->_internal_set_fill_amount(from._internal_fill_amount());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_price = from._internal_price();
+  uint64_t raw_price;
+  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
+  if (raw_price != 0) {
+    _this->_internal_set_price(from._internal_price());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_usd_balance_delta = from._internal_usd_balance_delta();
+  uint64_t raw_usd_balance_delta;
+  memcpy(&raw_usd_balance_delta, &tmp_usd_balance_delta, sizeof(tmp_usd_balance_delta));
+  if (raw_usd_balance_delta != 0) {
+    _this->_internal_set_usd_balance_delta(from._internal_usd_balance_delta());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rub_balance_delta = from._internal_rub_balance_delta();
+  uint64_t raw_rub_balance_delta;
+  memcpy(&raw_rub_balance_delta, &tmp_rub_balance_delta, sizeof(tmp_rub_balance_delta));
+  if (raw_rub_balance_delta != 0) {
+    _this->_internal_set_rub_balance_delta(from._internal_rub_balance_delta());
+  }
+  if (from._internal_remaining_amount() != 0) {
+    _this->_internal_set_remaining_amount(from._internal_remaining_amount());
+  }
+  if (from._internal_canceled_amount() != 0) {
+    _this->_internal_set_canceled_amount(from._internal_canceled_amount());
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_trade_id() != 0) {
+    _this->_internal_set_trade_id(from._internal_trade_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ExecutionReport::CopyFrom(const ExecutionReport& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.ExecutionReport)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExecutionReport::IsInitialized() const {
+  return true;
+}
+
+void ExecutionReport::InternalSwap(ExecutionReport* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ExecutionReport, _impl_.trade_id_)
+      + sizeof(ExecutionReport::_impl_.trade_id_)
+      - PROTOBUF_FIELD_OFFSET(ExecutionReport, _impl_.order_id_)>(
+          reinterpret_cast<char*>(&_impl_.order_id_),
+          reinterpret_cast<char*>(&other->_impl_.order_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ExecutionReport::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[10]);
+}
+
+// ===================================================================
+
+class Execution::_Internal {
+ public:
+};
+
+Execution::Execution(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Serialize.Execution)
+}
+Execution::Execution(const Execution& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Execution* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.trade_id_){}
+    , decltype(_impl_.price_){}
+    , decltype(_impl_.usd_amount_){}
+    , decltype(_impl_.aggressor_side_){}
+    , decltype(_impl_.maker_order_id_){}
+    , decltype(_impl_.taker_order_id_){}
+    , decltype(_impl_.timestamp_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.trade_id_, &from._impl_.trade_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.timestamp_) -
+    reinterpret_cast<char*>(&_impl_.trade_id_)) + sizeof(_impl_.timestamp_));
+  // @@protoc_insertion_point(copy_constructor:Serialize.Execution)
+}
+
+inline void Execution::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.trade_id_){int64_t{0}}
+    , decltype(_impl_.price_){0}
+    , decltype(_impl_.usd_amount_){0}
+    , decltype(_impl_.aggressor_side_){0}
+    , decltype(_impl_.maker_order_id_){int64_t{0}}
+    , decltype(_impl_.taker_order_id_){int64_t{0}}
+    , decltype(_impl_.timestamp_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Execution::~Execution() {
+  // @@protoc_insertion_point(destructor:Serialize.Execution)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Execution::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Execution::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Execution::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.Execution)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.trade_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.timestamp_) -
+      reinterpret_cast<char*>(&_impl_.trade_id_)) + sizeof(_impl_.timestamp_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Execution::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 trade_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.trade_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double price = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.price_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 usd_amount = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.usd_amount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.TradeOrder.TradeType aggressor_side = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_aggressor_side(static_cast<::Serialize::TradeOrder_TradeType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 maker_order_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.maker_order_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 taker_order_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.taker_order_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 timestamp = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Execution::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.Execution)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 trade_id = 1;
+  if (this->_internal_trade_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_trade_id(), target);
+  }
+
+  // double price = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_price = this->_internal_price();
+  uint64_t raw_price;
+  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
+  if (raw_price != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_price(), target);
+  }
+
+  // int32 usd_amount = 3;
+  if (this->_internal_usd_amount() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_usd_amount(), target);
+  }
+
+  // .Serialize.TradeOrder.TradeType aggressor_side = 4;
+  if (this->_internal_aggressor_side() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_aggressor_side(), target);
+  }
+
+  // int64 maker_order_id = 5;
+  if (this->_internal_maker_order_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_maker_order_id(), target);
+  }
+
+  // int64 taker_order_id = 6;
+  if (this->_internal_taker_order_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_taker_order_id(), target);
+  }
+
+  // int64 timestamp = 7;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_timestamp(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.Execution)
+  return target;
+}
+
+size_t Execution::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.Execution)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 trade_id = 1;
+  if (this->_internal_trade_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_trade_id());
+  }
+
+  // double price = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_price = this->_internal_price();
+  uint64_t raw_price;
+  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
+  if (raw_price != 0) {
+    total_size += 1 + 8;
+  }
+
+  // int32 usd_amount = 3;
+  if (this->_internal_usd_amount() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_usd_amount());
+  }
+
+  // .Serialize.TradeOrder.TradeType aggressor_side = 4;
+  if (this->_internal_aggressor_side() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_aggressor_side());
+  }
+
+  // int64 maker_order_id = 5;
+  if (this->_internal_maker_order_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_maker_order_id());
+  }
+
+  // int64 taker_order_id = 6;
+  if (this->_internal_taker_order_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_taker_order_id());
+  }
+
+  // int64 timestamp = 7;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Execution::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Execution::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Execution::GetClassData() const { return &_class_data_; }
+
+
+void Execution::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Execution*>(&to_msg);
+  auto& from = static_cast<const Execution&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.Execution)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_trade_id() != 0) {
+    _this->_internal_set_trade_id(from._internal_trade_id());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_price = from._internal_price();
+  uint64_t raw_price;
+  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
+  if (raw_price != 0) {
+    _this->_internal_set_price(from._internal_price());
+  }
+  if (from._internal_usd_amount() != 0) {
+    _this->_internal_set_usd_amount(from._internal_usd_amount());
+  }
+  if (from._internal_aggressor_side() != 0) {
+    _this->_internal_set_aggressor_side(from._internal_aggressor_side());
+  }
+  if (from._internal_maker_order_id() != 0) {
+    _this->_internal_set_maker_order_id(from._internal_maker_order_id());
+  }
+  if (from._internal_taker_order_id() != 0) {
+    _this->_internal_set_taker_order_id(from._internal_taker_order_id());
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Execution::CopyFrom(const Execution& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.Execution)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Execution::IsInitialized() const {
+  return true;
+}
+
+void Execution::InternalSwap(Execution* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Execution, _impl_.timestamp_)
+      + sizeof(Execution::_impl_.timestamp_)
+      - PROTOBUF_FIELD_OFFSET(Execution, _impl_.trade_id_)>(
+          reinterpret_cast<char*>(&_impl_.trade_id_),
+          reinterpret_cast<char*>(&other->_impl_.trade_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Execution::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[11]);
+}
+
+// ===================================================================
+
+class Trades::_Internal {
+ public:
+};
+
+Trades::Trades(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Serialize.Trades)
+}
+Trades::Trades(const Trades& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Trades* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.executions_){from._impl_.executions_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:Serialize.Trades)
+}
+
+inline void Trades::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.executions_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Trades::~Trades() {
+  // @@protoc_insertion_point(destructor:Serialize.Trades)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Trades::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.executions_.~RepeatedPtrField();
+}
+
+void Trades::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Trades::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.Trades)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.executions_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Trades::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .Serialize.Execution executions = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_executions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Trades::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.Trades)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .Serialize.Execution executions = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_executions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_executions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.Trades)
+  return target;
+}
+
+size_t Trades::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.Trades)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Serialize.Execution executions = 1;
+  total_size += 1UL * this->_internal_executions_size();
+  for (const auto& msg : this->_impl_.executions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Trades::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Trades::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Trades::GetClassData() const { return &_class_data_; }
+
+
+void Trades::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Trades*>(&to_msg);
+  auto& from = static_cast<const Trades&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.Trades)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.executions_.MergeFrom(from._impl_.executions_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Trades::CopyFrom(const Trades& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.Trades)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Trades::IsInitialized() const {
+  return true;
+}
+
+void Trades::InternalSwap(Trades* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.executions_.InternalSwap(&other->_impl_.executions_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Trades::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[12]);
+}
+
+// ===================================================================
+
+class ClientBalance::_Internal {
+ public:
+  static const ::Serialize::AccountBalance& funds(const ClientBalance* msg);
+};
+
+const ::Serialize::AccountBalance&
+ClientBalance::_Internal::funds(const ClientBalance* msg) {
+  return *msg->_impl_.funds_;
+}
+ClientBalance::ClientBalance(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Serialize.ClientBalance)
+}
+ClientBalance::ClientBalance(const ClientBalance& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClientBalance* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.funds_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_funds()) {
+    _this->_impl_.funds_ = new ::Serialize::AccountBalance(*from._impl_.funds_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Serialize.ClientBalance)
+}
+
+inline void ClientBalance::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.funds_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ClientBalance::~ClientBalance() {
+  // @@protoc_insertion_point(destructor:Serialize.ClientBalance)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ClientBalance::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.funds_;
+}
+
+void ClientBalance::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ClientBalance::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.ClientBalance)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.username_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.funds_ != nullptr) {
+    delete _impl_.funds_;
+  }
+  _impl_.funds_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClientBalance::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string username = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Serialize.ClientBalance.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .Serialize.AccountBalance funds = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_funds(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ClientBalance::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.ClientBalance)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Serialize.ClientBalance.username");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
+  }
+
+  // .Serialize.AccountBalance funds = 2;
+  if (this->_internal_has_funds()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::funds(this),
+        _Internal::funds(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.ClientBalance)
+  return target;
+}
+
+size_t ClientBalance::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.ClientBalance)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // .Serialize.AccountBalance funds = 2;
+  if (this->_internal_has_funds()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.funds_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientBalance::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClientBalance::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientBalance::GetClassData() const { return &_class_data_; }
+
+
+void ClientBalance::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClientBalance*>(&to_msg);
+  auto& from = static_cast<const ClientBalance&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.ClientBalance)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (from._internal_has_funds()) {
+    _this->_internal_mutable_funds()->::Serialize::AccountBalance::MergeFrom(
+        from._internal_funds());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClientBalance::CopyFrom(const ClientBalance& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.ClientBalance)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClientBalance::IsInitialized() const {
+  return true;
+}
+
+void ClientBalance::InternalSwap(ClientBalance* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  swap(_impl_.funds_, other->_impl_.funds_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClientBalance::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[13]);
+}
+
+// ===================================================================
+
+class AccountBalance::_Internal {
+ public:
+};
+
+AccountBalance::AccountBalance(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Serialize.AccountBalance)
+}
+AccountBalance::AccountBalance(const AccountBalance& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AccountBalance* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.usd_balance_){}
+    , decltype(_impl_.rub_balance_){}
+    , decltype(_impl_.usd_reserved_){}
+    , decltype(_impl_.rub_reserved_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.usd_balance_, &from._impl_.usd_balance_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.rub_reserved_) -
+    reinterpret_cast<char*>(&_impl_.usd_balance_)) + sizeof(_impl_.rub_reserved_));
+  // @@protoc_insertion_point(copy_constructor:Serialize.AccountBalance)
+}
+
+inline void AccountBalance::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.usd_balance_){0}
+    , decltype(_impl_.rub_balance_){0}
+    , decltype(_impl_.usd_reserved_){0}
+    , decltype(_impl_.rub_reserved_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+AccountBalance::~AccountBalance() {
+  // @@protoc_insertion_point(destructor:Serialize.AccountBalance)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AccountBalance::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void AccountBalance::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AccountBalance::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.AccountBalance)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.usd_balance_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.rub_reserved_) -
+      reinterpret_cast<char*>(&_impl_.usd_balance_)) + sizeof(_impl_.rub_reserved_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AccountBalance::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double usd_balance = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.usd_balance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double rub_balance = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.rub_balance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double usd_reserved = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.usd_reserved_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double rub_reserved = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.rub_reserved_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AccountBalance::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.AccountBalance)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double usd_balance = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_usd_balance = this->_internal_usd_balance();
+  uint64_t raw_usd_balance;
+  memcpy(&raw_usd_balance, &tmp_usd_balance, sizeof(tmp_usd_balance));
+  if (raw_usd_balance != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_usd_balance(), target);
+  }
+
+  // double rub_balance = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rub_balance = this->_internal_rub_balance();
+  uint64_t raw_rub_balance;
+  memcpy(&raw_rub_balance, &tmp_rub_balance, sizeof(tmp_rub_balance));
+  if (raw_rub_balance != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_rub_balance(), target);
+  }
+
+  // double usd_reserved = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_usd_reserved = this->_internal_usd_reserved();
+  uint64_t raw_usd_reserved;
+  memcpy(&raw_usd_reserved, &tmp_usd_reserved, sizeof(tmp_usd_reserved));
+  if (raw_usd_reserved != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_usd_reserved(), target);
+  }
+
+  // double rub_reserved = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rub_reserved = this->_internal_rub_reserved();
+  uint64_t raw_rub_reserved;
+  memcpy(&raw_rub_reserved, &tmp_rub_reserved, sizeof(tmp_rub_reserved));
+  if (raw_rub_reserved != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_rub_reserved(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.AccountBalance)
+  return target;
+}
+
+size_t AccountBalance::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.AccountBalance)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double usd_balance = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_usd_balance = this->_internal_usd_balance();
+  uint64_t raw_usd_balance;
+  memcpy(&raw_usd_balance, &tmp_usd_balance, sizeof(tmp_usd_balance));
+  if (raw_usd_balance != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double rub_balance = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rub_balance = this->_internal_rub_balance();
+  uint64_t raw_rub_balance;
+  memcpy(&raw_rub_balance, &tmp_rub_balance, sizeof(tmp_rub_balance));
+  if (raw_rub_balance != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double usd_reserved = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_usd_reserved = this->_internal_usd_reserved();
+  uint64_t raw_usd_reserved;
+  memcpy(&raw_usd_reserved, &tmp_usd_reserved, sizeof(tmp_usd_reserved));
+  if (raw_usd_reserved != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double rub_reserved = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rub_reserved = this->_internal_rub_reserved();
+  uint64_t raw_rub_reserved;
+  memcpy(&raw_rub_reserved, &tmp_rub_reserved, sizeof(tmp_rub_reserved));
+  if (raw_rub_reserved != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AccountBalance::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AccountBalance::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AccountBalance::GetClassData() const { return &_class_data_; }
+
+
+void AccountBalance::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AccountBalance*>(&to_msg);
+  auto& from = static_cast<const AccountBalance&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.AccountBalance)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_usd_balance = from._internal_usd_balance();
+  uint64_t raw_usd_balance;
+  memcpy(&raw_usd_balance, &tmp_usd_balance, sizeof(tmp_usd_balance));
+  if (raw_usd_balance != 0) {
+    _this->_internal_set_usd_balance(from._internal_usd_balance());
   }
-  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.account_balance)
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rub_balance = from._internal_rub_balance();
+  uint64_t raw_rub_balance;
+  memcpy(&raw_rub_balance, &tmp_rub_balance, sizeof(tmp_rub_balance));
+  if (raw_rub_balance != 0) {
+    _this->_internal_set_rub_balance(from._internal_rub_balance());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_usd_reserved = from._internal_usd_reserved();
+  uint64_t raw_usd_reserved;
+  memcpy(&raw_usd_reserved, &tmp_usd_reserved, sizeof(tmp_usd_reserved));
+  if (raw_usd_reserved != 0) {
+    _this->_internal_set_usd_reserved(from._internal_usd_reserved());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rub_reserved = from._internal_rub_reserved();
+  uint64_t raw_rub_reserved;
+  memcpy(&raw_rub_reserved, &tmp_rub_reserved, sizeof(tmp_rub_reserved));
+  if (raw_rub_reserved != 0) {
+    _this->_internal_set_rub_reserved(from._internal_rub_reserved());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-void TradeResponse::set_allocated_active_orders(::Serialize::ActiveOrders* active_orders) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  clear_RequestData();
-  if (active_orders) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(active_orders);
-    if (message_arena != submessage_arena) {
-      active_orders = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, active_orders, submessage_arena);
+
+void AccountBalance::CopyFrom(const AccountBalance& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.AccountBalance)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AccountBalance::IsInitialized() const {
+  return true;
+}
+
+void AccountBalance::InternalSwap(AccountBalance* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AccountBalance, _impl_.rub_reserved_)
+      + sizeof(AccountBalance::_impl_.rub_reserved_)
+      - PROTOBUF_FIELD_OFFSET(AccountBalance, _impl_.usd_balance_)>(
+          reinterpret_cast<char*>(&_impl_.usd_balance_),
+          reinterpret_cast<char*>(&other->_impl_.usd_balance_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AccountBalance::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[14]);
+}
+
+// ===================================================================
+
+class ActiveOrders::_Internal {
+ public:
+};
+
+ActiveOrders::ActiveOrders(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Serialize.ActiveOrders)
+}
+ActiveOrders::ActiveOrders(const ActiveOrders& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ActiveOrders* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.active_buy_orders_){from._impl_.active_buy_orders_}
+    , decltype(_impl_.active_sell_orders_){from._impl_.active_sell_orders_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:Serialize.ActiveOrders)
+}
+
+inline void ActiveOrders::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.active_buy_orders_){arena}
+    , decltype(_impl_.active_sell_orders_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ActiveOrders::~ActiveOrders() {
+  // @@protoc_insertion_point(destructor:Serialize.ActiveOrders)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ActiveOrders::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.active_buy_orders_.~RepeatedPtrField();
+  _impl_.active_sell_orders_.~RepeatedPtrField();
+}
+
+void ActiveOrders::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ActiveOrders::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.ActiveOrders)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.active_buy_orders_.Clear();
+  _impl_.active_sell_orders_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ActiveOrders::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .Serialize.TradeOrder active_buy_orders = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_active_buy_orders(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .Serialize.TradeOrder active_sell_orders = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_active_sell_orders(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-    set_has_active_orders();
-    _impl_.RequestData_.active_orders_ = active_orders;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ActiveOrders::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.ActiveOrders)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .Serialize.TradeOrder active_buy_orders = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_active_buy_orders_size()); i < n; i++) {
+    const auto& repfield = this->_internal_active_buy_orders(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .Serialize.TradeOrder active_sell_orders = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_active_sell_orders_size()); i < n; i++) {
+    const auto& repfield = this->_internal_active_sell_orders(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.ActiveOrders)
+  return target;
+}
+
+size_t ActiveOrders::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.ActiveOrders)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Serialize.TradeOrder active_buy_orders = 1;
+  total_size += 1UL * this->_internal_active_buy_orders_size();
+  for (const auto& msg : this->_impl_.active_buy_orders_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .Serialize.TradeOrder active_sell_orders = 2;
+  total_size += 1UL * this->_internal_active_sell_orders_size();
+  for (const auto& msg : this->_impl_.active_sell_orders_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.active_orders)
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
-void TradeResponse::set_allocated_completed_orders(::Serialize::CompletedOredrs* completed_orders) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  clear_RequestData();
-  if (completed_orders) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(completed_orders);
-    if (message_arena != submessage_arena) {
-      completed_orders = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, completed_orders, submessage_arena);
-    }
-    set_has_completed_orders();
-    _impl_.RequestData_.completed_orders_ = completed_orders;
-  }
-  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.completed_orders)
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ActiveOrders::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ActiveOrders::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ActiveOrders::GetClassData() const { return &_class_data_; }
+
+
+void ActiveOrders::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ActiveOrders*>(&to_msg);
+  auto& from = static_cast<const ActiveOrders&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.ActiveOrders)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.active_buy_orders_.MergeFrom(from._impl_.active_buy_orders_);
+  _this->_impl_.active_sell_orders_.MergeFrom(from._impl_.active_sell_orders_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-void TradeResponse::set_allocated_quote_history(::Serialize::QuoteHistory* quote_history) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  clear_RequestData();
-  if (quote_history) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(quote_history);
-    if (message_arena != submessage_arena) {
-      quote_history = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, quote_history, submessage_arena);
-    }
-    set_has_quote_history();
-    _impl_.RequestData_.quote_history_ = quote_history;
-  }
-  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.quote_history)
+
+void ActiveOrders::CopyFrom(const ActiveOrders& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.ActiveOrders)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-TradeResponse::TradeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+
+bool ActiveOrders::IsInitialized() const {
+  return true;
+}
+
+void ActiveOrders::InternalSwap(ActiveOrders* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.active_buy_orders_.InternalSwap(&other->_impl_.active_buy_orders_);
+  _impl_.active_sell_orders_.InternalSwap(&other->_impl_.active_sell_orders_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ActiveOrders::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[15]);
+}
+
+// ===================================================================
+
+class CompletedOredrs::_Internal {
+ public:
+};
+
+CompletedOredrs::CompletedOredrs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:Serialize.TradeResponse)
+  // @@protoc_insertion_point(arena_constructor:Serialize.CompletedOredrs)
 }
-TradeResponse::TradeResponse(const TradeResponse& from)
+CompletedOredrs::CompletedOredrs(const CompletedOredrs& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  TradeResponse* const _this = this; (void)_this;
+  CompletedOredrs* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.response_msg_){}
-    , decltype(_impl_.RequestData_){}
-    , /*decltype(_impl_._cached_size_)*/{}
-    , /*decltype(_impl_._oneof_case_)*/{}};
+      decltype(_impl_.completed_buy_orders_){from._impl_.completed_buy_orders_}
+    , decltype(_impl_.completed_sell_orders_){from._impl_.completed_sell_orders_}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.response_msg_ = from._impl_.response_msg_;
-  clear_has_RequestData();
-  switch (from.RequestData_case()) {
-    case kJwt: {
-      _this->_internal_set_jwt(from._internal_jwt());
-      break;
-    }
-    case kAccountBalance: {
-      _this->_internal_mutable_account_balance()->::Serialize::AccountBalance::MergeFrom(
-          from._internal_account_balance());
-      break;
-    }
-    case kActiveOrders: {
-      _this->_internal_mutable_active_orders()->::Serialize::ActiveOrders::MergeFrom(
-          from._internal_active_orders());
-      break;
-    }
-    case kCompletedOrders: {
-      _this->_internal_mutable_completed_orders()->::Serialize::CompletedOredrs::MergeFrom(
-          from._internal_completed_orders());
-      break;
-    }
-    case kQuoteHistory: {
-      _this->_internal_mutable_quote_history()->::Serialize::QuoteHistory::MergeFrom(
-          from._internal_quote_history());
-      break;
-    }
-    case kErrorResponse: {
-      _this->_internal_set_error_response(from._internal_error_response());
-      break;
-    }
-    case REQUESTDATA_NOT_SET: {
-      break;
-    }
-  }
-  // @@protoc_insertion_point(copy_constructor:Serialize.TradeResponse)
+  // @@protoc_insertion_point(copy_constructor:Serialize.CompletedOredrs)
 }
 
-inline void TradeResponse::SharedCtor(
+inline void CompletedOredrs::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.response_msg_){0}
-    , decltype(_impl_.RequestData_){}
+      decltype(_impl_.completed_buy_orders_){arena}
+    , decltype(_impl_.completed_sell_orders_){arena}
     , /*decltype(_impl_._cached_size_)*/{}
-    , /*decltype(_impl_._oneof_case_)*/{}
   };
-  clear_has_RequestData();
 }
 
-TradeResponse::~TradeResponse() {
-  // @@protoc_insertion_point(destructor:Serialize.TradeResponse)
+CompletedOredrs::~CompletedOredrs() {
+  // @@protoc_insertion_point(destructor:Serialize.CompletedOredrs)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2349,135 +6599,56 @@ TradeResponse::~TradeResponse() {
   SharedDtor();
 }
 
-inline void TradeResponse::SharedDtor() {
+inline void CompletedOredrs::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (has_RequestData()) {
-    clear_RequestData();
-  }
+  _impl_.completed_buy_orders_.~RepeatedPtrField();
+  _impl_.completed_sell_orders_.~RepeatedPtrField();
 }
 
-void TradeResponse::SetCachedSize(int size) const {
+void CompletedOredrs::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void TradeResponse::clear_RequestData() {
-// @@protoc_insertion_point(one_of_clear_start:Serialize.TradeResponse)
-  switch (RequestData_case()) {
-    case kJwt: {
-      _impl_.RequestData_.jwt_.Destroy();
-      break;
-    }
-    case kAccountBalance: {
-      if (GetArenaForAllocation() == nullptr) {
-        delete _impl_.RequestData_.account_balance_;
-      }
-      break;
-    }
-    case kActiveOrders: {
-      if (GetArenaForAllocation() == nullptr) {
-        delete _impl_.RequestData_.active_orders_;
-      }
-      break;
-    }
-    case kCompletedOrders: {
-      if (GetArenaForAllocation() == nullptr) {
-        delete _impl_.RequestData_.completed_orders_;
-      }
-      break;
-    }
-    case kQuoteHistory: {
-      if (GetArenaForAllocation() == nullptr) {
-        delete _impl_.RequestData_.quote_history_;
-      }
-      break;
-    }
-    case kErrorResponse: {
-      _impl_.RequestData_.error_response_.Destroy();
-      break;
-    }
-    case REQUESTDATA_NOT_SET: {
-      break;
-    }
-  }
-  _impl_._oneof_case_[0] = REQUESTDATA_NOT_SET;
-}
-
-
-void TradeResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:Serialize.TradeResponse)
+void CompletedOredrs::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.CompletedOredrs)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.response_msg_ = 0;
-  clear_RequestData();
+  _impl_.completed_buy_orders_.Clear();
+  _impl_.completed_sell_orders_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TradeResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CompletedOredrs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .Serialize.TradeResponse.status response_msg = 1;
+      // repeated .Serialize.TradeOrder completed_buy_orders = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-          _internal_set_response_msg(static_cast<::Serialize::TradeResponse_status>(val));
-        } else
-          goto handle_unusual;
-        continue;
-      // string jwt = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_jwt();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "Serialize.TradeResponse.jwt"));
-        } else
-          goto handle_unusual;
-        continue;
-      // .Serialize.AccountBalance account_balance = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_account_balance(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .Serialize.ActiveOrders active_orders = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_active_orders(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .Serialize.CompletedOredrs completed_orders = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          ptr = ctx->ParseMessage(_internal_mutable_completed_orders(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .Serialize.QuoteHistory quote_history = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
-          ptr = ctx->ParseMessage(_internal_mutable_quote_history(), ptr);
-          CHK_(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_completed_buy_orders(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // string error_response = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
-          auto str = _internal_mutable_error_response();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "Serialize.TradeResponse.error_response"));
+      // repeated .Serialize.TradeOrder completed_sell_orders = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_completed_sell_orders(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -2504,275 +6675,140 @@ failure:
 #undef CHK_
 }
 
-uint8_t* TradeResponse::_InternalSerialize(
+uint8_t* CompletedOredrs::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Serialize.TradeResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.CompletedOredrs)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .Serialize.TradeResponse.status response_msg = 1;
-  if (this->_internal_response_msg() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_response_msg(), target);
-  }
-
-  // string jwt = 2;
-  if (_internal_has_jwt()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_jwt().data(), static_cast<int>(this->_internal_jwt().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "Serialize.TradeResponse.jwt");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_jwt(), target);
-  }
-
-  // .Serialize.AccountBalance account_balance = 3;
-  if (_internal_has_account_balance()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(3, _Internal::account_balance(this),
-        _Internal::account_balance(this).GetCachedSize(), target, stream);
-  }
-
-  // .Serialize.ActiveOrders active_orders = 4;
-  if (_internal_has_active_orders()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(4, _Internal::active_orders(this),
-        _Internal::active_orders(this).GetCachedSize(), target, stream);
-  }
-
-  // .Serialize.CompletedOredrs completed_orders = 5;
-  if (_internal_has_completed_orders()) {
+  // repeated .Serialize.TradeOrder completed_buy_orders = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_completed_buy_orders_size()); i < n; i++) {
+    const auto& repfield = this->_internal_completed_buy_orders(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, _Internal::completed_orders(this),
-        _Internal::completed_orders(this).GetCachedSize(), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // .Serialize.QuoteHistory quote_history = 6;
-  if (_internal_has_quote_history()) {
+  // repeated .Serialize.TradeOrder completed_sell_orders = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_completed_sell_orders_size()); i < n; i++) {
+    const auto& repfield = this->_internal_completed_sell_orders(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(6, _Internal::quote_history(this),
-        _Internal::quote_history(this).GetCachedSize(), target, stream);
-  }
-
-  // string error_response = 7;
-  if (_internal_has_error_response()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_error_response().data(), static_cast<int>(this->_internal_error_response().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "Serialize.TradeResponse.error_response");
-    target = stream->WriteStringMaybeAliased(
-        7, this->_internal_error_response(), target);
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Serialize.TradeResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.CompletedOredrs)
   return target;
 }
 
-size_t TradeResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Serialize.TradeResponse)
+size_t CompletedOredrs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.CompletedOredrs)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .Serialize.TradeResponse.status response_msg = 1;
-  if (this->_internal_response_msg() != 0) {
-    total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_response_msg());
+  // repeated .Serialize.TradeOrder completed_buy_orders = 1;
+  total_size += 1UL * this->_internal_completed_buy_orders_size();
+  for (const auto& msg : this->_impl_.completed_buy_orders_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  switch (RequestData_case()) {
-    // string jwt = 2;
-    case kJwt: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-          this->_internal_jwt());
-      break;
-    }
-    // .Serialize.AccountBalance account_balance = 3;
-    case kAccountBalance: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *_impl_.RequestData_.account_balance_);
-      break;
-    }
-    // .Serialize.ActiveOrders active_orders = 4;
-    case kActiveOrders: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *_impl_.RequestData_.active_orders_);
-      break;
-    }
-    // .Serialize.CompletedOredrs completed_orders = 5;
-    case kCompletedOrders: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *_impl_.RequestData_.completed_orders_);
-      break;
-    }
-    // .Serialize.QuoteHistory quote_history = 6;
-    case kQuoteHistory: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *_impl_.RequestData_.quote_history_);
-      break;
-    }
-    // string error_response = 7;
-    case kErrorResponse: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-          this->_internal_error_response());
-      break;
-    }
-    case REQUESTDATA_NOT_SET: {
-      break;
-    }
+  // repeated .Serialize.TradeOrder completed_sell_orders = 2;
+  total_size += 1UL * this->_internal_completed_sell_orders_size();
+  for (const auto& msg : this->_impl_.completed_sell_orders_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TradeResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CompletedOredrs::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    TradeResponse::MergeImpl
+    CompletedOredrs::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TradeResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CompletedOredrs::GetClassData() const { return &_class_data_; }
 
 
-void TradeResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<TradeResponse*>(&to_msg);
-  auto& from = static_cast<const TradeResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.TradeResponse)
+void CompletedOredrs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CompletedOredrs*>(&to_msg);
+  auto& from = static_cast<const CompletedOredrs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.CompletedOredrs)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_response_msg() != 0) {
-    _this->_internal_set_response_msg(from._internal_response_msg());
-  }
-  switch (from.RequestData_case()) {
-    case kJwt: {
-      _this->_internal_set_jwt(from._internal_jwt());
-      break;
-    }
-    case kAccountBalance: {
-      _this->_internal_mutable_account_balance()->::Serialize::AccountBalance::MergeFrom(
-          from._internal_account_balance());
-      break;
-    }
-    case kActiveOrders: {
-      _this->_internal_mutable_active_orders()->::Serialize::ActiveOrders::MergeFrom(
-          from._internal_active_orders());
-      break;
-    }
-    case kCompletedOrders: {
-      _this->_internal_mutable_completed_orders()->::Serialize::CompletedOredrs::MergeFrom(
-          from._internal_completed_orders());
-      break;
-    }
-    case kQuoteHistory: {
-      _this->_internal_mutable_quote_history()->::Serialize::QuoteHistory::MergeFrom(
-          from._internal_quote_history());
-      break;
-    }
-    case kErrorResponse: {
-      _this->_internal_set_error_response(from._internal_error_response());
-      break;
-    }
-    case REQUESTDATA_NOT_SET: {
-      break;
-    }
-  }
+  _this->_impl_.completed_buy_orders_.MergeFrom(from._impl_.completed_buy_orders_);
+  _this->_impl_.completed_sell_orders_.MergeFrom(from._impl_.completed_sell_orders_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void TradeResponse::CopyFrom(const TradeResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.TradeResponse)
+void CompletedOredrs::CopyFrom(const CompletedOredrs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.CompletedOredrs)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TradeResponse::IsInitialized() const {
+bool CompletedOredrs::IsInitialized() const {
   return true;
 }
 
-void TradeResponse::InternalSwap(TradeResponse* other) {
+void CompletedOredrs::InternalSwap(CompletedOredrs* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.response_msg_, other->_impl_.response_msg_);
-  swap(_impl_.RequestData_, other->_impl_.RequestData_);
-  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+  _impl_.completed_buy_orders_.InternalSwap(&other->_impl_.completed_buy_orders_);
+  _impl_.completed_sell_orders_.InternalSwap(&other->_impl_.completed_sell_orders_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TradeResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata CompletedOredrs::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
-      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[5]);
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[16]);
 }
 
 // ===================================================================
 
-class ClientBalance::_Internal {
+class QuoteHistory::_Internal {
  public:
-  static const ::Serialize::AccountBalance& funds(const ClientBalance* msg);
 };
 
-const ::Serialize::AccountBalance&
-ClientBalance::_Internal::funds(const ClientBalance* msg) {
-  return *msg->_impl_.funds_;
-}
-ClientBalance::ClientBalance(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+QuoteHistory::QuoteHistory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:Serialize.ClientBalance)
+  // @@protoc_insertion_point(arena_constructor:Serialize.QuoteHistory)
 }
-ClientBalance::ClientBalance(const ClientBalance& from)
+QuoteHistory::QuoteHistory(const QuoteHistory& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ClientBalance* const _this = this; (void)_this;
+  QuoteHistory* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.username_){}
-    , decltype(_impl_.funds_){nullptr}
+      decltype(_impl_.quotes_){from._impl_.quotes_}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.username_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.username_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_username().empty()) {
-    _this->_impl_.username_.Set(from._internal_username(), 
-      _this->GetArenaForAllocation());
-  }
-  if (from._internal_has_funds()) {
-    _this->_impl_.funds_ = new ::Serialize::AccountBalance(*from._impl_.funds_);
-  }
-  // @@protoc_insertion_point(copy_constructor:Serialize.ClientBalance)
+  // @@protoc_insertion_point(copy_constructor:Serialize.QuoteHistory)
 }
 
-inline void ClientBalance::SharedCtor(
+inline void QuoteHistory::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
-  new (&_impl_) Impl_{
-      decltype(_impl_.username_){}
-    , decltype(_impl_.funds_){nullptr}
+  new (&_impl_) Impl_{
+      decltype(_impl_.quotes_){arena}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.username_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.username_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-ClientBalance::~ClientBalance() {
-  // @@protoc_insertion_point(destructor:Serialize.ClientBalance)
+QuoteHistory::~QuoteHistory() {
+  // @@protoc_insertion_point(destructor:Serialize.QuoteHistory)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2780,51 +6816,41 @@ ClientBalance::~ClientBalance() {
   SharedDtor();
 }
 
-inline void ClientBalance::SharedDtor() {
+inline void QuoteHistory::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.username_.Destroy();
-  if (this != internal_default_instance()) delete _impl_.funds_;
+  _impl_.quotes_.~RepeatedPtrField();
 }
 
-void ClientBalance::SetCachedSize(int size) const {
+void QuoteHistory::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ClientBalance::Clear() {
-// @@protoc_insertion_point(message_clear_start:Serialize.ClientBalance)
+void QuoteHistory::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.QuoteHistory)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.username_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && _impl_.funds_ != nullptr) {
-    delete _impl_.funds_;
-  }
-  _impl_.funds_ = nullptr;
+  _impl_.quotes_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ClientBalance::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* QuoteHistory::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string username = 1;
+      // repeated .Serialize.Quote quotes = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_username();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "Serialize.ClientBalance.username"));
-        } else
-          goto handle_unusual;
-        continue;
-      // .Serialize.AccountBalance funds = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_funds(), ptr);
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_quotes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -2851,156 +6877,128 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ClientBalance::_InternalSerialize(
+uint8_t* QuoteHistory::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Serialize.ClientBalance)
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.QuoteHistory)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string username = 1;
-  if (!this->_internal_username().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "Serialize.ClientBalance.username");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_username(), target);
-  }
-
-  // .Serialize.AccountBalance funds = 2;
-  if (this->_internal_has_funds()) {
+  // repeated .Serialize.Quote quotes = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_quotes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_quotes(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::funds(this),
-        _Internal::funds(this).GetCachedSize(), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Serialize.ClientBalance)
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.QuoteHistory)
   return target;
 }
 
-size_t ClientBalance::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Serialize.ClientBalance)
+size_t QuoteHistory::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.QuoteHistory)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string username = 1;
-  if (!this->_internal_username().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_username());
-  }
-
-  // .Serialize.AccountBalance funds = 2;
-  if (this->_internal_has_funds()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.funds_);
+  // repeated .Serialize.Quote quotes = 1;
+  total_size += 1UL * this->_internal_quotes_size();
+  for (const auto& msg : this->_impl_.quotes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientBalance::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QuoteHistory::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ClientBalance::MergeImpl
+    QuoteHistory::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientBalance::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QuoteHistory::GetClassData() const { return &_class_data_; }
 
 
-void ClientBalance::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ClientBalance*>(&to_msg);
-  auto& from = static_cast<const ClientBalance&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.ClientBalance)
+void QuoteHistory::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QuoteHistory*>(&to_msg);
+  auto& from = static_cast<const QuoteHistory&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.QuoteHistory)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_username().empty()) {
-    _this->_internal_set_username(from._internal_username());
-  }
-  if (from._internal_has_funds()) {
-    _this->_internal_mutable_funds()->::Serialize::AccountBalance::MergeFrom(
-        from._internal_funds());
-  }
+  _this->_impl_.quotes_.MergeFrom(from._impl_.quotes_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ClientBalance::CopyFrom(const ClientBalance& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.ClientBalance)
+void QuoteHistory::CopyFrom(const QuoteHistory& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.QuoteHistory)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ClientBalance::IsInitialized() const {
+bool QuoteHistory::IsInitialized() const {
   return true;
 }
 
-void ClientBalance::InternalSwap(ClientBalance* other) {
+void QuoteHistory::InternalSwap(QuoteHistory* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.username_, lhs_arena,
-      &other->_impl_.username_, rhs_arena
-  );
-  swap(_impl_.funds_, other->_impl_.funds_);
+  _impl_.quotes_.InternalSwap(&other->_impl_.quotes_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ClientBalance::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata QuoteHistory::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
-      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[6]);
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[17]);
 }
 
 // ===================================================================
 
-class AccountBalance::_Internal {
+class Quote::_Internal {
  public:
 };
 
-AccountBalance::AccountBalance(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+Quote::Quote(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:Serialize.AccountBalance)
+  // @@protoc_insertion_point(arena_constructor:Serialize.Quote)
 }
-AccountBalance::AccountBalance(const AccountBalance& from)
+Quote::Quote(const Quote& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  AccountBalance* const _this = this; (void)_this;
+  Quote* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.usd_balance_){}
-    , decltype(_impl_.rub_balance_){}
+      decltype(_impl_.timestamp_){}
+    , decltype(_impl_.price_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.usd_balance_, &from._impl_.usd_balance_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.rub_balance_) -
-    reinterpret_cast<char*>(&_impl_.usd_balance_)) + sizeof(_impl_.rub_balance_));
-  // @@protoc_insertion_point(copy_constructor:Serialize.AccountBalance)
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.price_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.price_));
+  // @@protoc_insertion_point(copy_constructor:Serialize.Quote)
 }
 
-inline void AccountBalance::SharedCtor(
+inline void Quote::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.usd_balance_){0}
-    , decltype(_impl_.rub_balance_){0}
+      decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.price_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-AccountBalance::~AccountBalance() {
-  // @@protoc_insertion_point(destructor:Serialize.AccountBalance)
+Quote::~Quote() {
+  // @@protoc_insertion_point(destructor:Serialize.Quote)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3008,44 +7006,44 @@ AccountBalance::~AccountBalance() {
   SharedDtor();
 }
 
-inline void AccountBalance::SharedDtor() {
+inline void Quote::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void AccountBalance::SetCachedSize(int size) const {
+void Quote::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void AccountBalance::Clear() {
-// @@protoc_insertion_point(message_clear_start:Serialize.AccountBalance)
+void Quote::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.Quote)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.usd_balance_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.rub_balance_) -
-      reinterpret_cast<char*>(&_impl_.usd_balance_)) + sizeof(_impl_.rub_balance_));
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.price_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.price_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* AccountBalance::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* Quote::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // double usd_balance = 1;
+      // int64 timestamp = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
-          _impl_.usd_balance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // double rub_balance = 2;
+      // double price = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
-          _impl_.rub_balance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.price_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -3073,166 +7071,159 @@ failure:
 #undef CHK_
 }
 
-uint8_t* AccountBalance::_InternalSerialize(
+uint8_t* Quote::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Serialize.AccountBalance)
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.Quote)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // double usd_balance = 1;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_usd_balance = this->_internal_usd_balance();
-  uint64_t raw_usd_balance;
-  memcpy(&raw_usd_balance, &tmp_usd_balance, sizeof(tmp_usd_balance));
-  if (raw_usd_balance != 0) {
+  // int64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_usd_balance(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_timestamp(), target);
   }
 
-  // double rub_balance = 2;
+  // double price = 2;
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_rub_balance = this->_internal_rub_balance();
-  uint64_t raw_rub_balance;
-  memcpy(&raw_rub_balance, &tmp_rub_balance, sizeof(tmp_rub_balance));
-  if (raw_rub_balance != 0) {
+  double tmp_price = this->_internal_price();
+  uint64_t raw_price;
+  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
+  if (raw_price != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_rub_balance(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_price(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Serialize.AccountBalance)
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.Quote)
   return target;
 }
 
-size_t AccountBalance::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Serialize.AccountBalance)
+size_t Quote::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.Quote)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // double usd_balance = 1;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_usd_balance = this->_internal_usd_balance();
-  uint64_t raw_usd_balance;
-  memcpy(&raw_usd_balance, &tmp_usd_balance, sizeof(tmp_usd_balance));
-  if (raw_usd_balance != 0) {
-    total_size += 1 + 8;
+  // int64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
   }
 
-  // double rub_balance = 2;
+  // double price = 2;
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_rub_balance = this->_internal_rub_balance();
-  uint64_t raw_rub_balance;
-  memcpy(&raw_rub_balance, &tmp_rub_balance, sizeof(tmp_rub_balance));
-  if (raw_rub_balance != 0) {
+  double tmp_price = this->_internal_price();
+  uint64_t raw_price;
+  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
+  if (raw_price != 0) {
     total_size += 1 + 8;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AccountBalance::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Quote::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    AccountBalance::MergeImpl
+    Quote::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AccountBalance::GetClassData() const { return &_class_data_; }
-
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Quote::GetClassData() const { return &_class_data_; }
 
-void AccountBalance::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<AccountBalance*>(&to_msg);
-  auto& from = static_cast<const AccountBalance&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.AccountBalance)
+
+void Quote::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Quote*>(&to_msg);
+  auto& from = static_cast<const Quote&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.Quote)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_usd_balance = from._internal_usd_balance();
-  uint64_t raw_usd_balance;
-  memcpy(&raw_usd_balance, &tmp_usd_balance, sizeof(tmp_usd_balance));
-  if (raw_usd_balance != 0) {
-    _this->_internal_set_usd_balance(from._internal_usd_balance());
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_rub_balance = from._internal_rub_balance();
-  uint64_t raw_rub_balance;
-  memcpy(&raw_rub_balance, &tmp_rub_balance, sizeof(tmp_rub_balance));
-  if (raw_rub_balance != 0) {
-    _this->_internal_set_rub_balance(from._internal_rub_balance());
+  double tmp_price = from._internal_price();
+  uint64_t raw_price;
+  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
+  if (raw_price != 0) {
+    _this->_internal_set_price(from._internal_price());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void AccountBalance::CopyFrom(const AccountBalance& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.AccountBalance)
+void Quote::CopyFrom(const Quote& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.Quote)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AccountBalance::IsInitialized() const {
+bool Quote::IsInitialized() const {
   return true;
 }
 
-void AccountBalance::InternalSwap(AccountBalance* other) {
+void Quote::InternalSwap(Quote* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AccountBalance, _impl_.rub_balance_)
-      + sizeof(AccountBalance::_impl_.rub_balance_)
-      - PROTOBUF_FIELD_OFFSET(AccountBalance, _impl_.usd_balance_)>(
-          reinterpret_cast<char*>(&_impl_.usd_balance_),
-          reinterpret_cast<char*>(&other->_impl_.usd_balance_));
+      PROTOBUF_FIELD_OFFSET(Quote, _impl_.price_)
+      + sizeof(Quote::_impl_.price_)
+      - PROTOBUF_FIELD_OFFSET(Quote, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata AccountBalance::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata Quote::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
-      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[7]);
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[18]);
 }
 
 // ===================================================================
 
-class ActiveOrders::_Internal {
+class PriceLevel::_Internal {
  public:
 };
 
-ActiveOrders::ActiveOrders(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+PriceLevel::PriceLevel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:Serialize.ActiveOrders)
+  // @@protoc_insertion_point(arena_constructor:Serialize.PriceLevel)
 }
-ActiveOrders::ActiveOrders(const ActiveOrders& from)
+PriceLevel::PriceLevel(const PriceLevel& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ActiveOrders* const _this = this; (void)_this;
+  PriceLevel* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.active_buy_orders_){from._impl_.active_buy_orders_}
-    , decltype(_impl_.active_sell_orders_){from._impl_.active_sell_orders_}
+      decltype(_impl_.price_){}
+    , decltype(_impl_.usd_amount_){}
+    , decltype(_impl_.orders_count_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:Serialize.ActiveOrders)
+  ::memcpy(&_impl_.price_, &from._impl_.price_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.orders_count_) -
+    reinterpret_cast<char*>(&_impl_.price_)) + sizeof(_impl_.orders_count_));
+  // @@protoc_insertion_point(copy_constructor:Serialize.PriceLevel)
 }
 
-inline void ActiveOrders::SharedCtor(
+inline void PriceLevel::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.active_buy_orders_){arena}
-    , decltype(_impl_.active_sell_orders_){arena}
+      decltype(_impl_.price_){0}
+    , decltype(_impl_.usd_amount_){int64_t{0}}
+    , decltype(_impl_.orders_count_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-ActiveOrders::~ActiveOrders() {
-  // @@protoc_insertion_point(destructor:Serialize.ActiveOrders)
+PriceLevel::~PriceLevel() {
+  // @@protoc_insertion_point(destructor:Serialize.PriceLevel)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3240,56 +7231,53 @@ ActiveOrders::~ActiveOrders() {
   SharedDtor();
 }
 
-inline void ActiveOrders::SharedDtor() {
+inline void PriceLevel::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.active_buy_orders_.~RepeatedPtrField();
-  _impl_.active_sell_orders_.~RepeatedPtrField();
 }
 
-void ActiveOrders::SetCachedSize(int size) const {
+void PriceLevel::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ActiveOrders::Clear() {
-// @@protoc_insertion_point(message_clear_start:Serialize.ActiveOrders)
+void PriceLevel::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.PriceLevel)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.active_buy_orders_.Clear();
-  _impl_.active_sell_orders_.Clear();
+  ::memset(&_impl_.price_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.orders_count_) -
+      reinterpret_cast<char*>(&_impl_.price_)) + sizeof(_impl_.orders_count_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ActiveOrders::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* PriceLevel::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .Serialize.TradeOrder active_buy_orders = 1;
+      // double price = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_active_buy_orders(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.price_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
         } else
           goto handle_unusual;
         continue;
-      // repeated .Serialize.TradeOrder active_sell_orders = 2;
+      // int64 usd_amount = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_active_sell_orders(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.usd_amount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 orders_count = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.orders_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -3316,142 +7304,171 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ActiveOrders::_InternalSerialize(
+uint8_t* PriceLevel::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Serialize.ActiveOrders)
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.PriceLevel)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .Serialize.TradeOrder active_buy_orders = 1;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_active_buy_orders_size()); i < n; i++) {
-    const auto& repfield = this->_internal_active_buy_orders(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  // double price = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_price = this->_internal_price();
+  uint64_t raw_price;
+  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
+  if (raw_price != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_price(), target);
   }
 
-  // repeated .Serialize.TradeOrder active_sell_orders = 2;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_active_sell_orders_size()); i < n; i++) {
-    const auto& repfield = this->_internal_active_sell_orders(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  // int64 usd_amount = 2;
+  if (this->_internal_usd_amount() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_usd_amount(), target);
+  }
+
+  // int32 orders_count = 3;
+  if (this->_internal_orders_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_orders_count(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Serialize.ActiveOrders)
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.PriceLevel)
   return target;
 }
 
-size_t ActiveOrders::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Serialize.ActiveOrders)
+size_t PriceLevel::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.PriceLevel)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .Serialize.TradeOrder active_buy_orders = 1;
-  total_size += 1UL * this->_internal_active_buy_orders_size();
-  for (const auto& msg : this->_impl_.active_buy_orders_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // double price = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_price = this->_internal_price();
+  uint64_t raw_price;
+  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
+  if (raw_price != 0) {
+    total_size += 1 + 8;
   }
 
-  // repeated .Serialize.TradeOrder active_sell_orders = 2;
-  total_size += 1UL * this->_internal_active_sell_orders_size();
-  for (const auto& msg : this->_impl_.active_sell_orders_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // int64 usd_amount = 2;
+  if (this->_internal_usd_amount() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_usd_amount());
+  }
+
+  // int32 orders_count = 3;
+  if (this->_internal_orders_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_orders_count());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ActiveOrders::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PriceLevel::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ActiveOrders::MergeImpl
+    PriceLevel::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ActiveOrders::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PriceLevel::GetClassData() const { return &_class_data_; }
 
 
-void ActiveOrders::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ActiveOrders*>(&to_msg);
-  auto& from = static_cast<const ActiveOrders&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.ActiveOrders)
+void PriceLevel::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PriceLevel*>(&to_msg);
+  auto& from = static_cast<const PriceLevel&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.PriceLevel)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.active_buy_orders_.MergeFrom(from._impl_.active_buy_orders_);
-  _this->_impl_.active_sell_orders_.MergeFrom(from._impl_.active_sell_orders_);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_price = from._internal_price();
+  uint64_t raw_price;
+  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
+  if (raw_price != 0) {
+    _this->_internal_set_price(from._internal_price());
+  }
+  if (from._internal_usd_amount() != 0) {
+    _this->_internal_set_usd_amount(from._internal_usd_amount());
+  }
+  if (from._internal_orders_count() != 0) {
+    _this->_internal_set_orders_count(from._internal_orders_count());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ActiveOrders::CopyFrom(const ActiveOrders& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.ActiveOrders)
+void PriceLevel::CopyFrom(const PriceLevel& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.PriceLevel)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ActiveOrders::IsInitialized() const {
+bool PriceLevel::IsInitialized() const {
   return true;
 }
 
-void ActiveOrders::InternalSwap(ActiveOrders* other) {
+void PriceLevel::InternalSwap(PriceLevel* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.active_buy_orders_.InternalSwap(&other->_impl_.active_buy_orders_);
-  _impl_.active_sell_orders_.InternalSwap(&other->_impl_.active_sell_orders_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.orders_count_)
+      + sizeof(PriceLevel::_impl_.orders_count_)
+      - PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.price_)>(
+          reinterpret_cast<char*>(&_impl_.price_),
+          reinterpret_cast<char*>(&other->_impl_.price_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ActiveOrders::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata PriceLevel::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
-      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[8]);
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[19]);
 }
 
 // ===================================================================
 
-class CompletedOredrs::_Internal {
+class MarketDepth::_Internal {
  public:
 };
 
-CompletedOredrs::CompletedOredrs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+MarketDepth::MarketDepth(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:Serialize.CompletedOredrs)
+  // @@protoc_insertion_point(arena_constructor:Serialize.MarketDepth)
 }
-CompletedOredrs::CompletedOredrs(const CompletedOredrs& from)
+MarketDepth::MarketDepth(const MarketDepth& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  CompletedOredrs* const _this = this; (void)_this;
+  MarketDepth* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.completed_buy_orders_){from._impl_.completed_buy_orders_}
-    , decltype(_impl_.completed_sell_orders_){from._impl_.completed_sell_orders_}
+      decltype(_impl_.bids_){from._impl_.bids_}
+    , decltype(_impl_.asks_){from._impl_.asks_}
+    , decltype(_impl_.timestamp_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:Serialize.CompletedOredrs)
+  _this->_impl_.timestamp_ = from._impl_.timestamp_;
+  // @@protoc_insertion_point(copy_constructor:Serialize.MarketDepth)
 }
 
-inline void CompletedOredrs::SharedCtor(
+inline void MarketDepth::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.completed_buy_orders_){arena}
-    , decltype(_impl_.completed_sell_orders_){arena}
+      decltype(_impl_.bids_){arena}
+    , decltype(_impl_.asks_){arena}
+    , decltype(_impl_.timestamp_){int64_t{0}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-CompletedOredrs::~CompletedOredrs() {
-  // @@protoc_insertion_point(destructor:Serialize.CompletedOredrs)
+MarketDepth::~MarketDepth() {
+  // @@protoc_insertion_point(destructor:Serialize.MarketDepth)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3459,59 +7476,68 @@ CompletedOredrs::~CompletedOredrs() {
   SharedDtor();
 }
 
-inline void CompletedOredrs::SharedDtor() {
+inline void MarketDepth::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.completed_buy_orders_.~RepeatedPtrField();
-  _impl_.completed_sell_orders_.~RepeatedPtrField();
+  _impl_.bids_.~RepeatedPtrField();
+  _impl_.asks_.~RepeatedPtrField();
 }
 
-void CompletedOredrs::SetCachedSize(int size) const {
+void MarketDepth::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void CompletedOredrs::Clear() {
-// @@protoc_insertion_point(message_clear_start:Serialize.CompletedOredrs)
+void MarketDepth::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.MarketDepth)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.completed_buy_orders_.Clear();
-  _impl_.completed_sell_orders_.Clear();
+  _impl_.bids_.Clear();
+  _impl_.asks_.Clear();
+  _impl_.timestamp_ = int64_t{0};
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* CompletedOredrs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* MarketDepth::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .Serialize.TradeOrder completed_buy_orders = 1;
+      // repeated .Serialize.PriceLevel bids = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_completed_buy_orders(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_bids(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // repeated .Serialize.TradeOrder completed_sell_orders = 2;
+      // repeated .Serialize.PriceLevel asks = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_completed_sell_orders(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_asks(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
         } else
           goto handle_unusual;
         continue;
+      // int64 timestamp = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3535,140 +7561,170 @@ failure:
 #undef CHK_
 }
 
-uint8_t* CompletedOredrs::_InternalSerialize(
+uint8_t* MarketDepth::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Serialize.CompletedOredrs)
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.MarketDepth)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .Serialize.TradeOrder completed_buy_orders = 1;
+  // repeated .Serialize.PriceLevel bids = 1;
   for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_completed_buy_orders_size()); i < n; i++) {
-    const auto& repfield = this->_internal_completed_buy_orders(i);
+      n = static_cast<unsigned>(this->_internal_bids_size()); i < n; i++) {
+    const auto& repfield = this->_internal_bids(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
         InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // repeated .Serialize.TradeOrder completed_sell_orders = 2;
+  // repeated .Serialize.PriceLevel asks = 2;
   for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_completed_sell_orders_size()); i < n; i++) {
-    const auto& repfield = this->_internal_completed_sell_orders(i);
+      n = static_cast<unsigned>(this->_internal_asks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_asks(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
         InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // int64 timestamp = 3;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_timestamp(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Serialize.CompletedOredrs)
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.MarketDepth)
   return target;
 }
 
-size_t CompletedOredrs::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Serialize.CompletedOredrs)
+size_t MarketDepth::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.MarketDepth)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .Serialize.TradeOrder completed_buy_orders = 1;
-  total_size += 1UL * this->_internal_completed_buy_orders_size();
-  for (const auto& msg : this->_impl_.completed_buy_orders_) {
+  // repeated .Serialize.PriceLevel bids = 1;
+  total_size += 1UL * this->_internal_bids_size();
+  for (const auto& msg : this->_impl_.bids_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // repeated .Serialize.TradeOrder completed_sell_orders = 2;
-  total_size += 1UL * this->_internal_completed_sell_orders_size();
-  for (const auto& msg : this->_impl_.completed_sell_orders_) {
+  // repeated .Serialize.PriceLevel asks = 2;
+  total_size += 1UL * this->_internal_asks_size();
+  for (const auto& msg : this->_impl_.asks_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // int64 timestamp = 3;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CompletedOredrs::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MarketDepth::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    CompletedOredrs::MergeImpl
+    MarketDepth::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CompletedOredrs::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MarketDepth::GetClassData() const { return &_class_data_; }
 
 
-void CompletedOredrs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<CompletedOredrs*>(&to_msg);
-  auto& from = static_cast<const CompletedOredrs&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.CompletedOredrs)
+void MarketDepth::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MarketDepth*>(&to_msg);
+  auto& from = static_cast<const MarketDepth&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.MarketDepth)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.completed_buy_orders_.MergeFrom(from._impl_.completed_buy_orders_);
-  _this->_impl_.completed_sell_orders_.MergeFrom(from._impl_.completed_sell_orders_);
+  _this->_impl_.bids_.MergeFrom(from._impl_.bids_);
+  _this->_impl_.asks_.MergeFrom(from._impl_.asks_);
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CompletedOredrs::CopyFrom(const CompletedOredrs& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.CompletedOredrs)
+void MarketDepth::CopyFrom(const MarketDepth& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.MarketDepth)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CompletedOredrs::IsInitialized() const {
+bool MarketDepth::IsInitialized() const {
   return true;
 }
 
-void CompletedOredrs::InternalSwap(CompletedOredrs* other) {
+void MarketDepth::InternalSwap(MarketDepth* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.completed_buy_orders_.InternalSwap(&other->_impl_.completed_buy_orders_);
-  _impl_.completed_sell_orders_.InternalSwap(&other->_impl_.completed_sell_orders_);
+  _impl_.bids_.InternalSwap(&other->_impl_.bids_);
+  _impl_.asks_.InternalSwap(&other->_impl_.asks_);
+  swap(_impl_.timestamp_, other->_impl_.timestamp_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata CompletedOredrs::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata MarketDepth::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
-      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[9]);
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[20]);
 }
 
 // ===================================================================
 
-class QuoteHistory::_Internal {
+class Candle::_Internal {
  public:
 };
 
-QuoteHistory::QuoteHistory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+Candle::Candle(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:Serialize.QuoteHistory)
+  // @@protoc_insertion_point(arena_constructor:Serialize.Candle)
 }
-QuoteHistory::QuoteHistory(const QuoteHistory& from)
+Candle::Candle(const Candle& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  QuoteHistory* const _this = this; (void)_this;
+  Candle* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.quotes_){from._impl_.quotes_}
+      decltype(_impl_.open_time_){}
+    , decltype(_impl_.open_){}
+    , decltype(_impl_.high_){}
+    , decltype(_impl_.low_){}
+    , decltype(_impl_.close_){}
+    , decltype(_impl_.usd_volume_){}
+    , decltype(_impl_.trades_count_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:Serialize.QuoteHistory)
+  ::memcpy(&_impl_.open_time_, &from._impl_.open_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.trades_count_) -
+    reinterpret_cast<char*>(&_impl_.open_time_)) + sizeof(_impl_.trades_count_));
+  // @@protoc_insertion_point(copy_constructor:Serialize.Candle)
 }
 
-inline void QuoteHistory::SharedCtor(
+inline void Candle::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.quotes_){arena}
+      decltype(_impl_.open_time_){int64_t{0}}
+    , decltype(_impl_.open_){0}
+    , decltype(_impl_.high_){0}
+    , decltype(_impl_.low_){0}
+    , decltype(_impl_.close_){0}
+    , decltype(_impl_.usd_volume_){int64_t{0}}
+    , decltype(_impl_.trades_count_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-QuoteHistory::~QuoteHistory() {
-  // @@protoc_insertion_point(destructor:Serialize.QuoteHistory)
+Candle::~Candle() {
+  // @@protoc_insertion_point(destructor:Serialize.Candle)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3676,41 +7732,85 @@ QuoteHistory::~QuoteHistory() {
   SharedDtor();
 }
 
-inline void QuoteHistory::SharedDtor() {
+inline void Candle::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.quotes_.~RepeatedPtrField();
 }
 
-void QuoteHistory::SetCachedSize(int size) const {
+void Candle::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void QuoteHistory::Clear() {
-// @@protoc_insertion_point(message_clear_start:Serialize.QuoteHistory)
+void Candle::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.Candle)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.quotes_.Clear();
+  ::memset(&_impl_.open_time_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.trades_count_) -
+      reinterpret_cast<char*>(&_impl_.open_time_)) + sizeof(_impl_.trades_count_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* QuoteHistory::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* Candle::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .Serialize.Quote quotes = 1;
+      // int64 open_time = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_quotes(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.open_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double open = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.open_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double high = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.high_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double low = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.low_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double close = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.close_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 usd_volume = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.usd_volume_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 trades_count = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.trades_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -3737,128 +7837,261 @@ failure:
 #undef CHK_
 }
 
-uint8_t* QuoteHistory::_InternalSerialize(
+uint8_t* Candle::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Serialize.QuoteHistory)
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.Candle)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .Serialize.Quote quotes = 1;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_quotes_size()); i < n; i++) {
-    const auto& repfield = this->_internal_quotes(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  // int64 open_time = 1;
+  if (this->_internal_open_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_open_time(), target);
+  }
+
+  // double open = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_open = this->_internal_open();
+  uint64_t raw_open;
+  memcpy(&raw_open, &tmp_open, sizeof(tmp_open));
+  if (raw_open != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_open(), target);
+  }
+
+  // double high = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_high = this->_internal_high();
+  uint64_t raw_high;
+  memcpy(&raw_high, &tmp_high, sizeof(tmp_high));
+  if (raw_high != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_high(), target);
+  }
+
+  // double low = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_low = this->_internal_low();
+  uint64_t raw_low;
+  memcpy(&raw_low, &tmp_low, sizeof(tmp_low));
+  if (raw_low != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_low(), target);
+  }
+
+  // double close = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_close = this->_internal_close();
+  uint64_t raw_close;
+  memcpy(&raw_close, &tmp_close, sizeof(tmp_close));
+  if (raw_close != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_close(), target);
+  }
+
+  // int64 usd_volume = 6;
+  if (this->_internal_usd_volume() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_usd_volume(), target);
+  }
+
+  // int32 trades_count = 7;
+  if (this->_internal_trades_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_trades_count(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Serialize.QuoteHistory)
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.Candle)
   return target;
 }
 
-size_t QuoteHistory::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Serialize.QuoteHistory)
+size_t Candle::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.Candle)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .Serialize.Quote quotes = 1;
-  total_size += 1UL * this->_internal_quotes_size();
-  for (const auto& msg : this->_impl_.quotes_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // int64 open_time = 1;
+  if (this->_internal_open_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_open_time());
+  }
+
+  // double open = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_open = this->_internal_open();
+  uint64_t raw_open;
+  memcpy(&raw_open, &tmp_open, sizeof(tmp_open));
+  if (raw_open != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double high = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_high = this->_internal_high();
+  uint64_t raw_high;
+  memcpy(&raw_high, &tmp_high, sizeof(tmp_high));
+  if (raw_high != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double low = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_low = this->_internal_low();
+  uint64_t raw_low;
+  memcpy(&raw_low, &tmp_low, sizeof(tmp_low));
+  if (raw_low != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double close = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_close = this->_internal_close();
+  uint64_t raw_close;
+  memcpy(&raw_close, &tmp_close, sizeof(tmp_close));
+  if (raw_close != 0) {
+    total_size += 1 + 8;
+  }
+
+  // int64 usd_volume = 6;
+  if (this->_internal_usd_volume() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_usd_volume());
+  }
+
+  // int32 trades_count = 7;
+  if (this->_internal_trades_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_trades_count());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QuoteHistory::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Candle::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    QuoteHistory::MergeImpl
+    Candle::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QuoteHistory::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Candle::GetClassData() const { return &_class_data_; }
 
 
-void QuoteHistory::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<QuoteHistory*>(&to_msg);
-  auto& from = static_cast<const QuoteHistory&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.QuoteHistory)
+void Candle::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Candle*>(&to_msg);
+  auto& from = static_cast<const Candle&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.Candle)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.quotes_.MergeFrom(from._impl_.quotes_);
+  if (from._internal_open_time() != 0) {
+    _this->_internal_set_open_time(from._internal_open_time());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_open = from._internal_open();
+  uint64_t raw_open;
+  memcpy(&raw_open, &tmp_open, sizeof(tmp_open));
+  if (raw_open != 0) {
+    _this->_internal_set_open(from._internal_open());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_high = from._internal_high();
+  uint64_t raw_high;
+  memcpy(&raw_high, &tmp_high, sizeof(tmp_high));
+  if (raw_high != 0) {
+    _this->_internal_set_high(from._internal_high());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_low = from._internal_low();
+  uint64_t raw_low;
+  memcpy(&raw_low, &tmp_low, sizeof(tmp_low));
+  if (raw_low != 0) {
+    _this->_internal_set_low(from._internal_low());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_close = from._internal_close();
+  uint64_t raw_close;
+  memcpy(&raw_close, &tmp_close, sizeof(tmp_close));
+  if (raw_close != 0) {
+    _this->_internal_set_close(from._internal_close());
+  }
+  if (from._internal_usd_volume() != 0) {
+    _this->_internal_set_usd_volume(from._internal_usd_volume());
+  }
+  if (from._internal_trades_count() != 0) {
+    _this->_internal_set_trades_count(from._internal_trades_count());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void QuoteHistory::CopyFrom(const QuoteHistory& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.QuoteHistory)
+void Candle::CopyFrom(const Candle& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.Candle)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool QuoteHistory::IsInitialized() const {
+bool Candle::IsInitialized() const {
   return true;
 }
 
-void QuoteHistory::InternalSwap(QuoteHistory* other) {
+void Candle::InternalSwap(Candle* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.quotes_.InternalSwap(&other->_impl_.quotes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Candle, _impl_.trades_count_)
+      + sizeof(Candle::_impl_.trades_count_)
+      - PROTOBUF_FIELD_OFFSET(Candle, _impl_.open_time_)>(
+          reinterpret_cast<char*>(&_impl_.open_time_),
+          reinterpret_cast<char*>(&other->_impl_.open_time_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata QuoteHistory::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata Candle::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
-      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[10]);
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[21]);
 }
 
 // ===================================================================
 
-class Quote::_Internal {
+class Candles::_Internal {
  public:
 };
 
-Quote::Quote(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+Candles::Candles(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:Serialize.Quote)
+  // @@protoc_insertion_point(arena_constructor:Serialize.Candles)
 }
-Quote::Quote(const Quote& from)
+Candles::Candles(const Candles& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  Quote* const _this = this; (void)_this;
+  Candles* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.timestamp_){}
-    , decltype(_impl_.price_){}
+      decltype(_impl_.candles_){from._impl_.candles_}
+    , decltype(_impl_.resolution_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.price_) -
-    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.price_));
-  // @@protoc_insertion_point(copy_constructor:Serialize.Quote)
+  _this->_impl_.resolution_ = from._impl_.resolution_;
+  // @@protoc_insertion_point(copy_constructor:Serialize.Candles)
 }
 
-inline void Quote::SharedCtor(
+inline void Candles::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.timestamp_){int64_t{0}}
-    , decltype(_impl_.price_){0}
+      decltype(_impl_.candles_){arena}
+    , decltype(_impl_.resolution_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-Quote::~Quote() {
-  // @@protoc_insertion_point(destructor:Serialize.Quote)
+Candles::~Candles() {
+  // @@protoc_insertion_point(destructor:Serialize.Candles)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3866,45 +8099,51 @@ Quote::~Quote() {
   SharedDtor();
 }
 
-inline void Quote::SharedDtor() {
+inline void Candles::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.candles_.~RepeatedPtrField();
 }
 
-void Quote::SetCachedSize(int size) const {
+void Candles::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void Quote::Clear() {
-// @@protoc_insertion_point(message_clear_start:Serialize.Quote)
+void Candles::Clear() {
+// @@protoc_insertion_point(message_clear_start:Serialize.Candles)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.price_) -
-      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.price_));
+  _impl_.candles_.Clear();
+  _impl_.resolution_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Quote::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* Candles::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int64 timestamp = 1;
+      // .Serialize.CandleResolution resolution = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
+          _internal_set_resolution(static_cast<::Serialize::CandleResolution>(val));
         } else
           goto handle_unusual;
         continue;
-      // double price = 2;
+      // repeated .Serialize.Candle candles = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
-          _impl_.price_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_candles(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -3931,115 +8170,103 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Quote::_InternalSerialize(
+uint8_t* Candles::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Serialize.Quote)
+  // @@protoc_insertion_point(serialize_to_array_start:Serialize.Candles)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int64 timestamp = 1;
-  if (this->_internal_timestamp() != 0) {
+  // .Serialize.CandleResolution resolution = 1;
+  if (this->_internal_resolution() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_timestamp(), target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_resolution(), target);
   }
 
-  // double price = 2;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_price = this->_internal_price();
-  uint64_t raw_price;
-  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
-  if (raw_price != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_price(), target);
+  // repeated .Serialize.Candle candles = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_candles_size()); i < n; i++) {
+    const auto& repfield = this->_internal_candles(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Serialize.Quote)
+  // @@protoc_insertion_point(serialize_to_array_end:Serialize.Candles)
   return target;
 }
 
-size_t Quote::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Serialize.Quote)
+size_t Candles::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Serialize.Candles)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int64 timestamp = 1;
-  if (this->_internal_timestamp() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
+  // repeated .Serialize.Candle candles = 2;
+  total_size += 1UL * this->_internal_candles_size();
+  for (const auto& msg : this->_impl_.candles_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // double price = 2;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_price = this->_internal_price();
-  uint64_t raw_price;
-  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
-  if (raw_price != 0) {
-    total_size += 1 + 8;
+  // .Serialize.CandleResolution resolution = 1;
+  if (this->_internal_resolution() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_resolution());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Quote::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Candles::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    Quote::MergeImpl
+    Candles::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Quote::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Candles::GetClassData() const { return &_class_data_; }
 
 
-void Quote::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<Quote*>(&to_msg);
-  auto& from = static_cast<const Quote&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.Quote)
+void Candles::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Candles*>(&to_msg);
+  auto& from = static_cast<const Candles&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Serialize.Candles)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_timestamp() != 0) {
-    _this->_internal_set_timestamp(from._internal_timestamp());
-  }
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_price = from._internal_price();
-  uint64_t raw_price;
-  memcpy(&raw_price, &tmp_price, sizeof(tmp_price));
-  if (raw_price != 0) {
-    _this->_internal_set_price(from._internal_price());
+  _this->_impl_.candles_.MergeFrom(from._impl_.candles_);
+  if (from._internal_resolution() != 0) {
+    _this->_internal_set_resolution(from._internal_resolution());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Quote::CopyFrom(const Quote& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.Quote)
+void Candles::CopyFrom(const Candles& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Serialize.Candles)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Quote::IsInitialized() const {
+bool Candles::IsInitialized() const {
   return true;
 }
 
-void Quote::InternalSwap(Quote* other) {
+void Candles::InternalSwap(Candles* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Quote, _impl_.price_)
-      + sizeof(Quote::_impl_.price_)
-      - PROTOBUF_FIELD_OFFSET(Quote, _impl_.timestamp_)>(
-          reinterpret_cast<char*>(&_impl_.timestamp_),
-          reinterpret_cast<char*>(&other->_impl_.timestamp_));
+  _impl_.candles_.InternalSwap(&other->_impl_.candles_);
+  swap(_impl_.resolution_, other->_impl_.resolution_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Quote::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata Candles::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_trade_5fmarket_5fprotocol_2eproto_getter, &descriptor_table_trade_5fmarket_5fprotocol_2eproto_once,
-      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[11]);
+      file_level_metadata_trade_5fmarket_5fprotocol_2eproto[22]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -4061,6 +8288,22 @@ template<> PROTOBUF_NOINLINE ::Serialize::CancelTradeOrder*
 Arena::CreateMaybeMessage< ::Serialize::CancelTradeOrder >(Arena* arena) {
   return Arena::CreateMessageInternal< ::Serialize::CancelTradeOrder >(arena);
 }
+template<> PROTOBUF_NOINLINE ::Serialize::CancelAllOrders*
+Arena::CreateMaybeMessage< ::Serialize::CancelAllOrders >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Serialize::CancelAllOrders >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Serialize::ModifyTradeOrder*
+Arena::CreateMaybeMessage< ::Serialize::ModifyTradeOrder >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Serialize::ModifyTradeOrder >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Serialize::DepthRequest*
+Arena::CreateMaybeMessage< ::Serialize::DepthRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Serialize::DepthRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Serialize::CandlesRequest*
+Arena::CreateMaybeMessage< ::Serialize::CandlesRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Serialize::CandlesRequest >(arena);
+}
 template<> PROTOBUF_NOINLINE ::Serialize::TradeRequest*
 Arena::CreateMaybeMessage< ::Serialize::TradeRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::Serialize::TradeRequest >(arena);
@@ -4069,6 +8312,18 @@ template<> PROTOBUF_NOINLINE ::Serialize::TradeResponse*
 Arena::CreateMaybeMessage< ::Serialize::TradeResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::Serialize::TradeResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::Serialize::ExecutionReport*
+Arena::CreateMaybeMessage< ::Serialize::ExecutionReport >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Serialize::ExecutionReport >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Serialize::Execution*
+Arena::CreateMaybeMessage< ::Serialize::Execution >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Serialize::Execution >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Serialize::Trades*
+Arena::CreateMaybeMessage< ::Serialize::Trades >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Serialize::Trades >(arena);
+}
 template<> PROTOBUF_NOINLINE ::Serialize::ClientBalance*
 Arena::CreateMaybeMessage< ::Serialize::ClientBalance >(Arena* arena) {
   return Arena::CreateMessageInternal< ::Serialize::ClientBalance >(arena);
@@ -4093,6 +8348,22 @@ template<> PROTOBUF_NOINLINE ::Serialize::Quote*
 Arena::CreateMaybeMessage< ::Serialize::Quote >(Arena* arena) {
   return Arena::CreateMessageInternal< ::Serialize::Quote >(arena);
 }
+template<> PROTOBUF_NOINLINE ::Serialize::PriceLevel*
+Arena::CreateMaybeMessage< ::Serialize::PriceLevel >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Serialize::PriceLevel >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Serialize::MarketDepth*
+Arena::CreateMaybeMessage< ::Serialize::MarketDepth >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Serialize::MarketDepth >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Serialize::Candle*
+Arena::CreateMaybeMessage< ::Serialize::Candle >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Serialize::Candle >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Serialize::Candles*
+Arena::CreateMaybeMessage< ::Serialize::Candles >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Serialize::Candles >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -52,15 +52,45 @@ extern AccountBalanceDefaultTypeInternal _AccountBalance_default_instance_;
 class ActiveOrders;
 struct ActiveOrdersDefaultTypeInternal;
 extern ActiveOrdersDefaultTypeInternal _ActiveOrders_default_instance_;
+class CancelAllOrders;
+struct CancelAllOrdersDefaultTypeInternal;
+extern CancelAllOrdersDefaultTypeInternal _CancelAllOrders_default_instance_;
 class CancelTradeOrder;
 struct CancelTradeOrderDefaultTypeInternal;
 extern CancelTradeOrderDefaultTypeInternal _CancelTradeOrder_default_instance_;
+class Candle;
+struct CandleDefaultTypeInternal;
+extern CandleDefaultTypeInternal _Candle_default_instance_;
+class Candles;
+struct CandlesDefaultTypeInternal;
+extern CandlesDefaultTypeInternal _Candles_default_instance_;
+class CandlesRequest;
+struct CandlesRequestDefaultTypeInternal;
+extern CandlesRequestDefaultTypeInternal _CandlesRequest_default_instance_;
 class ClientBalance;
 struct ClientBalanceDefaultTypeInternal;
 extern ClientBalanceDefaultTypeInternal _ClientBalance_default_instance_;
 class CompletedOredrs;
 struct CompletedOredrsDefaultTypeInternal;
 extern CompletedOredrsDefaultTypeInternal _CompletedOredrs_default_instance_;
+class DepthRequest;
+struct DepthRequestDefaultTypeInternal;
+extern DepthRequestDefaultTypeInternal _DepthRequest_default_instance_;
+class Execution;
+struct ExecutionDefaultTypeInternal;
+extern ExecutionDefaultTypeInternal _Execution_default_instance_;
+class ExecutionReport;
+struct ExecutionReportDefaultTypeInternal;
+extern ExecutionReportDefaultTypeInternal _ExecutionReport_default_instance_;
+class MarketDepth;
+struct MarketDepthDefaultTypeInternal;
+extern MarketDepthDefaultTypeInternal _MarketDepth_default_instance_;
+class ModifyTradeOrder;
+struct ModifyTradeOrderDefaultTypeInternal;
+extern ModifyTradeOrderDefaultTypeInternal _ModifyTradeOrder_default_instance_;
+class PriceLevel;
+struct PriceLevelDefaultTypeInternal;
+extern PriceLevelDefaultTypeInternal _PriceLevel_default_instance_;
 class Quote;
 struct QuoteDefaultTypeInternal;
 extern QuoteDefaultTypeInternal _Quote_default_instance_;
@@ -82,13 +112,26 @@ extern TradeRequestDefaultTypeInternal _TradeRequest_default_instance_;
 class TradeResponse;
 struct TradeResponseDefaultTypeInternal;
 extern TradeResponseDefaultTypeInternal _TradeResponse_default_instance_;
+class Trades;
+struct TradesDefaultTypeInternal;
+extern TradesDefaultTypeInternal _Trades_default_instance_;
 }  // namespace Serialize
 PROTOBUF_NAMESPACE_OPEN
 template<> ::Serialize::AccountBalance* Arena::CreateMaybeMessage<::Serialize::AccountBalance>(Arena*);
 template<> ::Serialize::ActiveOrders* Arena::CreateMaybeMessage<::Serialize::ActiveOrders>(Arena*);
+template<> ::Serialize::CancelAllOrders* Arena::CreateMaybeMessage<::Serialize::CancelAllOrders>(Arena*);
 template<> ::Serialize::CancelTradeOrder* Arena::CreateMaybeMessage<::Serialize::CancelTradeOrder>(Arena*);
+template<> ::Serialize::Candle* Arena::CreateMaybeMessage<::Serialize::Candle>(Arena*);
+template<> ::Serialize::Candles* Arena::CreateMaybeMessage<::Serialize::Candles>(Arena*);
+template<> ::Serialize::CandlesRequest* Arena::CreateMaybeMessage<::Serialize::CandlesRequest>(Arena*);
 template<> ::Serialize::ClientBalance* Arena::CreateMaybeMessage<::Serialize::ClientBalance>(Arena*);
 template<> ::Serialize::CompletedOredrs* Arena::CreateMaybeMessage<::Serialize::CompletedOredrs>(Arena*);
+template<> ::Serialize::DepthRequest* Arena::CreateMaybeMessage<::Serialize::DepthRequest>(Arena*);
+template<> ::Serialize::Execution* Arena::CreateMaybeMessage<::Serialize::Execution>(Arena*);
+template<> ::Serialize::ExecutionReport* Arena::CreateMaybeMessage<::Serialize::ExecutionReport>(Arena*);
+template<> ::Serialize::MarketDepth* Arena::CreateMaybeMessage<::Serialize::MarketDepth>(Arena*);
+template<> ::Serialize::ModifyTradeOrder* Arena::CreateMaybeMessage<::Serialize::ModifyTradeOrder>(Arena*);
+template<> ::Serialize::PriceLevel* Arena::CreateMaybeMessage<::Serialize::PriceLevel>(Arena*);
 template<> ::Serialize::Quote* Arena::CreateMaybeMessage<::Serialize::Quote>(Arena*);
 template<> ::Serialize::QuoteHistory* Arena::CreateMaybeMessage<::Serialize::QuoteHistory>(Arena*);
 template<> ::Serialize::SignInRequest* Arena::CreateMaybeMessage<::Serialize::SignInRequest>(Arena*);
@@ -96,6 +139,7 @@ template<> ::Serialize::SignUpRequest* Arena::CreateMaybeMessage<::Serialize::Si
 template<> ::Serialize::TradeOrder* Arena::CreateMaybeMessage<::Serialize::TradeOrder>(Arena*);
 template<> ::Serialize::TradeRequest* Arena::CreateMaybeMessage<::Serialize::TradeRequest>(Arena*);
 template<> ::Serialize::TradeResponse* Arena::CreateMaybeMessage<::Serialize::TradeResponse>(Arena*);
+template<> ::Serialize::Trades* Arena::CreateMaybeMessage<::Serialize::Trades>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace Serialize {
 
@@ -124,6 +168,61 @@ inline bool TradeOrder_TradeType_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TradeOrder_TradeType>(
     TradeOrder_TradeType_descriptor(), name, value);
 }
+enum TradeOrder_OrderType : int {
+  TradeOrder_OrderType_LIMIT = 0,
+  TradeOrder_OrderType_MARKET = 1,
+  TradeOrder_OrderType_STOP = 2,
+  TradeOrder_OrderType_STOP_LIMIT = 3,
+  TradeOrder_OrderType_TradeOrder_OrderType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  TradeOrder_OrderType_TradeOrder_OrderType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool TradeOrder_OrderType_IsValid(int value);
+constexpr TradeOrder_OrderType TradeOrder_OrderType_OrderType_MIN = TradeOrder_OrderType_LIMIT;
+constexpr TradeOrder_OrderType TradeOrder_OrderType_OrderType_MAX = TradeOrder_OrderType_STOP_LIMIT;
+constexpr int TradeOrder_OrderType_OrderType_ARRAYSIZE = TradeOrder_OrderType_OrderType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TradeOrder_OrderType_descriptor();
+template<typename T>
+inline const std::string& TradeOrder_OrderType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TradeOrder_OrderType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TradeOrder_OrderType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TradeOrder_OrderType_descriptor(), enum_t_value);
+}
+inline bool TradeOrder_OrderType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TradeOrder_OrderType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TradeOrder_OrderType>(
+    TradeOrder_OrderType_descriptor(), name, value);
+}
+enum TradeOrder_TimeInForce : int {
+  TradeOrder_TimeInForce_GTC = 0,
+  TradeOrder_TimeInForce_IOC = 1,
+  TradeOrder_TimeInForce_FOK = 2,
+  TradeOrder_TimeInForce_GTD = 3,
+  TradeOrder_TimeInForce_DAY = 4,
+  TradeOrder_TimeInForce_TradeOrder_TimeInForce_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  TradeOrder_TimeInForce_TradeOrder_TimeInForce_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool TradeOrder_TimeInForce_IsValid(int value);
+constexpr TradeOrder_TimeInForce TradeOrder_TimeInForce_TimeInForce_MIN = TradeOrder_TimeInForce_GTC;
+constexpr TradeOrder_TimeInForce TradeOrder_TimeInForce_TimeInForce_MAX = TradeOrder_TimeInForce_DAY;
+constexpr int TradeOrder_TimeInForce_TimeInForce_ARRAYSIZE = TradeOrder_TimeInForce_TimeInForce_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TradeOrder_TimeInForce_descriptor();
+template<typename T>
+inline const std::string& TradeOrder_TimeInForce_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TradeOrder_TimeInForce>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TradeOrder_TimeInForce_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TradeOrder_TimeInForce_descriptor(), enum_t_value);
+}
+inline bool TradeOrder_TimeInForce_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TradeOrder_TimeInForce* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TradeOrder_TimeInForce>(
+    TradeOrder_TimeInForce_descriptor(), name, value);
+}
 enum CancelTradeOrder_TradeType : int {
   CancelTradeOrder_TradeType_BUY = 0,
   CancelTradeOrder_TradeType_SELL = 1,
@@ -149,6 +248,32 @@ inline bool CancelTradeOrder_TradeType_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CancelTradeOrder_TradeType>(
     CancelTradeOrder_TradeType_descriptor(), name, value);
 }
+enum CancelAllOrders_Side : int {
+  CancelAllOrders_Side_BOTH = 0,
+  CancelAllOrders_Side_BUY = 1,
+  CancelAllOrders_Side_SELL = 2,
+  CancelAllOrders_Side_CancelAllOrders_Side_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  CancelAllOrders_Side_CancelAllOrders_Side_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool CancelAllOrders_Side_IsValid(int value);
+constexpr CancelAllOrders_Side CancelAllOrders_Side_Side_MIN = CancelAllOrders_Side_BOTH;
+constexpr CancelAllOrders_Side CancelAllOrders_Side_Side_MAX = CancelAllOrders_Side_SELL;
+constexpr int CancelAllOrders_Side_Side_ARRAYSIZE = CancelAllOrders_Side_Side_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CancelAllOrders_Side_descriptor();
+template<typename T>
+inline const std::string& CancelAllOrders_Side_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, CancelAllOrders_Side>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function CancelAllOrders_Side_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    CancelAllOrders_Side_descriptor(), enum_t_value);
+}
+inline bool CancelAllOrders_Side_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CancelAllOrders_Side* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CancelAllOrders_Side>(
+    CancelAllOrders_Side_descriptor(), name, value);
+}
 enum TradeRequest_CommandType : int {
   TradeRequest_CommandType_SIGN_UP = 0,
   TradeRequest_CommandType_SIGN_IN = 1,
@@ -158,12 +283,18 @@ enum TradeRequest_CommandType : int {
   TradeRequest_CommandType_VIEW_COMPLETED_TRADES = 5,
   TradeRequest_CommandType_VIEW_QUOTE_HISTORY = 6,
   TradeRequest_CommandType_CANCEL_ACTIVE_ORDER = 7,
+  TradeRequest_CommandType_VIEW_DEPTH = 8,
+  TradeRequest_CommandType_VIEW_MY_ACTIVE_ORDERS = 9,
+  TradeRequest_CommandType_VIEW_CANDLES = 10,
+  TradeRequest_CommandType_VIEW_TRADES = 11,
+  TradeRequest_CommandType_MODIFY_ORDER = 12,
+  TradeRequest_CommandType_CANCEL_ALL = 13,
   TradeRequest_CommandType_TradeRequest_CommandType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
   TradeRequest_CommandType_TradeRequest_CommandType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool TradeRequest_CommandType_IsValid(int value);
 constexpr TradeRequest_CommandType TradeRequest_CommandType_CommandType_MIN = TradeRequest_CommandType_SIGN_UP;
-constexpr TradeRequest_CommandType TradeRequest_CommandType_CommandType_MAX = TradeRequest_CommandType_CANCEL_ACTIVE_ORDER;
+constexpr TradeRequest_CommandType TradeRequest_CommandType_CommandType_MAX = TradeRequest_CommandType_CANCEL_ALL;
 constexpr int TradeRequest_CommandType_CommandType_ARRAYSIZE = TradeRequest_CommandType_CommandType_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TradeRequest_CommandType_descriptor();
@@ -195,12 +326,20 @@ enum TradeResponse_status : int {
   TradeResponse_status_SUCCESS_CANCEL_ACTIVE_ORDER = 12,
   TradeResponse_status_ERROR_CANCEL_ACTIVE_ORDER = 13,
   TradeResponse_status_ORDER_MATCHED = 14,
+  TradeResponse_status_SUCCESS_VIEW_DEPTH = 15,
+  TradeResponse_status_SUCCESS_VIEW_MY_ACTIVE_ORDERS = 16,
+  TradeResponse_status_SUCCESS_VIEW_CANDLES = 17,
+  TradeResponse_status_SUCCESS_VIEW_TRADES = 18,
+  TradeResponse_status_ORDER_REJECTED_BY_RISK = 19,
+  TradeResponse_status_SUCCESS_MODIFY_ORDER = 20,
+  TradeResponse_status_ERROR_MODIFY_ORDER = 21,
+  TradeResponse_status_SUCCESS_CANCEL_ALL = 22,
   TradeResponse_status_TradeResponse_status_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
   TradeResponse_status_TradeResponse_status_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool TradeResponse_status_IsValid(int value);
 constexpr TradeResponse_status TradeResponse_status_status_MIN = TradeResponse_status_ERROR;
-constexpr TradeResponse_status TradeResponse_status_status_MAX = TradeResponse_status_ORDER_MATCHED;
+constexpr TradeResponse_status TradeResponse_status_status_MAX = TradeResponse_status_SUCCESS_CANCEL_ALL;
 constexpr int TradeResponse_status_status_ARRAYSIZE = TradeResponse_status_status_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TradeResponse_status_descriptor();
@@ -217,6 +356,34 @@ inline bool TradeResponse_status_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TradeResponse_status>(
     TradeResponse_status_descriptor(), name, value);
 }
+enum CandleResolution : int {
+  SECOND_1 = 0,
+  MINUTE_1 = 1,
+  MINUTE_5 = 2,
+  HOUR_1 = 3,
+  DAY_1 = 4,
+  CandleResolution_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  CandleResolution_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool CandleResolution_IsValid(int value);
+constexpr CandleResolution CandleResolution_MIN = SECOND_1;
+constexpr CandleResolution CandleResolution_MAX = DAY_1;
+constexpr int CandleResolution_ARRAYSIZE = CandleResolution_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CandleResolution_descriptor();
+template<typename T>
+inline const std::string& CandleResolution_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, CandleResolution>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function CandleResolution_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    CandleResolution_descriptor(), enum_t_value);
+}
+inline bool CandleResolution_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CandleResolution* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CandleResolution>(
+    CandleResolution_descriptor(), name, value);
+}
 // ===================================================================
 
 class SignUpRequest final :
@@ -511,6 +678,7 @@ class SignInRequest final :
   enum : int {
     kUsernameFieldNumber = 1,
     kPasswordFieldNumber = 2,
+    kCancelOnDisconnectFieldNumber = 3,
   };
   // string username = 1;
   void clear_username();
@@ -540,6 +708,15 @@ class SignInRequest final :
   std::string* _internal_mutable_password();
   public:
 
+  // bool cancel_on_disconnect = 3;
+  void clear_cancel_on_disconnect();
+  bool cancel_on_disconnect() const;
+  void set_cancel_on_disconnect(bool value);
+  private:
+  bool _internal_cancel_on_disconnect() const;
+  void _internal_set_cancel_on_disconnect(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:Serialize.SignInRequest)
  private:
   class _Internal;
@@ -550,6 +727,7 @@ class SignInRequest final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr password_;
+    bool cancel_on_disconnect_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -705,6 +883,76 @@ class TradeOrder final :
     return TradeOrder_TradeType_Parse(name, value);
   }
 
+  typedef TradeOrder_OrderType OrderType;
+  static constexpr OrderType LIMIT =
+    TradeOrder_OrderType_LIMIT;
+  static constexpr OrderType MARKET =
+    TradeOrder_OrderType_MARKET;
+  static constexpr OrderType STOP =
+    TradeOrder_OrderType_STOP;
+  static constexpr OrderType STOP_LIMIT =
+    TradeOrder_OrderType_STOP_LIMIT;
+  static inline bool OrderType_IsValid(int value) {
+    return TradeOrder_OrderType_IsValid(value);
+  }
+  static constexpr OrderType OrderType_MIN =
+    TradeOrder_OrderType_OrderType_MIN;
+  static constexpr OrderType OrderType_MAX =
+    TradeOrder_OrderType_OrderType_MAX;
+  static constexpr int OrderType_ARRAYSIZE =
+    TradeOrder_OrderType_OrderType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  OrderType_descriptor() {
+    return TradeOrder_OrderType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& OrderType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, OrderType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function OrderType_Name.");
+    return TradeOrder_OrderType_Name(enum_t_value);
+  }
+  static inline bool OrderType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      OrderType* value) {
+    return TradeOrder_OrderType_Parse(name, value);
+  }
+
+  typedef TradeOrder_TimeInForce TimeInForce;
+  static constexpr TimeInForce GTC =
+    TradeOrder_TimeInForce_GTC;
+  static constexpr TimeInForce IOC =
+    TradeOrder_TimeInForce_IOC;
+  static constexpr TimeInForce FOK =
+    TradeOrder_TimeInForce_FOK;
+  static constexpr TimeInForce GTD =
+    TradeOrder_TimeInForce_GTD;
+  static constexpr TimeInForce DAY =
+    TradeOrder_TimeInForce_DAY;
+  static inline bool TimeInForce_IsValid(int value) {
+    return TradeOrder_TimeInForce_IsValid(value);
+  }
+  static constexpr TimeInForce TimeInForce_MIN =
+    TradeOrder_TimeInForce_TimeInForce_MIN;
+  static constexpr TimeInForce TimeInForce_MAX =
+    TradeOrder_TimeInForce_TimeInForce_MAX;
+  static constexpr int TimeInForce_ARRAYSIZE =
+    TradeOrder_TimeInForce_TimeInForce_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  TimeInForce_descriptor() {
+    return TradeOrder_TimeInForce_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& TimeInForce_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, TimeInForce>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function TimeInForce_Name.");
+    return TradeOrder_TimeInForce_Name(enum_t_value);
+  }
+  static inline bool TimeInForce_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      TimeInForce* value) {
+    return TradeOrder_TimeInForce_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
@@ -715,6 +963,13 @@ class TradeOrder final :
     kTimestampFieldNumber = 4,
     kOrderIdFieldNumber = 5,
     kUsdVolumeFieldNumber = 6,
+    kOrderTypeFieldNumber = 8,
+    kStopPriceFieldNumber = 10,
+    kTimeInForceFieldNumber = 9,
+    kPeakAmountFieldNumber = 11,
+    kDisplayedAmountFieldNumber = 12,
+    kAccountIdFieldNumber = 13,
+    kExpireTimeFieldNumber = 14,
   };
   // string username = 7;
   void clear_username();
@@ -784,6 +1039,69 @@ class TradeOrder final :
   void _internal_set_usd_volume(int32_t value);
   public:
 
+  // .Serialize.TradeOrder.OrderType order_type = 8;
+  void clear_order_type();
+  ::Serialize::TradeOrder_OrderType order_type() const;
+  void set_order_type(::Serialize::TradeOrder_OrderType value);
+  private:
+  ::Serialize::TradeOrder_OrderType _internal_order_type() const;
+  void _internal_set_order_type(::Serialize::TradeOrder_OrderType value);
+  public:
+
+  // double stop_price = 10;
+  void clear_stop_price();
+  double stop_price() const;
+  void set_stop_price(double value);
+  private:
+  double _internal_stop_price() const;
+  void _internal_set_stop_price(double value);
+  public:
+
+  // .Serialize.TradeOrder.TimeInForce time_in_force = 9;
+  void clear_time_in_force();
+  ::Serialize::TradeOrder_TimeInForce time_in_force() const;
+  void set_time_in_force(::Serialize::TradeOrder_TimeInForce value);
+  private:
+  ::Serialize::TradeOrder_TimeInForce _internal_time_in_force() const;
+  void _internal_set_time_in_force(::Serialize::TradeOrder_TimeInForce value);
+  public:
+
+  // int32 peak_amount = 11;
+  void clear_peak_amount();
+  int32_t peak_amount() const;
+  void set_peak_amount(int32_t value);
+  private:
+  int32_t _internal_peak_amount() const;
+  void _internal_set_peak_amount(int32_t value);
+  public:
+
+  // int32 displayed_amount = 12;
+  void clear_displayed_amount();
+  int32_t displayed_amount() const;
+  void set_displayed_amount(int32_t value);
+  private:
+  int32_t _internal_displayed_amount() const;
+  void _internal_set_displayed_amount(int32_t value);
+  public:
+
+  // uint32 account_id = 13;
+  void clear_account_id();
+  uint32_t account_id() const;
+  void set_account_id(uint32_t value);
+  private:
+  uint32_t _internal_account_id() const;
+  void _internal_set_account_id(uint32_t value);
+  public:
+
+  // int64 expire_time = 14;
+  void clear_expire_time();
+  int64_t expire_time() const;
+  void set_expire_time(int64_t value);
+  private:
+  int64_t _internal_expire_time() const;
+  void _internal_set_expire_time(int64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:Serialize.TradeOrder)
  private:
   class _Internal;
@@ -799,6 +1117,13 @@ class TradeOrder final :
     int64_t timestamp_;
     int64_t order_id_;
     int32_t usd_volume_;
+    int order_type_;
+    double stop_price_;
+    int time_in_force_;
+    int32_t peak_amount_;
+    int32_t displayed_amount_;
+    uint32_t account_id_;
+    int64_t expire_time_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -995,24 +1320,24 @@ class CancelTradeOrder final :
 };
 // -------------------------------------------------------------------
 
-class TradeRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.TradeRequest) */ {
+class CancelAllOrders final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.CancelAllOrders) */ {
  public:
-  inline TradeRequest() : TradeRequest(nullptr) {}
-  ~TradeRequest() override;
-  explicit PROTOBUF_CONSTEXPR TradeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline CancelAllOrders() : CancelAllOrders(nullptr) {}
+  ~CancelAllOrders() override;
+  explicit PROTOBUF_CONSTEXPR CancelAllOrders(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  TradeRequest(const TradeRequest& from);
-  TradeRequest(TradeRequest&& from) noexcept
-    : TradeRequest() {
+  CancelAllOrders(const CancelAllOrders& from);
+  CancelAllOrders(CancelAllOrders&& from) noexcept
+    : CancelAllOrders() {
     *this = ::std::move(from);
   }
 
-  inline TradeRequest& operator=(const TradeRequest& from) {
+  inline CancelAllOrders& operator=(const CancelAllOrders& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TradeRequest& operator=(TradeRequest&& from) noexcept {
+  inline CancelAllOrders& operator=(CancelAllOrders&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1035,28 +1360,20 @@ class TradeRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const TradeRequest& default_instance() {
+  static const CancelAllOrders& default_instance() {
     return *internal_default_instance();
   }
-  enum RequestDataCase {
-    kSignUpRequest = 4,
-    kSignInRequest = 5,
-    kOrder = 6,
-    kCancelOrder = 7,
-    REQUESTDATA_NOT_SET = 0,
-  };
-
-  static inline const TradeRequest* internal_default_instance() {
-    return reinterpret_cast<const TradeRequest*>(
-               &_TradeRequest_default_instance_);
+  static inline const CancelAllOrders* internal_default_instance() {
+    return reinterpret_cast<const CancelAllOrders*>(
+               &_CancelAllOrders_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     4;
 
-  friend void swap(TradeRequest& a, TradeRequest& b) {
+  friend void swap(CancelAllOrders& a, CancelAllOrders& b) {
     a.Swap(&b);
   }
-  inline void Swap(TradeRequest* other) {
+  inline void Swap(CancelAllOrders* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1069,7 +1386,7 @@ class TradeRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(TradeRequest* other) {
+  void UnsafeArenaSwap(CancelAllOrders* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1077,14 +1394,14 @@ class TradeRequest final :
 
   // implements Message ----------------------------------------------
 
-  TradeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<TradeRequest>(arena);
+  CancelAllOrders* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CancelAllOrders>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const TradeRequest& from);
+  void CopyFrom(const CancelAllOrders& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const TradeRequest& from) {
-    TradeRequest::MergeImpl(*this, from);
+  void MergeFrom( const CancelAllOrders& from) {
+    CancelAllOrders::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1102,15 +1419,15 @@ class TradeRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(TradeRequest* other);
+  void InternalSwap(CancelAllOrders* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "Serialize.TradeRequest";
+    return "Serialize.CancelAllOrders";
   }
   protected:
-  explicit TradeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit CancelAllOrders(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1121,223 +1438,86 @@ class TradeRequest final :
 
   // nested types ----------------------------------------------------
 
-  typedef TradeRequest_CommandType CommandType;
-  static constexpr CommandType SIGN_UP =
-    TradeRequest_CommandType_SIGN_UP;
-  static constexpr CommandType SIGN_IN =
-    TradeRequest_CommandType_SIGN_IN;
-  static constexpr CommandType MAKE_ORDER =
-    TradeRequest_CommandType_MAKE_ORDER;
-  static constexpr CommandType VIEW_BALANCE =
-    TradeRequest_CommandType_VIEW_BALANCE;
-  static constexpr CommandType VIEW_ALL_ACTIVE_ORDERS =
-    TradeRequest_CommandType_VIEW_ALL_ACTIVE_ORDERS;
-  static constexpr CommandType VIEW_COMPLETED_TRADES =
-    TradeRequest_CommandType_VIEW_COMPLETED_TRADES;
-  static constexpr CommandType VIEW_QUOTE_HISTORY =
-    TradeRequest_CommandType_VIEW_QUOTE_HISTORY;
-  static constexpr CommandType CANCEL_ACTIVE_ORDER =
-    TradeRequest_CommandType_CANCEL_ACTIVE_ORDER;
-  static inline bool CommandType_IsValid(int value) {
-    return TradeRequest_CommandType_IsValid(value);
-  }
-  static constexpr CommandType CommandType_MIN =
-    TradeRequest_CommandType_CommandType_MIN;
-  static constexpr CommandType CommandType_MAX =
-    TradeRequest_CommandType_CommandType_MAX;
-  static constexpr int CommandType_ARRAYSIZE =
-    TradeRequest_CommandType_CommandType_ARRAYSIZE;
+  typedef CancelAllOrders_Side Side;
+  static constexpr Side BOTH =
+    CancelAllOrders_Side_BOTH;
+  static constexpr Side BUY =
+    CancelAllOrders_Side_BUY;
+  static constexpr Side SELL =
+    CancelAllOrders_Side_SELL;
+  static inline bool Side_IsValid(int value) {
+    return CancelAllOrders_Side_IsValid(value);
+  }
+  static constexpr Side Side_MIN =
+    CancelAllOrders_Side_Side_MIN;
+  static constexpr Side Side_MAX =
+    CancelAllOrders_Side_Side_MAX;
+  static constexpr int Side_ARRAYSIZE =
+    CancelAllOrders_Side_Side_ARRAYSIZE;
   static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  CommandType_descriptor() {
-    return TradeRequest_CommandType_descriptor();
+  Side_descriptor() {
+    return CancelAllOrders_Side_descriptor();
   }
   template<typename T>
-  static inline const std::string& CommandType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, CommandType>::value ||
+  static inline const std::string& Side_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Side>::value ||
       ::std::is_integral<T>::value,
-      "Incorrect type passed to function CommandType_Name.");
-    return TradeRequest_CommandType_Name(enum_t_value);
+      "Incorrect type passed to function Side_Name.");
+    return CancelAllOrders_Side_Name(enum_t_value);
   }
-  static inline bool CommandType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      CommandType* value) {
-    return TradeRequest_CommandType_Parse(name, value);
+  static inline bool Side_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Side* value) {
+    return CancelAllOrders_Side_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kUsernameFieldNumber = 2,
-    kJwtFieldNumber = 3,
-    kCommandFieldNumber = 1,
-    kSignUpRequestFieldNumber = 4,
-    kSignInRequestFieldNumber = 5,
-    kOrderFieldNumber = 6,
-    kCancelOrderFieldNumber = 7,
+    kSideFieldNumber = 1,
   };
-  // string username = 2;
-  void clear_username();
-  const std::string& username() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_username(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_username();
-  PROTOBUF_NODISCARD std::string* release_username();
-  void set_allocated_username(std::string* username);
-  private:
-  const std::string& _internal_username() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
-  std::string* _internal_mutable_username();
-  public:
-
-  // string jwt = 3;
-  void clear_jwt();
-  const std::string& jwt() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_jwt(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_jwt();
-  PROTOBUF_NODISCARD std::string* release_jwt();
-  void set_allocated_jwt(std::string* jwt);
-  private:
-  const std::string& _internal_jwt() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_jwt(const std::string& value);
-  std::string* _internal_mutable_jwt();
-  public:
-
-  // .Serialize.TradeRequest.CommandType command = 1;
-  void clear_command();
-  ::Serialize::TradeRequest_CommandType command() const;
-  void set_command(::Serialize::TradeRequest_CommandType value);
-  private:
-  ::Serialize::TradeRequest_CommandType _internal_command() const;
-  void _internal_set_command(::Serialize::TradeRequest_CommandType value);
-  public:
-
-  // .Serialize.SignUpRequest sign_up_request = 4;
-  bool has_sign_up_request() const;
-  private:
-  bool _internal_has_sign_up_request() const;
-  public:
-  void clear_sign_up_request();
-  const ::Serialize::SignUpRequest& sign_up_request() const;
-  PROTOBUF_NODISCARD ::Serialize::SignUpRequest* release_sign_up_request();
-  ::Serialize::SignUpRequest* mutable_sign_up_request();
-  void set_allocated_sign_up_request(::Serialize::SignUpRequest* sign_up_request);
-  private:
-  const ::Serialize::SignUpRequest& _internal_sign_up_request() const;
-  ::Serialize::SignUpRequest* _internal_mutable_sign_up_request();
-  public:
-  void unsafe_arena_set_allocated_sign_up_request(
-      ::Serialize::SignUpRequest* sign_up_request);
-  ::Serialize::SignUpRequest* unsafe_arena_release_sign_up_request();
-
-  // .Serialize.SignInRequest sign_in_request = 5;
-  bool has_sign_in_request() const;
-  private:
-  bool _internal_has_sign_in_request() const;
-  public:
-  void clear_sign_in_request();
-  const ::Serialize::SignInRequest& sign_in_request() const;
-  PROTOBUF_NODISCARD ::Serialize::SignInRequest* release_sign_in_request();
-  ::Serialize::SignInRequest* mutable_sign_in_request();
-  void set_allocated_sign_in_request(::Serialize::SignInRequest* sign_in_request);
-  private:
-  const ::Serialize::SignInRequest& _internal_sign_in_request() const;
-  ::Serialize::SignInRequest* _internal_mutable_sign_in_request();
-  public:
-  void unsafe_arena_set_allocated_sign_in_request(
-      ::Serialize::SignInRequest* sign_in_request);
-  ::Serialize::SignInRequest* unsafe_arena_release_sign_in_request();
-
-  // .Serialize.TradeOrder order = 6;
-  bool has_order() const;
-  private:
-  bool _internal_has_order() const;
-  public:
-  void clear_order();
-  const ::Serialize::TradeOrder& order() const;
-  PROTOBUF_NODISCARD ::Serialize::TradeOrder* release_order();
-  ::Serialize::TradeOrder* mutable_order();
-  void set_allocated_order(::Serialize::TradeOrder* order);
-  private:
-  const ::Serialize::TradeOrder& _internal_order() const;
-  ::Serialize::TradeOrder* _internal_mutable_order();
-  public:
-  void unsafe_arena_set_allocated_order(
-      ::Serialize::TradeOrder* order);
-  ::Serialize::TradeOrder* unsafe_arena_release_order();
-
-  // .Serialize.CancelTradeOrder cancel_order = 7;
-  bool has_cancel_order() const;
-  private:
-  bool _internal_has_cancel_order() const;
-  public:
-  void clear_cancel_order();
-  const ::Serialize::CancelTradeOrder& cancel_order() const;
-  PROTOBUF_NODISCARD ::Serialize::CancelTradeOrder* release_cancel_order();
-  ::Serialize::CancelTradeOrder* mutable_cancel_order();
-  void set_allocated_cancel_order(::Serialize::CancelTradeOrder* cancel_order);
+  // .Serialize.CancelAllOrders.Side side = 1;
+  void clear_side();
+  ::Serialize::CancelAllOrders_Side side() const;
+  void set_side(::Serialize::CancelAllOrders_Side value);
   private:
-  const ::Serialize::CancelTradeOrder& _internal_cancel_order() const;
-  ::Serialize::CancelTradeOrder* _internal_mutable_cancel_order();
+  ::Serialize::CancelAllOrders_Side _internal_side() const;
+  void _internal_set_side(::Serialize::CancelAllOrders_Side value);
   public:
-  void unsafe_arena_set_allocated_cancel_order(
-      ::Serialize::CancelTradeOrder* cancel_order);
-  ::Serialize::CancelTradeOrder* unsafe_arena_release_cancel_order();
 
-  void clear_RequestData();
-  RequestDataCase RequestData_case() const;
-  // @@protoc_insertion_point(class_scope:Serialize.TradeRequest)
+  // @@protoc_insertion_point(class_scope:Serialize.CancelAllOrders)
  private:
   class _Internal;
-  void set_has_sign_up_request();
-  void set_has_sign_in_request();
-  void set_has_order();
-  void set_has_cancel_order();
-
-  inline bool has_RequestData() const;
-  inline void clear_has_RequestData();
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr jwt_;
-    int command_;
-    union RequestDataUnion {
-      constexpr RequestDataUnion() : _constinit_{} {}
-        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
-      ::Serialize::SignUpRequest* sign_up_request_;
-      ::Serialize::SignInRequest* sign_in_request_;
-      ::Serialize::TradeOrder* order_;
-      ::Serialize::CancelTradeOrder* cancel_order_;
-    } RequestData_;
+    int side_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-    uint32_t _oneof_case_[1];
-
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TradeResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.TradeResponse) */ {
+class ModifyTradeOrder final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.ModifyTradeOrder) */ {
  public:
-  inline TradeResponse() : TradeResponse(nullptr) {}
-  ~TradeResponse() override;
-  explicit PROTOBUF_CONSTEXPR TradeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ModifyTradeOrder() : ModifyTradeOrder(nullptr) {}
+  ~ModifyTradeOrder() override;
+  explicit PROTOBUF_CONSTEXPR ModifyTradeOrder(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  TradeResponse(const TradeResponse& from);
-  TradeResponse(TradeResponse&& from) noexcept
-    : TradeResponse() {
+  ModifyTradeOrder(const ModifyTradeOrder& from);
+  ModifyTradeOrder(ModifyTradeOrder&& from) noexcept
+    : ModifyTradeOrder() {
     *this = ::std::move(from);
   }
 
-  inline TradeResponse& operator=(const TradeResponse& from) {
+  inline ModifyTradeOrder& operator=(const ModifyTradeOrder& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TradeResponse& operator=(TradeResponse&& from) noexcept {
+  inline ModifyTradeOrder& operator=(ModifyTradeOrder&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1360,30 +1540,20 @@ class TradeResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const TradeResponse& default_instance() {
+  static const ModifyTradeOrder& default_instance() {
     return *internal_default_instance();
   }
-  enum RequestDataCase {
-    kJwt = 2,
-    kAccountBalance = 3,
-    kActiveOrders = 4,
-    kCompletedOrders = 5,
-    kQuoteHistory = 6,
-    kErrorResponse = 7,
-    REQUESTDATA_NOT_SET = 0,
-  };
-
-  static inline const TradeResponse* internal_default_instance() {
-    return reinterpret_cast<const TradeResponse*>(
-               &_TradeResponse_default_instance_);
+  static inline const ModifyTradeOrder* internal_default_instance() {
+    return reinterpret_cast<const ModifyTradeOrder*>(
+               &_ModifyTradeOrder_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     5;
 
-  friend void swap(TradeResponse& a, TradeResponse& b) {
+  friend void swap(ModifyTradeOrder& a, ModifyTradeOrder& b) {
     a.Swap(&b);
   }
-  inline void Swap(TradeResponse* other) {
+  inline void Swap(ModifyTradeOrder* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1396,7 +1566,7 @@ class TradeResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(TradeResponse* other) {
+  void UnsafeArenaSwap(ModifyTradeOrder* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1404,14 +1574,14 @@ class TradeResponse final :
 
   // implements Message ----------------------------------------------
 
-  TradeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<TradeResponse>(arena);
+  ModifyTradeOrder* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ModifyTradeOrder>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const TradeResponse& from);
+  void CopyFrom(const ModifyTradeOrder& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const TradeResponse& from) {
-    TradeResponse::MergeImpl(*this, from);
+  void MergeFrom( const ModifyTradeOrder& from) {
+    ModifyTradeOrder::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1429,15 +1599,15 @@ class TradeResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(TradeResponse* other);
+  void InternalSwap(ModifyTradeOrder* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "Serialize.TradeResponse";
+    return "Serialize.ModifyTradeOrder";
   }
   protected:
-  explicit TradeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ModifyTradeOrder(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1448,245 +1618,87 @@ class TradeResponse final :
 
   // nested types ----------------------------------------------------
 
-  typedef TradeResponse_status status;
-  static constexpr status ERROR =
-    TradeResponse_status_ERROR;
-  static constexpr status SIGN_UP_SUCCESSFUL =
-    TradeResponse_status_SIGN_UP_SUCCESSFUL;
-  static constexpr status USERNAME_ALREADY_TAKEN =
-    TradeResponse_status_USERNAME_ALREADY_TAKEN;
-  static constexpr status SIGN_IN_SUCCESSFUL =
-    TradeResponse_status_SIGN_IN_SUCCESSFUL;
-  static constexpr status INVALID_USERNAME_OR_PASSWORD =
-    TradeResponse_status_INVALID_USERNAME_OR_PASSWORD;
-  static constexpr status USER_ALREADY_LOGGED_IN =
-    TradeResponse_status_USER_ALREADY_LOGGED_IN;
-  static constexpr status ORDER_SUCCESSFULLY_CREATED =
-    TradeResponse_status_ORDER_SUCCESSFULLY_CREATED;
-  static constexpr status SUCCESS_VIEW_BALANCE =
-    TradeResponse_status_SUCCESS_VIEW_BALANCE;
-  static constexpr status SUCCESS_VIEW_ALL_ACTIVE_ORDERS =
-    TradeResponse_status_SUCCESS_VIEW_ALL_ACTIVE_ORDERS;
-  static constexpr status SUCCESS_VIEW_COMPLETED_TRADES =
-    TradeResponse_status_SUCCESS_VIEW_COMPLETED_TRADES;
-  static constexpr status SUCCESS_VIEW_QUOTE_HISTORY =
-    TradeResponse_status_SUCCESS_VIEW_QUOTE_HISTORY;
-  static constexpr status SUCCESS_CANCEL_ACTIVE_ORDER =
-    TradeResponse_status_SUCCESS_CANCEL_ACTIVE_ORDER;
-  static constexpr status ERROR_CANCEL_ACTIVE_ORDER =
-    TradeResponse_status_ERROR_CANCEL_ACTIVE_ORDER;
-  static constexpr status ORDER_MATCHED =
-    TradeResponse_status_ORDER_MATCHED;
-  static inline bool status_IsValid(int value) {
-    return TradeResponse_status_IsValid(value);
-  }
-  static constexpr status status_MIN =
-    TradeResponse_status_status_MIN;
-  static constexpr status status_MAX =
-    TradeResponse_status_status_MAX;
-  static constexpr int status_ARRAYSIZE =
-    TradeResponse_status_status_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  status_descriptor() {
-    return TradeResponse_status_descriptor();
-  }
-  template<typename T>
-  static inline const std::string& status_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, status>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function status_Name.");
-    return TradeResponse_status_Name(enum_t_value);
-  }
-  static inline bool status_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      status* value) {
-    return TradeResponse_status_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResponseMsgFieldNumber = 1,
-    kJwtFieldNumber = 2,
-    kAccountBalanceFieldNumber = 3,
-    kActiveOrdersFieldNumber = 4,
-    kCompletedOrdersFieldNumber = 5,
-    kQuoteHistoryFieldNumber = 6,
-    kErrorResponseFieldNumber = 7,
+    kOrderIdFieldNumber = 2,
+    kTypeFieldNumber = 1,
+    kUsdAmountFieldNumber = 4,
+    kUsdCostFieldNumber = 3,
   };
-  // .Serialize.TradeResponse.status response_msg = 1;
-  void clear_response_msg();
-  ::Serialize::TradeResponse_status response_msg() const;
-  void set_response_msg(::Serialize::TradeResponse_status value);
-  private:
-  ::Serialize::TradeResponse_status _internal_response_msg() const;
-  void _internal_set_response_msg(::Serialize::TradeResponse_status value);
-  public:
-
-  // string jwt = 2;
-  bool has_jwt() const;
-  private:
-  bool _internal_has_jwt() const;
-  public:
-  void clear_jwt();
-  const std::string& jwt() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_jwt(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_jwt();
-  PROTOBUF_NODISCARD std::string* release_jwt();
-  void set_allocated_jwt(std::string* jwt);
-  private:
-  const std::string& _internal_jwt() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_jwt(const std::string& value);
-  std::string* _internal_mutable_jwt();
-  public:
-
-  // .Serialize.AccountBalance account_balance = 3;
-  bool has_account_balance() const;
-  private:
-  bool _internal_has_account_balance() const;
-  public:
-  void clear_account_balance();
-  const ::Serialize::AccountBalance& account_balance() const;
-  PROTOBUF_NODISCARD ::Serialize::AccountBalance* release_account_balance();
-  ::Serialize::AccountBalance* mutable_account_balance();
-  void set_allocated_account_balance(::Serialize::AccountBalance* account_balance);
-  private:
-  const ::Serialize::AccountBalance& _internal_account_balance() const;
-  ::Serialize::AccountBalance* _internal_mutable_account_balance();
-  public:
-  void unsafe_arena_set_allocated_account_balance(
-      ::Serialize::AccountBalance* account_balance);
-  ::Serialize::AccountBalance* unsafe_arena_release_account_balance();
-
-  // .Serialize.ActiveOrders active_orders = 4;
-  bool has_active_orders() const;
-  private:
-  bool _internal_has_active_orders() const;
-  public:
-  void clear_active_orders();
-  const ::Serialize::ActiveOrders& active_orders() const;
-  PROTOBUF_NODISCARD ::Serialize::ActiveOrders* release_active_orders();
-  ::Serialize::ActiveOrders* mutable_active_orders();
-  void set_allocated_active_orders(::Serialize::ActiveOrders* active_orders);
+  // int64 order_id = 2;
+  void clear_order_id();
+  int64_t order_id() const;
+  void set_order_id(int64_t value);
   private:
-  const ::Serialize::ActiveOrders& _internal_active_orders() const;
-  ::Serialize::ActiveOrders* _internal_mutable_active_orders();
+  int64_t _internal_order_id() const;
+  void _internal_set_order_id(int64_t value);
   public:
-  void unsafe_arena_set_allocated_active_orders(
-      ::Serialize::ActiveOrders* active_orders);
-  ::Serialize::ActiveOrders* unsafe_arena_release_active_orders();
 
-  // .Serialize.CompletedOredrs completed_orders = 5;
-  bool has_completed_orders() const;
-  private:
-  bool _internal_has_completed_orders() const;
-  public:
-  void clear_completed_orders();
-  const ::Serialize::CompletedOredrs& completed_orders() const;
-  PROTOBUF_NODISCARD ::Serialize::CompletedOredrs* release_completed_orders();
-  ::Serialize::CompletedOredrs* mutable_completed_orders();
-  void set_allocated_completed_orders(::Serialize::CompletedOredrs* completed_orders);
+  // .Serialize.TradeOrder.TradeType type = 1;
+  void clear_type();
+  ::Serialize::TradeOrder_TradeType type() const;
+  void set_type(::Serialize::TradeOrder_TradeType value);
   private:
-  const ::Serialize::CompletedOredrs& _internal_completed_orders() const;
-  ::Serialize::CompletedOredrs* _internal_mutable_completed_orders();
+  ::Serialize::TradeOrder_TradeType _internal_type() const;
+  void _internal_set_type(::Serialize::TradeOrder_TradeType value);
   public:
-  void unsafe_arena_set_allocated_completed_orders(
-      ::Serialize::CompletedOredrs* completed_orders);
-  ::Serialize::CompletedOredrs* unsafe_arena_release_completed_orders();
 
-  // .Serialize.QuoteHistory quote_history = 6;
-  bool has_quote_history() const;
-  private:
-  bool _internal_has_quote_history() const;
-  public:
-  void clear_quote_history();
-  const ::Serialize::QuoteHistory& quote_history() const;
-  PROTOBUF_NODISCARD ::Serialize::QuoteHistory* release_quote_history();
-  ::Serialize::QuoteHistory* mutable_quote_history();
-  void set_allocated_quote_history(::Serialize::QuoteHistory* quote_history);
+  // int32 usd_amount = 4;
+  void clear_usd_amount();
+  int32_t usd_amount() const;
+  void set_usd_amount(int32_t value);
   private:
-  const ::Serialize::QuoteHistory& _internal_quote_history() const;
-  ::Serialize::QuoteHistory* _internal_mutable_quote_history();
+  int32_t _internal_usd_amount() const;
+  void _internal_set_usd_amount(int32_t value);
   public:
-  void unsafe_arena_set_allocated_quote_history(
-      ::Serialize::QuoteHistory* quote_history);
-  ::Serialize::QuoteHistory* unsafe_arena_release_quote_history();
 
-  // string error_response = 7;
-  bool has_error_response() const;
-  private:
-  bool _internal_has_error_response() const;
-  public:
-  void clear_error_response();
-  const std::string& error_response() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_error_response(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_error_response();
-  PROTOBUF_NODISCARD std::string* release_error_response();
-  void set_allocated_error_response(std::string* error_response);
+  // double usd_cost = 3;
+  void clear_usd_cost();
+  double usd_cost() const;
+  void set_usd_cost(double value);
   private:
-  const std::string& _internal_error_response() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_response(const std::string& value);
-  std::string* _internal_mutable_error_response();
+  double _internal_usd_cost() const;
+  void _internal_set_usd_cost(double value);
   public:
 
-  void clear_RequestData();
-  RequestDataCase RequestData_case() const;
-  // @@protoc_insertion_point(class_scope:Serialize.TradeResponse)
+  // @@protoc_insertion_point(class_scope:Serialize.ModifyTradeOrder)
  private:
   class _Internal;
-  void set_has_jwt();
-  void set_has_account_balance();
-  void set_has_active_orders();
-  void set_has_completed_orders();
-  void set_has_quote_history();
-  void set_has_error_response();
-
-  inline bool has_RequestData() const;
-  inline void clear_has_RequestData();
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int response_msg_;
-    union RequestDataUnion {
-      constexpr RequestDataUnion() : _constinit_{} {}
-        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
-      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr jwt_;
-      ::Serialize::AccountBalance* account_balance_;
-      ::Serialize::ActiveOrders* active_orders_;
-      ::Serialize::CompletedOredrs* completed_orders_;
-      ::Serialize::QuoteHistory* quote_history_;
-      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_response_;
-    } RequestData_;
+    int64_t order_id_;
+    int type_;
+    int32_t usd_amount_;
+    double usd_cost_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-    uint32_t _oneof_case_[1];
-
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ClientBalance final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.ClientBalance) */ {
+class DepthRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.DepthRequest) */ {
  public:
-  inline ClientBalance() : ClientBalance(nullptr) {}
-  ~ClientBalance() override;
-  explicit PROTOBUF_CONSTEXPR ClientBalance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline DepthRequest() : DepthRequest(nullptr) {}
+  ~DepthRequest() override;
+  explicit PROTOBUF_CONSTEXPR DepthRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClientBalance(const ClientBalance& from);
-  ClientBalance(ClientBalance&& from) noexcept
-    : ClientBalance() {
+  DepthRequest(const DepthRequest& from);
+  DepthRequest(DepthRequest&& from) noexcept
+    : DepthRequest() {
     *this = ::std::move(from);
   }
 
-  inline ClientBalance& operator=(const ClientBalance& from) {
+  inline DepthRequest& operator=(const DepthRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClientBalance& operator=(ClientBalance&& from) noexcept {
+  inline DepthRequest& operator=(DepthRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1709,20 +1721,20 @@ class ClientBalance final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClientBalance& default_instance() {
+  static const DepthRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClientBalance* internal_default_instance() {
-    return reinterpret_cast<const ClientBalance*>(
-               &_ClientBalance_default_instance_);
+  static inline const DepthRequest* internal_default_instance() {
+    return reinterpret_cast<const DepthRequest*>(
+               &_DepthRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     6;
 
-  friend void swap(ClientBalance& a, ClientBalance& b) {
+  friend void swap(DepthRequest& a, DepthRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClientBalance* other) {
+  inline void Swap(DepthRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1735,7 +1747,7 @@ class ClientBalance final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClientBalance* other) {
+  void UnsafeArenaSwap(DepthRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1743,14 +1755,14 @@ class ClientBalance final :
 
   // implements Message ----------------------------------------------
 
-  ClientBalance* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ClientBalance>(arena);
+  DepthRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DepthRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ClientBalance& from);
+  void CopyFrom(const DepthRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ClientBalance& from) {
-    ClientBalance::MergeImpl(*this, from);
+  void MergeFrom( const DepthRequest& from) {
+    DepthRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1768,15 +1780,15 @@ class ClientBalance final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClientBalance* other);
+  void InternalSwap(DepthRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "Serialize.ClientBalance";
+    return "Serialize.DepthRequest";
   }
   protected:
-  explicit ClientBalance(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit DepthRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1790,42 +1802,18 @@ class ClientBalance final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kUsernameFieldNumber = 1,
-    kFundsFieldNumber = 2,
+    kLevelsFieldNumber = 1,
   };
-  // string username = 1;
-  void clear_username();
-  const std::string& username() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_username(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_username();
-  PROTOBUF_NODISCARD std::string* release_username();
-  void set_allocated_username(std::string* username);
-  private:
-  const std::string& _internal_username() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
-  std::string* _internal_mutable_username();
-  public:
-
-  // .Serialize.AccountBalance funds = 2;
-  bool has_funds() const;
-  private:
-  bool _internal_has_funds() const;
-  public:
-  void clear_funds();
-  const ::Serialize::AccountBalance& funds() const;
-  PROTOBUF_NODISCARD ::Serialize::AccountBalance* release_funds();
-  ::Serialize::AccountBalance* mutable_funds();
-  void set_allocated_funds(::Serialize::AccountBalance* funds);
+  // int32 levels = 1;
+  void clear_levels();
+  int32_t levels() const;
+  void set_levels(int32_t value);
   private:
-  const ::Serialize::AccountBalance& _internal_funds() const;
-  ::Serialize::AccountBalance* _internal_mutable_funds();
+  int32_t _internal_levels() const;
+  void _internal_set_levels(int32_t value);
   public:
-  void unsafe_arena_set_allocated_funds(
-      ::Serialize::AccountBalance* funds);
-  ::Serialize::AccountBalance* unsafe_arena_release_funds();
 
-  // @@protoc_insertion_point(class_scope:Serialize.ClientBalance)
+  // @@protoc_insertion_point(class_scope:Serialize.DepthRequest)
  private:
   class _Internal;
 
@@ -1833,8 +1821,7 @@ class ClientBalance final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
-    ::Serialize::AccountBalance* funds_;
+    int32_t levels_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1842,24 +1829,24 @@ class ClientBalance final :
 };
 // -------------------------------------------------------------------
 
-class AccountBalance final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.AccountBalance) */ {
+class CandlesRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.CandlesRequest) */ {
  public:
-  inline AccountBalance() : AccountBalance(nullptr) {}
-  ~AccountBalance() override;
-  explicit PROTOBUF_CONSTEXPR AccountBalance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline CandlesRequest() : CandlesRequest(nullptr) {}
+  ~CandlesRequest() override;
+  explicit PROTOBUF_CONSTEXPR CandlesRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AccountBalance(const AccountBalance& from);
-  AccountBalance(AccountBalance&& from) noexcept
-    : AccountBalance() {
+  CandlesRequest(const CandlesRequest& from);
+  CandlesRequest(CandlesRequest&& from) noexcept
+    : CandlesRequest() {
     *this = ::std::move(from);
   }
 
-  inline AccountBalance& operator=(const AccountBalance& from) {
+  inline CandlesRequest& operator=(const CandlesRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AccountBalance& operator=(AccountBalance&& from) noexcept {
+  inline CandlesRequest& operator=(CandlesRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1882,20 +1869,20 @@ class AccountBalance final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const AccountBalance& default_instance() {
+  static const CandlesRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const AccountBalance* internal_default_instance() {
-    return reinterpret_cast<const AccountBalance*>(
-               &_AccountBalance_default_instance_);
+  static inline const CandlesRequest* internal_default_instance() {
+    return reinterpret_cast<const CandlesRequest*>(
+               &_CandlesRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     7;
 
-  friend void swap(AccountBalance& a, AccountBalance& b) {
+  friend void swap(CandlesRequest& a, CandlesRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(AccountBalance* other) {
+  inline void Swap(CandlesRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1908,7 +1895,7 @@ class AccountBalance final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AccountBalance* other) {
+  void UnsafeArenaSwap(CandlesRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1916,14 +1903,14 @@ class AccountBalance final :
 
   // implements Message ----------------------------------------------
 
-  AccountBalance* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<AccountBalance>(arena);
+  CandlesRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CandlesRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const AccountBalance& from);
+  void CopyFrom(const CandlesRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const AccountBalance& from) {
-    AccountBalance::MergeImpl(*this, from);
+  void MergeFrom( const CandlesRequest& from) {
+    CandlesRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1941,15 +1928,15 @@ class AccountBalance final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(AccountBalance* other);
+  void InternalSwap(CandlesRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "Serialize.AccountBalance";
+    return "Serialize.CandlesRequest";
   }
   protected:
-  explicit AccountBalance(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit CandlesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1963,28 +1950,38 @@ class AccountBalance final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kUsdBalanceFieldNumber = 1,
-    kRubBalanceFieldNumber = 2,
+    kFromTimestampFieldNumber = 2,
+    kToTimestampFieldNumber = 3,
+    kResolutionFieldNumber = 1,
   };
-  // double usd_balance = 1;
-  void clear_usd_balance();
-  double usd_balance() const;
-  void set_usd_balance(double value);
+  // int64 from_timestamp = 2;
+  void clear_from_timestamp();
+  int64_t from_timestamp() const;
+  void set_from_timestamp(int64_t value);
   private:
-  double _internal_usd_balance() const;
-  void _internal_set_usd_balance(double value);
+  int64_t _internal_from_timestamp() const;
+  void _internal_set_from_timestamp(int64_t value);
   public:
 
-  // double rub_balance = 2;
-  void clear_rub_balance();
-  double rub_balance() const;
-  void set_rub_balance(double value);
+  // int64 to_timestamp = 3;
+  void clear_to_timestamp();
+  int64_t to_timestamp() const;
+  void set_to_timestamp(int64_t value);
   private:
-  double _internal_rub_balance() const;
-  void _internal_set_rub_balance(double value);
+  int64_t _internal_to_timestamp() const;
+  void _internal_set_to_timestamp(int64_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:Serialize.AccountBalance)
+  // .Serialize.CandleResolution resolution = 1;
+  void clear_resolution();
+  ::Serialize::CandleResolution resolution() const;
+  void set_resolution(::Serialize::CandleResolution value);
+  private:
+  ::Serialize::CandleResolution _internal_resolution() const;
+  void _internal_set_resolution(::Serialize::CandleResolution value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Serialize.CandlesRequest)
  private:
   class _Internal;
 
@@ -1992,8 +1989,9 @@ class AccountBalance final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    double usd_balance_;
-    double rub_balance_;
+    int64_t from_timestamp_;
+    int64_t to_timestamp_;
+    int resolution_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2001,24 +1999,24 @@ class AccountBalance final :
 };
 // -------------------------------------------------------------------
 
-class ActiveOrders final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.ActiveOrders) */ {
+class TradeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.TradeRequest) */ {
  public:
-  inline ActiveOrders() : ActiveOrders(nullptr) {}
-  ~ActiveOrders() override;
-  explicit PROTOBUF_CONSTEXPR ActiveOrders(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline TradeRequest() : TradeRequest(nullptr) {}
+  ~TradeRequest() override;
+  explicit PROTOBUF_CONSTEXPR TradeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ActiveOrders(const ActiveOrders& from);
-  ActiveOrders(ActiveOrders&& from) noexcept
-    : ActiveOrders() {
+  TradeRequest(const TradeRequest& from);
+  TradeRequest(TradeRequest&& from) noexcept
+    : TradeRequest() {
     *this = ::std::move(from);
   }
 
-  inline ActiveOrders& operator=(const ActiveOrders& from) {
+  inline TradeRequest& operator=(const TradeRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ActiveOrders& operator=(ActiveOrders&& from) noexcept {
+  inline TradeRequest& operator=(TradeRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2041,20 +2039,32 @@ class ActiveOrders final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ActiveOrders& default_instance() {
+  static const TradeRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ActiveOrders* internal_default_instance() {
-    return reinterpret_cast<const ActiveOrders*>(
-               &_ActiveOrders_default_instance_);
+  enum RequestDataCase {
+    kSignUpRequest = 4,
+    kSignInRequest = 5,
+    kOrder = 6,
+    kCancelOrder = 7,
+    kDepthRequest = 8,
+    kCandlesRequest = 9,
+    kModifyOrder = 10,
+    kCancelAll = 11,
+    REQUESTDATA_NOT_SET = 0,
+  };
+
+  static inline const TradeRequest* internal_default_instance() {
+    return reinterpret_cast<const TradeRequest*>(
+               &_TradeRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     8;
 
-  friend void swap(ActiveOrders& a, ActiveOrders& b) {
+  friend void swap(TradeRequest& a, TradeRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(ActiveOrders* other) {
+  inline void Swap(TradeRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2067,7 +2077,7 @@ class ActiveOrders final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ActiveOrders* other) {
+  void UnsafeArenaSwap(TradeRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2075,14 +2085,14 @@ class ActiveOrders final :
 
   // implements Message ----------------------------------------------
 
-  ActiveOrders* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ActiveOrders>(arena);
+  TradeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TradeRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ActiveOrders& from);
+  void CopyFrom(const TradeRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ActiveOrders& from) {
-    ActiveOrders::MergeImpl(*this, from);
+  void MergeFrom( const TradeRequest& from) {
+    TradeRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2100,15 +2110,15 @@ class ActiveOrders final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ActiveOrders* other);
+  void InternalSwap(TradeRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "Serialize.ActiveOrders";
+    return "Serialize.TradeRequest";
   }
   protected:
-  explicit ActiveOrders(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit TradeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2119,83 +2129,319 @@ class ActiveOrders final :
 
   // nested types ----------------------------------------------------
 
+  typedef TradeRequest_CommandType CommandType;
+  static constexpr CommandType SIGN_UP =
+    TradeRequest_CommandType_SIGN_UP;
+  static constexpr CommandType SIGN_IN =
+    TradeRequest_CommandType_SIGN_IN;
+  static constexpr CommandType MAKE_ORDER =
+    TradeRequest_CommandType_MAKE_ORDER;
+  static constexpr CommandType VIEW_BALANCE =
+    TradeRequest_CommandType_VIEW_BALANCE;
+  static constexpr CommandType VIEW_ALL_ACTIVE_ORDERS =
+    TradeRequest_CommandType_VIEW_ALL_ACTIVE_ORDERS;
+  static constexpr CommandType VIEW_COMPLETED_TRADES =
+    TradeRequest_CommandType_VIEW_COMPLETED_TRADES;
+  static constexpr CommandType VIEW_QUOTE_HISTORY =
+    TradeRequest_CommandType_VIEW_QUOTE_HISTORY;
+  static constexpr CommandType CANCEL_ACTIVE_ORDER =
+    TradeRequest_CommandType_CANCEL_ACTIVE_ORDER;
+  static constexpr CommandType VIEW_DEPTH =
+    TradeRequest_CommandType_VIEW_DEPTH;
+  static constexpr CommandType VIEW_MY_ACTIVE_ORDERS =
+    TradeRequest_CommandType_VIEW_MY_ACTIVE_ORDERS;
+  static constexpr CommandType VIEW_CANDLES =
+    TradeRequest_CommandType_VIEW_CANDLES;
+  static constexpr CommandType VIEW_TRADES =
+    TradeRequest_CommandType_VIEW_TRADES;
+  static constexpr CommandType MODIFY_ORDER =
+    TradeRequest_CommandType_MODIFY_ORDER;
+  static constexpr CommandType CANCEL_ALL =
+    TradeRequest_CommandType_CANCEL_ALL;
+  static inline bool CommandType_IsValid(int value) {
+    return TradeRequest_CommandType_IsValid(value);
+  }
+  static constexpr CommandType CommandType_MIN =
+    TradeRequest_CommandType_CommandType_MIN;
+  static constexpr CommandType CommandType_MAX =
+    TradeRequest_CommandType_CommandType_MAX;
+  static constexpr int CommandType_ARRAYSIZE =
+    TradeRequest_CommandType_CommandType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CommandType_descriptor() {
+    return TradeRequest_CommandType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CommandType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CommandType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CommandType_Name.");
+    return TradeRequest_CommandType_Name(enum_t_value);
+  }
+  static inline bool CommandType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CommandType* value) {
+    return TradeRequest_CommandType_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kActiveBuyOrdersFieldNumber = 1,
-    kActiveSellOrdersFieldNumber = 2,
+    kUsernameFieldNumber = 2,
+    kJwtFieldNumber = 3,
+    kCommandFieldNumber = 1,
+    kSignUpRequestFieldNumber = 4,
+    kSignInRequestFieldNumber = 5,
+    kOrderFieldNumber = 6,
+    kCancelOrderFieldNumber = 7,
+    kDepthRequestFieldNumber = 8,
+    kCandlesRequestFieldNumber = 9,
+    kModifyOrderFieldNumber = 10,
+    kCancelAllFieldNumber = 11,
   };
-  // repeated .Serialize.TradeOrder active_buy_orders = 1;
-  int active_buy_orders_size() const;
+  // string username = 2;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
   private:
-  int _internal_active_buy_orders_size() const;
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
   public:
-  void clear_active_buy_orders();
-  ::Serialize::TradeOrder* mutable_active_buy_orders(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >*
-      mutable_active_buy_orders();
+
+  // string jwt = 3;
+  void clear_jwt();
+  const std::string& jwt() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_jwt(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_jwt();
+  PROTOBUF_NODISCARD std::string* release_jwt();
+  void set_allocated_jwt(std::string* jwt);
   private:
-  const ::Serialize::TradeOrder& _internal_active_buy_orders(int index) const;
-  ::Serialize::TradeOrder* _internal_add_active_buy_orders();
+  const std::string& _internal_jwt() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_jwt(const std::string& value);
+  std::string* _internal_mutable_jwt();
   public:
-  const ::Serialize::TradeOrder& active_buy_orders(int index) const;
-  ::Serialize::TradeOrder* add_active_buy_orders();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >&
-      active_buy_orders() const;
 
-  // repeated .Serialize.TradeOrder active_sell_orders = 2;
-  int active_sell_orders_size() const;
+  // .Serialize.TradeRequest.CommandType command = 1;
+  void clear_command();
+  ::Serialize::TradeRequest_CommandType command() const;
+  void set_command(::Serialize::TradeRequest_CommandType value);
   private:
-  int _internal_active_sell_orders_size() const;
+  ::Serialize::TradeRequest_CommandType _internal_command() const;
+  void _internal_set_command(::Serialize::TradeRequest_CommandType value);
   public:
-  void clear_active_sell_orders();
-  ::Serialize::TradeOrder* mutable_active_sell_orders(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >*
-      mutable_active_sell_orders();
+
+  // .Serialize.SignUpRequest sign_up_request = 4;
+  bool has_sign_up_request() const;
   private:
-  const ::Serialize::TradeOrder& _internal_active_sell_orders(int index) const;
-  ::Serialize::TradeOrder* _internal_add_active_sell_orders();
+  bool _internal_has_sign_up_request() const;
   public:
-  const ::Serialize::TradeOrder& active_sell_orders(int index) const;
-  ::Serialize::TradeOrder* add_active_sell_orders();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >&
-      active_sell_orders() const;
+  void clear_sign_up_request();
+  const ::Serialize::SignUpRequest& sign_up_request() const;
+  PROTOBUF_NODISCARD ::Serialize::SignUpRequest* release_sign_up_request();
+  ::Serialize::SignUpRequest* mutable_sign_up_request();
+  void set_allocated_sign_up_request(::Serialize::SignUpRequest* sign_up_request);
+  private:
+  const ::Serialize::SignUpRequest& _internal_sign_up_request() const;
+  ::Serialize::SignUpRequest* _internal_mutable_sign_up_request();
+  public:
+  void unsafe_arena_set_allocated_sign_up_request(
+      ::Serialize::SignUpRequest* sign_up_request);
+  ::Serialize::SignUpRequest* unsafe_arena_release_sign_up_request();
 
-  // @@protoc_insertion_point(class_scope:Serialize.ActiveOrders)
+  // .Serialize.SignInRequest sign_in_request = 5;
+  bool has_sign_in_request() const;
+  private:
+  bool _internal_has_sign_in_request() const;
+  public:
+  void clear_sign_in_request();
+  const ::Serialize::SignInRequest& sign_in_request() const;
+  PROTOBUF_NODISCARD ::Serialize::SignInRequest* release_sign_in_request();
+  ::Serialize::SignInRequest* mutable_sign_in_request();
+  void set_allocated_sign_in_request(::Serialize::SignInRequest* sign_in_request);
+  private:
+  const ::Serialize::SignInRequest& _internal_sign_in_request() const;
+  ::Serialize::SignInRequest* _internal_mutable_sign_in_request();
+  public:
+  void unsafe_arena_set_allocated_sign_in_request(
+      ::Serialize::SignInRequest* sign_in_request);
+  ::Serialize::SignInRequest* unsafe_arena_release_sign_in_request();
+
+  // .Serialize.TradeOrder order = 6;
+  bool has_order() const;
+  private:
+  bool _internal_has_order() const;
+  public:
+  void clear_order();
+  const ::Serialize::TradeOrder& order() const;
+  PROTOBUF_NODISCARD ::Serialize::TradeOrder* release_order();
+  ::Serialize::TradeOrder* mutable_order();
+  void set_allocated_order(::Serialize::TradeOrder* order);
+  private:
+  const ::Serialize::TradeOrder& _internal_order() const;
+  ::Serialize::TradeOrder* _internal_mutable_order();
+  public:
+  void unsafe_arena_set_allocated_order(
+      ::Serialize::TradeOrder* order);
+  ::Serialize::TradeOrder* unsafe_arena_release_order();
+
+  // .Serialize.CancelTradeOrder cancel_order = 7;
+  bool has_cancel_order() const;
+  private:
+  bool _internal_has_cancel_order() const;
+  public:
+  void clear_cancel_order();
+  const ::Serialize::CancelTradeOrder& cancel_order() const;
+  PROTOBUF_NODISCARD ::Serialize::CancelTradeOrder* release_cancel_order();
+  ::Serialize::CancelTradeOrder* mutable_cancel_order();
+  void set_allocated_cancel_order(::Serialize::CancelTradeOrder* cancel_order);
+  private:
+  const ::Serialize::CancelTradeOrder& _internal_cancel_order() const;
+  ::Serialize::CancelTradeOrder* _internal_mutable_cancel_order();
+  public:
+  void unsafe_arena_set_allocated_cancel_order(
+      ::Serialize::CancelTradeOrder* cancel_order);
+  ::Serialize::CancelTradeOrder* unsafe_arena_release_cancel_order();
+
+  // .Serialize.DepthRequest depth_request = 8;
+  bool has_depth_request() const;
+  private:
+  bool _internal_has_depth_request() const;
+  public:
+  void clear_depth_request();
+  const ::Serialize::DepthRequest& depth_request() const;
+  PROTOBUF_NODISCARD ::Serialize::DepthRequest* release_depth_request();
+  ::Serialize::DepthRequest* mutable_depth_request();
+  void set_allocated_depth_request(::Serialize::DepthRequest* depth_request);
+  private:
+  const ::Serialize::DepthRequest& _internal_depth_request() const;
+  ::Serialize::DepthRequest* _internal_mutable_depth_request();
+  public:
+  void unsafe_arena_set_allocated_depth_request(
+      ::Serialize::DepthRequest* depth_request);
+  ::Serialize::DepthRequest* unsafe_arena_release_depth_request();
+
+  // .Serialize.CandlesRequest candles_request = 9;
+  bool has_candles_request() const;
+  private:
+  bool _internal_has_candles_request() const;
+  public:
+  void clear_candles_request();
+  const ::Serialize::CandlesRequest& candles_request() const;
+  PROTOBUF_NODISCARD ::Serialize::CandlesRequest* release_candles_request();
+  ::Serialize::CandlesRequest* mutable_candles_request();
+  void set_allocated_candles_request(::Serialize::CandlesRequest* candles_request);
+  private:
+  const ::Serialize::CandlesRequest& _internal_candles_request() const;
+  ::Serialize::CandlesRequest* _internal_mutable_candles_request();
+  public:
+  void unsafe_arena_set_allocated_candles_request(
+      ::Serialize::CandlesRequest* candles_request);
+  ::Serialize::CandlesRequest* unsafe_arena_release_candles_request();
+
+  // .Serialize.ModifyTradeOrder modify_order = 10;
+  bool has_modify_order() const;
+  private:
+  bool _internal_has_modify_order() const;
+  public:
+  void clear_modify_order();
+  const ::Serialize::ModifyTradeOrder& modify_order() const;
+  PROTOBUF_NODISCARD ::Serialize::ModifyTradeOrder* release_modify_order();
+  ::Serialize::ModifyTradeOrder* mutable_modify_order();
+  void set_allocated_modify_order(::Serialize::ModifyTradeOrder* modify_order);
+  private:
+  const ::Serialize::ModifyTradeOrder& _internal_modify_order() const;
+  ::Serialize::ModifyTradeOrder* _internal_mutable_modify_order();
+  public:
+  void unsafe_arena_set_allocated_modify_order(
+      ::Serialize::ModifyTradeOrder* modify_order);
+  ::Serialize::ModifyTradeOrder* unsafe_arena_release_modify_order();
+
+  // .Serialize.CancelAllOrders cancel_all = 11;
+  bool has_cancel_all() const;
+  private:
+  bool _internal_has_cancel_all() const;
+  public:
+  void clear_cancel_all();
+  const ::Serialize::CancelAllOrders& cancel_all() const;
+  PROTOBUF_NODISCARD ::Serialize::CancelAllOrders* release_cancel_all();
+  ::Serialize::CancelAllOrders* mutable_cancel_all();
+  void set_allocated_cancel_all(::Serialize::CancelAllOrders* cancel_all);
+  private:
+  const ::Serialize::CancelAllOrders& _internal_cancel_all() const;
+  ::Serialize::CancelAllOrders* _internal_mutable_cancel_all();
+  public:
+  void unsafe_arena_set_allocated_cancel_all(
+      ::Serialize::CancelAllOrders* cancel_all);
+  ::Serialize::CancelAllOrders* unsafe_arena_release_cancel_all();
+
+  void clear_RequestData();
+  RequestDataCase RequestData_case() const;
+  // @@protoc_insertion_point(class_scope:Serialize.TradeRequest)
  private:
   class _Internal;
+  void set_has_sign_up_request();
+  void set_has_sign_in_request();
+  void set_has_order();
+  void set_has_cancel_order();
+  void set_has_depth_request();
+  void set_has_candles_request();
+  void set_has_modify_order();
+  void set_has_cancel_all();
+
+  inline bool has_RequestData() const;
+  inline void clear_has_RequestData();
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder > active_buy_orders_;
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder > active_sell_orders_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr jwt_;
+    int command_;
+    union RequestDataUnion {
+      constexpr RequestDataUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::Serialize::SignUpRequest* sign_up_request_;
+      ::Serialize::SignInRequest* sign_in_request_;
+      ::Serialize::TradeOrder* order_;
+      ::Serialize::CancelTradeOrder* cancel_order_;
+      ::Serialize::DepthRequest* depth_request_;
+      ::Serialize::CandlesRequest* candles_request_;
+      ::Serialize::ModifyTradeOrder* modify_order_;
+      ::Serialize::CancelAllOrders* cancel_all_;
+    } RequestData_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CompletedOredrs final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.CompletedOredrs) */ {
+class TradeResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.TradeResponse) */ {
  public:
-  inline CompletedOredrs() : CompletedOredrs(nullptr) {}
-  ~CompletedOredrs() override;
-  explicit PROTOBUF_CONSTEXPR CompletedOredrs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline TradeResponse() : TradeResponse(nullptr) {}
+  ~TradeResponse() override;
+  explicit PROTOBUF_CONSTEXPR TradeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CompletedOredrs(const CompletedOredrs& from);
-  CompletedOredrs(CompletedOredrs&& from) noexcept
-    : CompletedOredrs() {
+  TradeResponse(const TradeResponse& from);
+  TradeResponse(TradeResponse&& from) noexcept
+    : TradeResponse() {
     *this = ::std::move(from);
   }
 
-  inline CompletedOredrs& operator=(const CompletedOredrs& from) {
+  inline TradeResponse& operator=(const TradeResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline CompletedOredrs& operator=(CompletedOredrs&& from) noexcept {
+  inline TradeResponse& operator=(TradeResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2218,20 +2464,35 @@ class CompletedOredrs final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const CompletedOredrs& default_instance() {
+  static const TradeResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const CompletedOredrs* internal_default_instance() {
-    return reinterpret_cast<const CompletedOredrs*>(
-               &_CompletedOredrs_default_instance_);
+  enum RequestDataCase {
+    kJwt = 2,
+    kAccountBalance = 3,
+    kActiveOrders = 4,
+    kCompletedOrders = 5,
+    kQuoteHistory = 6,
+    kErrorResponse = 7,
+    kExecutionReport = 8,
+    kMarketDepth = 9,
+    kCandles = 10,
+    kTrades = 11,
+    kCanceledOrdersCount = 12,
+    REQUESTDATA_NOT_SET = 0,
+  };
+
+  static inline const TradeResponse* internal_default_instance() {
+    return reinterpret_cast<const TradeResponse*>(
+               &_TradeResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     9;
 
-  friend void swap(CompletedOredrs& a, CompletedOredrs& b) {
+  friend void swap(TradeResponse& a, TradeResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(CompletedOredrs* other) {
+  inline void Swap(TradeResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2244,7 +2505,7 @@ class CompletedOredrs final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(CompletedOredrs* other) {
+  void UnsafeArenaSwap(TradeResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2252,14 +2513,14 @@ class CompletedOredrs final :
 
   // implements Message ----------------------------------------------
 
-  CompletedOredrs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<CompletedOredrs>(arena);
+  TradeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TradeResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const CompletedOredrs& from);
+  void CopyFrom(const TradeResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const CompletedOredrs& from) {
-    CompletedOredrs::MergeImpl(*this, from);
+  void MergeFrom( const TradeResponse& from) {
+    TradeResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2277,15 +2538,15 @@ class CompletedOredrs final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(CompletedOredrs* other);
+  void InternalSwap(TradeResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "Serialize.CompletedOredrs";
+    return "Serialize.TradeResponse";
   }
   protected:
-  explicit CompletedOredrs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit TradeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2296,83 +2557,361 @@ class CompletedOredrs final :
 
   // nested types ----------------------------------------------------
 
+  typedef TradeResponse_status status;
+  static constexpr status ERROR =
+    TradeResponse_status_ERROR;
+  static constexpr status SIGN_UP_SUCCESSFUL =
+    TradeResponse_status_SIGN_UP_SUCCESSFUL;
+  static constexpr status USERNAME_ALREADY_TAKEN =
+    TradeResponse_status_USERNAME_ALREADY_TAKEN;
+  static constexpr status SIGN_IN_SUCCESSFUL =
+    TradeResponse_status_SIGN_IN_SUCCESSFUL;
+  static constexpr status INVALID_USERNAME_OR_PASSWORD =
+    TradeResponse_status_INVALID_USERNAME_OR_PASSWORD;
+  static constexpr status USER_ALREADY_LOGGED_IN =
+    TradeResponse_status_USER_ALREADY_LOGGED_IN;
+  static constexpr status ORDER_SUCCESSFULLY_CREATED =
+    TradeResponse_status_ORDER_SUCCESSFULLY_CREATED;
+  static constexpr status SUCCESS_VIEW_BALANCE =
+    TradeResponse_status_SUCCESS_VIEW_BALANCE;
+  static constexpr status SUCCESS_VIEW_ALL_ACTIVE_ORDERS =
+    TradeResponse_status_SUCCESS_VIEW_ALL_ACTIVE_ORDERS;
+  static constexpr status SUCCESS_VIEW_COMPLETED_TRADES =
+    TradeResponse_status_SUCCESS_VIEW_COMPLETED_TRADES;
+  static constexpr status SUCCESS_VIEW_QUOTE_HISTORY =
+    TradeResponse_status_SUCCESS_VIEW_QUOTE_HISTORY;
+  static constexpr status SUCCESS_CANCEL_ACTIVE_ORDER =
+    TradeResponse_status_SUCCESS_CANCEL_ACTIVE_ORDER;
+  static constexpr status ERROR_CANCEL_ACTIVE_ORDER =
+    TradeResponse_status_ERROR_CANCEL_ACTIVE_ORDER;
+  static constexpr status ORDER_MATCHED =
+    TradeResponse_status_ORDER_MATCHED;
+  static constexpr status SUCCESS_VIEW_DEPTH =
+    TradeResponse_status_SUCCESS_VIEW_DEPTH;
+  static constexpr status SUCCESS_VIEW_MY_ACTIVE_ORDERS =
+    TradeResponse_status_SUCCESS_VIEW_MY_ACTIVE_ORDERS;
+  static constexpr status SUCCESS_VIEW_CANDLES =
+    TradeResponse_status_SUCCESS_VIEW_CANDLES;
+  static constexpr status SUCCESS_VIEW_TRADES =
+    TradeResponse_status_SUCCESS_VIEW_TRADES;
+  static constexpr status ORDER_REJECTED_BY_RISK =
+    TradeResponse_status_ORDER_REJECTED_BY_RISK;
+  static constexpr status SUCCESS_MODIFY_ORDER =
+    TradeResponse_status_SUCCESS_MODIFY_ORDER;
+  static constexpr status ERROR_MODIFY_ORDER =
+    TradeResponse_status_ERROR_MODIFY_ORDER;
+  static constexpr status SUCCESS_CANCEL_ALL =
+    TradeResponse_status_SUCCESS_CANCEL_ALL;
+  static inline bool status_IsValid(int value) {
+    return TradeResponse_status_IsValid(value);
+  }
+  static constexpr status status_MIN =
+    TradeResponse_status_status_MIN;
+  static constexpr status status_MAX =
+    TradeResponse_status_status_MAX;
+  static constexpr int status_ARRAYSIZE =
+    TradeResponse_status_status_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  status_descriptor() {
+    return TradeResponse_status_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& status_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, status>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function status_Name.");
+    return TradeResponse_status_Name(enum_t_value);
+  }
+  static inline bool status_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      status* value) {
+    return TradeResponse_status_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kCompletedBuyOrdersFieldNumber = 1,
-    kCompletedSellOrdersFieldNumber = 2,
-  };
-  // repeated .Serialize.TradeOrder completed_buy_orders = 1;
-  int completed_buy_orders_size() const;
-  private:
-  int _internal_completed_buy_orders_size() const;
+    kResponseMsgFieldNumber = 1,
+    kJwtFieldNumber = 2,
+    kAccountBalanceFieldNumber = 3,
+    kActiveOrdersFieldNumber = 4,
+    kCompletedOrdersFieldNumber = 5,
+    kQuoteHistoryFieldNumber = 6,
+    kErrorResponseFieldNumber = 7,
+    kExecutionReportFieldNumber = 8,
+    kMarketDepthFieldNumber = 9,
+    kCandlesFieldNumber = 10,
+    kTradesFieldNumber = 11,
+    kCanceledOrdersCountFieldNumber = 12,
+  };
+  // .Serialize.TradeResponse.status response_msg = 1;
+  void clear_response_msg();
+  ::Serialize::TradeResponse_status response_msg() const;
+  void set_response_msg(::Serialize::TradeResponse_status value);
+  private:
+  ::Serialize::TradeResponse_status _internal_response_msg() const;
+  void _internal_set_response_msg(::Serialize::TradeResponse_status value);
   public:
-  void clear_completed_buy_orders();
-  ::Serialize::TradeOrder* mutable_completed_buy_orders(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >*
-      mutable_completed_buy_orders();
+
+  // string jwt = 2;
+  bool has_jwt() const;
   private:
-  const ::Serialize::TradeOrder& _internal_completed_buy_orders(int index) const;
-  ::Serialize::TradeOrder* _internal_add_completed_buy_orders();
+  bool _internal_has_jwt() const;
+  public:
+  void clear_jwt();
+  const std::string& jwt() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_jwt(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_jwt();
+  PROTOBUF_NODISCARD std::string* release_jwt();
+  void set_allocated_jwt(std::string* jwt);
+  private:
+  const std::string& _internal_jwt() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_jwt(const std::string& value);
+  std::string* _internal_mutable_jwt();
   public:
-  const ::Serialize::TradeOrder& completed_buy_orders(int index) const;
-  ::Serialize::TradeOrder* add_completed_buy_orders();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >&
-      completed_buy_orders() const;
 
-  // repeated .Serialize.TradeOrder completed_sell_orders = 2;
-  int completed_sell_orders_size() const;
+  // .Serialize.AccountBalance account_balance = 3;
+  bool has_account_balance() const;
   private:
-  int _internal_completed_sell_orders_size() const;
+  bool _internal_has_account_balance() const;
   public:
-  void clear_completed_sell_orders();
-  ::Serialize::TradeOrder* mutable_completed_sell_orders(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >*
-      mutable_completed_sell_orders();
+  void clear_account_balance();
+  const ::Serialize::AccountBalance& account_balance() const;
+  PROTOBUF_NODISCARD ::Serialize::AccountBalance* release_account_balance();
+  ::Serialize::AccountBalance* mutable_account_balance();
+  void set_allocated_account_balance(::Serialize::AccountBalance* account_balance);
   private:
-  const ::Serialize::TradeOrder& _internal_completed_sell_orders(int index) const;
-  ::Serialize::TradeOrder* _internal_add_completed_sell_orders();
+  const ::Serialize::AccountBalance& _internal_account_balance() const;
+  ::Serialize::AccountBalance* _internal_mutable_account_balance();
   public:
-  const ::Serialize::TradeOrder& completed_sell_orders(int index) const;
-  ::Serialize::TradeOrder* add_completed_sell_orders();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >&
-      completed_sell_orders() const;
+  void unsafe_arena_set_allocated_account_balance(
+      ::Serialize::AccountBalance* account_balance);
+  ::Serialize::AccountBalance* unsafe_arena_release_account_balance();
 
-  // @@protoc_insertion_point(class_scope:Serialize.CompletedOredrs)
+  // .Serialize.ActiveOrders active_orders = 4;
+  bool has_active_orders() const;
+  private:
+  bool _internal_has_active_orders() const;
+  public:
+  void clear_active_orders();
+  const ::Serialize::ActiveOrders& active_orders() const;
+  PROTOBUF_NODISCARD ::Serialize::ActiveOrders* release_active_orders();
+  ::Serialize::ActiveOrders* mutable_active_orders();
+  void set_allocated_active_orders(::Serialize::ActiveOrders* active_orders);
+  private:
+  const ::Serialize::ActiveOrders& _internal_active_orders() const;
+  ::Serialize::ActiveOrders* _internal_mutable_active_orders();
+  public:
+  void unsafe_arena_set_allocated_active_orders(
+      ::Serialize::ActiveOrders* active_orders);
+  ::Serialize::ActiveOrders* unsafe_arena_release_active_orders();
+
+  // .Serialize.CompletedOredrs completed_orders = 5;
+  bool has_completed_orders() const;
+  private:
+  bool _internal_has_completed_orders() const;
+  public:
+  void clear_completed_orders();
+  const ::Serialize::CompletedOredrs& completed_orders() const;
+  PROTOBUF_NODISCARD ::Serialize::CompletedOredrs* release_completed_orders();
+  ::Serialize::CompletedOredrs* mutable_completed_orders();
+  void set_allocated_completed_orders(::Serialize::CompletedOredrs* completed_orders);
+  private:
+  const ::Serialize::CompletedOredrs& _internal_completed_orders() const;
+  ::Serialize::CompletedOredrs* _internal_mutable_completed_orders();
+  public:
+  void unsafe_arena_set_allocated_completed_orders(
+      ::Serialize::CompletedOredrs* completed_orders);
+  ::Serialize::CompletedOredrs* unsafe_arena_release_completed_orders();
+
+  // .Serialize.QuoteHistory quote_history = 6;
+  bool has_quote_history() const;
+  private:
+  bool _internal_has_quote_history() const;
+  public:
+  void clear_quote_history();
+  const ::Serialize::QuoteHistory& quote_history() const;
+  PROTOBUF_NODISCARD ::Serialize::QuoteHistory* release_quote_history();
+  ::Serialize::QuoteHistory* mutable_quote_history();
+  void set_allocated_quote_history(::Serialize::QuoteHistory* quote_history);
+  private:
+  const ::Serialize::QuoteHistory& _internal_quote_history() const;
+  ::Serialize::QuoteHistory* _internal_mutable_quote_history();
+  public:
+  void unsafe_arena_set_allocated_quote_history(
+      ::Serialize::QuoteHistory* quote_history);
+  ::Serialize::QuoteHistory* unsafe_arena_release_quote_history();
+
+  // string error_response = 7;
+  bool has_error_response() const;
+  private:
+  bool _internal_has_error_response() const;
+  public:
+  void clear_error_response();
+  const std::string& error_response() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_response(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_response();
+  PROTOBUF_NODISCARD std::string* release_error_response();
+  void set_allocated_error_response(std::string* error_response);
+  private:
+  const std::string& _internal_error_response() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_response(const std::string& value);
+  std::string* _internal_mutable_error_response();
+  public:
+
+  // .Serialize.ExecutionReport execution_report = 8;
+  bool has_execution_report() const;
+  private:
+  bool _internal_has_execution_report() const;
+  public:
+  void clear_execution_report();
+  const ::Serialize::ExecutionReport& execution_report() const;
+  PROTOBUF_NODISCARD ::Serialize::ExecutionReport* release_execution_report();
+  ::Serialize::ExecutionReport* mutable_execution_report();
+  void set_allocated_execution_report(::Serialize::ExecutionReport* execution_report);
+  private:
+  const ::Serialize::ExecutionReport& _internal_execution_report() const;
+  ::Serialize::ExecutionReport* _internal_mutable_execution_report();
+  public:
+  void unsafe_arena_set_allocated_execution_report(
+      ::Serialize::ExecutionReport* execution_report);
+  ::Serialize::ExecutionReport* unsafe_arena_release_execution_report();
+
+  // .Serialize.MarketDepth market_depth = 9;
+  bool has_market_depth() const;
+  private:
+  bool _internal_has_market_depth() const;
+  public:
+  void clear_market_depth();
+  const ::Serialize::MarketDepth& market_depth() const;
+  PROTOBUF_NODISCARD ::Serialize::MarketDepth* release_market_depth();
+  ::Serialize::MarketDepth* mutable_market_depth();
+  void set_allocated_market_depth(::Serialize::MarketDepth* market_depth);
+  private:
+  const ::Serialize::MarketDepth& _internal_market_depth() const;
+  ::Serialize::MarketDepth* _internal_mutable_market_depth();
+  public:
+  void unsafe_arena_set_allocated_market_depth(
+      ::Serialize::MarketDepth* market_depth);
+  ::Serialize::MarketDepth* unsafe_arena_release_market_depth();
+
+  // .Serialize.Candles candles = 10;
+  bool has_candles() const;
+  private:
+  bool _internal_has_candles() const;
+  public:
+  void clear_candles();
+  const ::Serialize::Candles& candles() const;
+  PROTOBUF_NODISCARD ::Serialize::Candles* release_candles();
+  ::Serialize::Candles* mutable_candles();
+  void set_allocated_candles(::Serialize::Candles* candles);
+  private:
+  const ::Serialize::Candles& _internal_candles() const;
+  ::Serialize::Candles* _internal_mutable_candles();
+  public:
+  void unsafe_arena_set_allocated_candles(
+      ::Serialize::Candles* candles);
+  ::Serialize::Candles* unsafe_arena_release_candles();
+
+  // .Serialize.Trades trades = 11;
+  bool has_trades() const;
+  private:
+  bool _internal_has_trades() const;
+  public:
+  void clear_trades();
+  const ::Serialize::Trades& trades() const;
+  PROTOBUF_NODISCARD ::Serialize::Trades* release_trades();
+  ::Serialize::Trades* mutable_trades();
+  void set_allocated_trades(::Serialize::Trades* trades);
+  private:
+  const ::Serialize::Trades& _internal_trades() const;
+  ::Serialize::Trades* _internal_mutable_trades();
+  public:
+  void unsafe_arena_set_allocated_trades(
+      ::Serialize::Trades* trades);
+  ::Serialize::Trades* unsafe_arena_release_trades();
+
+  // int32 canceled_orders_count = 12;
+  bool has_canceled_orders_count() const;
+  private:
+  bool _internal_has_canceled_orders_count() const;
+  public:
+  void clear_canceled_orders_count();
+  int32_t canceled_orders_count() const;
+  void set_canceled_orders_count(int32_t value);
+  private:
+  int32_t _internal_canceled_orders_count() const;
+  void _internal_set_canceled_orders_count(int32_t value);
+  public:
+
+  void clear_RequestData();
+  RequestDataCase RequestData_case() const;
+  // @@protoc_insertion_point(class_scope:Serialize.TradeResponse)
  private:
   class _Internal;
+  void set_has_jwt();
+  void set_has_account_balance();
+  void set_has_active_orders();
+  void set_has_completed_orders();
+  void set_has_quote_history();
+  void set_has_error_response();
+  void set_has_execution_report();
+  void set_has_market_depth();
+  void set_has_candles();
+  void set_has_trades();
+  void set_has_canceled_orders_count();
+
+  inline bool has_RequestData() const;
+  inline void clear_has_RequestData();
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder > completed_buy_orders_;
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder > completed_sell_orders_;
+    int response_msg_;
+    union RequestDataUnion {
+      constexpr RequestDataUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr jwt_;
+      ::Serialize::AccountBalance* account_balance_;
+      ::Serialize::ActiveOrders* active_orders_;
+      ::Serialize::CompletedOredrs* completed_orders_;
+      ::Serialize::QuoteHistory* quote_history_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_response_;
+      ::Serialize::ExecutionReport* execution_report_;
+      ::Serialize::MarketDepth* market_depth_;
+      ::Serialize::Candles* candles_;
+      ::Serialize::Trades* trades_;
+      int32_t canceled_orders_count_;
+    } RequestData_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class QuoteHistory final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.QuoteHistory) */ {
+class ExecutionReport final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.ExecutionReport) */ {
  public:
-  inline QuoteHistory() : QuoteHistory(nullptr) {}
-  ~QuoteHistory() override;
-  explicit PROTOBUF_CONSTEXPR QuoteHistory(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ExecutionReport() : ExecutionReport(nullptr) {}
+  ~ExecutionReport() override;
+  explicit PROTOBUF_CONSTEXPR ExecutionReport(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  QuoteHistory(const QuoteHistory& from);
-  QuoteHistory(QuoteHistory&& from) noexcept
-    : QuoteHistory() {
+  ExecutionReport(const ExecutionReport& from);
+  ExecutionReport(ExecutionReport&& from) noexcept
+    : ExecutionReport() {
     *this = ::std::move(from);
   }
 
-  inline QuoteHistory& operator=(const QuoteHistory& from) {
+  inline ExecutionReport& operator=(const ExecutionReport& from) {
     CopyFrom(from);
     return *this;
   }
-  inline QuoteHistory& operator=(QuoteHistory&& from) noexcept {
+  inline ExecutionReport& operator=(ExecutionReport&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2395,20 +2934,20 @@ class QuoteHistory final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const QuoteHistory& default_instance() {
+  static const ExecutionReport& default_instance() {
     return *internal_default_instance();
   }
-  static inline const QuoteHistory* internal_default_instance() {
-    return reinterpret_cast<const QuoteHistory*>(
-               &_QuoteHistory_default_instance_);
+  static inline const ExecutionReport* internal_default_instance() {
+    return reinterpret_cast<const ExecutionReport*>(
+               &_ExecutionReport_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     10;
 
-  friend void swap(QuoteHistory& a, QuoteHistory& b) {
+  friend void swap(ExecutionReport& a, ExecutionReport& b) {
     a.Swap(&b);
   }
-  inline void Swap(QuoteHistory* other) {
+  inline void Swap(ExecutionReport* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2421,7 +2960,7 @@ class QuoteHistory final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(QuoteHistory* other) {
+  void UnsafeArenaSwap(ExecutionReport* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2429,14 +2968,14 @@ class QuoteHistory final :
 
   // implements Message ----------------------------------------------
 
-  QuoteHistory* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<QuoteHistory>(arena);
+  ExecutionReport* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExecutionReport>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const QuoteHistory& from);
+  void CopyFrom(const ExecutionReport& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const QuoteHistory& from) {
-    QuoteHistory::MergeImpl(*this, from);
+  void MergeFrom( const ExecutionReport& from) {
+    ExecutionReport::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2454,15 +2993,15 @@ class QuoteHistory final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(QuoteHistory* other);
+  void InternalSwap(ExecutionReport* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "Serialize.QuoteHistory";
+    return "Serialize.ExecutionReport";
   }
   protected:
-  explicit QuoteHistory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ExecutionReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2476,60 +3015,150 @@ class QuoteHistory final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kQuotesFieldNumber = 1,
+    kOrderIdFieldNumber = 1,
+    kTypeFieldNumber = 2,
+    kFillAmountFieldNumber = 3,
+    kPriceFieldNumber = 4,
+    kUsdBalanceDeltaFieldNumber = 6,
+    kRubBalanceDeltaFieldNumber = 7,
+    kRemainingAmountFieldNumber = 5,
+    kCanceledAmountFieldNumber = 10,
+    kTimestampFieldNumber = 8,
+    kTradeIdFieldNumber = 9,
   };
-  // repeated .Serialize.Quote quotes = 1;
-  int quotes_size() const;
+  // int64 order_id = 1;
+  void clear_order_id();
+  int64_t order_id() const;
+  void set_order_id(int64_t value);
   private:
-  int _internal_quotes_size() const;
+  int64_t _internal_order_id() const;
+  void _internal_set_order_id(int64_t value);
   public:
-  void clear_quotes();
-  ::Serialize::Quote* mutable_quotes(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Quote >*
-      mutable_quotes();
+
+  // .Serialize.TradeOrder.TradeType type = 2;
+  void clear_type();
+  ::Serialize::TradeOrder_TradeType type() const;
+  void set_type(::Serialize::TradeOrder_TradeType value);
   private:
-  const ::Serialize::Quote& _internal_quotes(int index) const;
-  ::Serialize::Quote* _internal_add_quotes();
+  ::Serialize::TradeOrder_TradeType _internal_type() const;
+  void _internal_set_type(::Serialize::TradeOrder_TradeType value);
   public:
-  const ::Serialize::Quote& quotes(int index) const;
-  ::Serialize::Quote* add_quotes();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Quote >&
-      quotes() const;
 
-  // @@protoc_insertion_point(class_scope:Serialize.QuoteHistory)
- private:
-  class _Internal;
+  // int32 fill_amount = 3;
+  void clear_fill_amount();
+  int32_t fill_amount() const;
+  void set_fill_amount(int32_t value);
+  private:
+  int32_t _internal_fill_amount() const;
+  void _internal_set_fill_amount(int32_t value);
+  public:
 
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Quote > quotes_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
+  // double price = 4;
+  void clear_price();
+  double price() const;
+  void set_price(double value);
+  private:
+  double _internal_price() const;
+  void _internal_set_price(double value);
+  public:
+
+  // double usd_balance_delta = 6;
+  void clear_usd_balance_delta();
+  double usd_balance_delta() const;
+  void set_usd_balance_delta(double value);
+  private:
+  double _internal_usd_balance_delta() const;
+  void _internal_set_usd_balance_delta(double value);
+  public:
+
+  // double rub_balance_delta = 7;
+  void clear_rub_balance_delta();
+  double rub_balance_delta() const;
+  void set_rub_balance_delta(double value);
+  private:
+  double _internal_rub_balance_delta() const;
+  void _internal_set_rub_balance_delta(double value);
+  public:
+
+  // int32 remaining_amount = 5;
+  void clear_remaining_amount();
+  int32_t remaining_amount() const;
+  void set_remaining_amount(int32_t value);
+  private:
+  int32_t _internal_remaining_amount() const;
+  void _internal_set_remaining_amount(int32_t value);
+  public:
+
+  // int32 canceled_amount = 10;
+  void clear_canceled_amount();
+  int32_t canceled_amount() const;
+  void set_canceled_amount(int32_t value);
+  private:
+  int32_t _internal_canceled_amount() const;
+  void _internal_set_canceled_amount(int32_t value);
+  public:
+
+  // int64 timestamp = 8;
+  void clear_timestamp();
+  int64_t timestamp() const;
+  void set_timestamp(int64_t value);
+  private:
+  int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(int64_t value);
+  public:
+
+  // int64 trade_id = 9;
+  void clear_trade_id();
+  int64_t trade_id() const;
+  void set_trade_id(int64_t value);
+  private:
+  int64_t _internal_trade_id() const;
+  void _internal_set_trade_id(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Serialize.ExecutionReport)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t order_id_;
+    int type_;
+    int32_t fill_amount_;
+    double price_;
+    double usd_balance_delta_;
+    double rub_balance_delta_;
+    int32_t remaining_amount_;
+    int32_t canceled_amount_;
+    int64_t timestamp_;
+    int64_t trade_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Quote final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.Quote) */ {
+class Execution final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.Execution) */ {
  public:
-  inline Quote() : Quote(nullptr) {}
-  ~Quote() override;
-  explicit PROTOBUF_CONSTEXPR Quote(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline Execution() : Execution(nullptr) {}
+  ~Execution() override;
+  explicit PROTOBUF_CONSTEXPR Execution(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Quote(const Quote& from);
-  Quote(Quote&& from) noexcept
-    : Quote() {
+  Execution(const Execution& from);
+  Execution(Execution&& from) noexcept
+    : Execution() {
     *this = ::std::move(from);
   }
 
-  inline Quote& operator=(const Quote& from) {
+  inline Execution& operator=(const Execution& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Quote& operator=(Quote&& from) noexcept {
+  inline Execution& operator=(Execution&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2552,20 +3181,20 @@ class Quote final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Quote& default_instance() {
+  static const Execution& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Quote* internal_default_instance() {
-    return reinterpret_cast<const Quote*>(
-               &_Quote_default_instance_);
+  static inline const Execution* internal_default_instance() {
+    return reinterpret_cast<const Execution*>(
+               &_Execution_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     11;
 
-  friend void swap(Quote& a, Quote& b) {
+  friend void swap(Execution& a, Execution& b) {
     a.Swap(&b);
   }
-  inline void Swap(Quote* other) {
+  inline void Swap(Execution* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2578,7 +3207,7 @@ class Quote final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Quote* other) {
+  void UnsafeArenaSwap(Execution* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2586,14 +3215,14 @@ class Quote final :
 
   // implements Message ----------------------------------------------
 
-  Quote* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Quote>(arena);
+  Execution* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Execution>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Quote& from);
+  void CopyFrom(const Execution& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const Quote& from) {
-    Quote::MergeImpl(*this, from);
+  void MergeFrom( const Execution& from) {
+    Execution::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2611,15 +3240,15 @@ class Quote final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Quote* other);
+  void InternalSwap(Execution* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "Serialize.Quote";
+    return "Serialize.Execution";
   }
   protected:
-  explicit Quote(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit Execution(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2633,16 +3262,21 @@ class Quote final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kTimestampFieldNumber = 1,
+    kTradeIdFieldNumber = 1,
     kPriceFieldNumber = 2,
+    kUsdAmountFieldNumber = 3,
+    kAggressorSideFieldNumber = 4,
+    kMakerOrderIdFieldNumber = 5,
+    kTakerOrderIdFieldNumber = 6,
+    kTimestampFieldNumber = 7,
   };
-  // int64 timestamp = 1;
-  void clear_timestamp();
-  int64_t timestamp() const;
-  void set_timestamp(int64_t value);
+  // int64 trade_id = 1;
+  void clear_trade_id();
+  int64_t trade_id() const;
+  void set_trade_id(int64_t value);
   private:
-  int64_t _internal_timestamp() const;
-  void _internal_set_timestamp(int64_t value);
+  int64_t _internal_trade_id() const;
+  void _internal_set_trade_id(int64_t value);
   public:
 
   // double price = 2;
@@ -2654,7 +3288,52 @@ class Quote final :
   void _internal_set_price(double value);
   public:
 
-  // @@protoc_insertion_point(class_scope:Serialize.Quote)
+  // int32 usd_amount = 3;
+  void clear_usd_amount();
+  int32_t usd_amount() const;
+  void set_usd_amount(int32_t value);
+  private:
+  int32_t _internal_usd_amount() const;
+  void _internal_set_usd_amount(int32_t value);
+  public:
+
+  // .Serialize.TradeOrder.TradeType aggressor_side = 4;
+  void clear_aggressor_side();
+  ::Serialize::TradeOrder_TradeType aggressor_side() const;
+  void set_aggressor_side(::Serialize::TradeOrder_TradeType value);
+  private:
+  ::Serialize::TradeOrder_TradeType _internal_aggressor_side() const;
+  void _internal_set_aggressor_side(::Serialize::TradeOrder_TradeType value);
+  public:
+
+  // int64 maker_order_id = 5;
+  void clear_maker_order_id();
+  int64_t maker_order_id() const;
+  void set_maker_order_id(int64_t value);
+  private:
+  int64_t _internal_maker_order_id() const;
+  void _internal_set_maker_order_id(int64_t value);
+  public:
+
+  // int64 taker_order_id = 6;
+  void clear_taker_order_id();
+  int64_t taker_order_id() const;
+  void set_taker_order_id(int64_t value);
+  private:
+  int64_t _internal_taker_order_id() const;
+  void _internal_set_taker_order_id(int64_t value);
+  public:
+
+  // int64 timestamp = 7;
+  void clear_timestamp();
+  int64_t timestamp() const;
+  void set_timestamp(int64_t value);
+  private:
+  int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Serialize.Execution)
  private:
   class _Internal;
 
@@ -2662,1358 +3341,4662 @@ class Quote final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int64_t timestamp_;
+    int64_t trade_id_;
     double price_;
+    int32_t usd_amount_;
+    int aggressor_side_;
+    int64_t maker_order_id_;
+    int64_t taker_order_id_;
+    int64_t timestamp_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class Trades final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.Trades) */ {
+ public:
+  inline Trades() : Trades(nullptr) {}
+  ~Trades() override;
+  explicit PROTOBUF_CONSTEXPR Trades(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  Trades(const Trades& from);
+  Trades(Trades&& from) noexcept
+    : Trades() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// SignUpRequest
+  inline Trades& operator=(const Trades& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Trades& operator=(Trades&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// string username = 1;
-inline void SignUpRequest::clear_username() {
-  _impl_.username_.ClearToEmpty();
-}
-inline const std::string& SignUpRequest::username() const {
-  // @@protoc_insertion_point(field_get:Serialize.SignUpRequest.username)
-  return _internal_username();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void SignUpRequest::set_username(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:Serialize.SignUpRequest.username)
-}
-inline std::string* SignUpRequest::mutable_username() {
-  std::string* _s = _internal_mutable_username();
-  // @@protoc_insertion_point(field_mutable:Serialize.SignUpRequest.username)
-  return _s;
-}
-inline const std::string& SignUpRequest::_internal_username() const {
-  return _impl_.username_.Get();
-}
-inline void SignUpRequest::_internal_set_username(const std::string& value) {
-  
-  _impl_.username_.Set(value, GetArenaForAllocation());
-}
-inline std::string* SignUpRequest::_internal_mutable_username() {
-  
-  return _impl_.username_.Mutable(GetArenaForAllocation());
-}
-inline std::string* SignUpRequest::release_username() {
-  // @@protoc_insertion_point(field_release:Serialize.SignUpRequest.username)
-  return _impl_.username_.Release();
-}
-inline void SignUpRequest::set_allocated_username(std::string* username) {
-  if (username != nullptr) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.username_.IsDefault()) {
-    _impl_.username_.Set("", GetArenaForAllocation());
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:Serialize.SignUpRequest.username)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Trades& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Trades* internal_default_instance() {
+    return reinterpret_cast<const Trades*>(
+               &_Trades_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
 
-// string password = 2;
-inline void SignUpRequest::clear_password() {
-  _impl_.password_.ClearToEmpty();
-}
-inline const std::string& SignUpRequest::password() const {
-  // @@protoc_insertion_point(field_get:Serialize.SignUpRequest.password)
-  return _internal_password();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void SignUpRequest::set_password(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.password_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:Serialize.SignUpRequest.password)
-}
-inline std::string* SignUpRequest::mutable_password() {
-  std::string* _s = _internal_mutable_password();
-  // @@protoc_insertion_point(field_mutable:Serialize.SignUpRequest.password)
-  return _s;
-}
-inline const std::string& SignUpRequest::_internal_password() const {
-  return _impl_.password_.Get();
-}
-inline void SignUpRequest::_internal_set_password(const std::string& value) {
-  
-  _impl_.password_.Set(value, GetArenaForAllocation());
-}
-inline std::string* SignUpRequest::_internal_mutable_password() {
-  
-  return _impl_.password_.Mutable(GetArenaForAllocation());
-}
-inline std::string* SignUpRequest::release_password() {
-  // @@protoc_insertion_point(field_release:Serialize.SignUpRequest.password)
-  return _impl_.password_.Release();
-}
-inline void SignUpRequest::set_allocated_password(std::string* password) {
-  if (password != nullptr) {
-    
-  } else {
-    
+  friend void swap(Trades& a, Trades& b) {
+    a.Swap(&b);
   }
-  _impl_.password_.SetAllocated(password, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.password_.IsDefault()) {
-    _impl_.password_.Set("", GetArenaForAllocation());
+  inline void Swap(Trades* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Trades* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:Serialize.SignUpRequest.password)
-}
+
+  // implements Message ----------------------------------------------
+
+  Trades* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Trades>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Trades& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Trades& from) {
+    Trades::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Trades* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Serialize.Trades";
+  }
+  protected:
+  explicit Trades(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kExecutionsFieldNumber = 1,
+  };
+  // repeated .Serialize.Execution executions = 1;
+  int executions_size() const;
+  private:
+  int _internal_executions_size() const;
+  public:
+  void clear_executions();
+  ::Serialize::Execution* mutable_executions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Execution >*
+      mutable_executions();
+  private:
+  const ::Serialize::Execution& _internal_executions(int index) const;
+  ::Serialize::Execution* _internal_add_executions();
+  public:
+  const ::Serialize::Execution& executions(int index) const;
+  ::Serialize::Execution* add_executions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Execution >&
+      executions() const;
+
+  // @@protoc_insertion_point(class_scope:Serialize.Trades)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Execution > executions_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClientBalance final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.ClientBalance) */ {
+ public:
+  inline ClientBalance() : ClientBalance(nullptr) {}
+  ~ClientBalance() override;
+  explicit PROTOBUF_CONSTEXPR ClientBalance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClientBalance(const ClientBalance& from);
+  ClientBalance(ClientBalance&& from) noexcept
+    : ClientBalance() {
+    *this = ::std::move(from);
+  }
+
+  inline ClientBalance& operator=(const ClientBalance& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClientBalance& operator=(ClientBalance&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClientBalance& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClientBalance* internal_default_instance() {
+    return reinterpret_cast<const ClientBalance*>(
+               &_ClientBalance_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(ClientBalance& a, ClientBalance& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClientBalance* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClientBalance* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClientBalance* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClientBalance>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClientBalance& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClientBalance& from) {
+    ClientBalance::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClientBalance* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Serialize.ClientBalance";
+  }
+  protected:
+  explicit ClientBalance(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kFundsFieldNumber = 2,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // .Serialize.AccountBalance funds = 2;
+  bool has_funds() const;
+  private:
+  bool _internal_has_funds() const;
+  public:
+  void clear_funds();
+  const ::Serialize::AccountBalance& funds() const;
+  PROTOBUF_NODISCARD ::Serialize::AccountBalance* release_funds();
+  ::Serialize::AccountBalance* mutable_funds();
+  void set_allocated_funds(::Serialize::AccountBalance* funds);
+  private:
+  const ::Serialize::AccountBalance& _internal_funds() const;
+  ::Serialize::AccountBalance* _internal_mutable_funds();
+  public:
+  void unsafe_arena_set_allocated_funds(
+      ::Serialize::AccountBalance* funds);
+  ::Serialize::AccountBalance* unsafe_arena_release_funds();
+
+  // @@protoc_insertion_point(class_scope:Serialize.ClientBalance)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::Serialize::AccountBalance* funds_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AccountBalance final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.AccountBalance) */ {
+ public:
+  inline AccountBalance() : AccountBalance(nullptr) {}
+  ~AccountBalance() override;
+  explicit PROTOBUF_CONSTEXPR AccountBalance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AccountBalance(const AccountBalance& from);
+  AccountBalance(AccountBalance&& from) noexcept
+    : AccountBalance() {
+    *this = ::std::move(from);
+  }
+
+  inline AccountBalance& operator=(const AccountBalance& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AccountBalance& operator=(AccountBalance&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AccountBalance& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AccountBalance* internal_default_instance() {
+    return reinterpret_cast<const AccountBalance*>(
+               &_AccountBalance_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(AccountBalance& a, AccountBalance& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AccountBalance* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AccountBalance* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AccountBalance* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AccountBalance>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AccountBalance& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AccountBalance& from) {
+    AccountBalance::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AccountBalance* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Serialize.AccountBalance";
+  }
+  protected:
+  explicit AccountBalance(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsdBalanceFieldNumber = 1,
+    kRubBalanceFieldNumber = 2,
+    kUsdReservedFieldNumber = 3,
+    kRubReservedFieldNumber = 4,
+  };
+  // double usd_balance = 1;
+  void clear_usd_balance();
+  double usd_balance() const;
+  void set_usd_balance(double value);
+  private:
+  double _internal_usd_balance() const;
+  void _internal_set_usd_balance(double value);
+  public:
+
+  // double rub_balance = 2;
+  void clear_rub_balance();
+  double rub_balance() const;
+  void set_rub_balance(double value);
+  private:
+  double _internal_rub_balance() const;
+  void _internal_set_rub_balance(double value);
+  public:
+
+  // double usd_reserved = 3;
+  void clear_usd_reserved();
+  double usd_reserved() const;
+  void set_usd_reserved(double value);
+  private:
+  double _internal_usd_reserved() const;
+  void _internal_set_usd_reserved(double value);
+  public:
+
+  // double rub_reserved = 4;
+  void clear_rub_reserved();
+  double rub_reserved() const;
+  void set_rub_reserved(double value);
+  private:
+  double _internal_rub_reserved() const;
+  void _internal_set_rub_reserved(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Serialize.AccountBalance)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double usd_balance_;
+    double rub_balance_;
+    double usd_reserved_;
+    double rub_reserved_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ActiveOrders final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.ActiveOrders) */ {
+ public:
+  inline ActiveOrders() : ActiveOrders(nullptr) {}
+  ~ActiveOrders() override;
+  explicit PROTOBUF_CONSTEXPR ActiveOrders(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ActiveOrders(const ActiveOrders& from);
+  ActiveOrders(ActiveOrders&& from) noexcept
+    : ActiveOrders() {
+    *this = ::std::move(from);
+  }
+
+  inline ActiveOrders& operator=(const ActiveOrders& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ActiveOrders& operator=(ActiveOrders&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ActiveOrders& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ActiveOrders* internal_default_instance() {
+    return reinterpret_cast<const ActiveOrders*>(
+               &_ActiveOrders_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(ActiveOrders& a, ActiveOrders& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ActiveOrders* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ActiveOrders* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ActiveOrders* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ActiveOrders>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ActiveOrders& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ActiveOrders& from) {
+    ActiveOrders::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ActiveOrders* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Serialize.ActiveOrders";
+  }
+  protected:
+  explicit ActiveOrders(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kActiveBuyOrdersFieldNumber = 1,
+    kActiveSellOrdersFieldNumber = 2,
+  };
+  // repeated .Serialize.TradeOrder active_buy_orders = 1;
+  int active_buy_orders_size() const;
+  private:
+  int _internal_active_buy_orders_size() const;
+  public:
+  void clear_active_buy_orders();
+  ::Serialize::TradeOrder* mutable_active_buy_orders(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >*
+      mutable_active_buy_orders();
+  private:
+  const ::Serialize::TradeOrder& _internal_active_buy_orders(int index) const;
+  ::Serialize::TradeOrder* _internal_add_active_buy_orders();
+  public:
+  const ::Serialize::TradeOrder& active_buy_orders(int index) const;
+  ::Serialize::TradeOrder* add_active_buy_orders();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >&
+      active_buy_orders() const;
+
+  // repeated .Serialize.TradeOrder active_sell_orders = 2;
+  int active_sell_orders_size() const;
+  private:
+  int _internal_active_sell_orders_size() const;
+  public:
+  void clear_active_sell_orders();
+  ::Serialize::TradeOrder* mutable_active_sell_orders(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >*
+      mutable_active_sell_orders();
+  private:
+  const ::Serialize::TradeOrder& _internal_active_sell_orders(int index) const;
+  ::Serialize::TradeOrder* _internal_add_active_sell_orders();
+  public:
+  const ::Serialize::TradeOrder& active_sell_orders(int index) const;
+  ::Serialize::TradeOrder* add_active_sell_orders();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >&
+      active_sell_orders() const;
+
+  // @@protoc_insertion_point(class_scope:Serialize.ActiveOrders)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder > active_buy_orders_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder > active_sell_orders_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CompletedOredrs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.CompletedOredrs) */ {
+ public:
+  inline CompletedOredrs() : CompletedOredrs(nullptr) {}
+  ~CompletedOredrs() override;
+  explicit PROTOBUF_CONSTEXPR CompletedOredrs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CompletedOredrs(const CompletedOredrs& from);
+  CompletedOredrs(CompletedOredrs&& from) noexcept
+    : CompletedOredrs() {
+    *this = ::std::move(from);
+  }
+
+  inline CompletedOredrs& operator=(const CompletedOredrs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CompletedOredrs& operator=(CompletedOredrs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CompletedOredrs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CompletedOredrs* internal_default_instance() {
+    return reinterpret_cast<const CompletedOredrs*>(
+               &_CompletedOredrs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(CompletedOredrs& a, CompletedOredrs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CompletedOredrs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CompletedOredrs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CompletedOredrs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CompletedOredrs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CompletedOredrs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CompletedOredrs& from) {
+    CompletedOredrs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CompletedOredrs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Serialize.CompletedOredrs";
+  }
+  protected:
+  explicit CompletedOredrs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCompletedBuyOrdersFieldNumber = 1,
+    kCompletedSellOrdersFieldNumber = 2,
+  };
+  // repeated .Serialize.TradeOrder completed_buy_orders = 1;
+  int completed_buy_orders_size() const;
+  private:
+  int _internal_completed_buy_orders_size() const;
+  public:
+  void clear_completed_buy_orders();
+  ::Serialize::TradeOrder* mutable_completed_buy_orders(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >*
+      mutable_completed_buy_orders();
+  private:
+  const ::Serialize::TradeOrder& _internal_completed_buy_orders(int index) const;
+  ::Serialize::TradeOrder* _internal_add_completed_buy_orders();
+  public:
+  const ::Serialize::TradeOrder& completed_buy_orders(int index) const;
+  ::Serialize::TradeOrder* add_completed_buy_orders();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >&
+      completed_buy_orders() const;
+
+  // repeated .Serialize.TradeOrder completed_sell_orders = 2;
+  int completed_sell_orders_size() const;
+  private:
+  int _internal_completed_sell_orders_size() const;
+  public:
+  void clear_completed_sell_orders();
+  ::Serialize::TradeOrder* mutable_completed_sell_orders(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >*
+      mutable_completed_sell_orders();
+  private:
+  const ::Serialize::TradeOrder& _internal_completed_sell_orders(int index) const;
+  ::Serialize::TradeOrder* _internal_add_completed_sell_orders();
+  public:
+  const ::Serialize::TradeOrder& completed_sell_orders(int index) const;
+  ::Serialize::TradeOrder* add_completed_sell_orders();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder >&
+      completed_sell_orders() const;
+
+  // @@protoc_insertion_point(class_scope:Serialize.CompletedOredrs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder > completed_buy_orders_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::TradeOrder > completed_sell_orders_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class QuoteHistory final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.QuoteHistory) */ {
+ public:
+  inline QuoteHistory() : QuoteHistory(nullptr) {}
+  ~QuoteHistory() override;
+  explicit PROTOBUF_CONSTEXPR QuoteHistory(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  QuoteHistory(const QuoteHistory& from);
+  QuoteHistory(QuoteHistory&& from) noexcept
+    : QuoteHistory() {
+    *this = ::std::move(from);
+  }
+
+  inline QuoteHistory& operator=(const QuoteHistory& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline QuoteHistory& operator=(QuoteHistory&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const QuoteHistory& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const QuoteHistory* internal_default_instance() {
+    return reinterpret_cast<const QuoteHistory*>(
+               &_QuoteHistory_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(QuoteHistory& a, QuoteHistory& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(QuoteHistory* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(QuoteHistory* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  QuoteHistory* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QuoteHistory>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const QuoteHistory& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const QuoteHistory& from) {
+    QuoteHistory::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(QuoteHistory* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Serialize.QuoteHistory";
+  }
+  protected:
+  explicit QuoteHistory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kQuotesFieldNumber = 1,
+  };
+  // repeated .Serialize.Quote quotes = 1;
+  int quotes_size() const;
+  private:
+  int _internal_quotes_size() const;
+  public:
+  void clear_quotes();
+  ::Serialize::Quote* mutable_quotes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Quote >*
+      mutable_quotes();
+  private:
+  const ::Serialize::Quote& _internal_quotes(int index) const;
+  ::Serialize::Quote* _internal_add_quotes();
+  public:
+  const ::Serialize::Quote& quotes(int index) const;
+  ::Serialize::Quote* add_quotes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Quote >&
+      quotes() const;
+
+  // @@protoc_insertion_point(class_scope:Serialize.QuoteHistory)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Quote > quotes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Quote final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.Quote) */ {
+ public:
+  inline Quote() : Quote(nullptr) {}
+  ~Quote() override;
+  explicit PROTOBUF_CONSTEXPR Quote(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Quote(const Quote& from);
+  Quote(Quote&& from) noexcept
+    : Quote() {
+    *this = ::std::move(from);
+  }
+
+  inline Quote& operator=(const Quote& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Quote& operator=(Quote&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Quote& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Quote* internal_default_instance() {
+    return reinterpret_cast<const Quote*>(
+               &_Quote_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(Quote& a, Quote& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Quote* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Quote* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Quote* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Quote>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Quote& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Quote& from) {
+    Quote::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Quote* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Serialize.Quote";
+  }
+  protected:
+  explicit Quote(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTimestampFieldNumber = 1,
+    kPriceFieldNumber = 2,
+  };
+  // int64 timestamp = 1;
+  void clear_timestamp();
+  int64_t timestamp() const;
+  void set_timestamp(int64_t value);
+  private:
+  int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(int64_t value);
+  public:
+
+  // double price = 2;
+  void clear_price();
+  double price() const;
+  void set_price(double value);
+  private:
+  double _internal_price() const;
+  void _internal_set_price(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Serialize.Quote)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t timestamp_;
+    double price_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PriceLevel final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.PriceLevel) */ {
+ public:
+  inline PriceLevel() : PriceLevel(nullptr) {}
+  ~PriceLevel() override;
+  explicit PROTOBUF_CONSTEXPR PriceLevel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PriceLevel(const PriceLevel& from);
+  PriceLevel(PriceLevel&& from) noexcept
+    : PriceLevel() {
+    *this = ::std::move(from);
+  }
+
+  inline PriceLevel& operator=(const PriceLevel& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PriceLevel& operator=(PriceLevel&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PriceLevel& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PriceLevel* internal_default_instance() {
+    return reinterpret_cast<const PriceLevel*>(
+               &_PriceLevel_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(PriceLevel& a, PriceLevel& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PriceLevel* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PriceLevel* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PriceLevel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PriceLevel>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PriceLevel& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PriceLevel& from) {
+    PriceLevel::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PriceLevel* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Serialize.PriceLevel";
+  }
+  protected:
+  explicit PriceLevel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPriceFieldNumber = 1,
+    kUsdAmountFieldNumber = 2,
+    kOrdersCountFieldNumber = 3,
+  };
+  // double price = 1;
+  void clear_price();
+  double price() const;
+  void set_price(double value);
+  private:
+  double _internal_price() const;
+  void _internal_set_price(double value);
+  public:
+
+  // int64 usd_amount = 2;
+  void clear_usd_amount();
+  int64_t usd_amount() const;
+  void set_usd_amount(int64_t value);
+  private:
+  int64_t _internal_usd_amount() const;
+  void _internal_set_usd_amount(int64_t value);
+  public:
+
+  // int32 orders_count = 3;
+  void clear_orders_count();
+  int32_t orders_count() const;
+  void set_orders_count(int32_t value);
+  private:
+  int32_t _internal_orders_count() const;
+  void _internal_set_orders_count(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Serialize.PriceLevel)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double price_;
+    int64_t usd_amount_;
+    int32_t orders_count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MarketDepth final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.MarketDepth) */ {
+ public:
+  inline MarketDepth() : MarketDepth(nullptr) {}
+  ~MarketDepth() override;
+  explicit PROTOBUF_CONSTEXPR MarketDepth(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MarketDepth(const MarketDepth& from);
+  MarketDepth(MarketDepth&& from) noexcept
+    : MarketDepth() {
+    *this = ::std::move(from);
+  }
+
+  inline MarketDepth& operator=(const MarketDepth& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MarketDepth& operator=(MarketDepth&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MarketDepth& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MarketDepth* internal_default_instance() {
+    return reinterpret_cast<const MarketDepth*>(
+               &_MarketDepth_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(MarketDepth& a, MarketDepth& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MarketDepth* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MarketDepth* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MarketDepth* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MarketDepth>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MarketDepth& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MarketDepth& from) {
+    MarketDepth::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MarketDepth* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Serialize.MarketDepth";
+  }
+  protected:
+  explicit MarketDepth(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBidsFieldNumber = 1,
+    kAsksFieldNumber = 2,
+    kTimestampFieldNumber = 3,
+  };
+  // repeated .Serialize.PriceLevel bids = 1;
+  int bids_size() const;
+  private:
+  int _internal_bids_size() const;
+  public:
+  void clear_bids();
+  ::Serialize::PriceLevel* mutable_bids(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::PriceLevel >*
+      mutable_bids();
+  private:
+  const ::Serialize::PriceLevel& _internal_bids(int index) const;
+  ::Serialize::PriceLevel* _internal_add_bids();
+  public:
+  const ::Serialize::PriceLevel& bids(int index) const;
+  ::Serialize::PriceLevel* add_bids();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::PriceLevel >&
+      bids() const;
+
+  // repeated .Serialize.PriceLevel asks = 2;
+  int asks_size() const;
+  private:
+  int _internal_asks_size() const;
+  public:
+  void clear_asks();
+  ::Serialize::PriceLevel* mutable_asks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::PriceLevel >*
+      mutable_asks();
+  private:
+  const ::Serialize::PriceLevel& _internal_asks(int index) const;
+  ::Serialize::PriceLevel* _internal_add_asks();
+  public:
+  const ::Serialize::PriceLevel& asks(int index) const;
+  ::Serialize::PriceLevel* add_asks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::PriceLevel >&
+      asks() const;
+
+  // int64 timestamp = 3;
+  void clear_timestamp();
+  int64_t timestamp() const;
+  void set_timestamp(int64_t value);
+  private:
+  int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Serialize.MarketDepth)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::PriceLevel > bids_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::PriceLevel > asks_;
+    int64_t timestamp_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Candle final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.Candle) */ {
+ public:
+  inline Candle() : Candle(nullptr) {}
+  ~Candle() override;
+  explicit PROTOBUF_CONSTEXPR Candle(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Candle(const Candle& from);
+  Candle(Candle&& from) noexcept
+    : Candle() {
+    *this = ::std::move(from);
+  }
+
+  inline Candle& operator=(const Candle& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Candle& operator=(Candle&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Candle& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Candle* internal_default_instance() {
+    return reinterpret_cast<const Candle*>(
+               &_Candle_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(Candle& a, Candle& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Candle* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Candle* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Candle* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Candle>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Candle& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Candle& from) {
+    Candle::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Candle* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Serialize.Candle";
+  }
+  protected:
+  explicit Candle(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpenTimeFieldNumber = 1,
+    kOpenFieldNumber = 2,
+    kHighFieldNumber = 3,
+    kLowFieldNumber = 4,
+    kCloseFieldNumber = 5,
+    kUsdVolumeFieldNumber = 6,
+    kTradesCountFieldNumber = 7,
+  };
+  // int64 open_time = 1;
+  void clear_open_time();
+  int64_t open_time() const;
+  void set_open_time(int64_t value);
+  private:
+  int64_t _internal_open_time() const;
+  void _internal_set_open_time(int64_t value);
+  public:
+
+  // double open = 2;
+  void clear_open();
+  double open() const;
+  void set_open(double value);
+  private:
+  double _internal_open() const;
+  void _internal_set_open(double value);
+  public:
+
+  // double high = 3;
+  void clear_high();
+  double high() const;
+  void set_high(double value);
+  private:
+  double _internal_high() const;
+  void _internal_set_high(double value);
+  public:
+
+  // double low = 4;
+  void clear_low();
+  double low() const;
+  void set_low(double value);
+  private:
+  double _internal_low() const;
+  void _internal_set_low(double value);
+  public:
+
+  // double close = 5;
+  void clear_close();
+  double close() const;
+  void set_close(double value);
+  private:
+  double _internal_close() const;
+  void _internal_set_close(double value);
+  public:
+
+  // int64 usd_volume = 6;
+  void clear_usd_volume();
+  int64_t usd_volume() const;
+  void set_usd_volume(int64_t value);
+  private:
+  int64_t _internal_usd_volume() const;
+  void _internal_set_usd_volume(int64_t value);
+  public:
+
+  // int32 trades_count = 7;
+  void clear_trades_count();
+  int32_t trades_count() const;
+  void set_trades_count(int32_t value);
+  private:
+  int32_t _internal_trades_count() const;
+  void _internal_set_trades_count(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Serialize.Candle)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t open_time_;
+    double open_;
+    double high_;
+    double low_;
+    double close_;
+    int64_t usd_volume_;
+    int32_t trades_count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Candles final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Serialize.Candles) */ {
+ public:
+  inline Candles() : Candles(nullptr) {}
+  ~Candles() override;
+  explicit PROTOBUF_CONSTEXPR Candles(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Candles(const Candles& from);
+  Candles(Candles&& from) noexcept
+    : Candles() {
+    *this = ::std::move(from);
+  }
+
+  inline Candles& operator=(const Candles& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Candles& operator=(Candles&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Candles& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Candles* internal_default_instance() {
+    return reinterpret_cast<const Candles*>(
+               &_Candles_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(Candles& a, Candles& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Candles* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Candles* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Candles* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Candles>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Candles& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Candles& from) {
+    Candles::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Candles* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Serialize.Candles";
+  }
+  protected:
+  explicit Candles(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCandlesFieldNumber = 2,
+    kResolutionFieldNumber = 1,
+  };
+  // repeated .Serialize.Candle candles = 2;
+  int candles_size() const;
+  private:
+  int _internal_candles_size() const;
+  public:
+  void clear_candles();
+  ::Serialize::Candle* mutable_candles(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Candle >*
+      mutable_candles();
+  private:
+  const ::Serialize::Candle& _internal_candles(int index) const;
+  ::Serialize::Candle* _internal_add_candles();
+  public:
+  const ::Serialize::Candle& candles(int index) const;
+  ::Serialize::Candle* add_candles();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Candle >&
+      candles() const;
+
+  // .Serialize.CandleResolution resolution = 1;
+  void clear_resolution();
+  ::Serialize::CandleResolution resolution() const;
+  void set_resolution(::Serialize::CandleResolution value);
+  private:
+  ::Serialize::CandleResolution _internal_resolution() const;
+  void _internal_set_resolution(::Serialize::CandleResolution value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Serialize.Candles)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Candle > candles_;
+    int resolution_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_trade_5fmarket_5fprotocol_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SignUpRequest
+
+// string username = 1;
+inline void SignUpRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& SignUpRequest::username() const {
+  // @@protoc_insertion_point(field_get:Serialize.SignUpRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SignUpRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Serialize.SignUpRequest.username)
+}
+inline std::string* SignUpRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:Serialize.SignUpRequest.username)
+  return _s;
+}
+inline const std::string& SignUpRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void SignUpRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SignUpRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SignUpRequest::release_username() {
+  // @@protoc_insertion_point(field_release:Serialize.SignUpRequest.username)
+  return _impl_.username_.Release();
+}
+inline void SignUpRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Serialize.SignUpRequest.username)
+}
+
+// string password = 2;
+inline void SignUpRequest::clear_password() {
+  _impl_.password_.ClearToEmpty();
+}
+inline const std::string& SignUpRequest::password() const {
+  // @@protoc_insertion_point(field_get:Serialize.SignUpRequest.password)
+  return _internal_password();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SignUpRequest::set_password(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.password_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Serialize.SignUpRequest.password)
+}
+inline std::string* SignUpRequest::mutable_password() {
+  std::string* _s = _internal_mutable_password();
+  // @@protoc_insertion_point(field_mutable:Serialize.SignUpRequest.password)
+  return _s;
+}
+inline const std::string& SignUpRequest::_internal_password() const {
+  return _impl_.password_.Get();
+}
+inline void SignUpRequest::_internal_set_password(const std::string& value) {
+  
+  _impl_.password_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SignUpRequest::_internal_mutable_password() {
+  
+  return _impl_.password_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SignUpRequest::release_password() {
+  // @@protoc_insertion_point(field_release:Serialize.SignUpRequest.password)
+  return _impl_.password_.Release();
+}
+inline void SignUpRequest::set_allocated_password(std::string* password) {
+  if (password != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.password_.SetAllocated(password, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.password_.IsDefault()) {
+    _impl_.password_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Serialize.SignUpRequest.password)
+}
+
+// -------------------------------------------------------------------
+
+// SignInRequest
+
+// string username = 1;
+inline void SignInRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& SignInRequest::username() const {
+  // @@protoc_insertion_point(field_get:Serialize.SignInRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SignInRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Serialize.SignInRequest.username)
+}
+inline std::string* SignInRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:Serialize.SignInRequest.username)
+  return _s;
+}
+inline const std::string& SignInRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void SignInRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SignInRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SignInRequest::release_username() {
+  // @@protoc_insertion_point(field_release:Serialize.SignInRequest.username)
+  return _impl_.username_.Release();
+}
+inline void SignInRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Serialize.SignInRequest.username)
+}
+
+// string password = 2;
+inline void SignInRequest::clear_password() {
+  _impl_.password_.ClearToEmpty();
+}
+inline const std::string& SignInRequest::password() const {
+  // @@protoc_insertion_point(field_get:Serialize.SignInRequest.password)
+  return _internal_password();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SignInRequest::set_password(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.password_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Serialize.SignInRequest.password)
+}
+inline std::string* SignInRequest::mutable_password() {
+  std::string* _s = _internal_mutable_password();
+  // @@protoc_insertion_point(field_mutable:Serialize.SignInRequest.password)
+  return _s;
+}
+inline const std::string& SignInRequest::_internal_password() const {
+  return _impl_.password_.Get();
+}
+inline void SignInRequest::_internal_set_password(const std::string& value) {
+  
+  _impl_.password_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SignInRequest::_internal_mutable_password() {
+  
+  return _impl_.password_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SignInRequest::release_password() {
+  // @@protoc_insertion_point(field_release:Serialize.SignInRequest.password)
+  return _impl_.password_.Release();
+}
+inline void SignInRequest::set_allocated_password(std::string* password) {
+  if (password != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.password_.SetAllocated(password, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.password_.IsDefault()) {
+    _impl_.password_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Serialize.SignInRequest.password)
+}
+
+// bool cancel_on_disconnect = 3;
+inline void SignInRequest::clear_cancel_on_disconnect() {
+  _impl_.cancel_on_disconnect_ = false;
+}
+inline bool SignInRequest::_internal_cancel_on_disconnect() const {
+  return _impl_.cancel_on_disconnect_;
+}
+inline bool SignInRequest::cancel_on_disconnect() const {
+  // @@protoc_insertion_point(field_get:Serialize.SignInRequest.cancel_on_disconnect)
+  return _internal_cancel_on_disconnect();
+}
+inline void SignInRequest::_internal_set_cancel_on_disconnect(bool value) {
+  
+  _impl_.cancel_on_disconnect_ = value;
+}
+inline void SignInRequest::set_cancel_on_disconnect(bool value) {
+  _internal_set_cancel_on_disconnect(value);
+  // @@protoc_insertion_point(field_set:Serialize.SignInRequest.cancel_on_disconnect)
+}
+
+// -------------------------------------------------------------------
+
+// TradeOrder
+
+// .Serialize.TradeOrder.TradeType type = 1;
+inline void TradeOrder::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::Serialize::TradeOrder_TradeType TradeOrder::_internal_type() const {
+  return static_cast< ::Serialize::TradeOrder_TradeType >(_impl_.type_);
+}
+inline ::Serialize::TradeOrder_TradeType TradeOrder::type() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.type)
+  return _internal_type();
+}
+inline void TradeOrder::_internal_set_type(::Serialize::TradeOrder_TradeType value) {
+  
+  _impl_.type_ = value;
+}
+inline void TradeOrder::set_type(::Serialize::TradeOrder_TradeType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.type)
+}
+
+// double usd_cost = 2;
+inline void TradeOrder::clear_usd_cost() {
+  _impl_.usd_cost_ = 0;
+}
+inline double TradeOrder::_internal_usd_cost() const {
+  return _impl_.usd_cost_;
+}
+inline double TradeOrder::usd_cost() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.usd_cost)
+  return _internal_usd_cost();
+}
+inline void TradeOrder::_internal_set_usd_cost(double value) {
+  
+  _impl_.usd_cost_ = value;
+}
+inline void TradeOrder::set_usd_cost(double value) {
+  _internal_set_usd_cost(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.usd_cost)
+}
+
+// int32 usd_amount = 3;
+inline void TradeOrder::clear_usd_amount() {
+  _impl_.usd_amount_ = 0;
+}
+inline int32_t TradeOrder::_internal_usd_amount() const {
+  return _impl_.usd_amount_;
+}
+inline int32_t TradeOrder::usd_amount() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.usd_amount)
+  return _internal_usd_amount();
+}
+inline void TradeOrder::_internal_set_usd_amount(int32_t value) {
+  
+  _impl_.usd_amount_ = value;
+}
+inline void TradeOrder::set_usd_amount(int32_t value) {
+  _internal_set_usd_amount(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.usd_amount)
+}
+
+// int64 timestamp = 4;
+inline void TradeOrder::clear_timestamp() {
+  _impl_.timestamp_ = int64_t{0};
+}
+inline int64_t TradeOrder::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline int64_t TradeOrder::timestamp() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.timestamp)
+  return _internal_timestamp();
+}
+inline void TradeOrder::_internal_set_timestamp(int64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void TradeOrder::set_timestamp(int64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.timestamp)
+}
+
+// int64 order_id = 5;
+inline void TradeOrder::clear_order_id() {
+  _impl_.order_id_ = int64_t{0};
+}
+inline int64_t TradeOrder::_internal_order_id() const {
+  return _impl_.order_id_;
+}
+inline int64_t TradeOrder::order_id() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.order_id)
+  return _internal_order_id();
+}
+inline void TradeOrder::_internal_set_order_id(int64_t value) {
+  
+  _impl_.order_id_ = value;
+}
+inline void TradeOrder::set_order_id(int64_t value) {
+  _internal_set_order_id(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.order_id)
+}
+
+// int32 usd_volume = 6;
+inline void TradeOrder::clear_usd_volume() {
+  _impl_.usd_volume_ = 0;
+}
+inline int32_t TradeOrder::_internal_usd_volume() const {
+  return _impl_.usd_volume_;
+}
+inline int32_t TradeOrder::usd_volume() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.usd_volume)
+  return _internal_usd_volume();
+}
+inline void TradeOrder::_internal_set_usd_volume(int32_t value) {
+  
+  _impl_.usd_volume_ = value;
+}
+inline void TradeOrder::set_usd_volume(int32_t value) {
+  _internal_set_usd_volume(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.usd_volume)
+}
+
+// string username = 7;
+inline void TradeOrder::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& TradeOrder::username() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TradeOrder::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.username)
+}
+inline std::string* TradeOrder::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeOrder.username)
+  return _s;
+}
+inline const std::string& TradeOrder::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void TradeOrder::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TradeOrder::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TradeOrder::release_username() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeOrder.username)
+  return _impl_.username_.Release();
+}
+inline void TradeOrder::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeOrder.username)
+}
+
+// .Serialize.TradeOrder.OrderType order_type = 8;
+inline void TradeOrder::clear_order_type() {
+  _impl_.order_type_ = 0;
+}
+inline ::Serialize::TradeOrder_OrderType TradeOrder::_internal_order_type() const {
+  return static_cast< ::Serialize::TradeOrder_OrderType >(_impl_.order_type_);
+}
+inline ::Serialize::TradeOrder_OrderType TradeOrder::order_type() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.order_type)
+  return _internal_order_type();
+}
+inline void TradeOrder::_internal_set_order_type(::Serialize::TradeOrder_OrderType value) {
+  
+  _impl_.order_type_ = value;
+}
+inline void TradeOrder::set_order_type(::Serialize::TradeOrder_OrderType value) {
+  _internal_set_order_type(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.order_type)
+}
+
+// .Serialize.TradeOrder.TimeInForce time_in_force = 9;
+inline void TradeOrder::clear_time_in_force() {
+  _impl_.time_in_force_ = 0;
+}
+inline ::Serialize::TradeOrder_TimeInForce TradeOrder::_internal_time_in_force() const {
+  return static_cast< ::Serialize::TradeOrder_TimeInForce >(_impl_.time_in_force_);
+}
+inline ::Serialize::TradeOrder_TimeInForce TradeOrder::time_in_force() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.time_in_force)
+  return _internal_time_in_force();
+}
+inline void TradeOrder::_internal_set_time_in_force(::Serialize::TradeOrder_TimeInForce value) {
+  
+  _impl_.time_in_force_ = value;
+}
+inline void TradeOrder::set_time_in_force(::Serialize::TradeOrder_TimeInForce value) {
+  _internal_set_time_in_force(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.time_in_force)
+}
+
+// double stop_price = 10;
+inline void TradeOrder::clear_stop_price() {
+  _impl_.stop_price_ = 0;
+}
+inline double TradeOrder::_internal_stop_price() const {
+  return _impl_.stop_price_;
+}
+inline double TradeOrder::stop_price() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.stop_price)
+  return _internal_stop_price();
+}
+inline void TradeOrder::_internal_set_stop_price(double value) {
+  
+  _impl_.stop_price_ = value;
+}
+inline void TradeOrder::set_stop_price(double value) {
+  _internal_set_stop_price(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.stop_price)
+}
+
+// int32 peak_amount = 11;
+inline void TradeOrder::clear_peak_amount() {
+  _impl_.peak_amount_ = 0;
+}
+inline int32_t TradeOrder::_internal_peak_amount() const {
+  return _impl_.peak_amount_;
+}
+inline int32_t TradeOrder::peak_amount() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.peak_amount)
+  return _internal_peak_amount();
+}
+inline void TradeOrder::_internal_set_peak_amount(int32_t value) {
+  
+  _impl_.peak_amount_ = value;
+}
+inline void TradeOrder::set_peak_amount(int32_t value) {
+  _internal_set_peak_amount(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.peak_amount)
+}
+
+// int32 displayed_amount = 12;
+inline void TradeOrder::clear_displayed_amount() {
+  _impl_.displayed_amount_ = 0;
+}
+inline int32_t TradeOrder::_internal_displayed_amount() const {
+  return _impl_.displayed_amount_;
+}
+inline int32_t TradeOrder::displayed_amount() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.displayed_amount)
+  return _internal_displayed_amount();
+}
+inline void TradeOrder::_internal_set_displayed_amount(int32_t value) {
+  
+  _impl_.displayed_amount_ = value;
+}
+inline void TradeOrder::set_displayed_amount(int32_t value) {
+  _internal_set_displayed_amount(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.displayed_amount)
+}
+
+// uint32 account_id = 13;
+inline void TradeOrder::clear_account_id() {
+  _impl_.account_id_ = 0u;
+}
+inline uint32_t TradeOrder::_internal_account_id() const {
+  return _impl_.account_id_;
+}
+inline uint32_t TradeOrder::account_id() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.account_id)
+  return _internal_account_id();
+}
+inline void TradeOrder::_internal_set_account_id(uint32_t value) {
+  
+  _impl_.account_id_ = value;
+}
+inline void TradeOrder::set_account_id(uint32_t value) {
+  _internal_set_account_id(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.account_id)
+}
+
+// int64 expire_time = 14;
+inline void TradeOrder::clear_expire_time() {
+  _impl_.expire_time_ = int64_t{0};
+}
+inline int64_t TradeOrder::_internal_expire_time() const {
+  return _impl_.expire_time_;
+}
+inline int64_t TradeOrder::expire_time() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.expire_time)
+  return _internal_expire_time();
+}
+inline void TradeOrder::_internal_set_expire_time(int64_t value) {
+  
+  _impl_.expire_time_ = value;
+}
+inline void TradeOrder::set_expire_time(int64_t value) {
+  _internal_set_expire_time(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.expire_time)
+}
+
+// -------------------------------------------------------------------
+
+// CancelTradeOrder
+
+// .Serialize.CancelTradeOrder.TradeType type = 1;
+inline void CancelTradeOrder::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::Serialize::CancelTradeOrder_TradeType CancelTradeOrder::_internal_type() const {
+  return static_cast< ::Serialize::CancelTradeOrder_TradeType >(_impl_.type_);
+}
+inline ::Serialize::CancelTradeOrder_TradeType CancelTradeOrder::type() const {
+  // @@protoc_insertion_point(field_get:Serialize.CancelTradeOrder.type)
+  return _internal_type();
+}
+inline void CancelTradeOrder::_internal_set_type(::Serialize::CancelTradeOrder_TradeType value) {
+  
+  _impl_.type_ = value;
+}
+inline void CancelTradeOrder::set_type(::Serialize::CancelTradeOrder_TradeType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:Serialize.CancelTradeOrder.type)
+}
+
+// int64 order_id = 2;
+inline void CancelTradeOrder::clear_order_id() {
+  _impl_.order_id_ = int64_t{0};
+}
+inline int64_t CancelTradeOrder::_internal_order_id() const {
+  return _impl_.order_id_;
+}
+inline int64_t CancelTradeOrder::order_id() const {
+  // @@protoc_insertion_point(field_get:Serialize.CancelTradeOrder.order_id)
+  return _internal_order_id();
+}
+inline void CancelTradeOrder::_internal_set_order_id(int64_t value) {
+  
+  _impl_.order_id_ = value;
+}
+inline void CancelTradeOrder::set_order_id(int64_t value) {
+  _internal_set_order_id(value);
+  // @@protoc_insertion_point(field_set:Serialize.CancelTradeOrder.order_id)
+}
 
 // -------------------------------------------------------------------
 
-// SignInRequest
+// CancelAllOrders
 
-// string username = 1;
-inline void SignInRequest::clear_username() {
+// .Serialize.CancelAllOrders.Side side = 1;
+inline void CancelAllOrders::clear_side() {
+  _impl_.side_ = 0;
+}
+inline ::Serialize::CancelAllOrders_Side CancelAllOrders::_internal_side() const {
+  return static_cast< ::Serialize::CancelAllOrders_Side >(_impl_.side_);
+}
+inline ::Serialize::CancelAllOrders_Side CancelAllOrders::side() const {
+  // @@protoc_insertion_point(field_get:Serialize.CancelAllOrders.side)
+  return _internal_side();
+}
+inline void CancelAllOrders::_internal_set_side(::Serialize::CancelAllOrders_Side value) {
+  
+  _impl_.side_ = value;
+}
+inline void CancelAllOrders::set_side(::Serialize::CancelAllOrders_Side value) {
+  _internal_set_side(value);
+  // @@protoc_insertion_point(field_set:Serialize.CancelAllOrders.side)
+}
+
+// -------------------------------------------------------------------
+
+// ModifyTradeOrder
+
+// .Serialize.TradeOrder.TradeType type = 1;
+inline void ModifyTradeOrder::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::Serialize::TradeOrder_TradeType ModifyTradeOrder::_internal_type() const {
+  return static_cast< ::Serialize::TradeOrder_TradeType >(_impl_.type_);
+}
+inline ::Serialize::TradeOrder_TradeType ModifyTradeOrder::type() const {
+  // @@protoc_insertion_point(field_get:Serialize.ModifyTradeOrder.type)
+  return _internal_type();
+}
+inline void ModifyTradeOrder::_internal_set_type(::Serialize::TradeOrder_TradeType value) {
+  
+  _impl_.type_ = value;
+}
+inline void ModifyTradeOrder::set_type(::Serialize::TradeOrder_TradeType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:Serialize.ModifyTradeOrder.type)
+}
+
+// int64 order_id = 2;
+inline void ModifyTradeOrder::clear_order_id() {
+  _impl_.order_id_ = int64_t{0};
+}
+inline int64_t ModifyTradeOrder::_internal_order_id() const {
+  return _impl_.order_id_;
+}
+inline int64_t ModifyTradeOrder::order_id() const {
+  // @@protoc_insertion_point(field_get:Serialize.ModifyTradeOrder.order_id)
+  return _internal_order_id();
+}
+inline void ModifyTradeOrder::_internal_set_order_id(int64_t value) {
+  
+  _impl_.order_id_ = value;
+}
+inline void ModifyTradeOrder::set_order_id(int64_t value) {
+  _internal_set_order_id(value);
+  // @@protoc_insertion_point(field_set:Serialize.ModifyTradeOrder.order_id)
+}
+
+// double usd_cost = 3;
+inline void ModifyTradeOrder::clear_usd_cost() {
+  _impl_.usd_cost_ = 0;
+}
+inline double ModifyTradeOrder::_internal_usd_cost() const {
+  return _impl_.usd_cost_;
+}
+inline double ModifyTradeOrder::usd_cost() const {
+  // @@protoc_insertion_point(field_get:Serialize.ModifyTradeOrder.usd_cost)
+  return _internal_usd_cost();
+}
+inline void ModifyTradeOrder::_internal_set_usd_cost(double value) {
+  
+  _impl_.usd_cost_ = value;
+}
+inline void ModifyTradeOrder::set_usd_cost(double value) {
+  _internal_set_usd_cost(value);
+  // @@protoc_insertion_point(field_set:Serialize.ModifyTradeOrder.usd_cost)
+}
+
+// int32 usd_amount = 4;
+inline void ModifyTradeOrder::clear_usd_amount() {
+  _impl_.usd_amount_ = 0;
+}
+inline int32_t ModifyTradeOrder::_internal_usd_amount() const {
+  return _impl_.usd_amount_;
+}
+inline int32_t ModifyTradeOrder::usd_amount() const {
+  // @@protoc_insertion_point(field_get:Serialize.ModifyTradeOrder.usd_amount)
+  return _internal_usd_amount();
+}
+inline void ModifyTradeOrder::_internal_set_usd_amount(int32_t value) {
+  
+  _impl_.usd_amount_ = value;
+}
+inline void ModifyTradeOrder::set_usd_amount(int32_t value) {
+  _internal_set_usd_amount(value);
+  // @@protoc_insertion_point(field_set:Serialize.ModifyTradeOrder.usd_amount)
+}
+
+// -------------------------------------------------------------------
+
+// DepthRequest
+
+// int32 levels = 1;
+inline void DepthRequest::clear_levels() {
+  _impl_.levels_ = 0;
+}
+inline int32_t DepthRequest::_internal_levels() const {
+  return _impl_.levels_;
+}
+inline int32_t DepthRequest::levels() const {
+  // @@protoc_insertion_point(field_get:Serialize.DepthRequest.levels)
+  return _internal_levels();
+}
+inline void DepthRequest::_internal_set_levels(int32_t value) {
+  
+  _impl_.levels_ = value;
+}
+inline void DepthRequest::set_levels(int32_t value) {
+  _internal_set_levels(value);
+  // @@protoc_insertion_point(field_set:Serialize.DepthRequest.levels)
+}
+
+// -------------------------------------------------------------------
+
+// CandlesRequest
+
+// .Serialize.CandleResolution resolution = 1;
+inline void CandlesRequest::clear_resolution() {
+  _impl_.resolution_ = 0;
+}
+inline ::Serialize::CandleResolution CandlesRequest::_internal_resolution() const {
+  return static_cast< ::Serialize::CandleResolution >(_impl_.resolution_);
+}
+inline ::Serialize::CandleResolution CandlesRequest::resolution() const {
+  // @@protoc_insertion_point(field_get:Serialize.CandlesRequest.resolution)
+  return _internal_resolution();
+}
+inline void CandlesRequest::_internal_set_resolution(::Serialize::CandleResolution value) {
+  
+  _impl_.resolution_ = value;
+}
+inline void CandlesRequest::set_resolution(::Serialize::CandleResolution value) {
+  _internal_set_resolution(value);
+  // @@protoc_insertion_point(field_set:Serialize.CandlesRequest.resolution)
+}
+
+// int64 from_timestamp = 2;
+inline void CandlesRequest::clear_from_timestamp() {
+  _impl_.from_timestamp_ = int64_t{0};
+}
+inline int64_t CandlesRequest::_internal_from_timestamp() const {
+  return _impl_.from_timestamp_;
+}
+inline int64_t CandlesRequest::from_timestamp() const {
+  // @@protoc_insertion_point(field_get:Serialize.CandlesRequest.from_timestamp)
+  return _internal_from_timestamp();
+}
+inline void CandlesRequest::_internal_set_from_timestamp(int64_t value) {
+  
+  _impl_.from_timestamp_ = value;
+}
+inline void CandlesRequest::set_from_timestamp(int64_t value) {
+  _internal_set_from_timestamp(value);
+  // @@protoc_insertion_point(field_set:Serialize.CandlesRequest.from_timestamp)
+}
+
+// int64 to_timestamp = 3;
+inline void CandlesRequest::clear_to_timestamp() {
+  _impl_.to_timestamp_ = int64_t{0};
+}
+inline int64_t CandlesRequest::_internal_to_timestamp() const {
+  return _impl_.to_timestamp_;
+}
+inline int64_t CandlesRequest::to_timestamp() const {
+  // @@protoc_insertion_point(field_get:Serialize.CandlesRequest.to_timestamp)
+  return _internal_to_timestamp();
+}
+inline void CandlesRequest::_internal_set_to_timestamp(int64_t value) {
+  
+  _impl_.to_timestamp_ = value;
+}
+inline void CandlesRequest::set_to_timestamp(int64_t value) {
+  _internal_set_to_timestamp(value);
+  // @@protoc_insertion_point(field_set:Serialize.CandlesRequest.to_timestamp)
+}
+
+// -------------------------------------------------------------------
+
+// TradeRequest
+
+// .Serialize.TradeRequest.CommandType command = 1;
+inline void TradeRequest::clear_command() {
+  _impl_.command_ = 0;
+}
+inline ::Serialize::TradeRequest_CommandType TradeRequest::_internal_command() const {
+  return static_cast< ::Serialize::TradeRequest_CommandType >(_impl_.command_);
+}
+inline ::Serialize::TradeRequest_CommandType TradeRequest::command() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.command)
+  return _internal_command();
+}
+inline void TradeRequest::_internal_set_command(::Serialize::TradeRequest_CommandType value) {
+  
+  _impl_.command_ = value;
+}
+inline void TradeRequest::set_command(::Serialize::TradeRequest_CommandType value) {
+  _internal_set_command(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeRequest.command)
+}
+
+// string username = 2;
+inline void TradeRequest::clear_username() {
   _impl_.username_.ClearToEmpty();
 }
-inline const std::string& SignInRequest::username() const {
-  // @@protoc_insertion_point(field_get:Serialize.SignInRequest.username)
-  return _internal_username();
+inline const std::string& TradeRequest::username() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TradeRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Serialize.TradeRequest.username)
+}
+inline std::string* TradeRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.username)
+  return _s;
+}
+inline const std::string& TradeRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void TradeRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TradeRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TradeRequest::release_username() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.username)
+  return _impl_.username_.Release();
+}
+inline void TradeRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.username)
+}
+
+// string jwt = 3;
+inline void TradeRequest::clear_jwt() {
+  _impl_.jwt_.ClearToEmpty();
+}
+inline const std::string& TradeRequest::jwt() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.jwt)
+  return _internal_jwt();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TradeRequest::set_jwt(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.jwt_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Serialize.TradeRequest.jwt)
+}
+inline std::string* TradeRequest::mutable_jwt() {
+  std::string* _s = _internal_mutable_jwt();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.jwt)
+  return _s;
+}
+inline const std::string& TradeRequest::_internal_jwt() const {
+  return _impl_.jwt_.Get();
+}
+inline void TradeRequest::_internal_set_jwt(const std::string& value) {
+  
+  _impl_.jwt_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TradeRequest::_internal_mutable_jwt() {
+  
+  return _impl_.jwt_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TradeRequest::release_jwt() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.jwt)
+  return _impl_.jwt_.Release();
+}
+inline void TradeRequest::set_allocated_jwt(std::string* jwt) {
+  if (jwt != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.jwt_.SetAllocated(jwt, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.jwt_.IsDefault()) {
+    _impl_.jwt_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.jwt)
+}
+
+// .Serialize.SignUpRequest sign_up_request = 4;
+inline bool TradeRequest::_internal_has_sign_up_request() const {
+  return RequestData_case() == kSignUpRequest;
+}
+inline bool TradeRequest::has_sign_up_request() const {
+  return _internal_has_sign_up_request();
+}
+inline void TradeRequest::set_has_sign_up_request() {
+  _impl_._oneof_case_[0] = kSignUpRequest;
+}
+inline void TradeRequest::clear_sign_up_request() {
+  if (_internal_has_sign_up_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.RequestData_.sign_up_request_;
+    }
+    clear_has_RequestData();
+  }
+}
+inline ::Serialize::SignUpRequest* TradeRequest::release_sign_up_request() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.sign_up_request)
+  if (_internal_has_sign_up_request()) {
+    clear_has_RequestData();
+    ::Serialize::SignUpRequest* temp = _impl_.RequestData_.sign_up_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.RequestData_.sign_up_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void SignInRequest::set_username(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:Serialize.SignInRequest.username)
+inline const ::Serialize::SignUpRequest& TradeRequest::_internal_sign_up_request() const {
+  return _internal_has_sign_up_request()
+      ? *_impl_.RequestData_.sign_up_request_
+      : reinterpret_cast< ::Serialize::SignUpRequest&>(::Serialize::_SignUpRequest_default_instance_);
 }
-inline std::string* SignInRequest::mutable_username() {
-  std::string* _s = _internal_mutable_username();
-  // @@protoc_insertion_point(field_mutable:Serialize.SignInRequest.username)
-  return _s;
+inline const ::Serialize::SignUpRequest& TradeRequest::sign_up_request() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.sign_up_request)
+  return _internal_sign_up_request();
 }
-inline const std::string& SignInRequest::_internal_username() const {
-  return _impl_.username_.Get();
+inline ::Serialize::SignUpRequest* TradeRequest::unsafe_arena_release_sign_up_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeRequest.sign_up_request)
+  if (_internal_has_sign_up_request()) {
+    clear_has_RequestData();
+    ::Serialize::SignUpRequest* temp = _impl_.RequestData_.sign_up_request_;
+    _impl_.RequestData_.sign_up_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void SignInRequest::_internal_set_username(const std::string& value) {
-  
-  _impl_.username_.Set(value, GetArenaForAllocation());
+inline void TradeRequest::unsafe_arena_set_allocated_sign_up_request(::Serialize::SignUpRequest* sign_up_request) {
+  clear_RequestData();
+  if (sign_up_request) {
+    set_has_sign_up_request();
+    _impl_.RequestData_.sign_up_request_ = sign_up_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeRequest.sign_up_request)
 }
-inline std::string* SignInRequest::_internal_mutable_username() {
-  
-  return _impl_.username_.Mutable(GetArenaForAllocation());
+inline ::Serialize::SignUpRequest* TradeRequest::_internal_mutable_sign_up_request() {
+  if (!_internal_has_sign_up_request()) {
+    clear_RequestData();
+    set_has_sign_up_request();
+    _impl_.RequestData_.sign_up_request_ = CreateMaybeMessage< ::Serialize::SignUpRequest >(GetArenaForAllocation());
+  }
+  return _impl_.RequestData_.sign_up_request_;
 }
-inline std::string* SignInRequest::release_username() {
-  // @@protoc_insertion_point(field_release:Serialize.SignInRequest.username)
-  return _impl_.username_.Release();
+inline ::Serialize::SignUpRequest* TradeRequest::mutable_sign_up_request() {
+  ::Serialize::SignUpRequest* _msg = _internal_mutable_sign_up_request();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.sign_up_request)
+  return _msg;
 }
-inline void SignInRequest::set_allocated_username(std::string* username) {
-  if (username != nullptr) {
-    
+
+// .Serialize.SignInRequest sign_in_request = 5;
+inline bool TradeRequest::_internal_has_sign_in_request() const {
+  return RequestData_case() == kSignInRequest;
+}
+inline bool TradeRequest::has_sign_in_request() const {
+  return _internal_has_sign_in_request();
+}
+inline void TradeRequest::set_has_sign_in_request() {
+  _impl_._oneof_case_[0] = kSignInRequest;
+}
+inline void TradeRequest::clear_sign_in_request() {
+  if (_internal_has_sign_in_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.RequestData_.sign_in_request_;
+    }
+    clear_has_RequestData();
+  }
+}
+inline ::Serialize::SignInRequest* TradeRequest::release_sign_in_request() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.sign_in_request)
+  if (_internal_has_sign_in_request()) {
+    clear_has_RequestData();
+    ::Serialize::SignInRequest* temp = _impl_.RequestData_.sign_in_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.RequestData_.sign_in_request_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.username_.IsDefault()) {
-    _impl_.username_.Set("", GetArenaForAllocation());
+}
+inline const ::Serialize::SignInRequest& TradeRequest::_internal_sign_in_request() const {
+  return _internal_has_sign_in_request()
+      ? *_impl_.RequestData_.sign_in_request_
+      : reinterpret_cast< ::Serialize::SignInRequest&>(::Serialize::_SignInRequest_default_instance_);
+}
+inline const ::Serialize::SignInRequest& TradeRequest::sign_in_request() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.sign_in_request)
+  return _internal_sign_in_request();
+}
+inline ::Serialize::SignInRequest* TradeRequest::unsafe_arena_release_sign_in_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeRequest.sign_in_request)
+  if (_internal_has_sign_in_request()) {
+    clear_has_RequestData();
+    ::Serialize::SignInRequest* temp = _impl_.RequestData_.sign_in_request_;
+    _impl_.RequestData_.sign_in_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:Serialize.SignInRequest.username)
 }
-
-// string password = 2;
-inline void SignInRequest::clear_password() {
-  _impl_.password_.ClearToEmpty();
+inline void TradeRequest::unsafe_arena_set_allocated_sign_in_request(::Serialize::SignInRequest* sign_in_request) {
+  clear_RequestData();
+  if (sign_in_request) {
+    set_has_sign_in_request();
+    _impl_.RequestData_.sign_in_request_ = sign_in_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeRequest.sign_in_request)
 }
-inline const std::string& SignInRequest::password() const {
-  // @@protoc_insertion_point(field_get:Serialize.SignInRequest.password)
-  return _internal_password();
+inline ::Serialize::SignInRequest* TradeRequest::_internal_mutable_sign_in_request() {
+  if (!_internal_has_sign_in_request()) {
+    clear_RequestData();
+    set_has_sign_in_request();
+    _impl_.RequestData_.sign_in_request_ = CreateMaybeMessage< ::Serialize::SignInRequest >(GetArenaForAllocation());
+  }
+  return _impl_.RequestData_.sign_in_request_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void SignInRequest::set_password(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.password_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:Serialize.SignInRequest.password)
+inline ::Serialize::SignInRequest* TradeRequest::mutable_sign_in_request() {
+  ::Serialize::SignInRequest* _msg = _internal_mutable_sign_in_request();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.sign_in_request)
+  return _msg;
 }
-inline std::string* SignInRequest::mutable_password() {
-  std::string* _s = _internal_mutable_password();
-  // @@protoc_insertion_point(field_mutable:Serialize.SignInRequest.password)
-  return _s;
+
+// .Serialize.TradeOrder order = 6;
+inline bool TradeRequest::_internal_has_order() const {
+  return RequestData_case() == kOrder;
 }
-inline const std::string& SignInRequest::_internal_password() const {
-  return _impl_.password_.Get();
+inline bool TradeRequest::has_order() const {
+  return _internal_has_order();
 }
-inline void SignInRequest::_internal_set_password(const std::string& value) {
-  
-  _impl_.password_.Set(value, GetArenaForAllocation());
+inline void TradeRequest::set_has_order() {
+  _impl_._oneof_case_[0] = kOrder;
 }
-inline std::string* SignInRequest::_internal_mutable_password() {
-  
-  return _impl_.password_.Mutable(GetArenaForAllocation());
+inline void TradeRequest::clear_order() {
+  if (_internal_has_order()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.RequestData_.order_;
+    }
+    clear_has_RequestData();
+  }
 }
-inline std::string* SignInRequest::release_password() {
-  // @@protoc_insertion_point(field_release:Serialize.SignInRequest.password)
-  return _impl_.password_.Release();
+inline ::Serialize::TradeOrder* TradeRequest::release_order() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.order)
+  if (_internal_has_order()) {
+    clear_has_RequestData();
+    ::Serialize::TradeOrder* temp = _impl_.RequestData_.order_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.RequestData_.order_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void SignInRequest::set_allocated_password(std::string* password) {
-  if (password != nullptr) {
-    
+inline const ::Serialize::TradeOrder& TradeRequest::_internal_order() const {
+  return _internal_has_order()
+      ? *_impl_.RequestData_.order_
+      : reinterpret_cast< ::Serialize::TradeOrder&>(::Serialize::_TradeOrder_default_instance_);
+}
+inline const ::Serialize::TradeOrder& TradeRequest::order() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.order)
+  return _internal_order();
+}
+inline ::Serialize::TradeOrder* TradeRequest::unsafe_arena_release_order() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeRequest.order)
+  if (_internal_has_order()) {
+    clear_has_RequestData();
+    ::Serialize::TradeOrder* temp = _impl_.RequestData_.order_;
+    _impl_.RequestData_.order_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  _impl_.password_.SetAllocated(password, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.password_.IsDefault()) {
-    _impl_.password_.Set("", GetArenaForAllocation());
+}
+inline void TradeRequest::unsafe_arena_set_allocated_order(::Serialize::TradeOrder* order) {
+  clear_RequestData();
+  if (order) {
+    set_has_order();
+    _impl_.RequestData_.order_ = order;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:Serialize.SignInRequest.password)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeRequest.order)
+}
+inline ::Serialize::TradeOrder* TradeRequest::_internal_mutable_order() {
+  if (!_internal_has_order()) {
+    clear_RequestData();
+    set_has_order();
+    _impl_.RequestData_.order_ = CreateMaybeMessage< ::Serialize::TradeOrder >(GetArenaForAllocation());
+  }
+  return _impl_.RequestData_.order_;
+}
+inline ::Serialize::TradeOrder* TradeRequest::mutable_order() {
+  ::Serialize::TradeOrder* _msg = _internal_mutable_order();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.order)
+  return _msg;
 }
 
-// -------------------------------------------------------------------
-
-// TradeOrder
-
-// .Serialize.TradeOrder.TradeType type = 1;
-inline void TradeOrder::clear_type() {
-  _impl_.type_ = 0;
+// .Serialize.CancelTradeOrder cancel_order = 7;
+inline bool TradeRequest::_internal_has_cancel_order() const {
+  return RequestData_case() == kCancelOrder;
 }
-inline ::Serialize::TradeOrder_TradeType TradeOrder::_internal_type() const {
-  return static_cast< ::Serialize::TradeOrder_TradeType >(_impl_.type_);
+inline bool TradeRequest::has_cancel_order() const {
+  return _internal_has_cancel_order();
 }
-inline ::Serialize::TradeOrder_TradeType TradeOrder::type() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.type)
-  return _internal_type();
+inline void TradeRequest::set_has_cancel_order() {
+  _impl_._oneof_case_[0] = kCancelOrder;
 }
-inline void TradeOrder::_internal_set_type(::Serialize::TradeOrder_TradeType value) {
-  
-  _impl_.type_ = value;
+inline void TradeRequest::clear_cancel_order() {
+  if (_internal_has_cancel_order()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.RequestData_.cancel_order_;
+    }
+    clear_has_RequestData();
+  }
 }
-inline void TradeOrder::set_type(::Serialize::TradeOrder_TradeType value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.type)
+inline ::Serialize::CancelTradeOrder* TradeRequest::release_cancel_order() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.cancel_order)
+  if (_internal_has_cancel_order()) {
+    clear_has_RequestData();
+    ::Serialize::CancelTradeOrder* temp = _impl_.RequestData_.cancel_order_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.RequestData_.cancel_order_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-
-// double usd_cost = 2;
-inline void TradeOrder::clear_usd_cost() {
-  _impl_.usd_cost_ = 0;
+inline const ::Serialize::CancelTradeOrder& TradeRequest::_internal_cancel_order() const {
+  return _internal_has_cancel_order()
+      ? *_impl_.RequestData_.cancel_order_
+      : reinterpret_cast< ::Serialize::CancelTradeOrder&>(::Serialize::_CancelTradeOrder_default_instance_);
 }
-inline double TradeOrder::_internal_usd_cost() const {
-  return _impl_.usd_cost_;
+inline const ::Serialize::CancelTradeOrder& TradeRequest::cancel_order() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.cancel_order)
+  return _internal_cancel_order();
 }
-inline double TradeOrder::usd_cost() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.usd_cost)
-  return _internal_usd_cost();
+inline ::Serialize::CancelTradeOrder* TradeRequest::unsafe_arena_release_cancel_order() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeRequest.cancel_order)
+  if (_internal_has_cancel_order()) {
+    clear_has_RequestData();
+    ::Serialize::CancelTradeOrder* temp = _impl_.RequestData_.cancel_order_;
+    _impl_.RequestData_.cancel_order_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void TradeOrder::_internal_set_usd_cost(double value) {
-  
-  _impl_.usd_cost_ = value;
+inline void TradeRequest::unsafe_arena_set_allocated_cancel_order(::Serialize::CancelTradeOrder* cancel_order) {
+  clear_RequestData();
+  if (cancel_order) {
+    set_has_cancel_order();
+    _impl_.RequestData_.cancel_order_ = cancel_order;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeRequest.cancel_order)
 }
-inline void TradeOrder::set_usd_cost(double value) {
-  _internal_set_usd_cost(value);
-  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.usd_cost)
+inline ::Serialize::CancelTradeOrder* TradeRequest::_internal_mutable_cancel_order() {
+  if (!_internal_has_cancel_order()) {
+    clear_RequestData();
+    set_has_cancel_order();
+    _impl_.RequestData_.cancel_order_ = CreateMaybeMessage< ::Serialize::CancelTradeOrder >(GetArenaForAllocation());
+  }
+  return _impl_.RequestData_.cancel_order_;
+}
+inline ::Serialize::CancelTradeOrder* TradeRequest::mutable_cancel_order() {
+  ::Serialize::CancelTradeOrder* _msg = _internal_mutable_cancel_order();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.cancel_order)
+  return _msg;
 }
 
-// int32 usd_amount = 3;
-inline void TradeOrder::clear_usd_amount() {
-  _impl_.usd_amount_ = 0;
+// .Serialize.DepthRequest depth_request = 8;
+inline bool TradeRequest::_internal_has_depth_request() const {
+  return RequestData_case() == kDepthRequest;
 }
-inline int32_t TradeOrder::_internal_usd_amount() const {
-  return _impl_.usd_amount_;
+inline bool TradeRequest::has_depth_request() const {
+  return _internal_has_depth_request();
 }
-inline int32_t TradeOrder::usd_amount() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.usd_amount)
-  return _internal_usd_amount();
+inline void TradeRequest::set_has_depth_request() {
+  _impl_._oneof_case_[0] = kDepthRequest;
 }
-inline void TradeOrder::_internal_set_usd_amount(int32_t value) {
-  
-  _impl_.usd_amount_ = value;
+inline void TradeRequest::clear_depth_request() {
+  if (_internal_has_depth_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.RequestData_.depth_request_;
+    }
+    clear_has_RequestData();
+  }
 }
-inline void TradeOrder::set_usd_amount(int32_t value) {
-  _internal_set_usd_amount(value);
-  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.usd_amount)
+inline ::Serialize::DepthRequest* TradeRequest::release_depth_request() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.depth_request)
+  if (_internal_has_depth_request()) {
+    clear_has_RequestData();
+    ::Serialize::DepthRequest* temp = _impl_.RequestData_.depth_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.RequestData_.depth_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-
-// int64 timestamp = 4;
-inline void TradeOrder::clear_timestamp() {
-  _impl_.timestamp_ = int64_t{0};
+inline const ::Serialize::DepthRequest& TradeRequest::_internal_depth_request() const {
+  return _internal_has_depth_request()
+      ? *_impl_.RequestData_.depth_request_
+      : reinterpret_cast< ::Serialize::DepthRequest&>(::Serialize::_DepthRequest_default_instance_);
 }
-inline int64_t TradeOrder::_internal_timestamp() const {
-  return _impl_.timestamp_;
+inline const ::Serialize::DepthRequest& TradeRequest::depth_request() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.depth_request)
+  return _internal_depth_request();
 }
-inline int64_t TradeOrder::timestamp() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.timestamp)
-  return _internal_timestamp();
+inline ::Serialize::DepthRequest* TradeRequest::unsafe_arena_release_depth_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeRequest.depth_request)
+  if (_internal_has_depth_request()) {
+    clear_has_RequestData();
+    ::Serialize::DepthRequest* temp = _impl_.RequestData_.depth_request_;
+    _impl_.RequestData_.depth_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void TradeOrder::_internal_set_timestamp(int64_t value) {
-  
-  _impl_.timestamp_ = value;
+inline void TradeRequest::unsafe_arena_set_allocated_depth_request(::Serialize::DepthRequest* depth_request) {
+  clear_RequestData();
+  if (depth_request) {
+    set_has_depth_request();
+    _impl_.RequestData_.depth_request_ = depth_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeRequest.depth_request)
 }
-inline void TradeOrder::set_timestamp(int64_t value) {
-  _internal_set_timestamp(value);
-  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.timestamp)
+inline ::Serialize::DepthRequest* TradeRequest::_internal_mutable_depth_request() {
+  if (!_internal_has_depth_request()) {
+    clear_RequestData();
+    set_has_depth_request();
+    _impl_.RequestData_.depth_request_ = CreateMaybeMessage< ::Serialize::DepthRequest >(GetArenaForAllocation());
+  }
+  return _impl_.RequestData_.depth_request_;
+}
+inline ::Serialize::DepthRequest* TradeRequest::mutable_depth_request() {
+  ::Serialize::DepthRequest* _msg = _internal_mutable_depth_request();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.depth_request)
+  return _msg;
 }
 
-// int64 order_id = 5;
-inline void TradeOrder::clear_order_id() {
-  _impl_.order_id_ = int64_t{0};
+// .Serialize.CandlesRequest candles_request = 9;
+inline bool TradeRequest::_internal_has_candles_request() const {
+  return RequestData_case() == kCandlesRequest;
 }
-inline int64_t TradeOrder::_internal_order_id() const {
-  return _impl_.order_id_;
+inline bool TradeRequest::has_candles_request() const {
+  return _internal_has_candles_request();
 }
-inline int64_t TradeOrder::order_id() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.order_id)
-  return _internal_order_id();
+inline void TradeRequest::set_has_candles_request() {
+  _impl_._oneof_case_[0] = kCandlesRequest;
 }
-inline void TradeOrder::_internal_set_order_id(int64_t value) {
-  
-  _impl_.order_id_ = value;
+inline void TradeRequest::clear_candles_request() {
+  if (_internal_has_candles_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.RequestData_.candles_request_;
+    }
+    clear_has_RequestData();
+  }
 }
-inline void TradeOrder::set_order_id(int64_t value) {
-  _internal_set_order_id(value);
-  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.order_id)
+inline ::Serialize::CandlesRequest* TradeRequest::release_candles_request() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.candles_request)
+  if (_internal_has_candles_request()) {
+    clear_has_RequestData();
+    ::Serialize::CandlesRequest* temp = _impl_.RequestData_.candles_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.RequestData_.candles_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-
-// int32 usd_volume = 6;
-inline void TradeOrder::clear_usd_volume() {
-  _impl_.usd_volume_ = 0;
+inline const ::Serialize::CandlesRequest& TradeRequest::_internal_candles_request() const {
+  return _internal_has_candles_request()
+      ? *_impl_.RequestData_.candles_request_
+      : reinterpret_cast< ::Serialize::CandlesRequest&>(::Serialize::_CandlesRequest_default_instance_);
 }
-inline int32_t TradeOrder::_internal_usd_volume() const {
-  return _impl_.usd_volume_;
+inline const ::Serialize::CandlesRequest& TradeRequest::candles_request() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.candles_request)
+  return _internal_candles_request();
 }
-inline int32_t TradeOrder::usd_volume() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.usd_volume)
-  return _internal_usd_volume();
+inline ::Serialize::CandlesRequest* TradeRequest::unsafe_arena_release_candles_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeRequest.candles_request)
+  if (_internal_has_candles_request()) {
+    clear_has_RequestData();
+    ::Serialize::CandlesRequest* temp = _impl_.RequestData_.candles_request_;
+    _impl_.RequestData_.candles_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void TradeOrder::_internal_set_usd_volume(int32_t value) {
-  
-  _impl_.usd_volume_ = value;
+inline void TradeRequest::unsafe_arena_set_allocated_candles_request(::Serialize::CandlesRequest* candles_request) {
+  clear_RequestData();
+  if (candles_request) {
+    set_has_candles_request();
+    _impl_.RequestData_.candles_request_ = candles_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeRequest.candles_request)
 }
-inline void TradeOrder::set_usd_volume(int32_t value) {
-  _internal_set_usd_volume(value);
-  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.usd_volume)
+inline ::Serialize::CandlesRequest* TradeRequest::_internal_mutable_candles_request() {
+  if (!_internal_has_candles_request()) {
+    clear_RequestData();
+    set_has_candles_request();
+    _impl_.RequestData_.candles_request_ = CreateMaybeMessage< ::Serialize::CandlesRequest >(GetArenaForAllocation());
+  }
+  return _impl_.RequestData_.candles_request_;
 }
-
-// string username = 7;
-inline void TradeOrder::clear_username() {
-  _impl_.username_.ClearToEmpty();
+inline ::Serialize::CandlesRequest* TradeRequest::mutable_candles_request() {
+  ::Serialize::CandlesRequest* _msg = _internal_mutable_candles_request();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.candles_request)
+  return _msg;
 }
-inline const std::string& TradeOrder::username() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeOrder.username)
-  return _internal_username();
+
+// .Serialize.ModifyTradeOrder modify_order = 10;
+inline bool TradeRequest::_internal_has_modify_order() const {
+  return RequestData_case() == kModifyOrder;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void TradeOrder::set_username(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:Serialize.TradeOrder.username)
+inline bool TradeRequest::has_modify_order() const {
+  return _internal_has_modify_order();
 }
-inline std::string* TradeOrder::mutable_username() {
-  std::string* _s = _internal_mutable_username();
-  // @@protoc_insertion_point(field_mutable:Serialize.TradeOrder.username)
-  return _s;
+inline void TradeRequest::set_has_modify_order() {
+  _impl_._oneof_case_[0] = kModifyOrder;
 }
-inline const std::string& TradeOrder::_internal_username() const {
-  return _impl_.username_.Get();
+inline void TradeRequest::clear_modify_order() {
+  if (_internal_has_modify_order()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.RequestData_.modify_order_;
+    }
+    clear_has_RequestData();
+  }
 }
-inline void TradeOrder::_internal_set_username(const std::string& value) {
-  
-  _impl_.username_.Set(value, GetArenaForAllocation());
+inline ::Serialize::ModifyTradeOrder* TradeRequest::release_modify_order() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.modify_order)
+  if (_internal_has_modify_order()) {
+    clear_has_RequestData();
+    ::Serialize::ModifyTradeOrder* temp = _impl_.RequestData_.modify_order_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.RequestData_.modify_order_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline std::string* TradeOrder::_internal_mutable_username() {
-  
-  return _impl_.username_.Mutable(GetArenaForAllocation());
+inline const ::Serialize::ModifyTradeOrder& TradeRequest::_internal_modify_order() const {
+  return _internal_has_modify_order()
+      ? *_impl_.RequestData_.modify_order_
+      : reinterpret_cast< ::Serialize::ModifyTradeOrder&>(::Serialize::_ModifyTradeOrder_default_instance_);
 }
-inline std::string* TradeOrder::release_username() {
-  // @@protoc_insertion_point(field_release:Serialize.TradeOrder.username)
-  return _impl_.username_.Release();
+inline const ::Serialize::ModifyTradeOrder& TradeRequest::modify_order() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.modify_order)
+  return _internal_modify_order();
 }
-inline void TradeOrder::set_allocated_username(std::string* username) {
-  if (username != nullptr) {
-    
+inline ::Serialize::ModifyTradeOrder* TradeRequest::unsafe_arena_release_modify_order() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeRequest.modify_order)
+  if (_internal_has_modify_order()) {
+    clear_has_RequestData();
+    ::Serialize::ModifyTradeOrder* temp = _impl_.RequestData_.modify_order_;
+    _impl_.RequestData_.modify_order_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.username_.IsDefault()) {
-    _impl_.username_.Set("", GetArenaForAllocation());
+}
+inline void TradeRequest::unsafe_arena_set_allocated_modify_order(::Serialize::ModifyTradeOrder* modify_order) {
+  clear_RequestData();
+  if (modify_order) {
+    set_has_modify_order();
+    _impl_.RequestData_.modify_order_ = modify_order;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeOrder.username)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeRequest.modify_order)
+}
+inline ::Serialize::ModifyTradeOrder* TradeRequest::_internal_mutable_modify_order() {
+  if (!_internal_has_modify_order()) {
+    clear_RequestData();
+    set_has_modify_order();
+    _impl_.RequestData_.modify_order_ = CreateMaybeMessage< ::Serialize::ModifyTradeOrder >(GetArenaForAllocation());
+  }
+  return _impl_.RequestData_.modify_order_;
+}
+inline ::Serialize::ModifyTradeOrder* TradeRequest::mutable_modify_order() {
+  ::Serialize::ModifyTradeOrder* _msg = _internal_mutable_modify_order();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.modify_order)
+  return _msg;
 }
 
-// -------------------------------------------------------------------
-
-// CancelTradeOrder
-
-// .Serialize.CancelTradeOrder.TradeType type = 1;
-inline void CancelTradeOrder::clear_type() {
-  _impl_.type_ = 0;
+// .Serialize.CancelAllOrders cancel_all = 11;
+inline bool TradeRequest::_internal_has_cancel_all() const {
+  return RequestData_case() == kCancelAll;
 }
-inline ::Serialize::CancelTradeOrder_TradeType CancelTradeOrder::_internal_type() const {
-  return static_cast< ::Serialize::CancelTradeOrder_TradeType >(_impl_.type_);
+inline bool TradeRequest::has_cancel_all() const {
+  return _internal_has_cancel_all();
 }
-inline ::Serialize::CancelTradeOrder_TradeType CancelTradeOrder::type() const {
-  // @@protoc_insertion_point(field_get:Serialize.CancelTradeOrder.type)
-  return _internal_type();
+inline void TradeRequest::set_has_cancel_all() {
+  _impl_._oneof_case_[0] = kCancelAll;
 }
-inline void CancelTradeOrder::_internal_set_type(::Serialize::CancelTradeOrder_TradeType value) {
-  
-  _impl_.type_ = value;
+inline void TradeRequest::clear_cancel_all() {
+  if (_internal_has_cancel_all()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.RequestData_.cancel_all_;
+    }
+    clear_has_RequestData();
+  }
 }
-inline void CancelTradeOrder::set_type(::Serialize::CancelTradeOrder_TradeType value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:Serialize.CancelTradeOrder.type)
+inline ::Serialize::CancelAllOrders* TradeRequest::release_cancel_all() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.cancel_all)
+  if (_internal_has_cancel_all()) {
+    clear_has_RequestData();
+    ::Serialize::CancelAllOrders* temp = _impl_.RequestData_.cancel_all_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.RequestData_.cancel_all_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-
-// int64 order_id = 2;
-inline void CancelTradeOrder::clear_order_id() {
-  _impl_.order_id_ = int64_t{0};
+inline const ::Serialize::CancelAllOrders& TradeRequest::_internal_cancel_all() const {
+  return _internal_has_cancel_all()
+      ? *_impl_.RequestData_.cancel_all_
+      : reinterpret_cast< ::Serialize::CancelAllOrders&>(::Serialize::_CancelAllOrders_default_instance_);
 }
-inline int64_t CancelTradeOrder::_internal_order_id() const {
-  return _impl_.order_id_;
+inline const ::Serialize::CancelAllOrders& TradeRequest::cancel_all() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.cancel_all)
+  return _internal_cancel_all();
 }
-inline int64_t CancelTradeOrder::order_id() const {
-  // @@protoc_insertion_point(field_get:Serialize.CancelTradeOrder.order_id)
-  return _internal_order_id();
+inline ::Serialize::CancelAllOrders* TradeRequest::unsafe_arena_release_cancel_all() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeRequest.cancel_all)
+  if (_internal_has_cancel_all()) {
+    clear_has_RequestData();
+    ::Serialize::CancelAllOrders* temp = _impl_.RequestData_.cancel_all_;
+    _impl_.RequestData_.cancel_all_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void CancelTradeOrder::_internal_set_order_id(int64_t value) {
-  
-  _impl_.order_id_ = value;
+inline void TradeRequest::unsafe_arena_set_allocated_cancel_all(::Serialize::CancelAllOrders* cancel_all) {
+  clear_RequestData();
+  if (cancel_all) {
+    set_has_cancel_all();
+    _impl_.RequestData_.cancel_all_ = cancel_all;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeRequest.cancel_all)
 }
-inline void CancelTradeOrder::set_order_id(int64_t value) {
-  _internal_set_order_id(value);
-  // @@protoc_insertion_point(field_set:Serialize.CancelTradeOrder.order_id)
+inline ::Serialize::CancelAllOrders* TradeRequest::_internal_mutable_cancel_all() {
+  if (!_internal_has_cancel_all()) {
+    clear_RequestData();
+    set_has_cancel_all();
+    _impl_.RequestData_.cancel_all_ = CreateMaybeMessage< ::Serialize::CancelAllOrders >(GetArenaForAllocation());
+  }
+  return _impl_.RequestData_.cancel_all_;
+}
+inline ::Serialize::CancelAllOrders* TradeRequest::mutable_cancel_all() {
+  ::Serialize::CancelAllOrders* _msg = _internal_mutable_cancel_all();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.cancel_all)
+  return _msg;
 }
 
+inline bool TradeRequest::has_RequestData() const {
+  return RequestData_case() != REQUESTDATA_NOT_SET;
+}
+inline void TradeRequest::clear_has_RequestData() {
+  _impl_._oneof_case_[0] = REQUESTDATA_NOT_SET;
+}
+inline TradeRequest::RequestDataCase TradeRequest::RequestData_case() const {
+  return TradeRequest::RequestDataCase(_impl_._oneof_case_[0]);
+}
 // -------------------------------------------------------------------
 
-// TradeRequest
+// TradeResponse
 
-// .Serialize.TradeRequest.CommandType command = 1;
-inline void TradeRequest::clear_command() {
-  _impl_.command_ = 0;
+// .Serialize.TradeResponse.status response_msg = 1;
+inline void TradeResponse::clear_response_msg() {
+  _impl_.response_msg_ = 0;
 }
-inline ::Serialize::TradeRequest_CommandType TradeRequest::_internal_command() const {
-  return static_cast< ::Serialize::TradeRequest_CommandType >(_impl_.command_);
+inline ::Serialize::TradeResponse_status TradeResponse::_internal_response_msg() const {
+  return static_cast< ::Serialize::TradeResponse_status >(_impl_.response_msg_);
 }
-inline ::Serialize::TradeRequest_CommandType TradeRequest::command() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.command)
-  return _internal_command();
+inline ::Serialize::TradeResponse_status TradeResponse::response_msg() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.response_msg)
+  return _internal_response_msg();
 }
-inline void TradeRequest::_internal_set_command(::Serialize::TradeRequest_CommandType value) {
+inline void TradeResponse::_internal_set_response_msg(::Serialize::TradeResponse_status value) {
   
-  _impl_.command_ = value;
+  _impl_.response_msg_ = value;
 }
-inline void TradeRequest::set_command(::Serialize::TradeRequest_CommandType value) {
-  _internal_set_command(value);
-  // @@protoc_insertion_point(field_set:Serialize.TradeRequest.command)
+inline void TradeResponse::set_response_msg(::Serialize::TradeResponse_status value) {
+  _internal_set_response_msg(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeResponse.response_msg)
 }
 
-// string username = 2;
-inline void TradeRequest::clear_username() {
-  _impl_.username_.ClearToEmpty();
-}
-inline const std::string& TradeRequest::username() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.username)
-  return _internal_username();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void TradeRequest::set_username(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:Serialize.TradeRequest.username)
-}
-inline std::string* TradeRequest::mutable_username() {
-  std::string* _s = _internal_mutable_username();
-  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.username)
-  return _s;
-}
-inline const std::string& TradeRequest::_internal_username() const {
-  return _impl_.username_.Get();
-}
-inline void TradeRequest::_internal_set_username(const std::string& value) {
-  
-  _impl_.username_.Set(value, GetArenaForAllocation());
+// string jwt = 2;
+inline bool TradeResponse::_internal_has_jwt() const {
+  return RequestData_case() == kJwt;
 }
-inline std::string* TradeRequest::_internal_mutable_username() {
-  
-  return _impl_.username_.Mutable(GetArenaForAllocation());
+inline bool TradeResponse::has_jwt() const {
+  return _internal_has_jwt();
 }
-inline std::string* TradeRequest::release_username() {
-  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.username)
-  return _impl_.username_.Release();
+inline void TradeResponse::set_has_jwt() {
+  _impl_._oneof_case_[0] = kJwt;
 }
-inline void TradeRequest::set_allocated_username(std::string* username) {
-  if (username != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.username_.IsDefault()) {
-    _impl_.username_.Set("", GetArenaForAllocation());
+inline void TradeResponse::clear_jwt() {
+  if (_internal_has_jwt()) {
+    _impl_.RequestData_.jwt_.Destroy();
+    clear_has_RequestData();
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.username)
-}
-
-// string jwt = 3;
-inline void TradeRequest::clear_jwt() {
-  _impl_.jwt_.ClearToEmpty();
 }
-inline const std::string& TradeRequest::jwt() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.jwt)
+inline const std::string& TradeResponse::jwt() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.jwt)
   return _internal_jwt();
 }
 template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void TradeRequest::set_jwt(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.jwt_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:Serialize.TradeRequest.jwt)
+inline void TradeResponse::set_jwt(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_jwt()) {
+    clear_RequestData();
+    set_has_jwt();
+    _impl_.RequestData_.jwt_.InitDefault();
+  }
+  _impl_.RequestData_.jwt_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Serialize.TradeResponse.jwt)
 }
-inline std::string* TradeRequest::mutable_jwt() {
+inline std::string* TradeResponse::mutable_jwt() {
   std::string* _s = _internal_mutable_jwt();
-  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.jwt)
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.jwt)
   return _s;
 }
-inline const std::string& TradeRequest::_internal_jwt() const {
-  return _impl_.jwt_.Get();
-}
-inline void TradeRequest::_internal_set_jwt(const std::string& value) {
-  
-  _impl_.jwt_.Set(value, GetArenaForAllocation());
+inline const std::string& TradeResponse::_internal_jwt() const {
+  if (_internal_has_jwt()) {
+    return _impl_.RequestData_.jwt_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
-inline std::string* TradeRequest::_internal_mutable_jwt() {
-  
-  return _impl_.jwt_.Mutable(GetArenaForAllocation());
+inline void TradeResponse::_internal_set_jwt(const std::string& value) {
+  if (!_internal_has_jwt()) {
+    clear_RequestData();
+    set_has_jwt();
+    _impl_.RequestData_.jwt_.InitDefault();
+  }
+  _impl_.RequestData_.jwt_.Set(value, GetArenaForAllocation());
 }
-inline std::string* TradeRequest::release_jwt() {
-  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.jwt)
-  return _impl_.jwt_.Release();
+inline std::string* TradeResponse::_internal_mutable_jwt() {
+  if (!_internal_has_jwt()) {
+    clear_RequestData();
+    set_has_jwt();
+    _impl_.RequestData_.jwt_.InitDefault();
+  }
+  return _impl_.RequestData_.jwt_.Mutable(      GetArenaForAllocation());
 }
-inline void TradeRequest::set_allocated_jwt(std::string* jwt) {
-  if (jwt != nullptr) {
-    
+inline std::string* TradeResponse::release_jwt() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.jwt)
+  if (_internal_has_jwt()) {
+    clear_has_RequestData();
+    return _impl_.RequestData_.jwt_.Release();
   } else {
-    
+    return nullptr;
   }
-  _impl_.jwt_.SetAllocated(jwt, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.jwt_.IsDefault()) {
-    _impl_.jwt_.Set("", GetArenaForAllocation());
+}
+inline void TradeResponse::set_allocated_jwt(std::string* jwt) {
+  if (has_RequestData()) {
+    clear_RequestData();
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeRequest.jwt)
+  if (jwt != nullptr) {
+    set_has_jwt();
+    _impl_.RequestData_.jwt_.InitAllocated(jwt, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.jwt)
 }
 
-// .Serialize.SignUpRequest sign_up_request = 4;
-inline bool TradeRequest::_internal_has_sign_up_request() const {
-  return RequestData_case() == kSignUpRequest;
+// .Serialize.AccountBalance account_balance = 3;
+inline bool TradeResponse::_internal_has_account_balance() const {
+  return RequestData_case() == kAccountBalance;
 }
-inline bool TradeRequest::has_sign_up_request() const {
-  return _internal_has_sign_up_request();
+inline bool TradeResponse::has_account_balance() const {
+  return _internal_has_account_balance();
 }
-inline void TradeRequest::set_has_sign_up_request() {
-  _impl_._oneof_case_[0] = kSignUpRequest;
+inline void TradeResponse::set_has_account_balance() {
+  _impl_._oneof_case_[0] = kAccountBalance;
 }
-inline void TradeRequest::clear_sign_up_request() {
-  if (_internal_has_sign_up_request()) {
+inline void TradeResponse::clear_account_balance() {
+  if (_internal_has_account_balance()) {
     if (GetArenaForAllocation() == nullptr) {
-      delete _impl_.RequestData_.sign_up_request_;
+      delete _impl_.RequestData_.account_balance_;
     }
     clear_has_RequestData();
   }
 }
-inline ::Serialize::SignUpRequest* TradeRequest::release_sign_up_request() {
-  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.sign_up_request)
-  if (_internal_has_sign_up_request()) {
+inline ::Serialize::AccountBalance* TradeResponse::release_account_balance() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.account_balance)
+  if (_internal_has_account_balance()) {
     clear_has_RequestData();
-    ::Serialize::SignUpRequest* temp = _impl_.RequestData_.sign_up_request_;
+    ::Serialize::AccountBalance* temp = _impl_.RequestData_.account_balance_;
     if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    _impl_.RequestData_.sign_up_request_ = nullptr;
+    _impl_.RequestData_.account_balance_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::Serialize::SignUpRequest& TradeRequest::_internal_sign_up_request() const {
-  return _internal_has_sign_up_request()
-      ? *_impl_.RequestData_.sign_up_request_
-      : reinterpret_cast< ::Serialize::SignUpRequest&>(::Serialize::_SignUpRequest_default_instance_);
+inline const ::Serialize::AccountBalance& TradeResponse::_internal_account_balance() const {
+  return _internal_has_account_balance()
+      ? *_impl_.RequestData_.account_balance_
+      : reinterpret_cast< ::Serialize::AccountBalance&>(::Serialize::_AccountBalance_default_instance_);
 }
-inline const ::Serialize::SignUpRequest& TradeRequest::sign_up_request() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.sign_up_request)
-  return _internal_sign_up_request();
+inline const ::Serialize::AccountBalance& TradeResponse::account_balance() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.account_balance)
+  return _internal_account_balance();
 }
-inline ::Serialize::SignUpRequest* TradeRequest::unsafe_arena_release_sign_up_request() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeRequest.sign_up_request)
-  if (_internal_has_sign_up_request()) {
+inline ::Serialize::AccountBalance* TradeResponse::unsafe_arena_release_account_balance() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeResponse.account_balance)
+  if (_internal_has_account_balance()) {
     clear_has_RequestData();
-    ::Serialize::SignUpRequest* temp = _impl_.RequestData_.sign_up_request_;
-    _impl_.RequestData_.sign_up_request_ = nullptr;
+    ::Serialize::AccountBalance* temp = _impl_.RequestData_.account_balance_;
+    _impl_.RequestData_.account_balance_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void TradeRequest::unsafe_arena_set_allocated_sign_up_request(::Serialize::SignUpRequest* sign_up_request) {
+inline void TradeResponse::unsafe_arena_set_allocated_account_balance(::Serialize::AccountBalance* account_balance) {
   clear_RequestData();
-  if (sign_up_request) {
-    set_has_sign_up_request();
-    _impl_.RequestData_.sign_up_request_ = sign_up_request;
+  if (account_balance) {
+    set_has_account_balance();
+    _impl_.RequestData_.account_balance_ = account_balance;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeRequest.sign_up_request)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeResponse.account_balance)
 }
-inline ::Serialize::SignUpRequest* TradeRequest::_internal_mutable_sign_up_request() {
-  if (!_internal_has_sign_up_request()) {
+inline ::Serialize::AccountBalance* TradeResponse::_internal_mutable_account_balance() {
+  if (!_internal_has_account_balance()) {
     clear_RequestData();
-    set_has_sign_up_request();
-    _impl_.RequestData_.sign_up_request_ = CreateMaybeMessage< ::Serialize::SignUpRequest >(GetArenaForAllocation());
+    set_has_account_balance();
+    _impl_.RequestData_.account_balance_ = CreateMaybeMessage< ::Serialize::AccountBalance >(GetArenaForAllocation());
   }
-  return _impl_.RequestData_.sign_up_request_;
+  return _impl_.RequestData_.account_balance_;
 }
-inline ::Serialize::SignUpRequest* TradeRequest::mutable_sign_up_request() {
-  ::Serialize::SignUpRequest* _msg = _internal_mutable_sign_up_request();
-  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.sign_up_request)
+inline ::Serialize::AccountBalance* TradeResponse::mutable_account_balance() {
+  ::Serialize::AccountBalance* _msg = _internal_mutable_account_balance();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.account_balance)
   return _msg;
 }
 
-// .Serialize.SignInRequest sign_in_request = 5;
-inline bool TradeRequest::_internal_has_sign_in_request() const {
-  return RequestData_case() == kSignInRequest;
+// .Serialize.ActiveOrders active_orders = 4;
+inline bool TradeResponse::_internal_has_active_orders() const {
+  return RequestData_case() == kActiveOrders;
 }
-inline bool TradeRequest::has_sign_in_request() const {
-  return _internal_has_sign_in_request();
+inline bool TradeResponse::has_active_orders() const {
+  return _internal_has_active_orders();
 }
-inline void TradeRequest::set_has_sign_in_request() {
-  _impl_._oneof_case_[0] = kSignInRequest;
+inline void TradeResponse::set_has_active_orders() {
+  _impl_._oneof_case_[0] = kActiveOrders;
 }
-inline void TradeRequest::clear_sign_in_request() {
-  if (_internal_has_sign_in_request()) {
+inline void TradeResponse::clear_active_orders() {
+  if (_internal_has_active_orders()) {
     if (GetArenaForAllocation() == nullptr) {
-      delete _impl_.RequestData_.sign_in_request_;
+      delete _impl_.RequestData_.active_orders_;
     }
     clear_has_RequestData();
   }
 }
-inline ::Serialize::SignInRequest* TradeRequest::release_sign_in_request() {
-  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.sign_in_request)
-  if (_internal_has_sign_in_request()) {
+inline ::Serialize::ActiveOrders* TradeResponse::release_active_orders() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.active_orders)
+  if (_internal_has_active_orders()) {
     clear_has_RequestData();
-    ::Serialize::SignInRequest* temp = _impl_.RequestData_.sign_in_request_;
+    ::Serialize::ActiveOrders* temp = _impl_.RequestData_.active_orders_;
     if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    _impl_.RequestData_.sign_in_request_ = nullptr;
+    _impl_.RequestData_.active_orders_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::Serialize::SignInRequest& TradeRequest::_internal_sign_in_request() const {
-  return _internal_has_sign_in_request()
-      ? *_impl_.RequestData_.sign_in_request_
-      : reinterpret_cast< ::Serialize::SignInRequest&>(::Serialize::_SignInRequest_default_instance_);
+inline const ::Serialize::ActiveOrders& TradeResponse::_internal_active_orders() const {
+  return _internal_has_active_orders()
+      ? *_impl_.RequestData_.active_orders_
+      : reinterpret_cast< ::Serialize::ActiveOrders&>(::Serialize::_ActiveOrders_default_instance_);
 }
-inline const ::Serialize::SignInRequest& TradeRequest::sign_in_request() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.sign_in_request)
-  return _internal_sign_in_request();
+inline const ::Serialize::ActiveOrders& TradeResponse::active_orders() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.active_orders)
+  return _internal_active_orders();
 }
-inline ::Serialize::SignInRequest* TradeRequest::unsafe_arena_release_sign_in_request() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeRequest.sign_in_request)
-  if (_internal_has_sign_in_request()) {
+inline ::Serialize::ActiveOrders* TradeResponse::unsafe_arena_release_active_orders() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeResponse.active_orders)
+  if (_internal_has_active_orders()) {
     clear_has_RequestData();
-    ::Serialize::SignInRequest* temp = _impl_.RequestData_.sign_in_request_;
-    _impl_.RequestData_.sign_in_request_ = nullptr;
+    ::Serialize::ActiveOrders* temp = _impl_.RequestData_.active_orders_;
+    _impl_.RequestData_.active_orders_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void TradeRequest::unsafe_arena_set_allocated_sign_in_request(::Serialize::SignInRequest* sign_in_request) {
+inline void TradeResponse::unsafe_arena_set_allocated_active_orders(::Serialize::ActiveOrders* active_orders) {
   clear_RequestData();
-  if (sign_in_request) {
-    set_has_sign_in_request();
-    _impl_.RequestData_.sign_in_request_ = sign_in_request;
+  if (active_orders) {
+    set_has_active_orders();
+    _impl_.RequestData_.active_orders_ = active_orders;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeRequest.sign_in_request)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeResponse.active_orders)
 }
-inline ::Serialize::SignInRequest* TradeRequest::_internal_mutable_sign_in_request() {
-  if (!_internal_has_sign_in_request()) {
+inline ::Serialize::ActiveOrders* TradeResponse::_internal_mutable_active_orders() {
+  if (!_internal_has_active_orders()) {
     clear_RequestData();
-    set_has_sign_in_request();
-    _impl_.RequestData_.sign_in_request_ = CreateMaybeMessage< ::Serialize::SignInRequest >(GetArenaForAllocation());
+    set_has_active_orders();
+    _impl_.RequestData_.active_orders_ = CreateMaybeMessage< ::Serialize::ActiveOrders >(GetArenaForAllocation());
   }
-  return _impl_.RequestData_.sign_in_request_;
+  return _impl_.RequestData_.active_orders_;
 }
-inline ::Serialize::SignInRequest* TradeRequest::mutable_sign_in_request() {
-  ::Serialize::SignInRequest* _msg = _internal_mutable_sign_in_request();
-  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.sign_in_request)
+inline ::Serialize::ActiveOrders* TradeResponse::mutable_active_orders() {
+  ::Serialize::ActiveOrders* _msg = _internal_mutable_active_orders();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.active_orders)
   return _msg;
 }
 
-// .Serialize.TradeOrder order = 6;
-inline bool TradeRequest::_internal_has_order() const {
-  return RequestData_case() == kOrder;
+// .Serialize.CompletedOredrs completed_orders = 5;
+inline bool TradeResponse::_internal_has_completed_orders() const {
+  return RequestData_case() == kCompletedOrders;
 }
-inline bool TradeRequest::has_order() const {
-  return _internal_has_order();
+inline bool TradeResponse::has_completed_orders() const {
+  return _internal_has_completed_orders();
 }
-inline void TradeRequest::set_has_order() {
-  _impl_._oneof_case_[0] = kOrder;
+inline void TradeResponse::set_has_completed_orders() {
+  _impl_._oneof_case_[0] = kCompletedOrders;
 }
-inline void TradeRequest::clear_order() {
-  if (_internal_has_order()) {
+inline void TradeResponse::clear_completed_orders() {
+  if (_internal_has_completed_orders()) {
     if (GetArenaForAllocation() == nullptr) {
-      delete _impl_.RequestData_.order_;
+      delete _impl_.RequestData_.completed_orders_;
     }
     clear_has_RequestData();
   }
 }
-inline ::Serialize::TradeOrder* TradeRequest::release_order() {
-  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.order)
-  if (_internal_has_order()) {
+inline ::Serialize::CompletedOredrs* TradeResponse::release_completed_orders() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.completed_orders)
+  if (_internal_has_completed_orders()) {
     clear_has_RequestData();
-    ::Serialize::TradeOrder* temp = _impl_.RequestData_.order_;
+    ::Serialize::CompletedOredrs* temp = _impl_.RequestData_.completed_orders_;
     if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    _impl_.RequestData_.order_ = nullptr;
+    _impl_.RequestData_.completed_orders_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::Serialize::TradeOrder& TradeRequest::_internal_order() const {
-  return _internal_has_order()
-      ? *_impl_.RequestData_.order_
-      : reinterpret_cast< ::Serialize::TradeOrder&>(::Serialize::_TradeOrder_default_instance_);
+inline const ::Serialize::CompletedOredrs& TradeResponse::_internal_completed_orders() const {
+  return _internal_has_completed_orders()
+      ? *_impl_.RequestData_.completed_orders_
+      : reinterpret_cast< ::Serialize::CompletedOredrs&>(::Serialize::_CompletedOredrs_default_instance_);
 }
-inline const ::Serialize::TradeOrder& TradeRequest::order() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.order)
-  return _internal_order();
+inline const ::Serialize::CompletedOredrs& TradeResponse::completed_orders() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.completed_orders)
+  return _internal_completed_orders();
 }
-inline ::Serialize::TradeOrder* TradeRequest::unsafe_arena_release_order() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeRequest.order)
-  if (_internal_has_order()) {
+inline ::Serialize::CompletedOredrs* TradeResponse::unsafe_arena_release_completed_orders() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeResponse.completed_orders)
+  if (_internal_has_completed_orders()) {
     clear_has_RequestData();
-    ::Serialize::TradeOrder* temp = _impl_.RequestData_.order_;
-    _impl_.RequestData_.order_ = nullptr;
+    ::Serialize::CompletedOredrs* temp = _impl_.RequestData_.completed_orders_;
+    _impl_.RequestData_.completed_orders_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void TradeRequest::unsafe_arena_set_allocated_order(::Serialize::TradeOrder* order) {
+inline void TradeResponse::unsafe_arena_set_allocated_completed_orders(::Serialize::CompletedOredrs* completed_orders) {
   clear_RequestData();
-  if (order) {
-    set_has_order();
-    _impl_.RequestData_.order_ = order;
+  if (completed_orders) {
+    set_has_completed_orders();
+    _impl_.RequestData_.completed_orders_ = completed_orders;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeRequest.order)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeResponse.completed_orders)
 }
-inline ::Serialize::TradeOrder* TradeRequest::_internal_mutable_order() {
-  if (!_internal_has_order()) {
+inline ::Serialize::CompletedOredrs* TradeResponse::_internal_mutable_completed_orders() {
+  if (!_internal_has_completed_orders()) {
     clear_RequestData();
-    set_has_order();
-    _impl_.RequestData_.order_ = CreateMaybeMessage< ::Serialize::TradeOrder >(GetArenaForAllocation());
+    set_has_completed_orders();
+    _impl_.RequestData_.completed_orders_ = CreateMaybeMessage< ::Serialize::CompletedOredrs >(GetArenaForAllocation());
   }
-  return _impl_.RequestData_.order_;
+  return _impl_.RequestData_.completed_orders_;
 }
-inline ::Serialize::TradeOrder* TradeRequest::mutable_order() {
-  ::Serialize::TradeOrder* _msg = _internal_mutable_order();
-  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.order)
+inline ::Serialize::CompletedOredrs* TradeResponse::mutable_completed_orders() {
+  ::Serialize::CompletedOredrs* _msg = _internal_mutable_completed_orders();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.completed_orders)
   return _msg;
 }
 
-// .Serialize.CancelTradeOrder cancel_order = 7;
-inline bool TradeRequest::_internal_has_cancel_order() const {
-  return RequestData_case() == kCancelOrder;
+// .Serialize.QuoteHistory quote_history = 6;
+inline bool TradeResponse::_internal_has_quote_history() const {
+  return RequestData_case() == kQuoteHistory;
 }
-inline bool TradeRequest::has_cancel_order() const {
-  return _internal_has_cancel_order();
+inline bool TradeResponse::has_quote_history() const {
+  return _internal_has_quote_history();
 }
-inline void TradeRequest::set_has_cancel_order() {
-  _impl_._oneof_case_[0] = kCancelOrder;
+inline void TradeResponse::set_has_quote_history() {
+  _impl_._oneof_case_[0] = kQuoteHistory;
 }
-inline void TradeRequest::clear_cancel_order() {
-  if (_internal_has_cancel_order()) {
+inline void TradeResponse::clear_quote_history() {
+  if (_internal_has_quote_history()) {
     if (GetArenaForAllocation() == nullptr) {
-      delete _impl_.RequestData_.cancel_order_;
+      delete _impl_.RequestData_.quote_history_;
     }
     clear_has_RequestData();
   }
 }
-inline ::Serialize::CancelTradeOrder* TradeRequest::release_cancel_order() {
-  // @@protoc_insertion_point(field_release:Serialize.TradeRequest.cancel_order)
-  if (_internal_has_cancel_order()) {
+inline ::Serialize::QuoteHistory* TradeResponse::release_quote_history() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.quote_history)
+  if (_internal_has_quote_history()) {
     clear_has_RequestData();
-    ::Serialize::CancelTradeOrder* temp = _impl_.RequestData_.cancel_order_;
+    ::Serialize::QuoteHistory* temp = _impl_.RequestData_.quote_history_;
     if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    _impl_.RequestData_.cancel_order_ = nullptr;
+    _impl_.RequestData_.quote_history_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::Serialize::CancelTradeOrder& TradeRequest::_internal_cancel_order() const {
-  return _internal_has_cancel_order()
-      ? *_impl_.RequestData_.cancel_order_
-      : reinterpret_cast< ::Serialize::CancelTradeOrder&>(::Serialize::_CancelTradeOrder_default_instance_);
-}
-inline const ::Serialize::CancelTradeOrder& TradeRequest::cancel_order() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeRequest.cancel_order)
-  return _internal_cancel_order();
+inline const ::Serialize::QuoteHistory& TradeResponse::_internal_quote_history() const {
+  return _internal_has_quote_history()
+      ? *_impl_.RequestData_.quote_history_
+      : reinterpret_cast< ::Serialize::QuoteHistory&>(::Serialize::_QuoteHistory_default_instance_);
 }
-inline ::Serialize::CancelTradeOrder* TradeRequest::unsafe_arena_release_cancel_order() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeRequest.cancel_order)
-  if (_internal_has_cancel_order()) {
+inline const ::Serialize::QuoteHistory& TradeResponse::quote_history() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.quote_history)
+  return _internal_quote_history();
+}
+inline ::Serialize::QuoteHistory* TradeResponse::unsafe_arena_release_quote_history() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeResponse.quote_history)
+  if (_internal_has_quote_history()) {
     clear_has_RequestData();
-    ::Serialize::CancelTradeOrder* temp = _impl_.RequestData_.cancel_order_;
-    _impl_.RequestData_.cancel_order_ = nullptr;
+    ::Serialize::QuoteHistory* temp = _impl_.RequestData_.quote_history_;
+    _impl_.RequestData_.quote_history_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void TradeRequest::unsafe_arena_set_allocated_cancel_order(::Serialize::CancelTradeOrder* cancel_order) {
+inline void TradeResponse::unsafe_arena_set_allocated_quote_history(::Serialize::QuoteHistory* quote_history) {
   clear_RequestData();
-  if (cancel_order) {
-    set_has_cancel_order();
-    _impl_.RequestData_.cancel_order_ = cancel_order;
+  if (quote_history) {
+    set_has_quote_history();
+    _impl_.RequestData_.quote_history_ = quote_history;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeRequest.cancel_order)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeResponse.quote_history)
 }
-inline ::Serialize::CancelTradeOrder* TradeRequest::_internal_mutable_cancel_order() {
-  if (!_internal_has_cancel_order()) {
+inline ::Serialize::QuoteHistory* TradeResponse::_internal_mutable_quote_history() {
+  if (!_internal_has_quote_history()) {
     clear_RequestData();
-    set_has_cancel_order();
-    _impl_.RequestData_.cancel_order_ = CreateMaybeMessage< ::Serialize::CancelTradeOrder >(GetArenaForAllocation());
+    set_has_quote_history();
+    _impl_.RequestData_.quote_history_ = CreateMaybeMessage< ::Serialize::QuoteHistory >(GetArenaForAllocation());
   }
-  return _impl_.RequestData_.cancel_order_;
+  return _impl_.RequestData_.quote_history_;
 }
-inline ::Serialize::CancelTradeOrder* TradeRequest::mutable_cancel_order() {
-  ::Serialize::CancelTradeOrder* _msg = _internal_mutable_cancel_order();
-  // @@protoc_insertion_point(field_mutable:Serialize.TradeRequest.cancel_order)
+inline ::Serialize::QuoteHistory* TradeResponse::mutable_quote_history() {
+  ::Serialize::QuoteHistory* _msg = _internal_mutable_quote_history();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.quote_history)
   return _msg;
 }
 
-inline bool TradeRequest::has_RequestData() const {
-  return RequestData_case() != REQUESTDATA_NOT_SET;
-}
-inline void TradeRequest::clear_has_RequestData() {
-  _impl_._oneof_case_[0] = REQUESTDATA_NOT_SET;
-}
-inline TradeRequest::RequestDataCase TradeRequest::RequestData_case() const {
-  return TradeRequest::RequestDataCase(_impl_._oneof_case_[0]);
-}
-// -------------------------------------------------------------------
-
-// TradeResponse
-
-// .Serialize.TradeResponse.status response_msg = 1;
-inline void TradeResponse::clear_response_msg() {
-  _impl_.response_msg_ = 0;
-}
-inline ::Serialize::TradeResponse_status TradeResponse::_internal_response_msg() const {
-  return static_cast< ::Serialize::TradeResponse_status >(_impl_.response_msg_);
-}
-inline ::Serialize::TradeResponse_status TradeResponse::response_msg() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.response_msg)
-  return _internal_response_msg();
-}
-inline void TradeResponse::_internal_set_response_msg(::Serialize::TradeResponse_status value) {
-  
-  _impl_.response_msg_ = value;
-}
-inline void TradeResponse::set_response_msg(::Serialize::TradeResponse_status value) {
-  _internal_set_response_msg(value);
-  // @@protoc_insertion_point(field_set:Serialize.TradeResponse.response_msg)
-}
-
-// string jwt = 2;
-inline bool TradeResponse::_internal_has_jwt() const {
-  return RequestData_case() == kJwt;
+// string error_response = 7;
+inline bool TradeResponse::_internal_has_error_response() const {
+  return RequestData_case() == kErrorResponse;
 }
-inline bool TradeResponse::has_jwt() const {
-  return _internal_has_jwt();
+inline bool TradeResponse::has_error_response() const {
+  return _internal_has_error_response();
 }
-inline void TradeResponse::set_has_jwt() {
-  _impl_._oneof_case_[0] = kJwt;
+inline void TradeResponse::set_has_error_response() {
+  _impl_._oneof_case_[0] = kErrorResponse;
 }
-inline void TradeResponse::clear_jwt() {
-  if (_internal_has_jwt()) {
-    _impl_.RequestData_.jwt_.Destroy();
+inline void TradeResponse::clear_error_response() {
+  if (_internal_has_error_response()) {
+    _impl_.RequestData_.error_response_.Destroy();
     clear_has_RequestData();
   }
 }
-inline const std::string& TradeResponse::jwt() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.jwt)
-  return _internal_jwt();
+inline const std::string& TradeResponse::error_response() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.error_response)
+  return _internal_error_response();
 }
 template <typename ArgT0, typename... ArgT>
-inline void TradeResponse::set_jwt(ArgT0&& arg0, ArgT... args) {
-  if (!_internal_has_jwt()) {
+inline void TradeResponse::set_error_response(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_error_response()) {
     clear_RequestData();
-    set_has_jwt();
-    _impl_.RequestData_.jwt_.InitDefault();
+    set_has_error_response();
+    _impl_.RequestData_.error_response_.InitDefault();
   }
-  _impl_.RequestData_.jwt_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:Serialize.TradeResponse.jwt)
+  _impl_.RequestData_.error_response_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Serialize.TradeResponse.error_response)
 }
-inline std::string* TradeResponse::mutable_jwt() {
-  std::string* _s = _internal_mutable_jwt();
-  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.jwt)
+inline std::string* TradeResponse::mutable_error_response() {
+  std::string* _s = _internal_mutable_error_response();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.error_response)
   return _s;
 }
-inline const std::string& TradeResponse::_internal_jwt() const {
-  if (_internal_has_jwt()) {
-    return _impl_.RequestData_.jwt_.Get();
+inline const std::string& TradeResponse::_internal_error_response() const {
+  if (_internal_has_error_response()) {
+    return _impl_.RequestData_.error_response_.Get();
   }
   return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
-inline void TradeResponse::_internal_set_jwt(const std::string& value) {
-  if (!_internal_has_jwt()) {
+inline void TradeResponse::_internal_set_error_response(const std::string& value) {
+  if (!_internal_has_error_response()) {
     clear_RequestData();
-    set_has_jwt();
-    _impl_.RequestData_.jwt_.InitDefault();
+    set_has_error_response();
+    _impl_.RequestData_.error_response_.InitDefault();
   }
-  _impl_.RequestData_.jwt_.Set(value, GetArenaForAllocation());
+  _impl_.RequestData_.error_response_.Set(value, GetArenaForAllocation());
 }
-inline std::string* TradeResponse::_internal_mutable_jwt() {
-  if (!_internal_has_jwt()) {
+inline std::string* TradeResponse::_internal_mutable_error_response() {
+  if (!_internal_has_error_response()) {
     clear_RequestData();
-    set_has_jwt();
-    _impl_.RequestData_.jwt_.InitDefault();
+    set_has_error_response();
+    _impl_.RequestData_.error_response_.InitDefault();
   }
-  return _impl_.RequestData_.jwt_.Mutable(      GetArenaForAllocation());
+  return _impl_.RequestData_.error_response_.Mutable(      GetArenaForAllocation());
 }
-inline std::string* TradeResponse::release_jwt() {
-  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.jwt)
-  if (_internal_has_jwt()) {
+inline std::string* TradeResponse::release_error_response() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.error_response)
+  if (_internal_has_error_response()) {
     clear_has_RequestData();
-    return _impl_.RequestData_.jwt_.Release();
+    return _impl_.RequestData_.error_response_.Release();
   } else {
     return nullptr;
   }
 }
-inline void TradeResponse::set_allocated_jwt(std::string* jwt) {
+inline void TradeResponse::set_allocated_error_response(std::string* error_response) {
   if (has_RequestData()) {
     clear_RequestData();
   }
-  if (jwt != nullptr) {
-    set_has_jwt();
-    _impl_.RequestData_.jwt_.InitAllocated(jwt, GetArenaForAllocation());
+  if (error_response != nullptr) {
+    set_has_error_response();
+    _impl_.RequestData_.error_response_.InitAllocated(error_response, GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.jwt)
+  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.error_response)
 }
 
-// .Serialize.AccountBalance account_balance = 3;
-inline bool TradeResponse::_internal_has_account_balance() const {
-  return RequestData_case() == kAccountBalance;
+// .Serialize.ExecutionReport execution_report = 8;
+inline bool TradeResponse::_internal_has_execution_report() const {
+  return RequestData_case() == kExecutionReport;
 }
-inline bool TradeResponse::has_account_balance() const {
-  return _internal_has_account_balance();
+inline bool TradeResponse::has_execution_report() const {
+  return _internal_has_execution_report();
 }
-inline void TradeResponse::set_has_account_balance() {
-  _impl_._oneof_case_[0] = kAccountBalance;
+inline void TradeResponse::set_has_execution_report() {
+  _impl_._oneof_case_[0] = kExecutionReport;
 }
-inline void TradeResponse::clear_account_balance() {
-  if (_internal_has_account_balance()) {
+inline void TradeResponse::clear_execution_report() {
+  if (_internal_has_execution_report()) {
     if (GetArenaForAllocation() == nullptr) {
-      delete _impl_.RequestData_.account_balance_;
+      delete _impl_.RequestData_.execution_report_;
     }
     clear_has_RequestData();
   }
 }
-inline ::Serialize::AccountBalance* TradeResponse::release_account_balance() {
-  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.account_balance)
-  if (_internal_has_account_balance()) {
+inline ::Serialize::ExecutionReport* TradeResponse::release_execution_report() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.execution_report)
+  if (_internal_has_execution_report()) {
     clear_has_RequestData();
-    ::Serialize::AccountBalance* temp = _impl_.RequestData_.account_balance_;
+    ::Serialize::ExecutionReport* temp = _impl_.RequestData_.execution_report_;
     if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    _impl_.RequestData_.account_balance_ = nullptr;
+    _impl_.RequestData_.execution_report_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::Serialize::AccountBalance& TradeResponse::_internal_account_balance() const {
-  return _internal_has_account_balance()
-      ? *_impl_.RequestData_.account_balance_
-      : reinterpret_cast< ::Serialize::AccountBalance&>(::Serialize::_AccountBalance_default_instance_);
+inline const ::Serialize::ExecutionReport& TradeResponse::_internal_execution_report() const {
+  return _internal_has_execution_report()
+      ? *_impl_.RequestData_.execution_report_
+      : reinterpret_cast< ::Serialize::ExecutionReport&>(::Serialize::_ExecutionReport_default_instance_);
 }
-inline const ::Serialize::AccountBalance& TradeResponse::account_balance() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.account_balance)
-  return _internal_account_balance();
+inline const ::Serialize::ExecutionReport& TradeResponse::execution_report() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.execution_report)
+  return _internal_execution_report();
 }
-inline ::Serialize::AccountBalance* TradeResponse::unsafe_arena_release_account_balance() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeResponse.account_balance)
-  if (_internal_has_account_balance()) {
+inline ::Serialize::ExecutionReport* TradeResponse::unsafe_arena_release_execution_report() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeResponse.execution_report)
+  if (_internal_has_execution_report()) {
     clear_has_RequestData();
-    ::Serialize::AccountBalance* temp = _impl_.RequestData_.account_balance_;
-    _impl_.RequestData_.account_balance_ = nullptr;
+    ::Serialize::ExecutionReport* temp = _impl_.RequestData_.execution_report_;
+    _impl_.RequestData_.execution_report_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void TradeResponse::unsafe_arena_set_allocated_account_balance(::Serialize::AccountBalance* account_balance) {
+inline void TradeResponse::unsafe_arena_set_allocated_execution_report(::Serialize::ExecutionReport* execution_report) {
   clear_RequestData();
-  if (account_balance) {
-    set_has_account_balance();
-    _impl_.RequestData_.account_balance_ = account_balance;
+  if (execution_report) {
+    set_has_execution_report();
+    _impl_.RequestData_.execution_report_ = execution_report;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeResponse.account_balance)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeResponse.execution_report)
 }
-inline ::Serialize::AccountBalance* TradeResponse::_internal_mutable_account_balance() {
-  if (!_internal_has_account_balance()) {
+inline ::Serialize::ExecutionReport* TradeResponse::_internal_mutable_execution_report() {
+  if (!_internal_has_execution_report()) {
     clear_RequestData();
-    set_has_account_balance();
-    _impl_.RequestData_.account_balance_ = CreateMaybeMessage< ::Serialize::AccountBalance >(GetArenaForAllocation());
+    set_has_execution_report();
+    _impl_.RequestData_.execution_report_ = CreateMaybeMessage< ::Serialize::ExecutionReport >(GetArenaForAllocation());
   }
-  return _impl_.RequestData_.account_balance_;
+  return _impl_.RequestData_.execution_report_;
 }
-inline ::Serialize::AccountBalance* TradeResponse::mutable_account_balance() {
-  ::Serialize::AccountBalance* _msg = _internal_mutable_account_balance();
-  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.account_balance)
+inline ::Serialize::ExecutionReport* TradeResponse::mutable_execution_report() {
+  ::Serialize::ExecutionReport* _msg = _internal_mutable_execution_report();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.execution_report)
   return _msg;
 }
 
-// .Serialize.ActiveOrders active_orders = 4;
-inline bool TradeResponse::_internal_has_active_orders() const {
-  return RequestData_case() == kActiveOrders;
+// .Serialize.MarketDepth market_depth = 9;
+inline bool TradeResponse::_internal_has_market_depth() const {
+  return RequestData_case() == kMarketDepth;
 }
-inline bool TradeResponse::has_active_orders() const {
-  return _internal_has_active_orders();
+inline bool TradeResponse::has_market_depth() const {
+  return _internal_has_market_depth();
 }
-inline void TradeResponse::set_has_active_orders() {
-  _impl_._oneof_case_[0] = kActiveOrders;
+inline void TradeResponse::set_has_market_depth() {
+  _impl_._oneof_case_[0] = kMarketDepth;
 }
-inline void TradeResponse::clear_active_orders() {
-  if (_internal_has_active_orders()) {
+inline void TradeResponse::clear_market_depth() {
+  if (_internal_has_market_depth()) {
     if (GetArenaForAllocation() == nullptr) {
-      delete _impl_.RequestData_.active_orders_;
+      delete _impl_.RequestData_.market_depth_;
     }
     clear_has_RequestData();
   }
 }
-inline ::Serialize::ActiveOrders* TradeResponse::release_active_orders() {
-  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.active_orders)
-  if (_internal_has_active_orders()) {
+inline ::Serialize::MarketDepth* TradeResponse::release_market_depth() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.market_depth)
+  if (_internal_has_market_depth()) {
     clear_has_RequestData();
-    ::Serialize::ActiveOrders* temp = _impl_.RequestData_.active_orders_;
+    ::Serialize::MarketDepth* temp = _impl_.RequestData_.market_depth_;
     if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    _impl_.RequestData_.active_orders_ = nullptr;
+    _impl_.RequestData_.market_depth_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::Serialize::ActiveOrders& TradeResponse::_internal_active_orders() const {
-  return _internal_has_active_orders()
-      ? *_impl_.RequestData_.active_orders_
-      : reinterpret_cast< ::Serialize::ActiveOrders&>(::Serialize::_ActiveOrders_default_instance_);
+inline const ::Serialize::MarketDepth& TradeResponse::_internal_market_depth() const {
+  return _internal_has_market_depth()
+      ? *_impl_.RequestData_.market_depth_
+      : reinterpret_cast< ::Serialize::MarketDepth&>(::Serialize::_MarketDepth_default_instance_);
 }
-inline const ::Serialize::ActiveOrders& TradeResponse::active_orders() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.active_orders)
-  return _internal_active_orders();
+inline const ::Serialize::MarketDepth& TradeResponse::market_depth() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.market_depth)
+  return _internal_market_depth();
 }
-inline ::Serialize::ActiveOrders* TradeResponse::unsafe_arena_release_active_orders() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeResponse.active_orders)
-  if (_internal_has_active_orders()) {
+inline ::Serialize::MarketDepth* TradeResponse::unsafe_arena_release_market_depth() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeResponse.market_depth)
+  if (_internal_has_market_depth()) {
     clear_has_RequestData();
-    ::Serialize::ActiveOrders* temp = _impl_.RequestData_.active_orders_;
-    _impl_.RequestData_.active_orders_ = nullptr;
+    ::Serialize::MarketDepth* temp = _impl_.RequestData_.market_depth_;
+    _impl_.RequestData_.market_depth_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void TradeResponse::unsafe_arena_set_allocated_active_orders(::Serialize::ActiveOrders* active_orders) {
+inline void TradeResponse::unsafe_arena_set_allocated_market_depth(::Serialize::MarketDepth* market_depth) {
   clear_RequestData();
-  if (active_orders) {
-    set_has_active_orders();
-    _impl_.RequestData_.active_orders_ = active_orders;
+  if (market_depth) {
+    set_has_market_depth();
+    _impl_.RequestData_.market_depth_ = market_depth;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeResponse.active_orders)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeResponse.market_depth)
 }
-inline ::Serialize::ActiveOrders* TradeResponse::_internal_mutable_active_orders() {
-  if (!_internal_has_active_orders()) {
+inline ::Serialize::MarketDepth* TradeResponse::_internal_mutable_market_depth() {
+  if (!_internal_has_market_depth()) {
     clear_RequestData();
-    set_has_active_orders();
-    _impl_.RequestData_.active_orders_ = CreateMaybeMessage< ::Serialize::ActiveOrders >(GetArenaForAllocation());
+    set_has_market_depth();
+    _impl_.RequestData_.market_depth_ = CreateMaybeMessage< ::Serialize::MarketDepth >(GetArenaForAllocation());
   }
-  return _impl_.RequestData_.active_orders_;
+  return _impl_.RequestData_.market_depth_;
 }
-inline ::Serialize::ActiveOrders* TradeResponse::mutable_active_orders() {
-  ::Serialize::ActiveOrders* _msg = _internal_mutable_active_orders();
-  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.active_orders)
+inline ::Serialize::MarketDepth* TradeResponse::mutable_market_depth() {
+  ::Serialize::MarketDepth* _msg = _internal_mutable_market_depth();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.market_depth)
   return _msg;
 }
 
-// .Serialize.CompletedOredrs completed_orders = 5;
-inline bool TradeResponse::_internal_has_completed_orders() const {
-  return RequestData_case() == kCompletedOrders;
+// .Serialize.Candles candles = 10;
+inline bool TradeResponse::_internal_has_candles() const {
+  return RequestData_case() == kCandles;
 }
-inline bool TradeResponse::has_completed_orders() const {
-  return _internal_has_completed_orders();
+inline bool TradeResponse::has_candles() const {
+  return _internal_has_candles();
 }
-inline void TradeResponse::set_has_completed_orders() {
-  _impl_._oneof_case_[0] = kCompletedOrders;
+inline void TradeResponse::set_has_candles() {
+  _impl_._oneof_case_[0] = kCandles;
 }
-inline void TradeResponse::clear_completed_orders() {
-  if (_internal_has_completed_orders()) {
+inline void TradeResponse::clear_candles() {
+  if (_internal_has_candles()) {
     if (GetArenaForAllocation() == nullptr) {
-      delete _impl_.RequestData_.completed_orders_;
+      delete _impl_.RequestData_.candles_;
     }
     clear_has_RequestData();
   }
 }
-inline ::Serialize::CompletedOredrs* TradeResponse::release_completed_orders() {
-  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.completed_orders)
-  if (_internal_has_completed_orders()) {
+inline ::Serialize::Candles* TradeResponse::release_candles() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.candles)
+  if (_internal_has_candles()) {
     clear_has_RequestData();
-    ::Serialize::CompletedOredrs* temp = _impl_.RequestData_.completed_orders_;
+    ::Serialize::Candles* temp = _impl_.RequestData_.candles_;
     if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    _impl_.RequestData_.completed_orders_ = nullptr;
+    _impl_.RequestData_.candles_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::Serialize::CompletedOredrs& TradeResponse::_internal_completed_orders() const {
-  return _internal_has_completed_orders()
-      ? *_impl_.RequestData_.completed_orders_
-      : reinterpret_cast< ::Serialize::CompletedOredrs&>(::Serialize::_CompletedOredrs_default_instance_);
+inline const ::Serialize::Candles& TradeResponse::_internal_candles() const {
+  return _internal_has_candles()
+      ? *_impl_.RequestData_.candles_
+      : reinterpret_cast< ::Serialize::Candles&>(::Serialize::_Candles_default_instance_);
 }
-inline const ::Serialize::CompletedOredrs& TradeResponse::completed_orders() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.completed_orders)
-  return _internal_completed_orders();
+inline const ::Serialize::Candles& TradeResponse::candles() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.candles)
+  return _internal_candles();
 }
-inline ::Serialize::CompletedOredrs* TradeResponse::unsafe_arena_release_completed_orders() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeResponse.completed_orders)
-  if (_internal_has_completed_orders()) {
+inline ::Serialize::Candles* TradeResponse::unsafe_arena_release_candles() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeResponse.candles)
+  if (_internal_has_candles()) {
     clear_has_RequestData();
-    ::Serialize::CompletedOredrs* temp = _impl_.RequestData_.completed_orders_;
-    _impl_.RequestData_.completed_orders_ = nullptr;
+    ::Serialize::Candles* temp = _impl_.RequestData_.candles_;
+    _impl_.RequestData_.candles_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void TradeResponse::unsafe_arena_set_allocated_completed_orders(::Serialize::CompletedOredrs* completed_orders) {
+inline void TradeResponse::unsafe_arena_set_allocated_candles(::Serialize::Candles* candles) {
   clear_RequestData();
-  if (completed_orders) {
-    set_has_completed_orders();
-    _impl_.RequestData_.completed_orders_ = completed_orders;
+  if (candles) {
+    set_has_candles();
+    _impl_.RequestData_.candles_ = candles;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeResponse.completed_orders)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeResponse.candles)
 }
-inline ::Serialize::CompletedOredrs* TradeResponse::_internal_mutable_completed_orders() {
-  if (!_internal_has_completed_orders()) {
+inline ::Serialize::Candles* TradeResponse::_internal_mutable_candles() {
+  if (!_internal_has_candles()) {
     clear_RequestData();
-    set_has_completed_orders();
-    _impl_.RequestData_.completed_orders_ = CreateMaybeMessage< ::Serialize::CompletedOredrs >(GetArenaForAllocation());
+    set_has_candles();
+    _impl_.RequestData_.candles_ = CreateMaybeMessage< ::Serialize::Candles >(GetArenaForAllocation());
   }
-  return _impl_.RequestData_.completed_orders_;
+  return _impl_.RequestData_.candles_;
 }
-inline ::Serialize::CompletedOredrs* TradeResponse::mutable_completed_orders() {
-  ::Serialize::CompletedOredrs* _msg = _internal_mutable_completed_orders();
-  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.completed_orders)
+inline ::Serialize::Candles* TradeResponse::mutable_candles() {
+  ::Serialize::Candles* _msg = _internal_mutable_candles();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.candles)
   return _msg;
 }
 
-// .Serialize.QuoteHistory quote_history = 6;
-inline bool TradeResponse::_internal_has_quote_history() const {
-  return RequestData_case() == kQuoteHistory;
+// .Serialize.Trades trades = 11;
+inline bool TradeResponse::_internal_has_trades() const {
+  return RequestData_case() == kTrades;
 }
-inline bool TradeResponse::has_quote_history() const {
-  return _internal_has_quote_history();
+inline bool TradeResponse::has_trades() const {
+  return _internal_has_trades();
 }
-inline void TradeResponse::set_has_quote_history() {
-  _impl_._oneof_case_[0] = kQuoteHistory;
+inline void TradeResponse::set_has_trades() {
+  _impl_._oneof_case_[0] = kTrades;
 }
-inline void TradeResponse::clear_quote_history() {
-  if (_internal_has_quote_history()) {
+inline void TradeResponse::clear_trades() {
+  if (_internal_has_trades()) {
     if (GetArenaForAllocation() == nullptr) {
-      delete _impl_.RequestData_.quote_history_;
+      delete _impl_.RequestData_.trades_;
     }
     clear_has_RequestData();
   }
 }
-inline ::Serialize::QuoteHistory* TradeResponse::release_quote_history() {
-  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.quote_history)
-  if (_internal_has_quote_history()) {
+inline ::Serialize::Trades* TradeResponse::release_trades() {
+  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.trades)
+  if (_internal_has_trades()) {
     clear_has_RequestData();
-    ::Serialize::QuoteHistory* temp = _impl_.RequestData_.quote_history_;
+    ::Serialize::Trades* temp = _impl_.RequestData_.trades_;
     if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    _impl_.RequestData_.quote_history_ = nullptr;
+    _impl_.RequestData_.trades_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::Serialize::QuoteHistory& TradeResponse::_internal_quote_history() const {
-  return _internal_has_quote_history()
-      ? *_impl_.RequestData_.quote_history_
-      : reinterpret_cast< ::Serialize::QuoteHistory&>(::Serialize::_QuoteHistory_default_instance_);
+inline const ::Serialize::Trades& TradeResponse::_internal_trades() const {
+  return _internal_has_trades()
+      ? *_impl_.RequestData_.trades_
+      : reinterpret_cast< ::Serialize::Trades&>(::Serialize::_Trades_default_instance_);
 }
-inline const ::Serialize::QuoteHistory& TradeResponse::quote_history() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.quote_history)
-  return _internal_quote_history();
+inline const ::Serialize::Trades& TradeResponse::trades() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.trades)
+  return _internal_trades();
 }
-inline ::Serialize::QuoteHistory* TradeResponse::unsafe_arena_release_quote_history() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeResponse.quote_history)
-  if (_internal_has_quote_history()) {
+inline ::Serialize::Trades* TradeResponse::unsafe_arena_release_trades() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Serialize.TradeResponse.trades)
+  if (_internal_has_trades()) {
     clear_has_RequestData();
-    ::Serialize::QuoteHistory* temp = _impl_.RequestData_.quote_history_;
-    _impl_.RequestData_.quote_history_ = nullptr;
+    ::Serialize::Trades* temp = _impl_.RequestData_.trades_;
+    _impl_.RequestData_.trades_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void TradeResponse::unsafe_arena_set_allocated_quote_history(::Serialize::QuoteHistory* quote_history) {
+inline void TradeResponse::unsafe_arena_set_allocated_trades(::Serialize::Trades* trades) {
   clear_RequestData();
-  if (quote_history) {
-    set_has_quote_history();
-    _impl_.RequestData_.quote_history_ = quote_history;
+  if (trades) {
+    set_has_trades();
+    _impl_.RequestData_.trades_ = trades;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeResponse.quote_history)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Serialize.TradeResponse.trades)
 }
-inline ::Serialize::QuoteHistory* TradeResponse::_internal_mutable_quote_history() {
-  if (!_internal_has_quote_history()) {
+inline ::Serialize::Trades* TradeResponse::_internal_mutable_trades() {
+  if (!_internal_has_trades()) {
     clear_RequestData();
-    set_has_quote_history();
-    _impl_.RequestData_.quote_history_ = CreateMaybeMessage< ::Serialize::QuoteHistory >(GetArenaForAllocation());
+    set_has_trades();
+    _impl_.RequestData_.trades_ = CreateMaybeMessage< ::Serialize::Trades >(GetArenaForAllocation());
   }
-  return _impl_.RequestData_.quote_history_;
+  return _impl_.RequestData_.trades_;
 }
-inline ::Serialize::QuoteHistory* TradeResponse::mutable_quote_history() {
-  ::Serialize::QuoteHistory* _msg = _internal_mutable_quote_history();
-  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.quote_history)
+inline ::Serialize::Trades* TradeResponse::mutable_trades() {
+  ::Serialize::Trades* _msg = _internal_mutable_trades();
+  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.trades)
   return _msg;
 }
 
-// string error_response = 7;
-inline bool TradeResponse::_internal_has_error_response() const {
-  return RequestData_case() == kErrorResponse;
+// int32 canceled_orders_count = 12;
+inline bool TradeResponse::_internal_has_canceled_orders_count() const {
+  return RequestData_case() == kCanceledOrdersCount;
 }
-inline bool TradeResponse::has_error_response() const {
-  return _internal_has_error_response();
+inline bool TradeResponse::has_canceled_orders_count() const {
+  return _internal_has_canceled_orders_count();
 }
-inline void TradeResponse::set_has_error_response() {
-  _impl_._oneof_case_[0] = kErrorResponse;
+inline void TradeResponse::set_has_canceled_orders_count() {
+  _impl_._oneof_case_[0] = kCanceledOrdersCount;
 }
-inline void TradeResponse::clear_error_response() {
-  if (_internal_has_error_response()) {
-    _impl_.RequestData_.error_response_.Destroy();
+inline void TradeResponse::clear_canceled_orders_count() {
+  if (_internal_has_canceled_orders_count()) {
+    _impl_.RequestData_.canceled_orders_count_ = 0;
     clear_has_RequestData();
   }
 }
-inline const std::string& TradeResponse::error_response() const {
-  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.error_response)
-  return _internal_error_response();
+inline int32_t TradeResponse::_internal_canceled_orders_count() const {
+  if (_internal_has_canceled_orders_count()) {
+    return _impl_.RequestData_.canceled_orders_count_;
+  }
+  return 0;
+}
+inline void TradeResponse::_internal_set_canceled_orders_count(int32_t value) {
+  if (!_internal_has_canceled_orders_count()) {
+    clear_RequestData();
+    set_has_canceled_orders_count();
+  }
+  _impl_.RequestData_.canceled_orders_count_ = value;
+}
+inline int32_t TradeResponse::canceled_orders_count() const {
+  // @@protoc_insertion_point(field_get:Serialize.TradeResponse.canceled_orders_count)
+  return _internal_canceled_orders_count();
+}
+inline void TradeResponse::set_canceled_orders_count(int32_t value) {
+  _internal_set_canceled_orders_count(value);
+  // @@protoc_insertion_point(field_set:Serialize.TradeResponse.canceled_orders_count)
+}
+
+inline bool TradeResponse::has_RequestData() const {
+  return RequestData_case() != REQUESTDATA_NOT_SET;
+}
+inline void TradeResponse::clear_has_RequestData() {
+  _impl_._oneof_case_[0] = REQUESTDATA_NOT_SET;
+}
+inline TradeResponse::RequestDataCase TradeResponse::RequestData_case() const {
+  return TradeResponse::RequestDataCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// ExecutionReport
+
+// int64 order_id = 1;
+inline void ExecutionReport::clear_order_id() {
+  _impl_.order_id_ = int64_t{0};
+}
+inline int64_t ExecutionReport::_internal_order_id() const {
+  return _impl_.order_id_;
+}
+inline int64_t ExecutionReport::order_id() const {
+  // @@protoc_insertion_point(field_get:Serialize.ExecutionReport.order_id)
+  return _internal_order_id();
+}
+inline void ExecutionReport::_internal_set_order_id(int64_t value) {
+  
+  _impl_.order_id_ = value;
+}
+inline void ExecutionReport::set_order_id(int64_t value) {
+  _internal_set_order_id(value);
+  // @@protoc_insertion_point(field_set:Serialize.ExecutionReport.order_id)
+}
+
+// .Serialize.TradeOrder.TradeType type = 2;
+inline void ExecutionReport::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::Serialize::TradeOrder_TradeType ExecutionReport::_internal_type() const {
+  return static_cast< ::Serialize::TradeOrder_TradeType >(_impl_.type_);
+}
+inline ::Serialize::TradeOrder_TradeType ExecutionReport::type() const {
+  // @@protoc_insertion_point(field_get:Serialize.ExecutionReport.type)
+  return _internal_type();
+}
+inline void ExecutionReport::_internal_set_type(::Serialize::TradeOrder_TradeType value) {
+  
+  _impl_.type_ = value;
+}
+inline void ExecutionReport::set_type(::Serialize::TradeOrder_TradeType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:Serialize.ExecutionReport.type)
+}
+
+// int32 fill_amount = 3;
+inline void ExecutionReport::clear_fill_amount() {
+  _impl_.fill_amount_ = 0;
+}
+inline int32_t ExecutionReport::_internal_fill_amount() const {
+  return _impl_.fill_amount_;
+}
+inline int32_t ExecutionReport::fill_amount() const {
+  // @@protoc_insertion_point(field_get:Serialize.ExecutionReport.fill_amount)
+  return _internal_fill_amount();
+}
+inline void ExecutionReport::_internal_set_fill_amount(int32_t value) {
+  
+  _impl_.fill_amount_ = value;
+}
+inline void ExecutionReport::set_fill_amount(int32_t value) {
+  _internal_set_fill_amount(value);
+  // @@protoc_insertion_point(field_set:Serialize.ExecutionReport.fill_amount)
+}
+
+// double price = 4;
+inline void ExecutionReport::clear_price() {
+  _impl_.price_ = 0;
+}
+inline double ExecutionReport::_internal_price() const {
+  return _impl_.price_;
+}
+inline double ExecutionReport::price() const {
+  // @@protoc_insertion_point(field_get:Serialize.ExecutionReport.price)
+  return _internal_price();
+}
+inline void ExecutionReport::_internal_set_price(double value) {
+  
+  _impl_.price_ = value;
+}
+inline void ExecutionReport::set_price(double value) {
+  _internal_set_price(value);
+  // @@protoc_insertion_point(field_set:Serialize.ExecutionReport.price)
+}
+
+// int32 remaining_amount = 5;
+inline void ExecutionReport::clear_remaining_amount() {
+  _impl_.remaining_amount_ = 0;
+}
+inline int32_t ExecutionReport::_internal_remaining_amount() const {
+  return _impl_.remaining_amount_;
+}
+inline int32_t ExecutionReport::remaining_amount() const {
+  // @@protoc_insertion_point(field_get:Serialize.ExecutionReport.remaining_amount)
+  return _internal_remaining_amount();
+}
+inline void ExecutionReport::_internal_set_remaining_amount(int32_t value) {
+  
+  _impl_.remaining_amount_ = value;
+}
+inline void ExecutionReport::set_remaining_amount(int32_t value) {
+  _internal_set_remaining_amount(value);
+  // @@protoc_insertion_point(field_set:Serialize.ExecutionReport.remaining_amount)
+}
+
+// double usd_balance_delta = 6;
+inline void ExecutionReport::clear_usd_balance_delta() {
+  _impl_.usd_balance_delta_ = 0;
+}
+inline double ExecutionReport::_internal_usd_balance_delta() const {
+  return _impl_.usd_balance_delta_;
+}
+inline double ExecutionReport::usd_balance_delta() const {
+  // @@protoc_insertion_point(field_get:Serialize.ExecutionReport.usd_balance_delta)
+  return _internal_usd_balance_delta();
+}
+inline void ExecutionReport::_internal_set_usd_balance_delta(double value) {
+  
+  _impl_.usd_balance_delta_ = value;
+}
+inline void ExecutionReport::set_usd_balance_delta(double value) {
+  _internal_set_usd_balance_delta(value);
+  // @@protoc_insertion_point(field_set:Serialize.ExecutionReport.usd_balance_delta)
+}
+
+// double rub_balance_delta = 7;
+inline void ExecutionReport::clear_rub_balance_delta() {
+  _impl_.rub_balance_delta_ = 0;
+}
+inline double ExecutionReport::_internal_rub_balance_delta() const {
+  return _impl_.rub_balance_delta_;
+}
+inline double ExecutionReport::rub_balance_delta() const {
+  // @@protoc_insertion_point(field_get:Serialize.ExecutionReport.rub_balance_delta)
+  return _internal_rub_balance_delta();
+}
+inline void ExecutionReport::_internal_set_rub_balance_delta(double value) {
+  
+  _impl_.rub_balance_delta_ = value;
+}
+inline void ExecutionReport::set_rub_balance_delta(double value) {
+  _internal_set_rub_balance_delta(value);
+  // @@protoc_insertion_point(field_set:Serialize.ExecutionReport.rub_balance_delta)
+}
+
+// int64 timestamp = 8;
+inline void ExecutionReport::clear_timestamp() {
+  _impl_.timestamp_ = int64_t{0};
+}
+inline int64_t ExecutionReport::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline int64_t ExecutionReport::timestamp() const {
+  // @@protoc_insertion_point(field_get:Serialize.ExecutionReport.timestamp)
+  return _internal_timestamp();
+}
+inline void ExecutionReport::_internal_set_timestamp(int64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void ExecutionReport::set_timestamp(int64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:Serialize.ExecutionReport.timestamp)
+}
+
+// int64 trade_id = 9;
+inline void ExecutionReport::clear_trade_id() {
+  _impl_.trade_id_ = int64_t{0};
+}
+inline int64_t ExecutionReport::_internal_trade_id() const {
+  return _impl_.trade_id_;
+}
+inline int64_t ExecutionReport::trade_id() const {
+  // @@protoc_insertion_point(field_get:Serialize.ExecutionReport.trade_id)
+  return _internal_trade_id();
+}
+inline void ExecutionReport::_internal_set_trade_id(int64_t value) {
+  
+  _impl_.trade_id_ = value;
+}
+inline void ExecutionReport::set_trade_id(int64_t value) {
+  _internal_set_trade_id(value);
+  // @@protoc_insertion_point(field_set:Serialize.ExecutionReport.trade_id)
+}
+
+// int32 canceled_amount = 10;
+inline void ExecutionReport::clear_canceled_amount() {
+  _impl_.canceled_amount_ = 0;
+}
+inline int32_t ExecutionReport::_internal_canceled_amount() const {
+  return _impl_.canceled_amount_;
+}
+inline int32_t ExecutionReport::canceled_amount() const {
+  // @@protoc_insertion_point(field_get:Serialize.ExecutionReport.canceled_amount)
+  return _internal_canceled_amount();
+}
+inline void ExecutionReport::_internal_set_canceled_amount(int32_t value) {
+  
+  _impl_.canceled_amount_ = value;
+}
+inline void ExecutionReport::set_canceled_amount(int32_t value) {
+  _internal_set_canceled_amount(value);
+  // @@protoc_insertion_point(field_set:Serialize.ExecutionReport.canceled_amount)
+}
+
+// -------------------------------------------------------------------
+
+// Execution
+
+// int64 trade_id = 1;
+inline void Execution::clear_trade_id() {
+  _impl_.trade_id_ = int64_t{0};
+}
+inline int64_t Execution::_internal_trade_id() const {
+  return _impl_.trade_id_;
+}
+inline int64_t Execution::trade_id() const {
+  // @@protoc_insertion_point(field_get:Serialize.Execution.trade_id)
+  return _internal_trade_id();
+}
+inline void Execution::_internal_set_trade_id(int64_t value) {
+  
+  _impl_.trade_id_ = value;
+}
+inline void Execution::set_trade_id(int64_t value) {
+  _internal_set_trade_id(value);
+  // @@protoc_insertion_point(field_set:Serialize.Execution.trade_id)
+}
+
+// double price = 2;
+inline void Execution::clear_price() {
+  _impl_.price_ = 0;
+}
+inline double Execution::_internal_price() const {
+  return _impl_.price_;
+}
+inline double Execution::price() const {
+  // @@protoc_insertion_point(field_get:Serialize.Execution.price)
+  return _internal_price();
+}
+inline void Execution::_internal_set_price(double value) {
+  
+  _impl_.price_ = value;
+}
+inline void Execution::set_price(double value) {
+  _internal_set_price(value);
+  // @@protoc_insertion_point(field_set:Serialize.Execution.price)
+}
+
+// int32 usd_amount = 3;
+inline void Execution::clear_usd_amount() {
+  _impl_.usd_amount_ = 0;
+}
+inline int32_t Execution::_internal_usd_amount() const {
+  return _impl_.usd_amount_;
+}
+inline int32_t Execution::usd_amount() const {
+  // @@protoc_insertion_point(field_get:Serialize.Execution.usd_amount)
+  return _internal_usd_amount();
+}
+inline void Execution::_internal_set_usd_amount(int32_t value) {
+  
+  _impl_.usd_amount_ = value;
+}
+inline void Execution::set_usd_amount(int32_t value) {
+  _internal_set_usd_amount(value);
+  // @@protoc_insertion_point(field_set:Serialize.Execution.usd_amount)
+}
+
+// .Serialize.TradeOrder.TradeType aggressor_side = 4;
+inline void Execution::clear_aggressor_side() {
+  _impl_.aggressor_side_ = 0;
+}
+inline ::Serialize::TradeOrder_TradeType Execution::_internal_aggressor_side() const {
+  return static_cast< ::Serialize::TradeOrder_TradeType >(_impl_.aggressor_side_);
+}
+inline ::Serialize::TradeOrder_TradeType Execution::aggressor_side() const {
+  // @@protoc_insertion_point(field_get:Serialize.Execution.aggressor_side)
+  return _internal_aggressor_side();
+}
+inline void Execution::_internal_set_aggressor_side(::Serialize::TradeOrder_TradeType value) {
+  
+  _impl_.aggressor_side_ = value;
+}
+inline void Execution::set_aggressor_side(::Serialize::TradeOrder_TradeType value) {
+  _internal_set_aggressor_side(value);
+  // @@protoc_insertion_point(field_set:Serialize.Execution.aggressor_side)
+}
+
+// int64 maker_order_id = 5;
+inline void Execution::clear_maker_order_id() {
+  _impl_.maker_order_id_ = int64_t{0};
+}
+inline int64_t Execution::_internal_maker_order_id() const {
+  return _impl_.maker_order_id_;
+}
+inline int64_t Execution::maker_order_id() const {
+  // @@protoc_insertion_point(field_get:Serialize.Execution.maker_order_id)
+  return _internal_maker_order_id();
+}
+inline void Execution::_internal_set_maker_order_id(int64_t value) {
+  
+  _impl_.maker_order_id_ = value;
+}
+inline void Execution::set_maker_order_id(int64_t value) {
+  _internal_set_maker_order_id(value);
+  // @@protoc_insertion_point(field_set:Serialize.Execution.maker_order_id)
+}
+
+// int64 taker_order_id = 6;
+inline void Execution::clear_taker_order_id() {
+  _impl_.taker_order_id_ = int64_t{0};
+}
+inline int64_t Execution::_internal_taker_order_id() const {
+  return _impl_.taker_order_id_;
+}
+inline int64_t Execution::taker_order_id() const {
+  // @@protoc_insertion_point(field_get:Serialize.Execution.taker_order_id)
+  return _internal_taker_order_id();
+}
+inline void Execution::_internal_set_taker_order_id(int64_t value) {
+  
+  _impl_.taker_order_id_ = value;
+}
+inline void Execution::set_taker_order_id(int64_t value) {
+  _internal_set_taker_order_id(value);
+  // @@protoc_insertion_point(field_set:Serialize.Execution.taker_order_id)
+}
+
+// int64 timestamp = 7;
+inline void Execution::clear_timestamp() {
+  _impl_.timestamp_ = int64_t{0};
+}
+inline int64_t Execution::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline int64_t Execution::timestamp() const {
+  // @@protoc_insertion_point(field_get:Serialize.Execution.timestamp)
+  return _internal_timestamp();
+}
+inline void Execution::_internal_set_timestamp(int64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void Execution::set_timestamp(int64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:Serialize.Execution.timestamp)
 }
-template <typename ArgT0, typename... ArgT>
-inline void TradeResponse::set_error_response(ArgT0&& arg0, ArgT... args) {
-  if (!_internal_has_error_response()) {
-    clear_RequestData();
-    set_has_error_response();
-    _impl_.RequestData_.error_response_.InitDefault();
-  }
-  _impl_.RequestData_.error_response_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:Serialize.TradeResponse.error_response)
+
+// -------------------------------------------------------------------
+
+// Trades
+
+// repeated .Serialize.Execution executions = 1;
+inline int Trades::_internal_executions_size() const {
+  return _impl_.executions_.size();
 }
-inline std::string* TradeResponse::mutable_error_response() {
-  std::string* _s = _internal_mutable_error_response();
-  // @@protoc_insertion_point(field_mutable:Serialize.TradeResponse.error_response)
-  return _s;
+inline int Trades::executions_size() const {
+  return _internal_executions_size();
 }
-inline const std::string& TradeResponse::_internal_error_response() const {
-  if (_internal_has_error_response()) {
-    return _impl_.RequestData_.error_response_.Get();
-  }
-  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+inline void Trades::clear_executions() {
+  _impl_.executions_.Clear();
 }
-inline void TradeResponse::_internal_set_error_response(const std::string& value) {
-  if (!_internal_has_error_response()) {
-    clear_RequestData();
-    set_has_error_response();
-    _impl_.RequestData_.error_response_.InitDefault();
-  }
-  _impl_.RequestData_.error_response_.Set(value, GetArenaForAllocation());
+inline ::Serialize::Execution* Trades::mutable_executions(int index) {
+  // @@protoc_insertion_point(field_mutable:Serialize.Trades.executions)
+  return _impl_.executions_.Mutable(index);
 }
-inline std::string* TradeResponse::_internal_mutable_error_response() {
-  if (!_internal_has_error_response()) {
-    clear_RequestData();
-    set_has_error_response();
-    _impl_.RequestData_.error_response_.InitDefault();
-  }
-  return _impl_.RequestData_.error_response_.Mutable(      GetArenaForAllocation());
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Execution >*
+Trades::mutable_executions() {
+  // @@protoc_insertion_point(field_mutable_list:Serialize.Trades.executions)
+  return &_impl_.executions_;
 }
-inline std::string* TradeResponse::release_error_response() {
-  // @@protoc_insertion_point(field_release:Serialize.TradeResponse.error_response)
-  if (_internal_has_error_response()) {
-    clear_has_RequestData();
-    return _impl_.RequestData_.error_response_.Release();
-  } else {
-    return nullptr;
-  }
+inline const ::Serialize::Execution& Trades::_internal_executions(int index) const {
+  return _impl_.executions_.Get(index);
 }
-inline void TradeResponse::set_allocated_error_response(std::string* error_response) {
-  if (has_RequestData()) {
-    clear_RequestData();
-  }
-  if (error_response != nullptr) {
-    set_has_error_response();
-    _impl_.RequestData_.error_response_.InitAllocated(error_response, GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(field_set_allocated:Serialize.TradeResponse.error_response)
+inline const ::Serialize::Execution& Trades::executions(int index) const {
+  // @@protoc_insertion_point(field_get:Serialize.Trades.executions)
+  return _internal_executions(index);
 }
-
-inline bool TradeResponse::has_RequestData() const {
-  return RequestData_case() != REQUESTDATA_NOT_SET;
+inline ::Serialize::Execution* Trades::_internal_add_executions() {
+  return _impl_.executions_.Add();
 }
-inline void TradeResponse::clear_has_RequestData() {
-  _impl_._oneof_case_[0] = REQUESTDATA_NOT_SET;
+inline ::Serialize::Execution* Trades::add_executions() {
+  ::Serialize::Execution* _add = _internal_add_executions();
+  // @@protoc_insertion_point(field_add:Serialize.Trades.executions)
+  return _add;
 }
-inline TradeResponse::RequestDataCase TradeResponse::RequestData_case() const {
-  return TradeResponse::RequestDataCase(_impl_._oneof_case_[0]);
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Execution >&
+Trades::executions() const {
+  // @@protoc_insertion_point(field_list:Serialize.Trades.executions)
+  return _impl_.executions_;
 }
+
 // -------------------------------------------------------------------
 
 // ClientBalance
@@ -4202,6 +8185,46 @@ inline void AccountBalance::set_rub_balance(double value) {
   // @@protoc_insertion_point(field_set:Serialize.AccountBalance.rub_balance)
 }
 
+// double usd_reserved = 3;
+inline void AccountBalance::clear_usd_reserved() {
+  _impl_.usd_reserved_ = 0;
+}
+inline double AccountBalance::_internal_usd_reserved() const {
+  return _impl_.usd_reserved_;
+}
+inline double AccountBalance::usd_reserved() const {
+  // @@protoc_insertion_point(field_get:Serialize.AccountBalance.usd_reserved)
+  return _internal_usd_reserved();
+}
+inline void AccountBalance::_internal_set_usd_reserved(double value) {
+  
+  _impl_.usd_reserved_ = value;
+}
+inline void AccountBalance::set_usd_reserved(double value) {
+  _internal_set_usd_reserved(value);
+  // @@protoc_insertion_point(field_set:Serialize.AccountBalance.usd_reserved)
+}
+
+// double rub_reserved = 4;
+inline void AccountBalance::clear_rub_reserved() {
+  _impl_.rub_reserved_ = 0;
+}
+inline double AccountBalance::_internal_rub_reserved() const {
+  return _impl_.rub_reserved_;
+}
+inline double AccountBalance::rub_reserved() const {
+  // @@protoc_insertion_point(field_get:Serialize.AccountBalance.rub_reserved)
+  return _internal_rub_reserved();
+}
+inline void AccountBalance::_internal_set_rub_reserved(double value) {
+  
+  _impl_.rub_reserved_ = value;
+}
+inline void AccountBalance::set_rub_reserved(double value) {
+  _internal_set_rub_reserved(value);
+  // @@protoc_insertion_point(field_set:Serialize.AccountBalance.rub_reserved)
+}
+
 // -------------------------------------------------------------------
 
 // ActiveOrders
@@ -4458,6 +8481,382 @@ inline void Quote::set_price(double value) {
   // @@protoc_insertion_point(field_set:Serialize.Quote.price)
 }
 
+// -------------------------------------------------------------------
+
+// PriceLevel
+
+// double price = 1;
+inline void PriceLevel::clear_price() {
+  _impl_.price_ = 0;
+}
+inline double PriceLevel::_internal_price() const {
+  return _impl_.price_;
+}
+inline double PriceLevel::price() const {
+  // @@protoc_insertion_point(field_get:Serialize.PriceLevel.price)
+  return _internal_price();
+}
+inline void PriceLevel::_internal_set_price(double value) {
+  
+  _impl_.price_ = value;
+}
+inline void PriceLevel::set_price(double value) {
+  _internal_set_price(value);
+  // @@protoc_insertion_point(field_set:Serialize.PriceLevel.price)
+}
+
+// int64 usd_amount = 2;
+inline void PriceLevel::clear_usd_amount() {
+  _impl_.usd_amount_ = int64_t{0};
+}
+inline int64_t PriceLevel::_internal_usd_amount() const {
+  return _impl_.usd_amount_;
+}
+inline int64_t PriceLevel::usd_amount() const {
+  // @@protoc_insertion_point(field_get:Serialize.PriceLevel.usd_amount)
+  return _internal_usd_amount();
+}
+inline void PriceLevel::_internal_set_usd_amount(int64_t value) {
+  
+  _impl_.usd_amount_ = value;
+}
+inline void PriceLevel::set_usd_amount(int64_t value) {
+  _internal_set_usd_amount(value);
+  // @@protoc_insertion_point(field_set:Serialize.PriceLevel.usd_amount)
+}
+
+// int32 orders_count = 3;
+inline void PriceLevel::clear_orders_count() {
+  _impl_.orders_count_ = 0;
+}
+inline int32_t PriceLevel::_internal_orders_count() const {
+  return _impl_.orders_count_;
+}
+inline int32_t PriceLevel::orders_count() const {
+  // @@protoc_insertion_point(field_get:Serialize.PriceLevel.orders_count)
+  return _internal_orders_count();
+}
+inline void PriceLevel::_internal_set_orders_count(int32_t value) {
+  
+  _impl_.orders_count_ = value;
+}
+inline void PriceLevel::set_orders_count(int32_t value) {
+  _internal_set_orders_count(value);
+  // @@protoc_insertion_point(field_set:Serialize.PriceLevel.orders_count)
+}
+
+// -------------------------------------------------------------------
+
+// MarketDepth
+
+// repeated .Serialize.PriceLevel bids = 1;
+inline int MarketDepth::_internal_bids_size() const {
+  return _impl_.bids_.size();
+}
+inline int MarketDepth::bids_size() const {
+  return _internal_bids_size();
+}
+inline void MarketDepth::clear_bids() {
+  _impl_.bids_.Clear();
+}
+inline ::Serialize::PriceLevel* MarketDepth::mutable_bids(int index) {
+  // @@protoc_insertion_point(field_mutable:Serialize.MarketDepth.bids)
+  return _impl_.bids_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::PriceLevel >*
+MarketDepth::mutable_bids() {
+  // @@protoc_insertion_point(field_mutable_list:Serialize.MarketDepth.bids)
+  return &_impl_.bids_;
+}
+inline const ::Serialize::PriceLevel& MarketDepth::_internal_bids(int index) const {
+  return _impl_.bids_.Get(index);
+}
+inline const ::Serialize::PriceLevel& MarketDepth::bids(int index) const {
+  // @@protoc_insertion_point(field_get:Serialize.MarketDepth.bids)
+  return _internal_bids(index);
+}
+inline ::Serialize::PriceLevel* MarketDepth::_internal_add_bids() {
+  return _impl_.bids_.Add();
+}
+inline ::Serialize::PriceLevel* MarketDepth::add_bids() {
+  ::Serialize::PriceLevel* _add = _internal_add_bids();
+  // @@protoc_insertion_point(field_add:Serialize.MarketDepth.bids)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::PriceLevel >&
+MarketDepth::bids() const {
+  // @@protoc_insertion_point(field_list:Serialize.MarketDepth.bids)
+  return _impl_.bids_;
+}
+
+// repeated .Serialize.PriceLevel asks = 2;
+inline int MarketDepth::_internal_asks_size() const {
+  return _impl_.asks_.size();
+}
+inline int MarketDepth::asks_size() const {
+  return _internal_asks_size();
+}
+inline void MarketDepth::clear_asks() {
+  _impl_.asks_.Clear();
+}
+inline ::Serialize::PriceLevel* MarketDepth::mutable_asks(int index) {
+  // @@protoc_insertion_point(field_mutable:Serialize.MarketDepth.asks)
+  return _impl_.asks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::PriceLevel >*
+MarketDepth::mutable_asks() {
+  // @@protoc_insertion_point(field_mutable_list:Serialize.MarketDepth.asks)
+  return &_impl_.asks_;
+}
+inline const ::Serialize::PriceLevel& MarketDepth::_internal_asks(int index) const {
+  return _impl_.asks_.Get(index);
+}
+inline const ::Serialize::PriceLevel& MarketDepth::asks(int index) const {
+  // @@protoc_insertion_point(field_get:Serialize.MarketDepth.asks)
+  return _internal_asks(index);
+}
+inline ::Serialize::PriceLevel* MarketDepth::_internal_add_asks() {
+  return _impl_.asks_.Add();
+}
+inline ::Serialize::PriceLevel* MarketDepth::add_asks() {
+  ::Serialize::PriceLevel* _add = _internal_add_asks();
+  // @@protoc_insertion_point(field_add:Serialize.MarketDepth.asks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::PriceLevel >&
+MarketDepth::asks() const {
+  // @@protoc_insertion_point(field_list:Serialize.MarketDepth.asks)
+  return _impl_.asks_;
+}
+
+// int64 timestamp = 3;
+inline void MarketDepth::clear_timestamp() {
+  _impl_.timestamp_ = int64_t{0};
+}
+inline int64_t MarketDepth::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline int64_t MarketDepth::timestamp() const {
+  // @@protoc_insertion_point(field_get:Serialize.MarketDepth.timestamp)
+  return _internal_timestamp();
+}
+inline void MarketDepth::_internal_set_timestamp(int64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void MarketDepth::set_timestamp(int64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:Serialize.MarketDepth.timestamp)
+}
+
+// -------------------------------------------------------------------
+
+// Candle
+
+// int64 open_time = 1;
+inline void Candle::clear_open_time() {
+  _impl_.open_time_ = int64_t{0};
+}
+inline int64_t Candle::_internal_open_time() const {
+  return _impl_.open_time_;
+}
+inline int64_t Candle::open_time() const {
+  // @@protoc_insertion_point(field_get:Serialize.Candle.open_time)
+  return _internal_open_time();
+}
+inline void Candle::_internal_set_open_time(int64_t value) {
+  
+  _impl_.open_time_ = value;
+}
+inline void Candle::set_open_time(int64_t value) {
+  _internal_set_open_time(value);
+  // @@protoc_insertion_point(field_set:Serialize.Candle.open_time)
+}
+
+// double open = 2;
+inline void Candle::clear_open() {
+  _impl_.open_ = 0;
+}
+inline double Candle::_internal_open() const {
+  return _impl_.open_;
+}
+inline double Candle::open() const {
+  // @@protoc_insertion_point(field_get:Serialize.Candle.open)
+  return _internal_open();
+}
+inline void Candle::_internal_set_open(double value) {
+  
+  _impl_.open_ = value;
+}
+inline void Candle::set_open(double value) {
+  _internal_set_open(value);
+  // @@protoc_insertion_point(field_set:Serialize.Candle.open)
+}
+
+// double high = 3;
+inline void Candle::clear_high() {
+  _impl_.high_ = 0;
+}
+inline double Candle::_internal_high() const {
+  return _impl_.high_;
+}
+inline double Candle::high() const {
+  // @@protoc_insertion_point(field_get:Serialize.Candle.high)
+  return _internal_high();
+}
+inline void Candle::_internal_set_high(double value) {
+  
+  _impl_.high_ = value;
+}
+inline void Candle::set_high(double value) {
+  _internal_set_high(value);
+  // @@protoc_insertion_point(field_set:Serialize.Candle.high)
+}
+
+// double low = 4;
+inline void Candle::clear_low() {
+  _impl_.low_ = 0;
+}
+inline double Candle::_internal_low() const {
+  return _impl_.low_;
+}
+inline double Candle::low() const {
+  // @@protoc_insertion_point(field_get:Serialize.Candle.low)
+  return _internal_low();
+}
+inline void Candle::_internal_set_low(double value) {
+  
+  _impl_.low_ = value;
+}
+inline void Candle::set_low(double value) {
+  _internal_set_low(value);
+  // @@protoc_insertion_point(field_set:Serialize.Candle.low)
+}
+
+// double close = 5;
+inline void Candle::clear_close() {
+  _impl_.close_ = 0;
+}
+inline double Candle::_internal_close() const {
+  return _impl_.close_;
+}
+inline double Candle::close() const {
+  // @@protoc_insertion_point(field_get:Serialize.Candle.close)
+  return _internal_close();
+}
+inline void Candle::_internal_set_close(double value) {
+  
+  _impl_.close_ = value;
+}
+inline void Candle::set_close(double value) {
+  _internal_set_close(value);
+  // @@protoc_insertion_point(field_set:Serialize.Candle.close)
+}
+
+// int64 usd_volume = 6;
+inline void Candle::clear_usd_volume() {
+  _impl_.usd_volume_ = int64_t{0};
+}
+inline int64_t Candle::_internal_usd_volume() const {
+  return _impl_.usd_volume_;
+}
+inline int64_t Candle::usd_volume() const {
+  // @@protoc_insertion_point(field_get:Serialize.Candle.usd_volume)
+  return _internal_usd_volume();
+}
+inline void Candle::_internal_set_usd_volume(int64_t value) {
+  
+  _impl_.usd_volume_ = value;
+}
+inline void Candle::set_usd_volume(int64_t value) {
+  _internal_set_usd_volume(value);
+  // @@protoc_insertion_point(field_set:Serialize.Candle.usd_volume)
+}
+
+// int32 trades_count = 7;
+inline void Candle::clear_trades_count() {
+  _impl_.trades_count_ = 0;
+}
+inline int32_t Candle::_internal_trades_count() const {
+  return _impl_.trades_count_;
+}
+inline int32_t Candle::trades_count() const {
+  // @@protoc_insertion_point(field_get:Serialize.Candle.trades_count)
+  return _internal_trades_count();
+}
+inline void Candle::_internal_set_trades_count(int32_t value) {
+  
+  _impl_.trades_count_ = value;
+}
+inline void Candle::set_trades_count(int32_t value) {
+  _internal_set_trades_count(value);
+  // @@protoc_insertion_point(field_set:Serialize.Candle.trades_count)
+}
+
+// -------------------------------------------------------------------
+
+// Candles
+
+// .Serialize.CandleResolution resolution = 1;
+inline void Candles::clear_resolution() {
+  _impl_.resolution_ = 0;
+}
+inline ::Serialize::CandleResolution Candles::_internal_resolution() const {
+  return static_cast< ::Serialize::CandleResolution >(_impl_.resolution_);
+}
+inline ::Serialize::CandleResolution Candles::resolution() const {
+  // @@protoc_insertion_point(field_get:Serialize.Candles.resolution)
+  return _internal_resolution();
+}
+inline void Candles::_internal_set_resolution(::Serialize::CandleResolution value) {
+  
+  _impl_.resolution_ = value;
+}
+inline void Candles::set_resolution(::Serialize::CandleResolution value) {
+  _internal_set_resolution(value);
+  // @@protoc_insertion_point(field_set:Serialize.Candles.resolution)
+}
+
+// repeated .Serialize.Candle candles = 2;
+inline int Candles::_internal_candles_size() const {
+  return _impl_.candles_.size();
+}
+inline int Candles::candles_size() const {
+  return _internal_candles_size();
+}
+inline void Candles::clear_candles() {
+  _impl_.candles_.Clear();
+}
+inline ::Serialize::Candle* Candles::mutable_candles(int index) {
+  // @@protoc_insertion_point(field_mutable:Serialize.Candles.candles)
+  return _impl_.candles_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Candle >*
+Candles::mutable_candles() {
+  // @@protoc_insertion_point(field_mutable_list:Serialize.Candles.candles)
+  return &_impl_.candles_;
+}
+inline const ::Serialize::Candle& Candles::_internal_candles(int index) const {
+  return _impl_.candles_.Get(index);
+}
+inline const ::Serialize::Candle& Candles::candles(int index) const {
+  // @@protoc_insertion_point(field_get:Serialize.Candles.candles)
+  return _internal_candles(index);
+}
+inline ::Serialize::Candle* Candles::_internal_add_candles() {
+  return _impl_.candles_.Add();
+}
+inline ::Serialize::Candle* Candles::add_candles() {
+  ::Serialize::Candle* _add = _internal_add_candles();
+  // @@protoc_insertion_point(field_add:Serialize.Candles.candles)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Serialize::Candle >&
+Candles::candles() const {
+  // @@protoc_insertion_point(field_list:Serialize.Candles.candles)
+  return _impl_.candles_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -4483,6 +8882,28 @@ inline void Quote::set_price(double value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -4495,11 +8916,26 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::Serialize::TradeOrder_TradeType>() {
   return ::Serialize::TradeOrder_TradeType_descriptor();
 }
+template <> struct is_proto_enum< ::Serialize::TradeOrder_OrderType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Serialize::TradeOrder_OrderType>() {
+  return ::Serialize::TradeOrder_OrderType_descriptor();
+}
+template <> struct is_proto_enum< ::Serialize::TradeOrder_TimeInForce> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Serialize::TradeOrder_TimeInForce>() {
+  return ::Serialize::TradeOrder_TimeInForce_descriptor();
+}
 template <> struct is_proto_enum< ::Serialize::CancelTradeOrder_TradeType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::Serialize::CancelTradeOrder_TradeType>() {
   return ::Serialize::CancelTradeOrder_TradeType_descriptor();
 }
+template <> struct is_proto_enum< ::Serialize::CancelAllOrders_Side> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Serialize::CancelAllOrders_Side>() {
+  return ::Serialize::CancelAllOrders_Side_descriptor();
+}
 template <> struct is_proto_enum< ::Serialize::TradeRequest_CommandType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::Serialize::TradeRequest_CommandType>() {
@@ -4510,6 +8946,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::Serialize::TradeResponse_status>() {
   return ::Serialize::TradeResponse_status_descriptor();
 }
+template <> struct is_proto_enum< ::Serialize::CandleResolution> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Serialize::CandleResolution>() {
+  return ::Serialize::CandleResolution_descriptor();
+}
 
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -0,0 +1,118 @@
+#ifndef IN_MEMORY_DATABASE_HPP
+#define IN_MEMORY_DATABASE_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
+
+#include "database.hpp"
+#include "trade_market_protocol.pb.h"
+
+//*INFO: IDatabase kept in process memory, engine runs without PostgreSQL.
+//*INFO: Loads return what was saved before, newest first where real database does so. Not thread-safe
+class InMemoryDatabase : public IDatabase {
+public:
+    bool is_user_exists(const std::string& username) override {
+        return users_.find(username) != users_.end();
+    }
+
+    void add_user(const std::string& username, const std::string& password) override {
+        users_[username] = password;
+    }
+
+    bool authenticate_user(const std::string& username, const std::string& password) override {
+        auto user_iterator = users_.find(username);
+        return user_iterator != users_.end() && user_iterator->second == password;
+    }
+
+    void save_active_order_to_db(const Serialize::TradeOrder& order) override {
+        active_orders_.push_back(order);
+    }
+
+    std::vector<Serialize::TradeOrder> load_active_orders_from_db(Serialize::TradeOrder::TradeType type) override {
+        std::vector<Serialize::TradeOrder> orders;
+        std::copy_if(active_orders_.begin(), active_orders_.end(), std::back_inserter(orders),
+                     [type](const Serialize::TradeOrder& order) { return order.type() == type; });
+        return orders;
+    }
+
+    void update_actual_client_balance_in_db(const Serialize::ClientBalance& client_balance) override {
+        clients_balances_[client_balance.username()] = client_balance;
+    }
+
+    std::vector<Serialize::ClientBalance> load_clients_balances_from_db() override {
+        std::vector<Serialize::ClientBalance> clients_balances;
+        for (const auto& [username, client_balance] : clients_balances_) {
+            clients_balances.push_back(client_balance);
+        }
+        return clients_balances;
+    }
+
+    void save_completed_order_to_db(const Serialize::TradeOrder& order, int64_t completion_timestamp) override {
+        completed_orders_.push_back(order);
+    }
+
+    std::vector<Serialize::TradeOrder> load_last_completed_orders(int number) override {
+        return load_newest(completed_orders_, number);
+    }
+
+    void save_qoute_to_db(const Serialize::Quote& qoute) override {
+        quotes_.push_back(qoute);
+    }
+
+    std::vector<Serialize::Quote> load_quote_history(int number) override {
+        return load_newest(quotes_, number);
+    }
+
+    //*INFO: Open candle is saved again on every update, only its last state is kept
+    void save_candle_to_db(Serialize::CandleResolution resolution, const Serialize::Candle& candle) override {
+        auto& candles = candles_[resolution];
+        if (!candles.empty() && candles.back().open_time() == candle.open_time()) {
+            candles.back() = candle;
+            return;
+        }
+        candles.push_back(candle);
+    }
+
+    std::vector<Serialize::Candle> load_candles_from_db(Serialize::CandleResolution resolution, int number) override {
+        return load_newest(candles_[resolution], number);
+    }
+
+    void save_executions_to_db(const std::vector<Serialize::Execution>& executions) override {
+        executions_.insert(executions_.end(), executions.begin(), executions.end());
+    }
+
+    std::vector<Serialize::Execution> load_last_executions(int number) override {
+        return load_newest(executions_, number);
+    }
+
+    void truncate_active_orders_table() override {
+        active_orders_.clear();
+    }
+
+    //*INFO: All trade prints in execution order
+    const std::vector<Serialize::Execution>& get_executions() const {
+        return executions_;
+    }
+
+private:
+    template<typename T>
+    static std::vector<T> load_newest(const std::vector<T>& records, int number) {
+        size_t count = std::min(records.size(), static_cast<size_t>(std::max(number, 0)));
+        return std::vector<T>(records.rbegin(), records.rbegin() + count);
+    }
+
+private:
+    std::map<std::string, std::string> users_;
+    std::vector<Serialize::TradeOrder> active_orders_;
+    std::map<std::string, Serialize::ClientBalance> clients_balances_;
+    std::vector<Serialize::TradeOrder> completed_orders_;
+    std::vector<Serialize::Quote> quotes_;
+    std::map<Serialize::CandleResolution, std::vector<Serialize::Candle>> candles_;
+    std::vector<Serialize::Execution> executions_;
+};
+
+#endif // IN_MEMORY_DATABASE_HPP
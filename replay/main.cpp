@@ -0,0 +1,124 @@
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "spdlog/spdlog.h"
+
+#include "replay_engine.hpp"
+#include "replay_journal.hpp"
+
+#define DEFAULT_GENERATED_SEED 42
+
+void print_usage() {
+    std::cout << "Usage:\n"
+              << "  replay <journal> [--golden <file>] [--write-golden <file>] [--stp <mode>]\n"
+              << "  replay --generate <commands_count> <journal> [seed]\n"
+              << "stp mode: none, cancel_newest, cancel_oldest, decrement_both" << std::endl;
+}
+
+int generate_journal(int argc, char* argv[]) {
+    if (argc < 4) {
+        print_usage();
+        return 1;
+    }
+
+    size_t commands_count = std::stoull(argv[2]);
+    uint32_t seed = (argc > 4) ? static_cast<uint32_t>(std::stoul(argv[4])) : DEFAULT_GENERATED_SEED;
+    if (!ReplayJournal::generate(argv[3], commands_count, seed)) {
+        std::cerr << "Failed to write journal " << argv[3] << std::endl;
+        return 1;
+    }
+
+    std::cout << "Journal " << argv[3] << " generated: " << commands_count << " commands" << std::endl;
+    return 0;
+}
+
+//*INFO: First differing line is reported, both outputs are in same deterministic order
+bool compare_with_golden(const std::vector<std::string>& golden_output, const std::string& golden_filename) {
+    std::ifstream golden_file(golden_filename);
+    if (!golden_file) {
+        std::cerr << "Can't open golden output " << golden_filename << std::endl;
+        return false;
+    }
+
+    std::string expected_line;
+    size_t line_num = 0;
+    while (std::getline(golden_file, expected_line)) {
+        if (line_num >= golden_output.size()) {
+            std::cerr << "Golden mismatch at line " << line_num + 1 << ": expected '" << expected_line << "', got end of output" << std::endl;
+            return false;
+        }
+        if (golden_output[line_num] != expected_line) {
+            std::cerr << "Golden mismatch at line " << line_num + 1 << ": expected '" << expected_line
+                      << "', got '" << golden_output[line_num] << "'" << std::endl;
+            return false;
+        }
+        ++line_num;
+    }
+
+    if (line_num != golden_output.size()) {
+        std::cerr << "Golden mismatch at line " << line_num + 1 << ": unexpected '" << golden_output[line_num] << "'" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        print_usage();
+        return 1;
+    }
+    spdlog::set_level(spdlog::level::off);
+
+    if (std::string(argv[1]) == "--generate") {
+        return generate_journal(argc, argv);
+    }
+
+    std::string journal_filename = argv[1];
+    std::string golden_filename;
+    std::string write_golden_filename;
+    std::string self_trade_prevention = "none";
+    for (int arg_num = 2; arg_num + 1 < argc; arg_num += 2) {
+        std::string option = argv[arg_num];
+        if (option == "--golden") {
+            golden_filename = argv[arg_num + 1];
+        } else if (option == "--write-golden") {
+            write_golden_filename = argv[arg_num + 1];
+        } else if (option == "--stp") {
+            self_trade_prevention = argv[arg_num + 1];
+        } else {
+            print_usage();
+            return 1;
+        }
+    }
+
+    std::vector<ReplayCommand> commands;
+    std::string error;
+    if (!ReplayJournal::load(journal_filename, commands, error)) {
+        std::cerr << "Failed to load journal: " << error << std::endl;
+        return 1;
+    }
+
+    ReplayEngine replay_engine(Core::self_trade_prevention_mode_from_string(self_trade_prevention));
+    replay_engine.run(commands);
+    replay_engine.print_report(std::cout);
+
+    std::vector<std::string> golden_output = replay_engine.get_golden_output();
+    if (!write_golden_filename.empty()) {
+        std::ofstream golden_file(write_golden_filename);
+        for (const auto& line : golden_output) {
+            golden_file << line << "\n";
+        }
+        std::cout << "Golden output written to " << write_golden_filename << std::endl;
+    }
+
+    if (!golden_filename.empty()) {
+        if (!compare_with_golden(golden_output, golden_filename)) {
+            return 2;
+        }
+        std::cout << "Golden output matches" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+#include "replay_engine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+ReplayEngine::ReplayEngine(self_trade_prevention_mode_t self_trade_prevention_mode) : database_(std::make_shared<InMemoryDatabase>()),
+                                                                                       session_manager_(std::make_shared<SessionManager>()),
+                                                                                       failed_commands_count_(0),
+                                                                                       total_time_ns_(0) {
+    session_manager_->init_mockdb(database_);
+    session_manager_->init_core();
+    session_manager_->init_client_data_manager();
+
+    client_data_manager_ = session_manager_->get_client_data_manager();
+    core_ = session_manager_->get_core();
+    core_->set_self_trade_prevention_mode(self_trade_prevention_mode);
+}
+
+void ReplayEngine::run(const std::vector<ReplayCommand>& commands) {
+    for (auto& latencies : latencies_ns_) {
+        latencies.reserve(commands.size());
+    }
+
+    auto run_start = std::chrono::steady_clock::now();
+    int64_t sequence_num = 0;
+    for (const auto& command : commands) {
+        auto command_start = std::chrono::steady_clock::now();
+        execute_command(command, ++sequence_num);
+        auto command_end = std::chrono::steady_clock::now();
+
+        latencies_ns_[command.type].push_back(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(command_end - command_start).count());
+    }
+    total_time_ns_ += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - run_start).count();
+}
+
+void ReplayEngine::execute_command(const ReplayCommand& command, int64_t sequence_num) {
+    const Serialize::TradeOrder& order = command.order;
+    trade_type_t trade_type = (order.type() == Serialize::TradeOrder::BUY) ? BUY : SELL;
+
+    switch (command.type) {
+        case REPLAY_NEW_ORDER: {
+            execute_new_order(order, sequence_num);
+            break;
+        }
+        case REPLAY_CANCEL_ORDER: {
+            if (!client_data_manager_->cancel_active_order(trade_type, order.order_id(), order.username())) {
+                ++failed_commands_count_;
+            }
+            break;
+        }
+        case REPLAY_MODIFY_ORDER: {
+            Serialize::ModifyTradeOrder modify_order;
+            modify_order.set_type(order.type());
+            modify_order.set_order_id(order.order_id());
+            modify_order.set_usd_cost(order.usd_cost());
+            modify_order.set_usd_amount(order.usd_amount());
+
+            risk_check_result_t risk_check_result = RISK_ACCEPTED;
+            if (!client_data_manager_->modify_active_order(modify_order, order.username(), risk_check_result) ||
+                risk_check_result != RISK_ACCEPTED) {
+                ++failed_commands_count_;
+            }
+            //*INFO: Stock loop runs pass requested by modify
+            core_->process_orders();
+            break;
+        }
+        case REPLAY_CANCEL_ALL: {
+            client_data_manager_->cancel_all_active_orders(order.username(), command.side);
+            break;
+        }
+        default: {
+            ++failed_commands_count_;
+            break;
+        }
+    }
+}
+
+//*INFO: Same steps as session and stock loop do for order from socket
+void ReplayEngine::execute_new_order(Serialize::TradeOrder order, int64_t sequence_num) {
+    create_client_if_missing(order.username());
+    order.set_timestamp(sequence_num);
+
+    risk_check_result_t risk_check_result = client_data_manager_->check_and_reserve_order(order);
+    if (risk_check_result != RISK_ACCEPTED) {
+        rejected_orders_.push_back("REJECT " + std::to_string(order.order_id()) + " " +
+                                   RiskEngine::risk_check_result_to_string(risk_check_result));
+        return;
+    }
+
+    client_data_manager_->push_order_to_active_orders(order);
+    core_->accept_incoming_order(order);
+    core_->process_orders();
+}
+
+void ReplayEngine::create_client_if_missing(const std::string& username) {
+    if (usernames_.insert(username).second && !client_data_manager_->get_account_balance_slot(username)) {
+        client_data_manager_->create_new_client_fund_data(username);
+    }
+}
+
+std::vector<std::string> ReplayEngine::get_golden_output() const {
+    std::vector<std::string> golden_output(rejected_orders_);
+
+    for (const auto& execution : database_->get_executions()) {
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(4)
+             << "FILL " << execution.maker_order_id() << " " << execution.taker_order_id() << " "
+             << Serialize::TradeOrder::TradeType_Name(execution.aggressor_side()) << " "
+             << execution.price() << " " << execution.usd_amount();
+        golden_output.push_back(line.str());
+    }
+
+    for (const auto& username : usernames_) {
+        Serialize::AccountBalance balance = client_data_manager_->get_client_balance(username);
+
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(4)
+             << "BALANCE " << username << " " << balance.usd_balance() << " " << balance.rub_balance() << " "
+             << balance.usd_reserved() << " " << balance.rub_reserved();
+        golden_output.push_back(line.str());
+    }
+
+    return golden_output;
+}
+
+void ReplayEngine::print_report(std::ostream& out) const {
+    size_t commands_count = 0;
+    for (const auto& latencies : latencies_ns_) {
+        commands_count += latencies.size();
+    }
+    double total_time_sec = total_time_ns_ / 1e9;
+
+    out << "Commands: " << commands_count
+        << ", fills: " << database_->get_executions().size()
+        << ", rejected orders: " << rejected_orders_.size()
+        << ", failed cancels/modifies: " << failed_commands_count_ << "\n";
+    out << "Total time: " << std::fixed << std::setprecision(3) << total_time_sec << " s, throughput: "
+        << std::setprecision(0) << (total_time_sec > 0.0 ? commands_count / total_time_sec : 0.0) << " commands/s\n";
+
+    out << "Latency, ns:\n"
+        << std::setw(12) << "command" << std::setw(10) << "count"
+        << std::setw(10) << "p50" << std::setw(10) << "p90" << std::setw(10) << "p99"
+        << std::setw(10) << "p99.9" << std::setw(12) << "max" << "\n";
+
+    for (size_t command_type = 0; command_type < REPLAY_COMMAND_TYPES_COUNT; ++command_type) {
+        std::vector<int64_t> latencies = latencies_ns_[command_type];
+        if (latencies.empty()) {
+            continue;
+        }
+        std::sort(latencies.begin(), latencies.end());
+
+        auto percentile = [&latencies](double fraction) {
+            size_t position = std::min(latencies.size() - 1, static_cast<size_t>(fraction * latencies.size()));
+            return latencies[position];
+        };
+
+        out << std::setw(12) << ReplayJournal::command_type_to_string(static_cast<replay_command_type_t>(command_type))
+            << std::setw(10) << latencies.size()
+            << std::setw(10) << percentile(0.50) << std::setw(10) << percentile(0.90)
+            << std::setw(10) << percentile(0.99) << std::setw(10) << percentile(0.999)
+            << std::setw(12) << latencies.back() << "\n";
+    }
+}
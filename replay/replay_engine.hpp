@@ -0,0 +1,51 @@
+#ifndef REPLAY_ENGINE_HPP
+#define REPLAY_ENGINE_HPP
+
+#include <array>
+#include <memory>
+#include <ostream>
+#include <set>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "in_memory_database.hpp"
+#include "replay_journal.hpp"
+#include "session_manager.hpp"
+#include "client_data_manager.hpp"
+#include "core.hpp"
+
+//*INFO: Runs journal through ClientDataManager and Core on calling thread, same path as stock loop
+//*INFO: takes for order from queue but without network, database and order queue.
+//*INFO: Order timestamps are journal positions, so time priority and fills don't depend on run speed
+class ReplayEngine {
+public:
+    ReplayEngine(self_trade_prevention_mode_t self_trade_prevention_mode = STP_NONE);
+
+    void run(const std::vector<ReplayCommand>& commands);
+
+    //*INFO: Rejected orders, fills in execution order and final balances of all accounts, one record per line.
+    //*INFO: Generated trade ids and wall clock timestamps are left out
+    std::vector<std::string> get_golden_output() const;
+    void print_report(std::ostream& out) const;
+
+private:
+    void execute_command(const ReplayCommand& command, int64_t sequence_num);
+    void execute_new_order(Serialize::TradeOrder order, int64_t sequence_num);
+    void create_client_if_missing(const std::string& username);
+
+private:
+    std::shared_ptr<InMemoryDatabase> database_;
+    std::shared_ptr<SessionManager> session_manager_;
+    std::shared_ptr<ClientDataManager> client_data_manager_;
+    std::shared_ptr<Core> core_;
+
+    std::set<std::string> usernames_;
+    std::vector<std::string> rejected_orders_;
+    size_t failed_commands_count_;
+
+    std::array<std::vector<int64_t>, REPLAY_COMMAND_TYPES_COUNT> latencies_ns_;
+    int64_t total_time_ns_;
+};
+
+#endif // REPLAY_ENGINE_HPP
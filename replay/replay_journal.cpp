@@ -0,0 +1,219 @@
+#include "replay_journal.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <iomanip>
+#include <algorithm>
+#include <cstdlib>
+
+#define GENERATED_ACCOUNTS_COUNT 100
+#define GENERATED_START_PRICE 70.0
+#define GENERATED_PRICE_TICK 0.01
+#define GENERATED_MAX_ORDER_AMOUNT 100
+
+bool ReplayJournal::load(const std::string& filename, std::vector<ReplayCommand>& commands, std::string& error) {
+    std::ifstream journal(filename);
+    if (!journal) {
+        error = "can't open journal " + filename;
+        return false;
+    }
+
+    std::string line;
+    size_t line_num = 0;
+    while (std::getline(journal, line)) {
+        ++line_num;
+
+        size_t comment_position = line.find('#');
+        if (comment_position != std::string::npos) {
+            line.erase(comment_position);
+        }
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+
+        ReplayCommand command;
+        if (!parse_line(line, command, error)) {
+            error = "line " + std::to_string(line_num) + ": " + error;
+            return false;
+        }
+        commands.push_back(std::move(command));
+    }
+    return true;
+}
+
+bool ReplayJournal::parse_line(const std::string& line, ReplayCommand& command, std::string& error) {
+    std::istringstream fields(line);
+    std::string command_name;
+    fields >> command_name;
+
+    command.side = Serialize::CancelAllOrders::BOTH;
+    command.order.Clear();
+
+    if (command_name == "CANCEL_ALL") {
+        command.type = REPLAY_CANCEL_ALL;
+
+        std::string username;
+        std::string side_name = "BOTH";
+        fields >> username >> side_name;
+        if (username.empty() || !Serialize::CancelAllOrders::Side_Parse(side_name, &command.side)) {
+            error = "expected CANCEL_ALL <username> [BOTH|BUY|SELL]";
+            return false;
+        }
+        command.order.set_username(username);
+        return true;
+    }
+
+    if (command_name == "NEW") {
+        command.type = REPLAY_NEW_ORDER;
+    } else if (command_name == "CANCEL") {
+        command.type = REPLAY_CANCEL_ORDER;
+    } else if (command_name == "MODIFY") {
+        command.type = REPLAY_MODIFY_ORDER;
+    } else {
+        error = "unknown command " + command_name;
+        return false;
+    }
+
+    int64_t order_id = 0;
+    std::string username;
+    std::string trade_type_name;
+    Serialize::TradeOrder::TradeType trade_type;
+    if (!(fields >> order_id >> username >> trade_type_name) ||
+        !Serialize::TradeOrder::TradeType_Parse(trade_type_name, &trade_type)) {
+        error = "expected <order_id> <username> <BUY|SELL>";
+        return false;
+    }
+    command.order.set_order_id(order_id);
+    command.order.set_username(username);
+    command.order.set_type(trade_type);
+
+    if (command.type == REPLAY_CANCEL_ORDER) {
+        return true;
+    }
+
+    double usd_cost = 0.0;
+    int32_t usd_amount = 0;
+    if (!(fields >> usd_cost >> usd_amount)) {
+        error = "expected <usd_cost> <usd_amount>";
+        return false;
+    }
+    command.order.set_usd_cost(usd_cost);
+    command.order.set_usd_amount(usd_amount);
+    command.order.set_usd_volume(usd_amount);
+
+    if (command.type == REPLAY_MODIFY_ORDER) {
+        return true;
+    }
+
+    std::string order_type_name = "LIMIT";
+    std::string time_in_force_name = "GTC";
+    double stop_price = 0.0;
+    int32_t peak_amount = 0;
+    fields >> order_type_name >> time_in_force_name >> stop_price >> peak_amount;
+
+    Serialize::TradeOrder::OrderType order_type;
+    Serialize::TradeOrder::TimeInForce time_in_force;
+    if (!Serialize::TradeOrder::OrderType_Parse(order_type_name, &order_type) ||
+        !Serialize::TradeOrder::TimeInForce_Parse(time_in_force_name, &time_in_force) ||
+        time_in_force == Serialize::TradeOrder::GTD) {
+        error = "unknown order type " + order_type_name + " or time in force " + time_in_force_name;
+        return false;
+    }
+    command.order.set_order_type(order_type);
+    command.order.set_time_in_force(time_in_force);
+    command.order.set_stop_price(stop_price);
+    command.order.set_peak_amount(peak_amount);
+    return true;
+}
+
+//*INFO: Mostly resting limit orders near mid price, with cancels, modifies and aggressive orders that trade through levels
+bool ReplayJournal::generate(const std::string& filename, size_t commands_count, uint32_t seed) {
+    std::ofstream journal(filename);
+    if (!journal) {
+        return false;
+    }
+
+    std::mt19937 random_engine(seed);
+    std::uniform_int_distribution<int> percent_distribution(0, 99);
+    std::uniform_int_distribution<int> account_distribution(0, GENERATED_ACCOUNTS_COUNT - 1);
+    std::uniform_int_distribution<int> amount_distribution(1, GENERATED_MAX_ORDER_AMOUNT);
+    std::uniform_int_distribution<int> offset_ticks_distribution(-50, 50);
+    std::uniform_int_distribution<int> drift_ticks_distribution(-1, 1);
+
+    struct GeneratedOrder {
+        int64_t order_id;
+        std::string username;
+        const char* trade_type;
+    };
+    std::vector<GeneratedOrder> resting_orders;
+
+    journal << "# Generated journal: " << commands_count << " commands, seed " << seed << "\n";
+    journal << std::fixed << std::setprecision(2);
+
+    double mid_price = GENERATED_START_PRICE;
+    int64_t next_order_id = 1;
+    for (size_t command_num = 0; command_num < commands_count; ++command_num) {
+        mid_price = std::max(mid_price + drift_ticks_distribution(random_engine) * GENERATED_PRICE_TICK, 1.0);
+
+        int command_percent = percent_distribution(random_engine);
+        std::string username = "trader_" + std::to_string(account_distribution(random_engine));
+
+        if (command_percent < 15 && !resting_orders.empty()) {
+            std::uniform_int_distribution<size_t> resting_distribution(0, resting_orders.size() - 1);
+            size_t resting_num = resting_distribution(random_engine);
+            const GeneratedOrder& order = resting_orders[resting_num];
+            journal << "CANCEL " << order.order_id << " " << order.username << " " << order.trade_type << "\n";
+
+            resting_orders[resting_num] = resting_orders.back();
+            resting_orders.pop_back();
+            continue;
+        }
+
+        if (command_percent < 20 && !resting_orders.empty()) {
+            std::uniform_int_distribution<size_t> resting_distribution(0, resting_orders.size() - 1);
+            const GeneratedOrder& order = resting_orders[resting_distribution(random_engine)];
+            journal << "MODIFY " << order.order_id << " " << order.username << " " << order.trade_type << " "
+                    << mid_price + offset_ticks_distribution(random_engine) * GENERATED_PRICE_TICK << " "
+                    << amount_distribution(random_engine) << "\n";
+            continue;
+        }
+
+        if (command_percent == 20) {
+            journal << "CANCEL_ALL " << username << "\n";
+            continue;
+        }
+
+        bool is_buy = (percent_distribution(random_engine) < 50);
+        const char* trade_type = is_buy ? "BUY" : "SELL";
+        int64_t order_id = next_order_id++;
+
+        //*INFO: Resting orders are placed on own side of mid price, aggressive ones cross it
+        double offset = std::abs(offset_ticks_distribution(random_engine)) * GENERATED_PRICE_TICK;
+        if (command_percent < 27) {
+            journal << "NEW " << order_id << " " << username << " " << trade_type << " 0 "
+                    << amount_distribution(random_engine) << " MARKET GTC\n";
+        } else if (command_percent < 37) {
+            double price = is_buy ? mid_price + offset : mid_price - offset;
+            journal << "NEW " << order_id << " " << username << " " << trade_type << " " << price << " "
+                    << amount_distribution(random_engine) * 3 << " LIMIT IOC\n";
+        } else {
+            double price = is_buy ? mid_price - offset : mid_price + offset;
+            journal << "NEW " << order_id << " " << username << " " << trade_type << " " << price << " "
+                    << amount_distribution(random_engine) << "\n";
+            resting_orders.push_back(GeneratedOrder{order_id, username, trade_type});
+        }
+    }
+
+    return static_cast<bool>(journal);
+}
+
+const char* ReplayJournal::command_type_to_string(replay_command_type_t command_type) {
+    switch (command_type) {
+        case REPLAY_NEW_ORDER: return "NEW";
+        case REPLAY_CANCEL_ORDER: return "CANCEL";
+        case REPLAY_MODIFY_ORDER: return "MODIFY";
+        case REPLAY_CANCEL_ALL: return "CANCEL_ALL";
+        default: return "UNKNOWN";
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef REPLAY_JOURNAL_HPP
+#define REPLAY_JOURNAL_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include "trade_market_protocol.pb.h"
+
+enum replay_command_type_t {
+    REPLAY_NEW_ORDER,
+    REPLAY_CANCEL_ORDER,
+    REPLAY_MODIFY_ORDER,
+    REPLAY_CANCEL_ALL,
+    REPLAY_COMMAND_TYPES_COUNT
+};
+
+struct ReplayCommand {
+    replay_command_type_t type;
+    //*INFO: NEW uses whole order, CANCEL - order_id, username and type, MODIFY - also usd_cost and usd_amount
+    Serialize::TradeOrder order;
+    //*INFO: CANCEL_ALL only
+    Serialize::CancelAllOrders::Side side;
+};
+
+//*INFO: Text journal of engine commands, one per line, fields separated by spaces, # starts comment:
+//*INFO:   NEW <order_id> <username> <BUY|SELL> <usd_cost> <usd_amount> [order_type] [time_in_force] [stop_price] [peak_amount]
+//*INFO:   CANCEL <order_id> <username> <BUY|SELL>
+//*INFO:   MODIFY <order_id> <username> <BUY|SELL> <usd_cost> <usd_amount>
+//*INFO:   CANCEL_ALL <username> [BOTH|BUY|SELL]
+//*INFO: order_type and time_in_force are names from protocol (LIMIT, MARKET, STOP, STOP_LIMIT / GTC, IOC, FOK, DAY).
+//*INFO: GTD is not supported, replay has no clock for expiry
+class ReplayJournal {
+public:
+    static bool load(const std::string& filename, std::vector<ReplayCommand>& commands, std::string& error);
+    static bool parse_line(const std::string& line, ReplayCommand& command, std::string& error);
+
+    //*INFO: Random order flow around drifting mid price, same seed gives same journal
+    static bool generate(const std::string& filename, size_t commands_count, uint32_t seed);
+
+    static const char* command_type_to_string(replay_command_type_t command_type);
+};
+
+#endif // REPLAY_JOURNAL_HPP
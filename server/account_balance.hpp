@@ -0,0 +1,125 @@
+#ifndef ACCOUNT_BALANCE_HPP
+#define ACCOUNT_BALANCE_HPP
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+#include "trade_market_protocol.pb.h"
+
+//*INFO: 1 unit of balance = BALANCE_FIXED_POINT_SCALE fixed-point units
+#define BALANCE_FIXED_POINT_SCALE 10000
+
+//*INFO: Balance of one account stored as plain fixed-point fields and published with sequence counter (seqlock).
+//*INFO: One writer thread (core) changes it without locks, readers on session threads retry on conflict.
+//*INFO: Reservations of risk engine and open orders counter are separate atomics changed from any thread.
+class AccountBalanceSlot {
+public:
+    AccountBalanceSlot(double usd_balance = 0.0, double rub_balance = 0.0) :
+                       sequence_(0),
+                       usd_balance_(to_fixed_point(usd_balance)),
+                       rub_balance_(to_fixed_point(rub_balance)),
+                       usd_reserved_(0),
+                       rub_reserved_(0),
+                       open_orders_count_(0) {
+    }
+
+    //*INFO: Avalible only on writer thread
+    void add(double usd_delta, double rub_delta) {
+        uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+
+        sequence_.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        usd_balance_.store(usd_balance_.load(std::memory_order_relaxed) + to_fixed_point(usd_delta), std::memory_order_relaxed);
+        rub_balance_.store(rub_balance_.load(std::memory_order_relaxed) + to_fixed_point(rub_delta), std::memory_order_relaxed);
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    //*INFO: Consistent pair of balances, never blocks writer
+    void load_fixed_point(int64_t& usd_balance, int64_t& rub_balance) const {
+        uint64_t sequence_before;
+
+        do {
+            sequence_before = sequence_.load(std::memory_order_acquire);
+            usd_balance = usd_balance_.load(std::memory_order_relaxed);
+            rub_balance = rub_balance_.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while ((sequence_before & 1) || sequence_.load(std::memory_order_relaxed) != sequence_before);
+    }
+
+    Serialize::AccountBalance load() const {
+        int64_t usd_balance;
+        int64_t rub_balance;
+        load_fixed_point(usd_balance, rub_balance);
+
+        Serialize::AccountBalance account_balance;
+        account_balance.set_usd_balance(from_fixed_point(usd_balance));
+        account_balance.set_rub_balance(from_fixed_point(rub_balance));
+        account_balance.set_usd_reserved(from_fixed_point(usd_reserved_.load(std::memory_order_relaxed)));
+        account_balance.set_rub_reserved(from_fixed_point(rub_reserved_.load(std::memory_order_relaxed)));
+        return account_balance;
+    }
+
+    //*INFO: Reserves amounts if balance + credit - already reserved covers them (check can be skipped),
+    //*INFO: concurrent reservations are added first and rolled back on failure, so they never overdraw together
+    bool try_reserve(int64_t usd_amount, int64_t rub_amount, int64_t usd_credit, int64_t rub_credit, bool is_check_required) {
+        int64_t usd_reserved = usd_reserved_.fetch_add(usd_amount, std::memory_order_acq_rel) + usd_amount;
+        int64_t rub_reserved = rub_reserved_.fetch_add(rub_amount, std::memory_order_acq_rel) + rub_amount;
+        if (!is_check_required) {
+            return true;
+        }
+
+        int64_t usd_balance;
+        int64_t rub_balance;
+        load_fixed_point(usd_balance, rub_balance);
+
+        if ((usd_amount > 0 && usd_balance + usd_credit < usd_reserved) ||
+            (rub_amount > 0 && rub_balance + rub_credit < rub_reserved)) {
+            release(usd_amount, rub_amount);
+            return false;
+        }
+        return true;
+    }
+
+    void release(int64_t usd_amount, int64_t rub_amount) {
+        usd_reserved_.fetch_sub(usd_amount, std::memory_order_acq_rel);
+        rub_reserved_.fetch_sub(rub_amount, std::memory_order_acq_rel);
+    }
+
+    //*INFO: max_open_orders 0 means unlimited
+    bool try_open_order(uint32_t max_open_orders) {
+        uint32_t open_orders_count = open_orders_count_.fetch_add(1, std::memory_order_acq_rel) + 1;
+        if (max_open_orders != 0 && open_orders_count > max_open_orders) {
+            open_orders_count_.fetch_sub(1, std::memory_order_acq_rel);
+            return false;
+        }
+        return true;
+    }
+
+    void close_order() {
+        open_orders_count_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    uint32_t get_open_orders_count() const {
+        return open_orders_count_.load(std::memory_order_relaxed);
+    }
+
+    static int64_t to_fixed_point(double amount) {
+        return std::llround(amount * BALANCE_FIXED_POINT_SCALE);
+    }
+
+    static double from_fixed_point(int64_t fixed_point_amount) {
+        return static_cast<double>(fixed_point_amount) / BALANCE_FIXED_POINT_SCALE;
+    }
+
+private:
+    alignas(64) std::atomic<uint64_t> sequence_;
+    std::atomic<int64_t> usd_balance_;
+    std::atomic<int64_t> rub_balance_;
+
+    alignas(64) std::atomic<int64_t> usd_reserved_;
+    std::atomic<int64_t> rub_reserved_;
+    std::atomic<uint32_t> open_orders_count_;
+};
+
+#endif // ACCOUNT_BALANCE_HPP
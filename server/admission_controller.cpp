@@ -0,0 +1,70 @@
+#include "admission_controller.hpp"
+
+AdmissionController::AdmissionController(const AdmissionLimits& limits) : limits_(limits),
+                                         accept_tokens_(limits.max_accept_rate),
+                                         last_refill_(std::chrono::steady_clock::now()) {
+}
+
+bool AdmissionController::try_admit(const std::string& client_address) {
+    std::lock_guard<std::mutex> try_admit_lock_guard(admission_mutex_);
+
+    if (limits_.max_sessions != 0 && admitted_sessions_count_ >= limits_.max_sessions) {
+        return false;
+    }
+
+    auto& address_sessions_count = sessions_per_address_[client_address];
+    if (limits_.max_sessions_per_ip != 0 && address_sessions_count >= limits_.max_sessions_per_ip) {
+        return false;
+    }
+
+    //*INFO: Token is taken last, so connections rejected by other limits don't burn rate
+    if (!try_take_accept_token()) {
+        if (address_sessions_count == 0) {
+            sessions_per_address_.erase(client_address);
+        }
+        return false;
+    }
+
+    ++address_sessions_count;
+    ++admitted_sessions_count_;
+    return true;
+}
+
+void AdmissionController::release(const std::string& client_address) {
+    std::lock_guard<std::mutex> release_lock_guard(admission_mutex_);
+
+    auto address_iterator = sessions_per_address_.find(client_address);
+    if (address_iterator == sessions_per_address_.end()) {
+        return;
+    }
+
+    if (--address_iterator->second == 0) {
+        sessions_per_address_.erase(address_iterator);
+    }
+    --admitted_sessions_count_;
+}
+
+uint32_t AdmissionController::get_admitted_sessions_count() const {
+    std::lock_guard<std::mutex> get_admitted_sessions_count_lock_guard(admission_mutex_);
+    return admitted_sessions_count_;
+}
+
+//*INFO: Token bucket, called under admission_mutex_
+bool AdmissionController::try_take_accept_token() {
+    if (limits_.max_accept_rate == 0) {
+        return true;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed = now - last_refill_;
+    last_refill_ = now;
+
+    accept_tokens_ = std::min<double>(limits_.max_accept_rate,
+                                      accept_tokens_ + elapsed.count() * limits_.max_accept_rate);
+    if (accept_tokens_ < 1.0) {
+        return false;
+    }
+
+    accept_tokens_ -= 1.0;
+    return true;
+}
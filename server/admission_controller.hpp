@@ -0,0 +1,42 @@
+#ifndef ADMISSION_CONTROLLER_HPP
+#define ADMISSION_CONTROLLER_HPP
+
+#include <string>
+#include <mutex>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+
+//*INFO: Limit value 0 means unlimited
+struct AdmissionLimits {
+    uint32_t max_sessions = 0;
+    uint32_t max_accept_rate = 0;       //*INFO: new sessions per second, burst up to one second of rate
+    uint32_t max_sessions_per_ip = 0;
+};
+
+//*INFO: Decides on accept thread whether new connection may become a session
+class AdmissionController {
+public:
+    AdmissionController(const AdmissionLimits& limits);
+
+    bool try_admit(const std::string& client_address);
+    void release(const std::string& client_address);
+
+    uint32_t get_admitted_sessions_count() const;
+
+private:
+    bool try_take_accept_token();
+
+private:
+    AdmissionLimits limits_;
+
+    mutable std::mutex admission_mutex_;
+    uint32_t admitted_sessions_count_ = 0;
+    std::unordered_map<std::string, uint32_t> sessions_per_address_;
+
+    double accept_tokens_;
+    std::chrono::steady_clock::time_point last_refill_;
+};
+
+#endif // ADMISSION_CONTROLLER_HPP
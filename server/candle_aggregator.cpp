@@ -0,0 +1,130 @@
+#include "candle_aggregator.hpp"
+
+CandleAggregator::CandleAggregator(std::shared_ptr<IDatabase> database) : database_(database) {
+}
+
+int64_t CandleAggregator::get_resolution_period_ms(Serialize::CandleResolution resolution) {
+    switch (resolution) {
+        case Serialize::SECOND_1 : return 1000LL;
+        case Serialize::MINUTE_1 : return 60LL * 1000;
+        case Serialize::MINUTE_5 : return 5LL * 60 * 1000;
+        case Serialize::HOUR_1 :   return 60LL * 60 * 1000;
+        case Serialize::DAY_1 :    return 24LL * 60 * 60 * 1000;
+        default :                  return 1000LL;
+    }
+}
+
+void CandleAggregator::load_candles_from_db() {
+    std::unique_lock<std::shared_mutex> load_candles_from_db_unique_lock(candles_mutex_);
+
+    for (int resolution = 0; resolution < CANDLE_RESOLUTIONS_COUNT; ++resolution) {
+        auto candles = database_->load_candles_from_db(static_cast<Serialize::CandleResolution>(resolution),
+                                                       MAX_CANDLES_PER_RESOLUTION);
+        //*INFO: Database returns newest first
+        candles_[resolution].assign(candles.rbegin(), candles.rend());
+    }
+}
+
+void CandleAggregator::save_open_candles_to_db() {
+    save_closed_candles_to_db();
+
+    std::vector<std::pair<Serialize::CandleResolution, Serialize::Candle>> open_candles;
+    {
+        std::shared_lock<std::shared_mutex> save_open_candles_to_db_shared_lock(candles_mutex_);
+        for (int resolution = 0; resolution < CANDLE_RESOLUTIONS_COUNT; ++resolution) {
+            if (!candles_[resolution].empty()) {
+                open_candles.emplace_back(static_cast<Serialize::CandleResolution>(resolution), candles_[resolution].back());
+            }
+        }
+    }
+
+    for (const auto& [resolution, candle] : open_candles) {
+        save_candle_to_db(resolution, candle);
+    }
+}
+
+void CandleAggregator::save_closed_candles_to_db() {
+    for (const auto& [resolution, candle] : closed_candles_) {
+        save_candle_to_db(resolution, candle);
+    }
+    closed_candles_.clear();
+}
+
+void CandleAggregator::add_fill(double price, int32_t usd_amount, int64_t timestamp) {
+    std::unique_lock<std::shared_mutex> add_fill_unique_lock(candles_mutex_);
+
+    for (int resolution = 0; resolution < CANDLE_RESOLUTIONS_COUNT; ++resolution) {
+        auto candle_resolution = static_cast<Serialize::CandleResolution>(resolution);
+        int64_t period = get_resolution_period_ms(candle_resolution);
+        int64_t open_time = timestamp - timestamp % period;
+
+        auto& resolution_candles = candles_[resolution];
+        if (!resolution_candles.empty() && resolution_candles.back().open_time() == open_time) {
+            Serialize::Candle& candle = resolution_candles.back();
+            candle.set_high(std::max(candle.high(), price));
+            candle.set_low(std::min(candle.low(), price));
+            candle.set_close(price);
+            candle.set_usd_volume(candle.usd_volume() + usd_amount);
+            candle.set_trades_count(candle.trades_count() + 1);
+            continue;
+        }
+
+        if (!resolution_candles.empty()) {
+            closed_candles_.emplace_back(candle_resolution, resolution_candles.back());
+        }
+
+        Serialize::Candle candle;
+        candle.set_open_time(open_time);
+        candle.set_open(price);
+        candle.set_high(price);
+        candle.set_low(price);
+        candle.set_close(price);
+        candle.set_usd_volume(usd_amount);
+        candle.set_trades_count(1);
+        resolution_candles.push_back(candle);
+
+        if (resolution_candles.size() > MAX_CANDLES_PER_RESOLUTION) {
+            resolution_candles.pop_front();
+        }
+    }
+}
+
+Serialize::Candles CandleAggregator::get_candles(Serialize::CandleResolution resolution,
+                                                 int64_t from_timestamp, int64_t to_timestamp) const {
+    Serialize::Candles candles;
+    candles.set_resolution(resolution);
+    if (resolution < 0 || resolution >= CANDLE_RESOLUTIONS_COUNT) {
+        return candles;
+    }
+
+    std::shared_lock<std::shared_mutex> get_candles_shared_lock(candles_mutex_);
+    const auto& resolution_candles = candles_[resolution];
+
+    //*INFO: Candles are sorted by open_time, so range bounds are found by binary search
+    auto first_candle = std::lower_bound(resolution_candles.begin(), resolution_candles.end(), from_timestamp,
+        [](const Serialize::Candle& candle, int64_t timestamp) {
+            return candle.open_time() < timestamp;
+        });
+    //*INFO: Candle opened before from_timestamp still covers it while its period lasts
+    if (first_candle != resolution_candles.begin() &&
+        std::prev(first_candle)->open_time() + get_resolution_period_ms(resolution) > from_timestamp) {
+        --first_candle;
+    }
+
+    for (auto candle_iterator = first_candle; candle_iterator != resolution_candles.end(); ++candle_iterator) {
+        if (to_timestamp != 0 && candle_iterator->open_time() > to_timestamp) {
+            break;
+        }
+        *candles.add_candles() = *candle_iterator;
+    }
+
+    return candles;
+}
+
+void CandleAggregator::save_candle_to_db(Serialize::CandleResolution resolution, const Serialize::Candle& candle) {
+    try {
+        database_->save_candle_to_db(resolution, candle);
+    } catch (const std::exception& e) {
+        spdlog::error("Failed to save candle to db: {}", e.what());
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef CANDLE_AGGREGATOR_HPP
+#define CANDLE_AGGREGATOR_HPP
+
+#include <array>
+#include <deque>
+#include <vector>
+#include <utility>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <shared_mutex>
+#include <algorithm>
+#include <iterator>
+
+#include <spdlog/spdlog.h>
+
+#include "database.hpp"
+#include "trade_market_protocol.pb.h"
+
+#define CANDLE_RESOLUTIONS_COUNT 5
+#define MAX_CANDLES_PER_RESOLUTION 1440
+
+//*INFO: Incrementally builds OHLCV candles of every resolution from fill stream.
+//*INFO: Candle is persisted after matching pass that closed its period, open candles are persisted on shutdown.
+class CandleAggregator {
+public:
+    CandleAggregator(std::shared_ptr<IDatabase> database);
+
+    void load_candles_from_db();
+    void save_open_candles_to_db();
+
+    //*INFO: Avalible only on core thread. Closed candles are only collected here, database is not touched
+    void add_fill(double price, int32_t usd_amount, int64_t timestamp);
+    //*INFO: Avalible only on core thread, called once per matching pass outside of candles lock
+    void save_closed_candles_to_db();
+
+    Serialize::Candles get_candles(Serialize::CandleResolution resolution, int64_t from_timestamp, int64_t to_timestamp) const;
+
+    static int64_t get_resolution_period_ms(Serialize::CandleResolution resolution);
+
+private:
+    void save_candle_to_db(Serialize::CandleResolution resolution, const Serialize::Candle& candle);
+
+private:
+    std::shared_ptr<IDatabase> database_;
+
+    mutable std::shared_mutex candles_mutex_;
+    std::array<std::deque<Serialize::Candle>, CANDLE_RESOLUTIONS_COUNT> candles_;
+
+    //*INFO: Written and read only on core thread, so not guarded by candles_mutex_
+    std::vector<std::pair<Serialize::CandleResolution, Serialize::Candle>> closed_candles_;
+};
+
+#endif // CANDLE_AGGREGATOR_HPP
@@ -1,6 +1,11 @@
 #include "client_data_manager.hpp"
 
-ClientDataManager::ClientDataManager(std::shared_ptr<SessionManager> session_manager) : session_manager_(session_manager),
+ClientDataManager::ClientDataManager(std::shared_ptr<SessionManager> session_manager, size_t shards_count) :
+                                         shards_(std::max<size_t>(shards_count, 1)),
+                                         session_manager_(session_manager),
+                                         risk_engine_(std::make_shared<RiskEngine>()),
+                                         stage_latencies_(session_manager->get_stage_latencies()),
+                                         metric_counters_(session_manager->get_metric_counters()),
                                          buy_orders_queue_(std::make_shared<OrderQueue>()),
                                          sell_orders_queue_(std::make_shared<OrderQueue>()) {
 }
@@ -10,104 +15,157 @@ void ClientDataManager::initialize_from_database() {
 
     auto clients_balances = database->load_clients_balances_from_db();
     for (const auto& client_balance : clients_balances) {
-        clients_funds_data_[client_balance.username()] = client_balance.funds();
+        get_shard(client_balance.username()).clients_balances[client_balance.username()] =
+            std::make_shared<AccountBalanceSlot>(client_balance.funds().usd_balance(), client_balance.funds().rub_balance());
     }
 
     auto active_buy_orders = database->load_active_orders_from_db(Serialize::TradeOrder::BUY);
     auto active_sell_orders = database->load_active_orders_from_db(Serialize::TradeOrder::SELL);
     for (const auto& order : active_buy_orders) {
-        active_buy_orders_[order.order_id()] = order;
+        get_shard(order.username()).active_buy_orders[order.order_id()] = order;
+        get_or_create_client_active_orders(order.username())->add_order(order);
+        restore_order_reservation(order);
     }
     for (const auto& order : active_sell_orders) {
-        active_sell_orders_[order.order_id()] = order;
+        get_shard(order.username()).active_sell_orders[order.order_id()] = order;
+        get_or_create_client_active_orders(order.username())->add_order(order);
+        restore_order_reservation(order);
     }
 
-    auto last_completed_orders = database->load_last_completed_orders(AMOUNT_LAST_COMPLETED_OREDRS);;
-    for (const auto& completed_order : last_completed_orders) {
-        completed_orders_.push_back(completed_order);
+    //*INFO: Database returns newest first, rings are filled oldest to newest
+    auto last_completed_orders = database->load_last_completed_orders(AMOUNT_LAST_COMPLETED_OREDRS);
+    for (auto order_iterator = last_completed_orders.rbegin(); order_iterator != last_completed_orders.rend(); ++order_iterator) {
+        completed_orders_.push(to_completed_order_record(*order_iterator));
     }
 
     auto qoute_history = database->load_quote_history(AMOUNT_QUOTE_HISTORY);
-    for (const auto& quote : qoute_history) {
-        quote_history_.push_back(quote);
+    for (auto quote_iterator = qoute_history.rbegin(); quote_iterator != qoute_history.rend(); ++quote_iterator) {
+        quote_history_.push(to_quote_record(*quote_iterator));
+    }
+
+    auto last_executions = database->load_last_executions(AMOUNT_LAST_TRADES);
+    for (auto execution_iterator = last_executions.rbegin(); execution_iterator != last_executions.rend(); ++execution_iterator) {
+        trades_.push(to_execution_record(*execution_iterator));
+    }
+    if (!last_executions.empty()) {
+        risk_engine_->update_last_trade_price(last_executions.front().price());
     }
 }
 
+void ClientDataManager::restore_order_reservation(const Serialize::TradeOrder& order) {
+    auto account_balance = find_account_balance_slot(order.username());
+    if (!account_balance) {
+        spdlog::error("client with {} in client balances not found, order id={} is not reserved", order.username(), order.order_id());
+        return;
+    }
+    risk_engine_->restore_reservation(order, *account_balance);
+}
+
 //                                                                                //
 //                                 Core operations                                //
 //                                                                                //
 bool ClientDataManager::update_active_order_usd_amount(const Serialize::TradeOrder& order, int32_t transaction_amount) {
-    std::unique_lock<std::shared_mutex> update_active_order_usd_amount_unique_lock(client_data_mutex_);
+    ClientDataShard& shard = get_shard(order.username());
+    auto update_active_order_usd_amount_unique_lock = stage_latencies_->lock_and_record_wait(shard.shard_mutex, LOCK_WAIT_CLIENT_SHARD);
 
-    auto& target_orders = (order.type() == Serialize::TradeOrder::BUY) ? active_buy_orders_ : active_sell_orders_;
+    auto& target_orders = (order.type() == Serialize::TradeOrder::BUY) ? shard.active_buy_orders : shard.active_sell_orders;
     if (target_orders.find(order.order_id()) == target_orders.end()) {
         spdlog::error("Order with id={} in unordered map active orders not found", order.order_id());
         return false;
     }
 
-    target_orders[order.order_id()].set_usd_amount(target_orders[order.order_id()].usd_amount() - transaction_amount);
+    Serialize::TradeOrder& active_order = target_orders[order.order_id()];
+    active_order.set_usd_amount(active_order.usd_amount() - transaction_amount);
+    active_order.set_displayed_amount(order.displayed_amount());
+    get_or_create_client_active_orders(active_order.username())->update_order_usd_amount(order.order_id(), transaction_amount);
+    return true;
+}
+
+bool ClientDataManager::update_active_order_displayed_amount(const Serialize::TradeOrder& order) {
+    ClientDataShard& shard = get_shard(order.username());
+    auto update_active_order_displayed_amount_unique_lock = stage_latencies_->lock_and_record_wait(shard.shard_mutex, LOCK_WAIT_CLIENT_SHARD);
+
+    auto& target_orders = (order.type() == Serialize::TradeOrder::BUY) ? shard.active_buy_orders : shard.active_sell_orders;
+    auto active_order_iterator = target_orders.find(order.order_id());
+    if (active_order_iterator == target_orders.end()) {
+        spdlog::error("Order with id={} in unordered map active orders not found", order.order_id());
+        return false;
+    }
+
+    active_order_iterator->second.set_displayed_amount(order.displayed_amount());
     return true;
 }
 
 bool ClientDataManager::change_client_balances_according_match(const std::string& client_sell, const std::string& client_buy,
-                                                              int32_t transaction_amount, double transaction_cost) {
-    
+                                                              int32_t transaction_amount, double transaction_cost,
+                                                              double sell_order_usd_cost, double buy_order_usd_cost) {
+    ClientDataShard& sell_shard = get_shard(client_sell);
+    ClientDataShard& buy_shard = get_shard(client_buy);
+    std::shared_ptr<AccountBalanceSlot> sell_client_balance;
+    std::shared_ptr<AccountBalanceSlot> buy_client_balance;
     {
-        std::unique_lock<std::shared_mutex> change_client_balance_unique_lock(client_data_mutex_);    
-
-        if (!change_client_balance(client_sell, DECREASE, USD, transaction_amount)) {
-            return false;
-        }
-        if (!change_client_balance(client_sell, INCREASE, RUB, transaction_cost)) {
-            return false;
-        }
-        if (!change_client_balance(client_buy, INCREASE, USD, transaction_amount)) {
-            return false;
+        //*INFO: Both shards are locked in order of their index, so two settlements never deadlock
+        ClientDataShard& first_shard = (&sell_shard < &buy_shard) ? sell_shard : buy_shard;
+        ClientDataShard& second_shard = (&sell_shard < &buy_shard) ? buy_shard : sell_shard;
+        auto first_shard_unique_lock = stage_latencies_->lock_and_record_wait(first_shard.shard_mutex, LOCK_WAIT_CLIENT_SHARD);
+        std::unique_lock<std::shared_mutex> second_shard_unique_lock;
+        if (&second_shard != &first_shard) {
+            second_shard_unique_lock = stage_latencies_->lock_and_record_wait(second_shard.shard_mutex, LOCK_WAIT_CLIENT_SHARD);
         }
-        if (!change_client_balance(client_buy, DECREASE, RUB, transaction_cost)) {
+
+        auto sell_balance_iterator = sell_shard.clients_balances.find(client_sell);
+        auto buy_balance_iterator = buy_shard.clients_balances.find(client_buy);
+        if (sell_balance_iterator == sell_shard.clients_balances.end() || buy_balance_iterator == buy_shard.clients_balances.end()) {
+            spdlog::error("client {} or {} in client balances not found", client_sell, client_buy);
             return false;
         }
+        sell_client_balance = sell_balance_iterator->second;
+        buy_client_balance = buy_balance_iterator->second;
+
+        //*INFO: Both sides of trade are settled together under shard locks
+        sell_client_balance->add(-transaction_amount, transaction_cost);
+        buy_client_balance->add(transaction_amount, -transaction_cost);
+        //*INFO: Reservations are released after balances changed, so available balance never looks higher than it is
+        risk_engine_->release(Serialize::TradeOrder::SELL, sell_order_usd_cost, transaction_amount, *sell_client_balance);
+        risk_engine_->release(Serialize::TradeOrder::BUY, buy_order_usd_cost, transaction_amount, *buy_client_balance);
     }
-    
-    if (!update_clients_balances_in_db(client_sell, client_buy)) {
+
+    if (!update_clients_balances_in_db(client_sell, *sell_client_balance, client_buy, *buy_client_balance)) {
         return false;
     }
 
     return true; 
 }
 
+//*INFO: Avalible only on core thread
 bool ClientDataManager::change_client_balance(const std::string& client_username,
         change_balance_type_t change_balance_type, wallet_type_t wallet_type, double amount) {
 
-    auto client_data_iterator = clients_funds_data_.find(client_username);
-    if (client_data_iterator == clients_funds_data_.end()) {
-        spdlog::error("client with {} in unordered map client_data not found", client_username);
+    auto account_balance = find_account_balance_slot(client_username);
+    if (!account_balance) {
+        spdlog::error("client with {} in client balances not found", client_username);
         return false;
     }
 
-    Serialize::AccountBalance& account_balance = client_data_iterator->second;
-    
-    if (change_balance_type == INCREASE) {
-        wallet_type == RUB ? (account_balance.set_rub_balance(account_balance.rub_balance() + amount)) : 
-                             (account_balance.set_usd_balance(account_balance.usd_balance() + amount));
-    }
-    if (change_balance_type == DECREASE) {
-        wallet_type == RUB ? (account_balance.set_rub_balance(account_balance.rub_balance() - amount)) : 
-                             (account_balance.set_usd_balance(account_balance.usd_balance() - amount));
-    }
-    spdlog::info("updated balance in client_data_manager for {} actual USD={}, RUB={}",
-                     client_username, account_balance.usd_balance(), account_balance.rub_balance());
+    double delta = (change_balance_type == INCREASE) ? amount : -amount;
+    wallet_type == RUB ? account_balance->add(0.0, delta) : account_balance->add(delta, 0.0);
+
     return true;
 }
 
-bool ClientDataManager::update_clients_balances_in_db(const std::string& client_sell, const std::string& client_buy) {
+bool ClientDataManager::update_clients_balances_in_db(const std::string& client_sell, const AccountBalanceSlot& sell_account_balance,
+                                                      const std::string& client_buy, const AccountBalanceSlot& buy_account_balance) {
     try {
         Serialize::ClientBalance sell_client_balance;
         Serialize::ClientBalance buy_client_balance;
         sell_client_balance.set_username(client_sell);
-        sell_client_balance.mutable_funds()->CopyFrom(get_client_balance(client_sell));
+        *sell_client_balance.mutable_funds() = sell_account_balance.load();
         buy_client_balance.set_username(client_buy);
-        buy_client_balance.mutable_funds()->CopyFrom(get_client_balance(client_buy));
+        *buy_client_balance.mutable_funds() = buy_account_balance.load();
+
+        spdlog::info("updated balances in client_data_manager: {} USD={}, RUB={}; {} USD={}, RUB={}",
+                     client_sell, sell_client_balance.funds().usd_balance(), sell_client_balance.funds().rub_balance(),
+                     client_buy, buy_client_balance.funds().usd_balance(), buy_client_balance.funds().rub_balance());
 
         auto database = session_manager_->get_database();
         database->update_actual_client_balance_in_db(sell_client_balance);
@@ -120,106 +178,258 @@ bool ClientDataManager::update_clients_balances_in_db(const std::string& client_
     }
 }
 
+//*INFO: Avalible only on core thread, it is the single writer of completed_orders_
 bool ClientDataManager::add_order_to_completed(const Serialize::TradeOrder& completed_order) {
-    std::unique_lock<std::shared_mutex> add_order_to_completed_unque_lock(client_data_mutex_);
-
     int64_t completion_timestamp = TimeOrderUtils::get_current_timestamp();
 
-    if (!remove_order_from_active_orders(completed_order.order_id(), completed_order.type())) {
-        spdlog::error("Failed to remove_order_from_active_orders, order id: {}", completed_order.order_id());
+    {
+        auto add_order_to_completed_unque_lock = stage_latencies_->lock_and_record_wait(get_shard(completed_order.username()).shard_mutex, LOCK_WAIT_CLIENT_SHARD);
+        if (!remove_order_from_active_orders(completed_order.order_id(), completed_order.type(), completed_order.username())) {
+            spdlog::error("Failed to remove_order_from_active_orders, order id: {}", completed_order.order_id());
+        }
     }
 
-    Serialize::Quote quote;
-    quote.set_price(completed_order.usd_cost());
-    quote.set_timestamp(completion_timestamp);
-    
+    auto account_balance = find_account_balance_slot(completed_order.username());
+    if (account_balance) {
+        risk_engine_->close_order(*account_balance);
+    }
 
-    quote_history_.push_back(quote);
-    spdlog::info("Quote: price={} added to quote_history_ in client_data_manager", completed_order.usd_cost());
-    completed_orders_.push_back(completed_order);
+    completed_orders_.push(to_completed_order_record(completed_order));
     spdlog::info("Order id:{} added to completed_orders_ in client_data_manager", completed_order.order_id());
 
     try {
         auto database = session_manager_->get_database();
         database->save_completed_order_to_db(completed_order, completion_timestamp);
-        database->save_qoute_to_db(quote);
 
     } catch (const std::exception& e) {
-        spdlog::error("Failed to save completed order or quote to db: {}", e.what());
+        spdlog::error("Failed to save completed order to db: {}", e.what());
         return false;
     }
 
     return true;
 }
 
-bool ClientDataManager::remove_order_from_active_orders(int64_t order_id, Serialize::TradeOrder::TradeType type){
-    auto& target_orders = (type == Serialize::TradeOrder::BUY) ? active_buy_orders_ : active_sell_orders_;
+//*INFO: Avalible only on core thread, it is the single writer of trades_ and quote_history_.
+//*INFO: Every match (also partial fill) is one trade print and one quote at execution price
+void ClientDataManager::add_execution(const Serialize::Execution& execution) {
+    trades_.push(to_execution_record(execution));
+    risk_engine_->update_last_trade_price(execution.price());
+
+    Serialize::Quote quote;
+    quote.set_price(execution.price());
+    quote.set_timestamp(execution.timestamp());
+    quote_history_.push(to_quote_record(quote));
+
+    spdlog::info("Trade id:{} price={} amount={} added to trades_ in client_data_manager",
+                  execution.trade_id(), execution.price(), execution.usd_amount());
+}
+
+bool ClientDataManager::save_executions_to_db(const std::vector<Serialize::Execution>& executions) {
+    try {
+        session_manager_->get_database()->save_executions_to_db(executions);
+    } catch (const std::exception& e) {
+        spdlog::error("Failed to save {} executions to db: {}", executions.size(), e.what());
+        return false;
+    }
+
+    return true;
+}
+
+//*INFO: Called under unique lock of client's shard
+bool ClientDataManager::remove_order_from_active_orders(int64_t order_id, Serialize::TradeOrder::TradeType type,
+                                                        const std::string& client_username) {
+    ClientDataShard& shard = get_shard(client_username);
+    auto& target_orders = (type == Serialize::TradeOrder::BUY) ? shard.active_buy_orders : shard.active_sell_orders;
 
     auto active_order_iterator = target_orders.find(order_id);
     if (active_order_iterator == target_orders.end()) {
         return false;
     }
 
+    get_or_create_client_active_orders(client_username)->remove_order(order_id);
     target_orders.erase(active_order_iterator);
     return true;
 }
 
+//*INFO: Called under unique lock of client's shard
+std::shared_ptr<ClientActiveOrders> ClientDataManager::get_or_create_client_active_orders(const std::string& client_username) {
+    auto& client_active_orders = get_shard(client_username).clients_active_orders[client_username];
+    if (!client_active_orders) {
+        client_active_orders = std::make_shared<ClientActiveOrders>();
+    }
+    return client_active_orders;
+}
+
+//*INFO: Session thread, before order is pushed to order queue
+risk_check_result_t ClientDataManager::check_and_reserve_order(Serialize::TradeOrder& order) {
+    auto account_balance = find_account_balance_slot(order.username());
+    if (!account_balance) {
+        spdlog::error("client with {} in client balances not found", order.username());
+        return RISK_REJECTED_INVALID_ORDER;
+    }
+
+    return risk_engine_->check_and_reserve(order, *account_balance);
+}
+
+risk_check_result_t ClientDataManager::check_and_reserve_order(Serialize::TradeOrder& order, AccountBalanceSlot& account_balance) {
+    return risk_engine_->check_and_reserve(order, account_balance);
+}
+
+//*INFO: Order leaves engine with unfilled usd_amount: rejected after risk check or rest of IOC/FOK/market order
+void ClientDataManager::release_unfilled_order(const Serialize::TradeOrder& order) {
+    {
+        auto release_unfilled_order_unique_lock = stage_latencies_->lock_and_record_wait(get_shard(order.username()).shard_mutex, LOCK_WAIT_CLIENT_SHARD);
+        remove_order_from_active_orders(order.order_id(), order.type(), order.username());
+    }
+
+    auto account_balance = find_account_balance_slot(order.username());
+    if (!account_balance) {
+        return;
+    }
+
+    risk_engine_->release(order.type(), order.usd_cost(), order.usd_amount(), *account_balance);
+    risk_engine_->close_order(*account_balance);
+}
+
+void ClientDataManager::release_canceled_amount(const Serialize::TradeOrder& order, int32_t canceled_amount) {
+    if (order.usd_amount() == 0) {
+        Serialize::TradeOrder unfilled_order = order;
+        unfilled_order.set_usd_amount(canceled_amount);
+        release_unfilled_order(unfilled_order);
+        return;
+    }
+
+    update_active_order_usd_amount(order, canceled_amount);
+
+    auto account_balance = find_account_balance_slot(order.username());
+    if (account_balance) {
+        risk_engine_->release(order.type(), order.usd_cost(), canceled_amount, *account_balance);
+    }
+}
+
+void ClientDataManager::set_risk_limits(const RiskLimits& limits) {
+    risk_engine_->set_limits(limits);
+}
+
+double ClientDataManager::get_last_trade_price() const {
+    return risk_engine_->get_last_trade_price();
+}
+
+ClientDataShard& ClientDataManager::get_shard(const std::string& client_username) {
+    return shards_[std::hash<std::string>{}(client_username) % shards_.size()];
+}
+
+const ClientDataShard& ClientDataManager::get_shard(const std::string& client_username) const {
+    return shards_[std::hash<std::string>{}(client_username) % shards_.size()];
+}
+
 //                                                                                //
 //                      SessionClientConnection operations                        //
 //                                                                                //
 void ClientDataManager::create_new_client_fund_data(std::string new_key) {
-    std::unique_lock<std::shared_mutex> create_new_client_fund_data_unique_lock(client_data_mutex_);
+    ClientDataShard& shard = get_shard(new_key);
+    auto create_new_client_fund_data_unique_lock = stage_latencies_->lock_and_record_wait(shard.shard_mutex, LOCK_WAIT_CLIENT_SHARD);
 
-    Serialize::AccountBalance new_account_balance;
-    new_account_balance.set_usd_balance(0.0);
-    new_account_balance.set_rub_balance(0.0);
-
-    clients_funds_data_[new_key] = new_account_balance;
+    shard.clients_balances[new_key] = std::make_shared<AccountBalanceSlot>(0.0, 0.0);
     spdlog::info("New client_fund_data username={} in client_data_manager created", new_key);
 }
 
 void ClientDataManager::push_order_to_active_orders(const Serialize::TradeOrder& order) {
-    std::unique_lock<std::shared_mutex> push_order_to_active_orders_unique_lock(client_data_mutex_);
+    ClientDataShard& shard = get_shard(order.username());
+    auto push_order_to_active_orders_unique_lock = stage_latencies_->lock_and_record_wait(shard.shard_mutex, LOCK_WAIT_CLIENT_SHARD);
     if (order.type() == Serialize::TradeOrder::BUY) {
-        active_buy_orders_[order.order_id()] = order;
+        shard.active_buy_orders[order.order_id()] = order;
     } else if (order.type() == Serialize::TradeOrder::SELL)  {
-        active_sell_orders_[order.order_id()] = order;
+        shard.active_sell_orders[order.order_id()] = order;
     }
+    get_or_create_client_active_orders(order.username())->add_order(order);
 }
 
 Serialize::AccountBalance ClientDataManager::get_client_balance(const std::string& client_username) const {
-    std::shared_lock<std::shared_mutex> get_client_balance_shared_lock(client_data_mutex_);
-
-    auto hash_map_iterator = clients_funds_data_.find(client_username);
-    if (hash_map_iterator == clients_funds_data_.end()) {
-        spdlog::error("client with {} in unordered map client_data not found", client_username);
+    auto account_balance = get_account_balance_slot(client_username);
+    if (!account_balance) {
+        spdlog::error("client with {} in client balances not found", client_username);
         throw std::runtime_error("client not found");
     }
 
-    Serialize::AccountBalance account_balance = hash_map_iterator->second;
+    return account_balance->load();
+}
 
-    return account_balance;
+//*INFO: Shard lock is taken only to find slot, session caches it at sign-in and then reads balance wait-free
+std::shared_ptr<const AccountBalanceSlot> ClientDataManager::get_account_balance_slot(const std::string& client_username) const {
+    return find_account_balance_slot(client_username);
+}
+
+std::shared_ptr<AccountBalanceSlot> ClientDataManager::get_risk_account_balance_slot(const std::string& client_username) const {
+    return find_account_balance_slot(client_username);
+}
+
+std::shared_ptr<AccountBalanceSlot> ClientDataManager::find_account_balance_slot(const std::string& client_username) const {
+    const ClientDataShard& shard = get_shard(client_username);
+    std::shared_lock<std::shared_mutex> find_account_balance_slot_shared_lock(shard.shard_mutex);
+
+    auto hash_map_iterator = shard.clients_balances.find(client_username);
+    if (hash_map_iterator == shard.clients_balances.end()) {
+        return nullptr;
+    }
+
+    return hash_map_iterator->second;
 }
 
 Serialize::ActiveOrders ClientDataManager::get_all_active_oreders() {
     Serialize::ActiveOrders all_active_orders;
-    std::shared_lock<std::shared_mutex> get_all_active_oreders_shared_lock(client_data_mutex_);
-    
-    for (const auto& [order_id, order] : active_buy_orders_) {
-        *all_active_orders.add_active_buy_orders() = order;
-    }
-    for (const auto& [order_id, order] : active_sell_orders_) {
-        *all_active_orders.add_active_sell_orders() = order;
+
+    //*INFO: Shards are locked one by one, never together
+    for (const auto& shard : shards_) {
+        std::shared_lock<std::shared_mutex> get_all_active_oreders_shared_lock(shard.shard_mutex);
+
+        for (const auto& [order_id, order] : shard.active_buy_orders) {
+            *all_active_orders.add_active_buy_orders() = to_public_active_order(order);
+        }
+        for (const auto& [order_id, order] : shard.active_sell_orders) {
+            *all_active_orders.add_active_sell_orders() = to_public_active_order(order);
+        }
     }
 
     return all_active_orders;
 }
 
+//*INFO: Iceberg is listed as plain order of its displayed size, hidden reserve is not exposed
+Serialize::TradeOrder ClientDataManager::to_public_active_order(const Serialize::TradeOrder& order) {
+    if (!OrderBook::is_iceberg_order(order)) {
+        return order;
+    }
+
+    Serialize::TradeOrder public_order = order;
+    int32_t displayed_amount = (order.displayed_amount() > 0) ? order.displayed_amount()
+                                                              : std::min(order.peak_amount(), order.usd_amount());
+    public_order.set_usd_amount(displayed_amount);
+    public_order.set_usd_volume(displayed_amount);
+    public_order.clear_peak_amount();
+    public_order.clear_displayed_amount();
+    return public_order;
+}
+
+//*INFO: Session caches result at sign-in, so further "my orders" queries skip shard locks
+std::shared_ptr<ClientActiveOrders> ClientDataManager::get_client_active_orders_index(const std::string& client_username) {
+    ClientDataShard& shard = get_shard(client_username);
+    {
+        std::shared_lock<std::shared_mutex> get_client_active_orders_index_shared_lock(shard.shard_mutex);
+        auto client_active_orders_iterator = shard.clients_active_orders.find(client_username);
+        if (client_active_orders_iterator != shard.clients_active_orders.end()) {
+            return client_active_orders_iterator->second;
+        }
+    }
+
+    auto get_client_active_orders_index_unique_lock = stage_latencies_->lock_and_record_wait(shard.shard_mutex, LOCK_WAIT_CLIENT_SHARD);
+    return get_or_create_client_active_orders(client_username);
+}
+
 Serialize::CompletedOredrs ClientDataManager::get_last_completed_oreders() {
     Serialize::CompletedOredrs all_completed_orders;
-    std::shared_lock<std::shared_mutex> get_all_completed_oreders_shared_lock(client_data_mutex_);
 
-    for (const auto& order : completed_orders_) {
+    for (const auto& record : completed_orders_.snapshot()) {
+        Serialize::TradeOrder order = from_completed_order_record(record);
         if (order.type() == Serialize::TradeOrder::BUY) {
             *all_completed_orders.add_completed_buy_orders() = order;
         } else if (order.type() == Serialize::TradeOrder::SELL) {
@@ -232,48 +442,111 @@ Serialize::CompletedOredrs ClientDataManager::get_last_completed_oreders() {
 
 Serialize::QuoteHistory ClientDataManager::get_quote_history() {
     Serialize::QuoteHistory quote_history;
-    std::shared_lock<std::shared_mutex> get_quote_history_shared_lock(client_data_mutex_);
-    
-    for (const auto& quote : quote_history_) {
-        *quote_history.add_quotes() = quote;
+
+    for (const auto& record : quote_history_.snapshot()) {
+        *quote_history.add_quotes() = from_quote_record(record);
     }
     
     return quote_history;
 }
 
-bool ClientDataManager::cancel_active_order(trade_type_t trade_type, int64_t order_id, const std::string& client_username) {
+Serialize::Trades ClientDataManager::get_last_trades() {
+    Serialize::Trades trades;
 
-    auto& target_orders = (trade_type == BUY) ? active_buy_orders_ : active_sell_orders_;
+    for (const auto& record : trades_.snapshot()) {
+        *trades.add_executions() = from_execution_record(record);
+    }
 
-    {
-        std::unique_lock<std::shared_mutex> cancel_active_order_unique_lock(client_data_mutex_); 
-        auto active_order_iterator = target_orders.find(order_id);
-        if (active_order_iterator == target_orders.end()) {
-            return false;
-        }
+    return trades;
+}
 
-        auto possible_to_cancel_order = active_order_iterator->second;
-        if (possible_to_cancel_order.username() != client_username) {
-            return false;
-        }
+bool ClientDataManager::cancel_active_order(trade_type_t trade_type, int64_t order_id, const std::string& client_username) {
+
+    //*INFO: Ownership check through per-account index, order of another client is never found there
+    if (!get_client_active_orders_index(client_username)->contains_order(order_id)) {
+        return false;
     }
-    
+
     auto core = session_manager_->get_core();
-    if (!core->remove_order_by_id(order_id, trade_type)) {
+    Serialize::TradeOrder removed_order;
+    if (!core->remove_order_by_id(order_id, trade_type, removed_order)) {
         return false;
     }
 
+    auto account_balance = find_account_balance_slot(client_username);
+    if (account_balance) {
+        risk_engine_->release(removed_order.type(), removed_order.usd_cost(), removed_order.usd_amount(), *account_balance);
+        risk_engine_->close_order(*account_balance);
+    }
+
     {
-        std::unique_lock<std::shared_mutex> cancel_active_order_unique_lock(client_data_mutex_);
+        auto cancel_active_order_unique_lock = stage_latencies_->lock_and_record_wait(get_shard(client_username).shard_mutex, LOCK_WAIT_CLIENT_SHARD);
 
         auto type = (trade_type == BUY) ? Serialize::TradeOrder::BUY : Serialize::TradeOrder::SELL;
 
-        remove_order_from_active_orders(order_id, type);
+        remove_order_from_active_orders(order_id, type, client_username);
     }
     
     return true;
 }
 
+//*INFO: Orders are taken from per-account index and removed from engine in one pass,
+//*INFO: client shard is locked once for whole batch
+size_t ClientDataManager::cancel_all_active_orders(const std::string& client_username, Serialize::CancelAllOrders::Side side) {
+    std::vector<OrderKey> order_keys = get_client_active_orders_index(client_username)->get_order_keys();
+    if (side != Serialize::CancelAllOrders::BOTH) {
+        auto type = (side == Serialize::CancelAllOrders::BUY) ? Serialize::TradeOrder::BUY : Serialize::TradeOrder::SELL;
+        order_keys.erase(std::remove_if(order_keys.begin(), order_keys.end(),
+                                        [type](const OrderKey& order_key) { return order_key.second != type; }),
+                         order_keys.end());
+    }
+    if (order_keys.empty()) {
+        return 0;
+    }
+
+    std::vector<Serialize::TradeOrder> removed_orders;
+    session_manager_->get_core()->remove_orders_by_ids(order_keys, removed_orders);
+
+    auto account_balance = find_account_balance_slot(client_username);
+    if (account_balance) {
+        for (const auto& removed_order : removed_orders) {
+            risk_engine_->release(removed_order.type(), removed_order.usd_cost(), removed_order.usd_amount(), *account_balance);
+            risk_engine_->close_order(*account_balance);
+        }
+    }
+
+    {
+        auto cancel_all_active_orders_unique_lock = stage_latencies_->lock_and_record_wait(get_shard(client_username).shard_mutex, LOCK_WAIT_CLIENT_SHARD);
+
+        for (const auto& removed_order : removed_orders) {
+            remove_order_from_active_orders(removed_order.order_id(), removed_order.type(), client_username);
+        }
+    }
+
+    spdlog::info("Cancelled {} active orders of {}", removed_orders.size(), client_username);
+    return removed_orders.size();
+}
+
+bool ClientDataManager::modify_active_order(const Serialize::ModifyTradeOrder& modify_order, const std::string& client_username,
+                                            risk_check_result_t& risk_check_result) {
+    if (!get_client_active_orders_index(client_username)->contains_order(modify_order.order_id())) {
+        return false;
+    }
+
+    return session_manager_->get_core()->modify_order(modify_order, risk_check_result);
+}
+
+risk_check_result_t ClientDataManager::check_and_modify_order_reservation(const Serialize::TradeOrder& order, double new_usd_cost,
+                                                                          int32_t new_usd_amount) {
+    auto account_balance = find_account_balance_slot(order.username());
+    if (!account_balance) {
+        spdlog::error("client with {} in client balances not found", order.username());
+        return RISK_REJECTED_INVALID_ORDER;
+    }
+
+    return risk_engine_->check_and_modify_reservation(order, new_usd_cost, new_usd_amount, *account_balance);
+}
+
 //                                                                                //
 //                     Condition variables notifications                          //
 //                                                                                //
@@ -285,14 +558,35 @@ void ClientDataManager::notify_to_stop_matching_orders() {
     order_queue_cv_.notify_all();
 }
 
+void ClientDataManager::request_matching_pass() {
+    {
+        std::lock_guard<std::mutex> request_matching_pass_lock_guard(order_queue_cv_mutex_);
+        is_matching_pass_requested_ = true;
+    }
+    order_queue_cv_.notify_all();
+}
+
 void ClientDataManager::stock_loop_wait_for_orders(std::shared_ptr<SessionManager> session_manager_ptr) {
     std::unique_lock<std::mutex> order_queue_unique_lock(order_queue_cv_mutex_);
 
     //*INFO: Wait order from order queue 
     order_queue_cv_.wait(order_queue_unique_lock, [this, session_manager_ptr] {
         return !is_empty_order_queue(BUY)  || !is_empty_order_queue(SELL) ||
-                !session_manager_ptr->is_runnig();
+                is_matching_pass_requested_ || !session_manager_ptr->is_runnig();
     });
+    is_matching_pass_requested_ = false;
+}
+
+//*INFO: Wait in call auction phase, wakes up for uncross at deadline
+void ClientDataManager::stock_loop_wait_for_orders_until(std::shared_ptr<SessionManager> session_manager_ptr,
+                                                         std::chrono::steady_clock::time_point deadline) {
+    std::unique_lock<std::mutex> order_queue_unique_lock(order_queue_cv_mutex_);
+
+    order_queue_cv_.wait_until(order_queue_unique_lock, deadline, [this, session_manager_ptr] {
+        return !is_empty_order_queue(BUY)  || !is_empty_order_queue(SELL) ||
+                is_matching_pass_requested_ || !session_manager_ptr->is_runnig();
+    });
+    is_matching_pass_requested_ = false;
 }
 
 //                                                                                //
@@ -306,18 +600,145 @@ bool ClientDataManager::is_empty_order_queue(trade_type_t trade_type) {
     }
 }
 
-bool ClientDataManager::pop_order_from_order_queue(trade_type_t trade_type, Serialize::TradeOrder& order) {
+bool ClientDataManager::pop_order_from_order_queue(trade_type_t trade_type, QueuedOrder& queued_order) {
     if (trade_type == BUY) {
-        return buy_orders_queue_->pop(order);
+        return buy_orders_queue_->pop(queued_order);
     } else {
-        return sell_orders_queue_->pop(order);
+        return sell_orders_queue_->pop(queued_order);
     }
 }
 
-bool ClientDataManager::push_order_to_order_queue(trade_type_t trade_type, const Serialize::TradeOrder& order) {
+bool ClientDataManager::push_order_to_order_queue(trade_type_t trade_type, const Serialize::TradeOrder& order, int64_t receive_time) {
+    QueuedOrder queued_order{order, receive_time, StageLatencies::now_ns()};
+    stage_latencies_->record(STAGE_RECEIVE_TO_ENQUEUE, receive_time, queued_order.enqueue_time);
+    metric_counters_->increment(COUNTER_ORDERS);
+
     if (trade_type == BUY) {
-        return buy_orders_queue_->push(order);
+        return buy_orders_queue_->push(queued_order);
     } else {
-        return sell_orders_queue_->push(order);
+        return sell_orders_queue_->push(queued_order);
+    }
+}
+
+size_t ClientDataManager::get_order_queue_size(trade_type_t trade_type) const {
+    if (trade_type == BUY) {
+        return buy_orders_queue_->get_size();
+    } else {
+        return sell_orders_queue_->get_size();
+    }
+}
+
+//                                                                                //
+//                               Ring buffer records                              //
+//                                                                                //
+CompletedOrderRecord ClientDataManager::to_completed_order_record(const Serialize::TradeOrder& completed_order) {
+    CompletedOrderRecord record{};
+    record.order_id = completed_order.order_id();
+    record.timestamp = completed_order.timestamp();
+    record.usd_cost = completed_order.usd_cost();
+    record.usd_amount = completed_order.usd_amount();
+    record.usd_volume = completed_order.usd_volume();
+    record.type = completed_order.type();
+    std::strncpy(record.username, completed_order.username().c_str(), MAX_RECORD_USERNAME_LENGTH);
+    return record;
+}
+
+Serialize::TradeOrder ClientDataManager::from_completed_order_record(const CompletedOrderRecord& record) {
+    Serialize::TradeOrder completed_order;
+    completed_order.set_order_id(record.order_id);
+    completed_order.set_timestamp(record.timestamp);
+    completed_order.set_usd_cost(record.usd_cost);
+    completed_order.set_usd_amount(record.usd_amount);
+    completed_order.set_usd_volume(record.usd_volume);
+    completed_order.set_type(record.type);
+    completed_order.set_username(record.username);
+    return completed_order;
+}
+
+QuoteRecord ClientDataManager::to_quote_record(const Serialize::Quote& quote) {
+    return QuoteRecord{quote.timestamp(), quote.price()};
+}
+
+Serialize::Quote ClientDataManager::from_quote_record(const QuoteRecord& record) {
+    Serialize::Quote quote;
+    quote.set_timestamp(record.timestamp);
+    quote.set_price(record.price);
+    return quote;
+}
+
+ExecutionRecord ClientDataManager::to_execution_record(const Serialize::Execution& execution) {
+    ExecutionRecord record{};
+    record.trade_id = execution.trade_id();
+    record.maker_order_id = execution.maker_order_id();
+    record.taker_order_id = execution.taker_order_id();
+    record.timestamp = execution.timestamp();
+    record.price = execution.price();
+    record.usd_amount = execution.usd_amount();
+    record.aggressor_side = execution.aggressor_side();
+    return record;
+}
+
+Serialize::Execution ClientDataManager::from_execution_record(const ExecutionRecord& record) {
+    Serialize::Execution execution;
+    execution.set_trade_id(record.trade_id);
+    execution.set_maker_order_id(record.maker_order_id);
+    execution.set_taker_order_id(record.taker_order_id);
+    execution.set_timestamp(record.timestamp);
+    execution.set_price(record.price);
+    execution.set_usd_amount(record.usd_amount);
+    execution.set_aggressor_side(record.aggressor_side);
+    return execution;
+}
+
+//                                                                                //
+//                          ClientActiveOrders operations                         //
+//                                                                                //
+void ClientActiveOrders::add_order(const Serialize::TradeOrder& order) {
+    std::lock_guard<std::mutex> add_order_lock_guard(client_active_orders_mutex_);
+    orders_[order.order_id()] = order;
+}
+
+void ClientActiveOrders::update_order_usd_amount(int64_t order_id, int32_t transaction_amount) {
+    std::lock_guard<std::mutex> update_order_usd_amount_lock_guard(client_active_orders_mutex_);
+
+    auto order_iterator = orders_.find(order_id);
+    if (order_iterator != orders_.end()) {
+        order_iterator->second.set_usd_amount(order_iterator->second.usd_amount() - transaction_amount);
     }
 }
+
+void ClientActiveOrders::remove_order(int64_t order_id) {
+    std::lock_guard<std::mutex> remove_order_lock_guard(client_active_orders_mutex_);
+    orders_.erase(order_id);
+}
+
+bool ClientActiveOrders::contains_order(int64_t order_id) const {
+    std::lock_guard<std::mutex> contains_order_lock_guard(client_active_orders_mutex_);
+    return orders_.find(order_id) != orders_.end();
+}
+
+std::vector<OrderKey> ClientActiveOrders::get_order_keys() const {
+    std::vector<OrderKey> order_keys;
+    std::lock_guard<std::mutex> get_order_keys_lock_guard(client_active_orders_mutex_);
+
+    order_keys.reserve(orders_.size());
+    for (const auto& [order_id, order] : orders_) {
+        order_keys.emplace_back(order_id, order.type());
+    }
+    return order_keys;
+}
+
+Serialize::ActiveOrders ClientActiveOrders::get_active_orders() const {
+    Serialize::ActiveOrders client_active_orders;
+    std::lock_guard<std::mutex> get_active_orders_lock_guard(client_active_orders_mutex_);
+
+    for (const auto& [order_id, order] : orders_) {
+        if (order.type() == Serialize::TradeOrder::BUY) {
+            *client_active_orders.add_active_buy_orders() = order;
+        } else {
+            *client_active_orders.add_active_sell_orders() = order;
+        }
+    }
+
+    return client_active_orders;
+}
@@ -5,72 +5,188 @@
 #include <unordered_map>
 #include <shared_mutex>
 #include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "common.hpp"
 #include "time_order_utils.hpp"
 #include "order_queue.hpp"
+#include "stage_latencies.hpp"
+#include "metric_counters.hpp"
+#include "ring_buffer.hpp"
+#include "account_balance.hpp"
+#include "risk_engine.hpp"
+#include "order_book.hpp"
 #include "core.hpp"
 #include "session_manager.hpp"
 #include "trade_market_protocol.pb.h"
 
 #define AMOUNT_LAST_COMPLETED_OREDRS 100
 #define AMOUNT_QUOTE_HISTORY 1000
+#define AMOUNT_LAST_TRADES 1000
+#define MAX_RECORD_USERNAME_LENGTH 31
+#define CLIENT_DATA_SHARDS_COUNT 16
+
+//*INFO: Flat copies of protobuf messages for lock-free RingBuffer, username longer than limit is truncated
+struct CompletedOrderRecord {
+    int64_t order_id;
+    int64_t timestamp;
+    double usd_cost;
+    int32_t usd_amount;
+    int32_t usd_volume;
+    Serialize::TradeOrder::TradeType type;
+    char username[MAX_RECORD_USERNAME_LENGTH + 1];
+};
+
+struct QuoteRecord {
+    int64_t timestamp;
+    double price;
+};
+
+struct ExecutionRecord {
+    int64_t trade_id;
+    int64_t maker_order_id;
+    int64_t taker_order_id;
+    int64_t timestamp;
+    double price;
+    int32_t usd_amount;
+    Serialize::TradeOrder::TradeType aggressor_side;
+};
 
 //*INFO: Forward declaration
 class SessionManager;
 class Core;
 
+//*INFO: Per-account index of own active orders with its own lock,
+//*INFO: so "my orders" queries cost O(own orders) and never touch global maps
+class ClientActiveOrders {
+public:
+    void add_order(const Serialize::TradeOrder& order);
+    void update_order_usd_amount(int64_t order_id, int32_t transaction_amount);
+    void remove_order(int64_t order_id);
+    bool contains_order(int64_t order_id) const;
+    std::vector<OrderKey> get_order_keys() const;
+    Serialize::ActiveOrders get_active_orders() const;
+
+private:
+    mutable std::mutex client_active_orders_mutex_;
+    std::unordered_map<int64_t, Serialize::TradeOrder> orders_;
+};
+
+//*INFO: Accounts with their active orders partitioned by username hash. Each shard has its own lock,
+//*INFO: so balance read of one client never waits behind fill of clients from other shards
+struct alignas(64) ClientDataShard {
+    mutable std::shared_mutex shard_mutex;
+
+    std::unordered_map<std::string, std::shared_ptr<AccountBalanceSlot>> clients_balances;
+    std::unordered_map<int64_t, Serialize::TradeOrder> active_buy_orders;
+    std::unordered_map<int64_t, Serialize::TradeOrder> active_sell_orders;
+    std::unordered_map<std::string, std::shared_ptr<ClientActiveOrders>> clients_active_orders;
+};
+
 class ClientDataManager {
 public:
-    ClientDataManager(std::shared_ptr<SessionManager> session_manager);
+    ClientDataManager(std::shared_ptr<SessionManager> session_manager, size_t shards_count = CLIENT_DATA_SHARDS_COUNT);
 
     void initialize_from_database();
 
     //*INFO: Core operations
+    bool update_active_order_displayed_amount(const Serialize::TradeOrder& order);
     bool update_active_order_usd_amount(const Serialize::TradeOrder& order, int32_t transaction_amount);
     bool change_client_balances_according_match(const std::string& client_sell, const std::string& client_buy,
-                               int32_t transaction_amount, double transaction_cost);
+                               int32_t transaction_amount, double transaction_cost,
+                               double sell_order_usd_cost, double buy_order_usd_cost);
     bool change_client_balance(const std::string& client_username, change_balance_type_t change_balance_type,
                                wallet_type_t wallet_type, double amount);
-    bool update_clients_balances_in_db(const std::string& client_sell, const std::string& client_buy);
+    bool update_clients_balances_in_db(const std::string& client_sell, const AccountBalanceSlot& sell_account_balance,
+                                       const std::string& client_buy, const AccountBalanceSlot& buy_account_balance);
     bool add_order_to_completed(const Serialize::TradeOrder& completed_order);
-    bool remove_order_from_active_orders(int64_t order_id, Serialize::TradeOrder::TradeType type);
+    void add_execution(const Serialize::Execution& execution);
+    bool save_executions_to_db(const std::vector<Serialize::Execution>& executions);
+    bool remove_order_from_active_orders(int64_t order_id, Serialize::TradeOrder::TradeType type,
+                                         const std::string& client_username);
+    std::shared_ptr<ClientActiveOrders> get_or_create_client_active_orders(const std::string& client_username);
+
+    static CompletedOrderRecord to_completed_order_record(const Serialize::TradeOrder& completed_order);
+    static Serialize::TradeOrder from_completed_order_record(const CompletedOrderRecord& record);
+    static QuoteRecord to_quote_record(const Serialize::Quote& quote);
+    static Serialize::Quote from_quote_record(const QuoteRecord& record);
+    static ExecutionRecord to_execution_record(const Serialize::Execution& execution);
+    static Serialize::TradeOrder to_public_active_order(const Serialize::TradeOrder& order);
+    static Serialize::Execution from_execution_record(const ExecutionRecord& record);
 
     //*INFO: SessionClientConnection operations
     void create_new_client_fund_data(std::string new_key);
     void push_order_to_active_orders(const Serialize::TradeOrder& order);
+    risk_check_result_t check_and_reserve_order(Serialize::TradeOrder& order);
+    //*INFO: Slot cached by session at sign-in, no shard lock is taken on order path
+    risk_check_result_t check_and_reserve_order(Serialize::TradeOrder& order, AccountBalanceSlot& account_balance);
+    void release_unfilled_order(const Serialize::TradeOrder& order);
+    //*INFO: Avalible only on core thread, order already has canceled_amount taken off
+    void release_canceled_amount(const Serialize::TradeOrder& order, int32_t canceled_amount);
+    void set_risk_limits(const RiskLimits& limits);
 
     Serialize::AccountBalance get_client_balance(const std::string& client_username) const;
+    std::shared_ptr<const AccountBalanceSlot> get_account_balance_slot(const std::string& client_username) const;
+    //*INFO: Writable slot for risk checks, cached by session at sign-in
+    std::shared_ptr<AccountBalanceSlot> get_risk_account_balance_slot(const std::string& client_username) const;
     Serialize::ActiveOrders get_all_active_oreders();
+    std::shared_ptr<ClientActiveOrders> get_client_active_orders_index(const std::string& client_username);
     Serialize::CompletedOredrs get_last_completed_oreders();
     Serialize::QuoteHistory get_quote_history();
+    Serialize::Trades get_last_trades();
+    double get_last_trade_price() const;
 
     bool cancel_active_order(trade_type_t trade_type, int64_t order_id, const std::string& client_username);
+    //*INFO: Returns count of cancelled orders
+    size_t cancel_all_active_orders(const std::string& client_username, Serialize::CancelAllOrders::Side side);
+    bool modify_active_order(const Serialize::ModifyTradeOrder& modify_order, const std::string& client_username,
+                             risk_check_result_t& risk_check_result);
+    //*INFO: Avalible only under core_mutex_
+    risk_check_result_t check_and_modify_order_reservation(const Serialize::TradeOrder& order, double new_usd_cost, int32_t new_usd_amount);
 
     //*INFO: Condition variables notifications
     void notify_order_received();
     void notify_to_stop_matching_orders();
+    //*INFO: Book was changed outside of stock loop (modify), matcher runs a pass even with empty order queues
+    void request_matching_pass();
     //*INFO: Avalible only on core thread
     void stock_loop_wait_for_orders(std::shared_ptr<SessionManager> session_manager);
+    void stock_loop_wait_for_orders_until(std::shared_ptr<SessionManager> session_manager,
+                                          std::chrono::steady_clock::time_point deadline);
 
     //*INFO: Orders queue operations
     bool is_empty_order_queue(trade_type_t trade_type);
-    bool push_order_to_order_queue(trade_type_t trade_type, const Serialize::TradeOrder& order);
-    bool pop_order_from_order_queue(trade_type_t trade_type, Serialize::TradeOrder& order);
+    //*INFO: receive_time - when order was read from socket, enqueue time is taken here
+    bool push_order_to_order_queue(trade_type_t trade_type, const Serialize::TradeOrder& order, int64_t receive_time);
+    bool pop_order_from_order_queue(trade_type_t trade_type, QueuedOrder& queued_order);
+    size_t get_order_queue_size(trade_type_t trade_type) const;
 
 private:
-    mutable std::shared_mutex client_data_mutex_;
+    void restore_order_reservation(const Serialize::TradeOrder& order);
+    std::shared_ptr<AccountBalanceSlot> find_account_balance_slot(const std::string& client_username) const;
+    ClientDataShard& get_shard(const std::string& client_username);
+    const ClientDataShard& get_shard(const std::string& client_username) const;
 
-    std::unordered_map<std::string, Serialize::AccountBalance> clients_funds_data_; 
-    std::unordered_map<int64_t, Serialize::TradeOrder> active_buy_orders_;
-    std::unordered_map<int64_t, Serialize::TradeOrder> active_sell_orders_;
-    std::deque<Serialize::TradeOrder> completed_orders_;
-    std::deque<Serialize::Quote> quote_history_;
+private:
+    std::vector<ClientDataShard> shards_;
+    //*INFO: Written only by core thread, read by sessions without shard locks
+    RingBuffer<CompletedOrderRecord, AMOUNT_LAST_COMPLETED_OREDRS> completed_orders_;
+    RingBuffer<QuoteRecord, AMOUNT_QUOTE_HISTORY> quote_history_;
+    RingBuffer<ExecutionRecord, AMOUNT_LAST_TRADES> trades_;
 
     std::shared_ptr<SessionManager> session_manager_;
+    std::shared_ptr<RiskEngine> risk_engine_;
+    //*INFO: Kept here, shard locks and order pushes must not touch reference counter of session manager getters
+    std::shared_ptr<StageLatencies> stage_latencies_;
+    std::shared_ptr<MetricCounters> metric_counters_;
 
     std::condition_variable order_queue_cv_;
     std::mutex order_queue_cv_mutex_;
+    //*INFO: Guarded by order_queue_cv_mutex_, reset by stock loop when it wakes up
+    bool is_matching_pass_requested_ = false;
     std::shared_ptr<OrderQueue> buy_orders_queue_;
     std::shared_ptr<OrderQueue> sell_orders_queue_;
 };
@@ -1,20 +1,66 @@
 #include "core.hpp"
 
-Core::Core(std::shared_ptr<SessionManager> session_manager) : session_manager_(session_manager) {
+Core::Core(std::shared_ptr<SessionManager> session_manager) : self_trade_prevention_mode_(STP_NONE),
+                                                              is_call_phase_(false),
+                                                              auction_interval_(0),
+                                                              expiry_wheel_(ORDER_EXPIRY_TICK_MS, TimeOrderUtils::get_current_timestamp()),
+                                                              traded_price_low_(0.0),
+                                                              traded_price_high_(0.0),
+                                                              candle_aggregator_(session_manager->get_database()),
+                                                              last_persist_lag_ns_(0),
+                                                              session_manager_(session_manager),
+                                                              stage_latencies_(session_manager->get_stage_latencies()),
+                                                              metric_counters_(session_manager->get_metric_counters()) {
+}
+
+void Core::set_self_trade_prevention_mode(self_trade_prevention_mode_t mode) {
+    self_trade_prevention_mode_ = mode;
+}
+
+self_trade_prevention_mode_t Core::self_trade_prevention_mode_from_string(const std::string& mode) {
+    if (mode == "cancel_newest") {
+        return STP_CANCEL_NEWEST;
+    }
+    if (mode == "cancel_oldest") {
+        return STP_CANCEL_OLDEST;
+    }
+    if (mode == "decrement_both") {
+        return STP_DECREMENT_BOTH;
+    }
+    if (mode != "none") {
+        spdlog::error("Unknown self trade prevention mode '{}', self trades are allowed", mode);
+    }
+    return STP_NONE;
+}
+
+void Core::set_auction_schedule(uint32_t auction_interval_ms, uint32_t opening_auction_ms) {
+    auction_interval_ = std::chrono::milliseconds(auction_interval_ms);
+    is_call_phase_ = (auction_interval_ms > 0 || opening_auction_ms > 0);
+
+    uint32_t first_uncross_ms = (opening_auction_ms > 0) ? opening_auction_ms : auction_interval_ms;
+    next_uncross_time_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(first_uncross_ms);
 }
 
 void Core::save_all_active_orders_to_db() {
+    save_active_orders_to_db(orders_book_.get_orders(Serialize::TradeOrder::BUY));
+    save_active_orders_to_db(orders_book_.get_orders(Serialize::TradeOrder::SELL));
+
+    //*INFO: Stop orders are saved with active orders, order_type tells them apart on load
+    save_active_orders_to_db(stop_orders_.get_orders(Serialize::TradeOrder::BUY));
+    save_active_orders_to_db(stop_orders_.get_orders(Serialize::TradeOrder::SELL));
+}
+
+//*INFO: Runs at shutdown, one failed order must not lose the rest of the book
+void Core::save_active_orders_to_db(const std::vector<Serialize::TradeOrder>& orders) {
     auto database = session_manager_->get_database();
 
-    while (!buy_orders_book_.empty()) {
-        database->save_active_order_to_db(buy_orders_book_.top());
-        buy_orders_book_.pop();
+    for (const auto& order : orders) {
+        try {
+            database->save_active_order_to_db(order);
+        } catch (const std::exception& e) {
+            spdlog::error("Failed to save active order id:{} to db: {}", order.order_id(), e.what());
+        }
     }
-
-    while (!sell_orders_book_.empty()) {
-        database->save_active_order_to_db(sell_orders_book_.top());
-        sell_orders_book_.pop();        
-    }   
 }
 
 void Core::load_all_active_orders_from_db() {
@@ -22,107 +68,547 @@ void Core::load_all_active_orders_from_db() {
 
     auto active_buy_orders = database->load_active_orders_from_db(Serialize::TradeOrder::BUY);
     for (const auto& order : active_buy_orders) {
-        buy_orders_book_.push(order);
+        restore_active_order(order);
     }
 
     auto active_sell_orders = database->load_active_orders_from_db(Serialize::TradeOrder::SELL);
     for (const auto& order : active_sell_orders) {
-        sell_orders_book_.push(order);
+        restore_active_order(order);
     }
+    market_depth_.publish();
+}
+
+void Core::restore_active_order(Serialize::TradeOrder order) {
+    assign_account_id(order);
+
+    if (StopOrderIndex::is_stop_order(order)) {
+        place_order_to_stop_orders(order);
+        return;
+    }
+    place_order_to_book(order);
+}
+
+void Core::assign_account_id(Serialize::TradeOrder& order) {
+    auto account_id_iterator = account_ids_.try_emplace(order.username(), static_cast<uint32_t>(account_ids_.size() + 1)).first;
+    order.set_account_id(account_id_iterator->second);
+}
+
+void Core::load_candles_from_db() {
+    candle_aggregator_.load_candles_from_db();
 }
 
 //*INFO matching orders thread
 void Core::stock_loop() {
+    auto wake_up_time = std::chrono::steady_clock::time_point::max();
+    {
+        auto match_engine_unique_lock = stage_latencies_->lock_and_record_wait(core_mutex_, LOCK_WAIT_CORE);
+        wake_up_time = get_next_wake_up_time();
+    }
 
     while (session_manager_->is_runnig()) {
 
         auto client_data_manager = session_manager_->get_client_data_manager();
-        client_data_manager->stock_loop_wait_for_orders(session_manager_);
+        if (wake_up_time != std::chrono::steady_clock::time_point::max()) {
+            client_data_manager->stock_loop_wait_for_orders_until(session_manager_, wake_up_time);
+        } else {
+            client_data_manager->stock_loop_wait_for_orders(session_manager_);
+        }
 
-        std::lock_guard<std::mutex> match_engine_lock_guard(core_mutex_);
+        auto match_engine_unique_lock = stage_latencies_->lock_and_record_wait(core_mutex_, LOCK_WAIT_CORE);
 
         complement_order_books();
 
         if (!session_manager_->is_runnig()) { 
             save_all_active_orders_to_db();
+            candle_aggregator_.save_open_candles_to_db();
             break;
         }
 
         process_orders();
+        expire_orders(TimeOrderUtils::get_current_timestamp());
+
+        if (is_call_phase_ && std::chrono::steady_clock::now() >= next_uncross_time_) {
+            uncross_auction();
+        }
+
+        wake_up_time = get_next_wake_up_time();
+    }
+}
+
+//*INFO: Matching thread sleeps until new order, next uncross or tick of nearest non-empty expiry wheel slot
+std::chrono::steady_clock::time_point Core::get_next_wake_up_time() const {
+    auto wake_up_time = std::chrono::steady_clock::time_point::max();
+
+    if (!expiry_wheel_.empty()) {
+        int64_t time_to_next_expiry = std::max<int64_t>(expiry_wheel_.get_next_expiry_time() - TimeOrderUtils::get_current_timestamp(), 0);
+        wake_up_time = std::chrono::steady_clock::now() + std::chrono::milliseconds(time_to_next_expiry);
+    }
+    if (is_call_phase_) {
+        wake_up_time = std::min(wake_up_time, next_uncross_time_);
     }
+    return wake_up_time;
 }
 
 void Core::complement_order_books() {
     auto client_data_manager = session_manager_->get_client_data_manager();
 
     while(!client_data_manager->is_empty_order_queue(BUY)) {
-            Serialize::TradeOrder buy_order;
-            client_data_manager->pop_order_from_order_queue(BUY, buy_order);
+            QueuedOrder queued_buy_order;
+            client_data_manager->pop_order_from_order_queue(BUY, queued_buy_order);
 
-            place_order_to_priority_queue(buy_order);
+            accept_queued_order(queued_buy_order);
         }
         while (!client_data_manager->is_empty_order_queue(SELL)) {
-            Serialize::TradeOrder sell_order;
-            client_data_manager->pop_order_from_order_queue(SELL, sell_order);
+            QueuedOrder queued_sell_order;
+            client_data_manager->pop_order_from_order_queue(SELL, queued_sell_order);
 
-            place_order_to_priority_queue(sell_order);
+            accept_queued_order(queued_sell_order);
         }
 }
 
-void Core::place_order_to_priority_queue(const Serialize::TradeOrder& order) {
-    if (order.type() == Serialize::TradeOrder::BUY) {
-        buy_orders_book_.push(order);
+void Core::accept_queued_order(QueuedOrder& queued_order) {
+    int64_t dequeue_time = StageLatencies::now_ns();
+    stage_latencies_->record(STAGE_QUEUE_WAIT, queued_order.enqueue_time, dequeue_time);
+
+    accept_incoming_order(queued_order.order);
+
+    int64_t match_time = StageLatencies::now_ns();
+    stage_latencies_->record(STAGE_MATCH, dequeue_time, match_time);
+    if (queued_order.receive_time != 0) {
+        pending_stage_times_.push_back(OrderStageTimes{queued_order.receive_time, match_time});
+    }
+}
+
+//*INFO: Orders matched in this pass are persisted together with executions flush
+void Core::record_persist_stages() {
+    if (pending_stage_times_.empty()) {
+        return;
+    }
+
+    int64_t persist_time = StageLatencies::now_ns();
+    for (const auto& order_stage_times : pending_stage_times_) {
+        stage_latencies_->record(STAGE_PERSIST, order_stage_times.match_time, persist_time);
+        stage_latencies_->record(STAGE_RECEIVE_TO_PERSIST, order_stage_times.receive_time, persist_time);
+    }
+    last_persist_lag_ns_.store(persist_time - pending_stage_times_.front().match_time, std::memory_order_relaxed);
+    pending_stage_times_.clear();
+}
+
+//*INFO: Stop order waits for trigger, others are matched. Trades of either may trigger stop orders
+void Core::accept_incoming_order(Serialize::TradeOrder& order) {
+    assign_account_id(order);
+
+    if (StopOrderIndex::is_stop_order(order)) {
+        place_order_to_stop_orders(order);
     } else {
-        sell_orders_book_.push(order);
+        match_incoming_order(order);
+    }
+
+    activate_triggered_stop_orders();
+}
+
+//*INFO: GTC/GTD/DAY limit order rests in book and crosses it, market/IOC/FOK orders are matched on arrival and never rest.
+//*INFO: In call phase only resting limit order is accepted, it rests until uncross
+void Core::match_incoming_order(Serialize::TradeOrder& order) {
+    if (is_call_phase_) {
+        if (OrderBook::is_resting_order(order)) {
+            place_order_to_book(order);
+            return;
+        }
+        spdlog::info("Order id={} cancelled: immediate orders are not accepted in call auction", order.order_id());
+        cancel_unfilled_order(order);
+        return;
+    }
+
+    if (OrderBook::is_resting_order(order)) {
+        place_order_to_book(order);
+        match_crossing_orders();
+        return;
+    }
+
+    execute_immediate_order(order);
+}
+
+void Core::place_order_to_book(const Serialize::TradeOrder& order, bool is_expiry_scheduled) {
+    const Serialize::TradeOrder* placed_order = orders_book_.add_order(order);
+    if (placed_order == nullptr) {
+        spdlog::error("Order id={} is already in orders book", order.order_id());
+        return;
+    }
+    market_depth_.add_order(order.type(), order.usd_cost(), OrderBook::get_displayed_amount(*placed_order));
+
+    if (!is_expiry_scheduled && OrderBook::is_expiring_order(order)) {
+        expiry_wheel_.schedule(order.order_id(), order.type(), order.expire_time());
+    }
+}
+
+void Core::place_order_to_stop_orders(const Serialize::TradeOrder& order) {
+    if (!stop_orders_.add_order(order)) {
+        spdlog::error("Order id={} is already in stop orders", order.order_id());
+        return;
+    }
+
+    if (OrderBook::is_expiring_order(order)) {
+        expiry_wheel_.schedule(order.order_id(), order.type(), order.expire_time());
+    }
+}
+
+//*INFO: Called under core_mutex_. Triggered stop order has timer of stop index and of book, extra one finds nothing
+void Core::expire_orders(int64_t current_time) {
+    std::vector<TimerWheel::Timer> expired_timers;
+    expiry_wheel_.advance(current_time, expired_timers);
+
+    bool is_expired = false;
+    for (const auto& timer : expired_timers) {
+        Serialize::TradeOrder expired_order;
+        if (!remove_expired_order(timer, current_time, expired_order)) {
+            continue;
+        }
+
+        spdlog::info("Order id={} expired", expired_order.order_id());
+        cancel_unfilled_order(expired_order);
+        is_expired = true;
+    }
+
+    if (is_expired) {
+        market_depth_.publish();
+    }
+}
+
+bool Core::remove_expired_order(const TimerWheel::Timer& timer, int64_t current_time, Serialize::TradeOrder& expired_order) {
+    const Serialize::TradeOrder* stop_order = stop_orders_.find_order(timer.order_id, timer.type);
+    if (stop_order != nullptr) {
+        return stop_order->expire_time() <= current_time &&
+               stop_orders_.remove_order(timer.order_id, timer.type, expired_order);
+    }
+
+    const Serialize::TradeOrder* order = orders_book_.find_order(timer.order_id, timer.type);
+    if (order == nullptr || order->expire_time() > current_time) {
+        return false;
+    }
+
+    int32_t displayed_amount = OrderBook::get_displayed_amount(*order);
+    orders_book_.remove_order(timer.order_id, timer.type, expired_order);
+    market_depth_.remove_quantity(expired_order.type(), expired_order.usd_cost(), displayed_amount, true);
+    return true;
+}
+
+//*INFO: Trigger range is all prices traded since previous activation plus last trade price, so stop
+//*INFO: crossed inside a sweep or already crossed on arrival is triggered too. Activated orders may trade
+//*INFO: and trigger next stops, loop runs until trigger range stops growing
+void Core::activate_triggered_stop_orders() {
+    double last_trade_price = session_manager_->get_client_data_manager()->get_last_trade_price();
+    if (last_trade_price <= 0.0 || stop_orders_.size() == 0) {
+        traded_price_low_ = traded_price_high_ = 0.0;
+        return;
+    }
+
+    std::vector<Serialize::TradeOrder> triggered_orders;
+    while (true) {
+        double low_trade_price = (traded_price_low_ > 0.0) ? std::min(traded_price_low_, last_trade_price) : last_trade_price;
+        double high_trade_price = std::max(traded_price_high_, last_trade_price);
+        traded_price_low_ = traded_price_high_ = 0.0;
+
+        if (!stop_orders_.pop_triggered_orders(low_trade_price, high_trade_price, triggered_orders)) {
+            break;
+        }
+
+        for (auto& order : triggered_orders) {
+            spdlog::info("Stop order id={} triggered at stop price {}", order.order_id(), order.stop_price());
+            StopOrderIndex::activate_order(order, TimeOrderUtils::get_current_timestamp());
+            match_incoming_order(order);
+        }
+        triggered_orders.clear();
+
+        last_trade_price = session_manager_->get_client_data_manager()->get_last_trade_price();
     }
 }
 
 //*INFO: Matching engine
 void Core::process_orders() {
+    if (!is_call_phase_) {
+        match_crossing_orders();
+    }
+    activate_triggered_stop_orders();
+
+    market_depth_.publish();
+    flush_pending_executions();
+    record_persist_stages();
+}
+
+//*INFO: Crosses best resting orders while prices intersect, the older order of the pair is the maker
+void Core::match_crossing_orders() {
+
+    while (true) {
+        Serialize::TradeOrder* buy_order = orders_book_.get_best_order(Serialize::TradeOrder::BUY);
+        Serialize::TradeOrder* sell_order = orders_book_.get_best_order(Serialize::TradeOrder::SELL);
+        if (buy_order == nullptr || sell_order == nullptr) {
+            break;
+        }
+
+        if (OrderBook::to_price_key(buy_order->usd_cost()) < OrderBook::to_price_key(sell_order->usd_cost())) {
+            break;
+        }
+
+        bool is_buy_aggressor = orders_book_.is_newer_order(*buy_order, *sell_order);
+        if (is_self_trade(*buy_order, *sell_order)) {
+            prevent_self_trade_in_book(is_buy_aggressor ? *buy_order : *sell_order, is_buy_aggressor ? *sell_order : *buy_order);
+            continue;
+        }
+
+        //*INFO: Maker gives only its displayed part, taker may take more than it shows
+        int32_t sell_displayed_amount = OrderBook::get_displayed_amount(*sell_order);
+        int32_t buy_displayed_amount = OrderBook::get_displayed_amount(*buy_order);
+        int32_t transaction_amount = std::min(is_buy_aggressor ? sell_displayed_amount : sell_order->usd_amount(),
+                                              is_buy_aggressor ? buy_order->usd_amount() : buy_displayed_amount);
+
+        double transaction_price = is_buy_aggressor ? sell_order->usd_cost() : buy_order->usd_cost();
+        if (!match_orders(*sell_order, *buy_order, transaction_amount, transaction_price, is_buy_aggressor)) {
+            spdlog::error("Error to match orders: BUY {} SELL {}",
+                                        buy_order->username(), sell_order->username());
+        }
+
+        finish_resting_order_fill(*sell_order, sell_displayed_amount);
+        finish_resting_order_fill(*buy_order, buy_displayed_amount);
+    }
+}
+
+//*INFO: Uncross of call phase. Periodic auction stays in call phase till next uncross, opening auction switches to continuous
+void Core::uncross_auction() {
+    int64_t reference_price_key = OrderBook::to_price_key(session_manager_->get_client_data_manager()->get_last_trade_price());
+    int64_t clearing_price_key = 0;
+    int64_t clearing_volume = orders_book_.find_clearing_price(reference_price_key, clearing_price_key);
 
-    while (!buy_orders_book_.empty() && !sell_orders_book_.empty()) {
-        Serialize::TradeOrder buy_order = buy_orders_book_.top();
-        buy_orders_book_.pop(); 
-        Serialize::TradeOrder sell_order = sell_orders_book_.top();
-        sell_orders_book_.pop();
+    if (clearing_volume > 0) {
+        spdlog::info("Auction uncross: price {} volume {}",
+                     static_cast<double>(clearing_price_key) / PRICE_KEY_SCALE, clearing_volume);
+        match_at_clearing_price(clearing_price_key);
+    }
+
+    if (auction_interval_.count() > 0) {
+        next_uncross_time_ = std::chrono::steady_clock::now() + auction_interval_;
+    } else {
+        is_call_phase_ = false;
+    }
+
+    activate_triggered_stop_orders();
+    market_depth_.publish();
+    flush_pending_executions();
+}
+
+//*INFO: Every order priced at or through clearing price trades at it, whole amount of iceberg takes part
+void Core::match_at_clearing_price(int64_t clearing_price_key) {
+    const double clearing_price = static_cast<double>(clearing_price_key) / PRICE_KEY_SCALE;
+
+    while (true) {
+        Serialize::TradeOrder* buy_order = orders_book_.get_best_order(Serialize::TradeOrder::BUY);
+        Serialize::TradeOrder* sell_order = orders_book_.get_best_order(Serialize::TradeOrder::SELL);
+        if (buy_order == nullptr || sell_order == nullptr) {
+            break;
+        }
+
+        if (OrderBook::to_price_key(buy_order->usd_cost()) < clearing_price_key ||
+            OrderBook::to_price_key(sell_order->usd_cost()) > clearing_price_key) {
+            break;
+        }
+
+        bool is_buy_aggressor = orders_book_.is_newer_order(*buy_order, *sell_order);
+        if (is_self_trade(*buy_order, *sell_order)) {
+            prevent_self_trade_in_book(is_buy_aggressor ? *buy_order : *sell_order, is_buy_aggressor ? *sell_order : *buy_order);
+            continue;
+        }
+
+        int32_t sell_displayed_amount = OrderBook::get_displayed_amount(*sell_order);
+        int32_t buy_displayed_amount = OrderBook::get_displayed_amount(*buy_order);
+        int32_t transaction_amount = std::min(sell_order->usd_amount(), buy_order->usd_amount());
+
+        if (!match_orders(*sell_order, *buy_order, transaction_amount, clearing_price, is_buy_aggressor)) {
+            spdlog::error("Error to match orders in auction: BUY {} SELL {}",
+                                        buy_order->username(), sell_order->username());
+        }
+
+        finish_resting_order_fill(*sell_order, sell_displayed_amount);
+        finish_resting_order_fill(*buy_order, buy_displayed_amount);
+    }
+}
 
-        if (buy_order.usd_cost() > sell_order.usd_cost() || std::fabs(buy_order.usd_cost() - sell_order.usd_cost()) < EPSILON) {
+//*INFO: Called for best order of its side after fill. Filled order leaves book, exhausted iceberg peak
+//*INFO: is replenished from hidden reserve and goes to the end of its price level like a new order
+void Core::finish_resting_order_fill(Serialize::TradeOrder& order, int32_t displayed_amount_before_fill) {
+    const auto type = order.type();
+    int32_t displayed_amount = OrderBook::get_displayed_amount(order);
+    market_depth_.remove_quantity(type, order.usd_cost(), displayed_amount_before_fill - displayed_amount, displayed_amount == 0);
+
+    if (order.usd_amount() == 0) {
+        move_order_to_completed_orders(order);
+        orders_book_.pop_best_order(type);
+        return;
+    }
+
+    if (displayed_amount == 0) {
+        order.set_displayed_amount(std::min(order.peak_amount(), order.usd_amount()));
+        order.set_timestamp(TimeOrderUtils::get_current_timestamp());
+        market_depth_.add_order(type, order.usd_cost(), order.displayed_amount());
+        session_manager_->get_client_data_manager()->update_active_order_displayed_amount(order);
+        orders_book_.requeue_best_order(type);
+    }
+}
 
-            if (!match_orders(sell_order, buy_order)) {
-                spdlog::error("Error to match orders: BUY {} SELL {}",
-                                            buy_order.username(), sell_order.username());
+//*INFO: Incoming order is always the taker. Market order with usd_cost 0 accepts any price,
+//*INFO: otherwise usd_cost is the worst price it may trade at. Unfilled rest is cancelled, nothing rests in book
+void Core::execute_immediate_order(Serialize::TradeOrder& order) {
+    const bool is_buy = (order.type() == Serialize::TradeOrder::BUY);
+    const auto resting_type = is_buy ? Serialize::TradeOrder::SELL : Serialize::TradeOrder::BUY;
+    const bool is_price_limited = (order.order_type() == Serialize::TradeOrder::LIMIT || order.usd_cost() > 0.0);
+
+    //*INFO: FOK counts only what it can fill. Own resting orders never fill it, cancel-newest and
+    //*INFO: decrement-both also cut it off at first own order
+    uint32_t self_account_id = (self_trade_prevention_mode_ != STP_NONE) ? order.account_id() : 0;
+    bool is_stopped_by_self_order = (self_trade_prevention_mode_ == STP_CANCEL_NEWEST ||
+                                     self_trade_prevention_mode_ == STP_DECREMENT_BOTH);
+    if (order.time_in_force() == Serialize::TradeOrder::FOK &&
+        orders_book_.get_available_amount(resting_type, order.usd_cost(), is_price_limited, order.usd_amount(),
+                                          self_account_id, is_stopped_by_self_order) < order.usd_amount()) {
+        spdlog::info("FOK order id={} killed: not enough liquidity for amount {}", order.order_id(), order.usd_amount());
+        cancel_unfilled_order(order);
+        return;
+    }
+
+    while (order.usd_amount() > 0) {
+        Serialize::TradeOrder* resting_order = orders_book_.get_best_order(resting_type);
+        if (resting_order == nullptr) {
+            break;
+        }
+
+        if (is_price_limited) {
+            int64_t order_price_key = OrderBook::to_price_key(order.usd_cost());
+            int64_t resting_price_key = OrderBook::to_price_key(resting_order->usd_cost());
+            if (is_buy ? (order_price_key < resting_price_key) : (order_price_key > resting_price_key)) {
+                break;
             }
+        }
+
+        int32_t resting_displayed_amount = OrderBook::get_displayed_amount(*resting_order);
+        int32_t transaction_amount = std::min(order.usd_amount(), resting_displayed_amount);
 
-            if (buy_order.usd_amount() == 0) {
-                move_order_to_completed_orders(buy_order);
+        //*INFO: Cancelled taker rest is handled after loop, decremented to nothing taker is already closed
+        if (is_self_trade(order, *resting_order)) {
+            if (self_trade_prevention_mode_ == STP_CANCEL_NEWEST) {
+                break;
             }
-            if (sell_order.usd_amount() == 0) {
-                move_order_to_completed_orders(sell_order);
+            if (self_trade_prevention_mode_ == STP_CANCEL_OLDEST) {
+                cancel_resting_order_amount(*resting_order, resting_order->usd_amount());
+                continue;
             }
 
-            if (buy_order.usd_amount() > 0) {
-                buy_orders_book_.push(buy_order);
-            }
-            if (sell_order.usd_amount() > 0) {
-                sell_orders_book_.push(sell_order);
+            cancel_order_amount(order, transaction_amount);
+            cancel_resting_order_amount(*resting_order, transaction_amount);
+            if (order.usd_amount() == 0) {
+                return;
             }
+            continue;
+        }
 
-        } else {
-            buy_orders_book_.push(buy_order);
-            sell_orders_book_.push(sell_order);
+        bool is_matched = is_buy ? match_orders(*resting_order, order, transaction_amount, resting_order->usd_cost(), true)
+                                 : match_orders(order, *resting_order, transaction_amount, resting_order->usd_cost(), false);
+        if (!is_matched) {
+            spdlog::error("Error to match incoming order id={} with resting order id={}",
+                                        order.order_id(), resting_order->order_id());
+        }
+
+        finish_resting_order_fill(*resting_order, resting_displayed_amount);
+    }
+
+    if (order.usd_amount() == 0) {
+        move_order_to_completed_orders(order);
+        return;
+    }
+    cancel_unfilled_order(order);
+}
+
+void Core::cancel_unfilled_order(Serialize::TradeOrder& order) {
+    cancel_order_amount(order, order.usd_amount());
+}
+
+//*INFO: Exchange side cancel of part of order, reservation of it is released. Order with nothing left is closed
+void Core::cancel_order_amount(Serialize::TradeOrder& order, int32_t canceled_amount) {
+    order.set_usd_amount(order.usd_amount() - canceled_amount);
+    if (OrderBook::is_iceberg_order(order)) {
+        order.set_displayed_amount(std::max(order.displayed_amount() - canceled_amount, 0));
+    }
+    session_manager_->get_client_data_manager()->release_canceled_amount(order, canceled_amount);
+
+    Serialize::ExecutionReport report;
+    report.set_order_id(order.order_id());
+    report.set_type(order.type());
+    report.set_remaining_amount(order.usd_amount());
+    report.set_canceled_amount(canceled_amount);
+    report.set_timestamp(TimeOrderUtils::get_current_timestamp());
+
+    session_manager_->push_execution_report(order.username(), report);
+}
+
+//*INFO: Called for best order of its side, order must not be used after it if nothing is left
+void Core::cancel_resting_order_amount(Serialize::TradeOrder& order, int32_t canceled_amount) {
+    const auto type = order.type();
+    int32_t displayed_amount_before_cancel = OrderBook::get_displayed_amount(order);
+    cancel_order_amount(order, canceled_amount);
+
+    if (order.usd_amount() == 0) {
+        market_depth_.remove_quantity(type, order.usd_cost(), displayed_amount_before_cancel, true);
+        orders_book_.pop_best_order(type);
+        return;
+    }
+    finish_resting_order_fill(order, displayed_amount_before_cancel);
+}
+
+bool Core::is_self_trade(const Serialize::TradeOrder& taker_order, const Serialize::TradeOrder& maker_order) const {
+    return self_trade_prevention_mode_ != STP_NONE && taker_order.account_id() != 0 &&
+           taker_order.account_id() == maker_order.account_id();
+}
+
+//*INFO: Both orders are best orders of their sides, at least one of them loses amount, so crossing loop always moves on
+void Core::prevent_self_trade_in_book(Serialize::TradeOrder& taker_order, Serialize::TradeOrder& maker_order) {
+    spdlog::info("Self trade prevented: account {} orders id={} and id={}",
+                 taker_order.username(), taker_order.order_id(), maker_order.order_id());
 
+    switch (self_trade_prevention_mode_) {
+        case STP_CANCEL_NEWEST: {
+            cancel_resting_order_amount(taker_order, taker_order.usd_amount());
+            break;
+        }
+        case STP_CANCEL_OLDEST: {
+            cancel_resting_order_amount(maker_order, maker_order.usd_amount());
+            break;
+        }
+        case STP_DECREMENT_BOTH: {
+            int32_t decrement_amount = std::min(taker_order.usd_amount(), OrderBook::get_displayed_amount(maker_order));
+            cancel_resting_order_amount(taker_order, decrement_amount);
+            cancel_resting_order_amount(maker_order, decrement_amount);
+            break;
+        }
+        case STP_NONE: {
             break;
         }
     }
 }
 
-bool Core::match_orders(Serialize::TradeOrder& sell_order, Serialize::TradeOrder& buy_order) {
+//*INFO: Trade price is the maker order price in continuous matching and clearing price in auction
+bool Core::match_orders(Serialize::TradeOrder& sell_order, Serialize::TradeOrder& buy_order,
+                        int32_t transaction_amount, double transaction_price, bool is_buy_aggressor) {
+
+    double transaction_cost = transaction_amount * transaction_price; //*INFO: RUB
 
-    int32_t transaction_amount = std::min(sell_order.usd_amount(), buy_order.usd_amount());
-    double transaction_cost = transaction_amount * buy_order.usd_cost(); //*INFO: RUB
+    traded_price_low_ = (traded_price_low_ > 0.0) ? std::min(traded_price_low_, transaction_price) : transaction_price;
+    traded_price_high_ = std::max(traded_price_high_, transaction_price);
 
     sell_order.set_usd_amount(sell_order.usd_amount() - transaction_amount);
     buy_order.set_usd_amount(buy_order.usd_amount() - transaction_amount);
+    for (Serialize::TradeOrder* order : {&sell_order, &buy_order}) {
+        if (OrderBook::is_iceberg_order(*order)) {
+            order->set_displayed_amount(std::max(order->displayed_amount() - transaction_amount, 0));
+        }
+    }
 
     if (!update_active_order_usd_amount_in_client_data_manager(sell_order, buy_order, transaction_amount, transaction_cost)) {
         spdlog::error("Error to update active order usd_amount: BUY {}, id={} . SELL {}, id={} . Amount: {} Cost: {}",
@@ -139,9 +625,49 @@ bool Core::match_orders(Serialize::TradeOrder& sell_order, Serialize::TradeOrder
 
     spdlog::info("Matched orders: BUY {} SELL {} - Amount: {} Cost: {}",
                         buy_order.username(), sell_order.username(), transaction_amount, transaction_cost);
+
+    Serialize::Execution execution = record_execution(sell_order, buy_order, transaction_amount, transaction_price, is_buy_aggressor);
+    candle_aggregator_.add_fill(execution.price(), transaction_amount, execution.timestamp());
+
+    send_execution_report(sell_order, execution, -transaction_amount, transaction_cost);
+    send_execution_report(buy_order, execution, transaction_amount, -transaction_cost);
     return true;
 }
 
+//*INFO: Resting order is the maker, the later one is the taker and its side is the aggressor side
+Serialize::Execution Core::record_execution(const Serialize::TradeOrder& sell_order, const Serialize::TradeOrder& buy_order,
+                                            int32_t transaction_amount, double price, bool is_buy_aggressor) {
+    const Serialize::TradeOrder& maker_order = is_buy_aggressor ? sell_order : buy_order;
+    const Serialize::TradeOrder& taker_order = is_buy_aggressor ? buy_order : sell_order;
+
+    Serialize::Execution execution;
+    execution.set_trade_id(TimeOrderUtils::generate_id());
+    execution.set_price(price);
+    execution.set_usd_amount(transaction_amount);
+    execution.set_aggressor_side(taker_order.type());
+    execution.set_maker_order_id(maker_order.order_id());
+    execution.set_taker_order_id(taker_order.order_id());
+    execution.set_timestamp(TimeOrderUtils::get_current_timestamp());
+    metric_counters_->increment(COUNTER_FILLS);
+
+    session_manager_->get_client_data_manager()->add_execution(execution);
+    pending_executions_.push_back(execution);
+
+    return execution;
+}
+
+//*INFO: Candles closed by pass are persisted with its executions, after candles lock is released
+void Core::flush_pending_executions() {
+    candle_aggregator_.save_closed_candles_to_db();
+
+    if (pending_executions_.empty()) {
+        return;
+    }
+
+    session_manager_->get_client_data_manager()->save_executions_to_db(pending_executions_);
+    pending_executions_.clear();
+}
+
 bool Core::update_active_order_usd_amount_in_client_data_manager (const Serialize::TradeOrder& sell_order, const Serialize::TradeOrder& buy_order,
                                 int32_t transaction_amount, double transaction_cost) {
     auto client_data_manager = session_manager_->get_client_data_manager();
@@ -159,7 +685,8 @@ bool Core::change_clients_balances(Serialize::TradeOrder& sell_order, Serialize:
 
     auto client_data_manager = session_manager_->get_client_data_manager();
     return client_data_manager->change_client_balances_according_match(sell_order.username(), buy_order.username(),
-                                                                            transaction_amount, transaction_cost);
+                                                                            transaction_amount, transaction_cost,
+                                                                            sell_order.usd_cost(), buy_order.usd_cost());
 }
 
 bool Core::move_order_to_completed_orders(Serialize::TradeOrder& completed_order) {
@@ -167,35 +694,134 @@ bool Core::move_order_to_completed_orders(Serialize::TradeOrder& completed_order
     return client_data_manager->add_order_to_completed(completed_order);
 }
 
-bool Core::remove_order_by_id(int64_t order_id, trade_type_t trade_type) {
-    std::lock_guard<std::mutex> remove_order_by_id_lock_guard(core_mutex_);
+void Core::send_execution_report(const Serialize::TradeOrder& order, const Serialize::Execution& execution,
+                                 double usd_balance_delta, double rub_balance_delta) {
+    Serialize::ExecutionReport report;
+    report.set_order_id(order.order_id());
+    report.set_type(order.type());
+    report.set_fill_amount(execution.usd_amount());
+    report.set_price(execution.price());
+    report.set_remaining_amount(order.usd_amount());
+    report.set_usd_balance_delta(usd_balance_delta);
+    report.set_rub_balance_delta(rub_balance_delta);
+    report.set_timestamp(execution.timestamp());
+    report.set_trade_id(execution.trade_id());
+
+    session_manager_->push_execution_report(order.username(), report);
+}
 
-    if (trade_type == BUY) {
-        return remove_from_queue(buy_orders_book_, order_id);
-    } else
-    if (trade_type == SELL) {
-        return remove_from_queue(sell_orders_book_, order_id);
-    } else {
+bool Core::remove_order_by_id(int64_t order_id, trade_type_t trade_type, Serialize::TradeOrder& removed_order) {
+    auto remove_order_by_id_unique_lock = stage_latencies_->lock_and_record_wait(core_mutex_, LOCK_WAIT_CORE);
+
+    auto type = (trade_type == BUY) ? Serialize::TradeOrder::BUY : Serialize::TradeOrder::SELL;
+    bool is_removed = remove_resting_order(order_id, type, removed_order);
+
+    if (is_removed) {
+        market_depth_.publish();
+    }
+    return is_removed;
+}
+
+void Core::remove_orders_by_ids(const std::vector<OrderKey>& order_keys, std::vector<Serialize::TradeOrder>& removed_orders) {
+    auto remove_orders_by_ids_unique_lock = stage_latencies_->lock_and_record_wait(core_mutex_, LOCK_WAIT_CORE);
+
+    size_t removed_before = removed_orders.size();
+    for (const auto& [order_id, type] : order_keys) {
+        Serialize::TradeOrder removed_order;
+        if (remove_resting_order(order_id, type, removed_order)) {
+            removed_orders.push_back(std::move(removed_order));
+        }
+    }
+
+    if (removed_orders.size() != removed_before) {
+        market_depth_.publish();
+    }
+}
+
+//*INFO: Called under core_mutex_, stop order is not in depth
+bool Core::remove_resting_order(int64_t order_id, Serialize::TradeOrder::TradeType type, Serialize::TradeOrder& removed_order) {
+    if (stop_orders_.remove_order(order_id, type, removed_order)) {
+        return true;
+    }
+
+    if (!orders_book_.remove_order(order_id, type, removed_order)) {
         return false;
     }
+    market_depth_.remove_quantity(removed_order.type(), removed_order.usd_cost(), OrderBook::get_displayed_amount(removed_order), true);
+    return true;
 }
 
-template<typename T, typename Container, typename Compare>
-bool Core::remove_from_queue(std::priority_queue<T, Container, Compare>& queue, int64_t order_id) {
+//*INFO: Applied under core_mutex_ between matching passes, so order is never seen half modified.
+//*INFO: Smaller amount at same price is changed in place and keeps queue position,
+//*INFO: new price or bigger amount re-enters book as newest order and may cross it
+bool Core::modify_order(const Serialize::ModifyTradeOrder& modify_order, risk_check_result_t& risk_check_result) {
+    auto modify_order_unique_lock = stage_latencies_->lock_and_record_wait(core_mutex_, LOCK_WAIT_CORE);
 
-    std::priority_queue<T, Container, Compare> temp_queue;
-    bool found = false;
+    Serialize::TradeOrder* order = orders_book_.find_order(modify_order.order_id(), modify_order.type());
+    if (order == nullptr) {
+        return false;
+    }
 
-    while (!queue.empty()) {
-        const auto& order = queue.top();
-        if (order.order_id() != order_id) {
-            temp_queue.push(std::move(const_cast<T&>(order)));
-        } else {
-            found = true;
+    auto client_data_manager = session_manager_->get_client_data_manager();
+    risk_check_result = client_data_manager->check_and_modify_order_reservation(*order, modify_order.usd_cost(), modify_order.usd_amount());
+    if (risk_check_result != RISK_ACCEPTED) {
+        return true;
+    }
+
+    int32_t displayed_amount = OrderBook::get_displayed_amount(*order);
+    int32_t new_usd_volume = order->usd_volume() - order->usd_amount() + modify_order.usd_amount();
+    bool is_priority_kept = OrderBook::to_price_key(modify_order.usd_cost()) == OrderBook::to_price_key(order->usd_cost()) &&
+                            modify_order.usd_amount() <= order->usd_amount();
+
+    if (is_priority_kept) {
+        order->set_usd_amount(modify_order.usd_amount());
+        order->set_usd_volume(new_usd_volume);
+        if (OrderBook::is_iceberg_order(*order)) {
+            order->set_displayed_amount(std::min(order->displayed_amount(), order->usd_amount()));
         }
-        queue.pop();
+        market_depth_.remove_quantity(order->type(), order->usd_cost(), displayed_amount - OrderBook::get_displayed_amount(*order), false);
+        client_data_manager->push_order_to_active_orders(*order);
+    } else {
+        Serialize::TradeOrder modified_order;
+        orders_book_.remove_order(modify_order.order_id(), modify_order.type(), modified_order);
+        market_depth_.remove_quantity(modified_order.type(), modified_order.usd_cost(), displayed_amount, true);
+
+        modified_order.set_usd_cost(modify_order.usd_cost());
+        modified_order.set_usd_amount(modify_order.usd_amount());
+        modified_order.set_usd_volume(new_usd_volume);
+        modified_order.set_timestamp(TimeOrderUtils::get_current_timestamp());
+        modified_order.clear_displayed_amount();
+
+        client_data_manager->push_order_to_active_orders(modified_order);
+        //*INFO: Expire time is not modified, timer of first placement stays valid
+        place_order_to_book(modified_order, true);
     }
 
-    queue = std::move(temp_queue);
-    return found;
+    //*INFO: Runs on session thread, so repriced order is matched by next pass of stock loop, not here
+    market_depth_.publish();
+    modify_order_unique_lock.unlock();
+    client_data_manager->request_matching_pass();
+    return true;
+}
+
+Serialize::MarketDepth Core::get_market_depth(int32_t levels) const {
+    return market_depth_.get_snapshot(levels);
 }
+
+Serialize::Candles Core::get_candles(const Serialize::CandlesRequest& candles_request) const {
+    return candle_aggregator_.get_candles(candles_request.resolution(),
+                                          candles_request.from_timestamp(), candles_request.to_timestamp());
+}
+
+int64_t Core::get_book_levels_count(Serialize::TradeOrder::TradeType type) const {
+    return market_depth_.get_levels_count(type);
+}
+
+int64_t Core::get_book_orders_count(Serialize::TradeOrder::TradeType type) const {
+    return market_depth_.get_orders_count(type);
+}
+
+int64_t Core::get_last_persist_lag_ns() const {
+    return last_persist_lag_ns_.load(std::memory_order_relaxed);
+}
+
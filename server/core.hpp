@@ -3,13 +3,24 @@
 
 #include <vector>
 #include <algorithm>
-#include <queue>
 #include <memory>
 #include <string>
+#include <chrono>
+#include <atomic>
+#include <unordered_map>
 
 #include "spdlog/spdlog.h"
 
 #include "common.hpp"
+#include "time_order_utils.hpp"
+#include "order_book.hpp"
+#include "stop_order_index.hpp"
+#include "timer_wheel.hpp"
+#include "market_depth.hpp"
+#include "candle_aggregator.hpp"
+#include "order_queue.hpp"
+#include "stage_latencies.hpp"
+#include "metric_counters.hpp"
 #include "session_manager.hpp"
 #include "client_data_manager.hpp"
 #include "session_client_connection.hpp"
@@ -17,46 +28,89 @@
 
 constexpr double EPSILON = 1e-6;
 
+//*INFO: Expiry precision of GTD and DAY orders
+#define ORDER_EXPIRY_TICK_MS 100
+
+//*INFO: What matcher does when both sides of a match belong to one account
+enum self_trade_prevention_mode_t {
+    STP_NONE,               //*INFO: Orders trade with each other
+    STP_CANCEL_NEWEST,      //*INFO: Taker is cancelled
+    STP_CANCEL_OLDEST,      //*INFO: Resting maker is cancelled, taker goes on
+    STP_DECREMENT_BOTH      //*INFO: Matchable amount is cancelled from both orders without trade
+};
+
 //*INFO: Forward declaration
 class SessionManager;
 class ClientDataManager;
 
-struct BuyOrderComparator {
-    bool operator()(const Serialize::TradeOrder& lhs, const Serialize::TradeOrder& rhs) const {
-        if (std::fabs(lhs.usd_cost() - rhs.usd_cost()) < EPSILON) {
-            return lhs.timestamp() > rhs.timestamp();
-        }
-        return lhs.usd_cost() < rhs.usd_cost();
-    }
-};
-struct SellOrderComparator {
-    bool operator()(const Serialize::TradeOrder& lhs, const Serialize::TradeOrder& rhs) const {
-        if (std::fabs(lhs.usd_cost() - rhs.usd_cost()) < EPSILON) {
-            return lhs.timestamp() > rhs.timestamp();
-        }
-        return lhs.usd_cost() > rhs.usd_cost();
-    }
-};
-
 class Core : public std::enable_shared_from_this<Core> {
 public:
     Core(std::shared_ptr<SessionManager> session_manager);
 
     void stock_loop();
 
+    //*INFO: Only before sessions are accepted
+    void set_self_trade_prevention_mode(self_trade_prevention_mode_t mode);
+    static self_trade_prevention_mode_t self_trade_prevention_mode_from_string(const std::string& mode);
+    //*INFO: Only before sessions are accepted. auction_interval_ms > 0 - periodic call auction instead of continuous matching,
+    //*INFO: opening_auction_ms > 0 - continuous matching starts after opening call auction of this length
+    void set_auction_schedule(uint32_t auction_interval_ms, uint32_t opening_auction_ms);
+
     void save_all_active_orders_to_db();
     void load_all_active_orders_from_db();
+    void load_candles_from_db();
 
-    void place_order_to_priority_queue(const Serialize::TradeOrder& order);
+    //*INFO: is_expiry_scheduled - order already has expiry timer, e.g. it is re-placed after modify
+    void place_order_to_book(const Serialize::TradeOrder& order, bool is_expiry_scheduled = false);
+    void accept_incoming_order(Serialize::TradeOrder& order);
     void process_orders(); 
-
-    bool remove_order_by_id(int64_t order_id, trade_type_t trade_type);
-    template<typename T, typename Container, typename Compare>
-    bool remove_from_queue(std::priority_queue<T, Container, Compare>& queue, int64_t order_id);
+    //*INFO: Ends call phase: book is uncrossed at single clearing price
+    void uncross_auction();
+    //*INFO: Cancels GTD and DAY orders expired by current_time
+    void expire_orders(int64_t current_time);
+
+    bool remove_order_by_id(int64_t order_id, trade_type_t trade_type, Serialize::TradeOrder& removed_order);
+    //*INFO: Bulk cancel in one matcher pass, depth is published once. Orders not resting in engine are skipped
+    void remove_orders_by_ids(const std::vector<OrderKey>& order_keys, std::vector<Serialize::TradeOrder>& removed_orders);
+    //*INFO: false if order is not resting in book, risk_check_result tells if new values were accepted.
+    //*INFO: Book is changed in place, crossing order is matched by next pass of stock loop
+    bool modify_order(const Serialize::ModifyTradeOrder& modify_order, risk_check_result_t& risk_check_result);
+
+    //*INFO: Lock-free for readers, served from last published depth snapshot
+    Serialize::MarketDepth get_market_depth(int32_t levels) const;
+    Serialize::Candles get_candles(const Serialize::CandlesRequest& candles_request) const;
+    //*INFO: Lock-free for readers, resting orders (stop orders excluded) as of last depth publish
+    int64_t get_book_levels_count(Serialize::TradeOrder::TradeType type) const;
+    int64_t get_book_orders_count(Serialize::TradeOrder::TradeType type) const;
+    //*INFO: Time from match of oldest order of last matching pass to its executions saved in database
+    int64_t get_last_persist_lag_ns() const;
 
 private:
+    friend class CoreTest;  //*INFO: Inspects expiry wheel
+
+    void save_active_orders_to_db(const std::vector<Serialize::TradeOrder>& orders);
+    void restore_active_order(Serialize::TradeOrder order);
+    void place_order_to_stop_orders(const Serialize::TradeOrder& order);
+    bool remove_resting_order(int64_t order_id, Serialize::TradeOrder::TradeType type, Serialize::TradeOrder& removed_order);
+    bool remove_expired_order(const TimerWheel::Timer& timer, int64_t current_time, Serialize::TradeOrder& expired_order);
+    std::chrono::steady_clock::time_point get_next_wake_up_time() const;
+    void activate_triggered_stop_orders();
+    void match_incoming_order(Serialize::TradeOrder& order);
     void complement_order_books();
-    bool match_orders(Serialize::TradeOrder& sell_order, Serialize::TradeOrder& buy_order); 
+    void accept_queued_order(QueuedOrder& queued_order);
+    void record_persist_stages();
+    void match_crossing_orders();
+    void match_at_clearing_price(int64_t clearing_price_key);
+    void execute_immediate_order(Serialize::TradeOrder& order);
+    void cancel_unfilled_order(Serialize::TradeOrder& order);
+    void cancel_order_amount(Serialize::TradeOrder& order, int32_t canceled_amount);
+    void cancel_resting_order_amount(Serialize::TradeOrder& order, int32_t canceled_amount);
+    bool is_self_trade(const Serialize::TradeOrder& taker_order, const Serialize::TradeOrder& maker_order) const;
+    void prevent_self_trade_in_book(Serialize::TradeOrder& taker_order, Serialize::TradeOrder& maker_order);
+    void assign_account_id(Serialize::TradeOrder& order);
+    bool match_orders(Serialize::TradeOrder& sell_order, Serialize::TradeOrder& buy_order,
+                      int32_t transaction_amount, double transaction_price, bool is_buy_aggressor);
+    void finish_resting_order_fill(Serialize::TradeOrder& order, int32_t displayed_amount_before_fill);
     
     bool update_active_order_usd_amount_in_client_data_manager (
                                 const Serialize::TradeOrder& sell_order, const Serialize::TradeOrder& buy_order,
@@ -65,14 +119,43 @@ private:
                                 Serialize::TradeOrder& buy_order_iterator,
                                  int32_t transaction_amount, double transaction_cost); 
     bool move_order_to_completed_orders(Serialize::TradeOrder& completed_order);
+    Serialize::Execution record_execution(const Serialize::TradeOrder& sell_order, const Serialize::TradeOrder& buy_order,
+                                          int32_t transaction_amount, double price, bool is_buy_aggressor);
+    void flush_pending_executions();
+    void send_execution_report(const Serialize::TradeOrder& order, const Serialize::Execution& execution,
+                               double usd_balance_delta, double rub_balance_delta);
 
 private:
     mutable std::mutex core_mutex_;
 
-    std::priority_queue<Serialize::TradeOrder, std::vector<Serialize::TradeOrder>, BuyOrderComparator> buy_orders_book_;
-    std::priority_queue<Serialize::TradeOrder, std::vector<Serialize::TradeOrder>, SellOrderComparator> sell_orders_book_;
+    OrderBook orders_book_;
+    StopOrderIndex stop_orders_;
+    //*INFO: Usernames interned to account ids, so match loop compares integers
+    std::unordered_map<std::string, uint32_t> account_ids_;
+    self_trade_prevention_mode_t self_trade_prevention_mode_;
+    //*INFO: In call phase orders only rest in book, nothing trades until uncross
+    bool is_call_phase_;
+    std::chrono::milliseconds auction_interval_;
+    std::chrono::steady_clock::time_point next_uncross_time_;
+    TimerWheel expiry_wheel_;
+    //*INFO: Price range traded since stop orders were last checked, 0 - no trades
+    double traded_price_low_;
+    double traded_price_high_;
+    MarketDepth market_depth_;
+    CandleAggregator candle_aggregator_;
+    //*INFO: Executions of current matching pass, persisted in one batch at its end
+    std::vector<Serialize::Execution> pending_executions_;
+    struct OrderStageTimes {
+        int64_t receive_time;
+        int64_t match_time;
+    };
+    //*INFO: Orders of current matching pass waiting for persist stage
+    std::vector<OrderStageTimes> pending_stage_times_;
+    std::atomic<int64_t> last_persist_lag_ns_;
 
     std::shared_ptr<SessionManager> session_manager_;
+    std::shared_ptr<StageLatencies> stage_latencies_;
+    std::shared_ptr<MetricCounters> metric_counters_;
 };
 
 #endif // CORE_HPP
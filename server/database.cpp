@@ -12,7 +12,12 @@ const char* Database::CREATE_ACTIVE_BUY_ORDERS_TABLE = "CREATE TABLE IF NOT EXIS
                                                         "usd_cost DOUBLE PRECISION, "
                                                         "usd_amount INTEGER, "
                                                         "usd_volume INTEGER, "
-                                                        "timestamp TIMESTAMP WITH TIME ZONE)";
+                                                        "timestamp TIMESTAMP WITH TIME ZONE, "
+                                                        "order_type SMALLINT DEFAULT 0, "
+                                                        "time_in_force SMALLINT DEFAULT 0, "
+                                                        "stop_price DOUBLE PRECISION DEFAULT 0, "
+                                                        "peak_amount INTEGER DEFAULT 0, "
+                                                        "expire_time TIMESTAMP WITH TIME ZONE)";
 
 const char* Database::CREATE_ACTIVE_SELL_ORDERS_TABLE = "CREATE TABLE IF NOT EXISTS active_sell_orders ("
                                                         "id SERIAL PRIMARY KEY, "
@@ -21,7 +26,26 @@ const char* Database::CREATE_ACTIVE_SELL_ORDERS_TABLE = "CREATE TABLE IF NOT EXI
                                                         "usd_cost DOUBLE PRECISION, "
                                                         "usd_amount INTEGER, "
                                                         "usd_volume INTEGER, "
-                                                        "timestamp TIMESTAMP WITH TIME ZONE)";
+                                                        "timestamp TIMESTAMP WITH TIME ZONE, "
+                                                        "order_type SMALLINT DEFAULT 0, "
+                                                        "time_in_force SMALLINT DEFAULT 0, "
+                                                        "stop_price DOUBLE PRECISION DEFAULT 0, "
+                                                        "peak_amount INTEGER DEFAULT 0, "
+                                                        "expire_time TIMESTAMP WITH TIME ZONE)";
+
+//*INFO: For tables created before stop, iceberg and expiring orders
+const char* Database::ALTER_ACTIVE_ORDERS_TABLES = "ALTER TABLE active_buy_orders "
+                                                   "ADD COLUMN IF NOT EXISTS order_type SMALLINT DEFAULT 0, "
+                                                   "ADD COLUMN IF NOT EXISTS time_in_force SMALLINT DEFAULT 0, "
+                                                   "ADD COLUMN IF NOT EXISTS stop_price DOUBLE PRECISION DEFAULT 0, "
+                                                   "ADD COLUMN IF NOT EXISTS peak_amount INTEGER DEFAULT 0, "
+                                                   "ADD COLUMN IF NOT EXISTS expire_time TIMESTAMP WITH TIME ZONE; "
+                                                   "ALTER TABLE active_sell_orders "
+                                                   "ADD COLUMN IF NOT EXISTS order_type SMALLINT DEFAULT 0, "
+                                                   "ADD COLUMN IF NOT EXISTS time_in_force SMALLINT DEFAULT 0, "
+                                                   "ADD COLUMN IF NOT EXISTS stop_price DOUBLE PRECISION DEFAULT 0, "
+                                                   "ADD COLUMN IF NOT EXISTS peak_amount INTEGER DEFAULT 0, "
+                                                   "ADD COLUMN IF NOT EXISTS expire_time TIMESTAMP WITH TIME ZONE";
 
 const char* Database::CREATE_CLIENTS_BALANCES_TABLE = "CREATE TABLE IF NOT EXISTS clients_balances ("
                                             "id SERIAL PRIMARY KEY, "
@@ -47,24 +71,65 @@ const char* Database::CREATE_QUOTE_HISTORY_TABLE = "CREATE TABLE IF NOT EXISTS q
                                                    "completion_timestamp TIMESTAMP WITH TIME ZONE)";
 
 
+const char* Database::CREATE_CANDLES_TABLE = "CREATE TABLE IF NOT EXISTS candles ("
+                                             "id SERIAL PRIMARY KEY, "
+                                             "resolution VARCHAR(2), "
+                                             "open_time TIMESTAMP WITH TIME ZONE, "
+                                             "open DOUBLE PRECISION, "
+                                             "high DOUBLE PRECISION, "
+                                             "low DOUBLE PRECISION, "
+                                             "close DOUBLE PRECISION, "
+                                             "usd_volume BIGINT, "
+                                             "trades_count INTEGER, "
+                                             "UNIQUE (resolution, open_time))";
+
+
+const char* Database::CREATE_EXECUTIONS_TABLE = "CREATE TABLE IF NOT EXISTS executions ("
+                                                "id SERIAL PRIMARY KEY, "
+                                                "trade_id BIGINT NOT NULL, "
+                                                "price DOUBLE PRECISION, "
+                                                "usd_amount INTEGER, "
+                                                "aggressor_side VARCHAR(4), "
+                                                "maker_order_id BIGINT, "
+                                                "taker_order_id BIGINT, "
+                                                "timestamp TIMESTAMP WITH TIME ZONE)";
+
+
+const char* Database::INSERT_EXECUTION_STATEMENT = "insert_execution";
+const char* Database::INSERT_QUOTE_STATEMENT = "insert_quote";
+
+
 Database::Database(const std::string& connection_info) : connection_(connection_info) {
     try {
         pqxx::work db_transaction(connection_);
 
         db_transaction.exec(Database::CREATE_USERS_TABLE);
 
-        //*INFO in core priority_queues
+        //*INFO in core orders book and stop orders
         db_transaction.exec(Database::CREATE_ACTIVE_BUY_ORDERS_TABLE);
         db_transaction.exec(Database::CREATE_ACTIVE_SELL_ORDERS_TABLE);
+        db_transaction.exec(Database::ALTER_ACTIVE_ORDERS_TABLES);
 
         //*INFO in client_data_manager
         db_transaction.exec(Database::CREATE_CLIENTS_BALANCES_TABLE);
         db_transaction.exec(Database::CREATE_COMPLETED_ORDERS_TABLE);
         db_transaction.exec(Database::CREATE_QUOTE_HISTORY_TABLE);
+        db_transaction.exec(Database::CREATE_EXECUTIONS_TABLE);
+
+        //*INFO in core candle_aggregator
+        db_transaction.exec(Database::CREATE_CANDLES_TABLE);
 
         db_transaction.commit();
 
         spdlog::info("Tables created or already exists.");
+
+        connection_.prepare(Database::INSERT_EXECUTION_STATEMENT,
+                            "INSERT INTO executions ("
+                            "trade_id, price, usd_amount, aggressor_side, maker_order_id, taker_order_id, timestamp) "
+                            "VALUES ($1, $2, $3, $4, $5, $6, to_timestamp($7 / 1000.0))");
+        connection_.prepare(Database::INSERT_QUOTE_STATEMENT,
+                            "INSERT INTO quote_history (price, completion_timestamp) "
+                            "VALUES ($1, to_timestamp($2 / 1000.0))");
     } catch (const pqxx::sql_error& e) {
         spdlog::error("SQL error: {}", e.what());
         spdlog::error("Query was: {}", e.query());
@@ -136,14 +201,21 @@ void Database::save_active_order_to_db(const Serialize::TradeOrder& order) {
                              ? "active_buy_orders" 
                              : "active_sell_orders";
 
-    db_transaction.exec_params("INSERT INTO " + table_name + " (order_id, username, usd_cost, usd_amount, usd_volume, timestamp)"
-                               "VALUES ($1, $2, $3, $4, $5, to_timestamp($6 / 1000.0))",
+    db_transaction.exec_params("INSERT INTO " + table_name + " (order_id, username, usd_cost, usd_amount, usd_volume, timestamp, "
+                               "order_type, time_in_force, stop_price, peak_amount, expire_time)"
+                               "VALUES ($1, $2, $3, $4, $5, to_timestamp($6 / 1000.0), $7, $8, $9, $10, "
+                               "CASE WHEN $11::bigint > 0 THEN to_timestamp($11::bigint / 1000.0) END)",
                                 order.order_id(),
                                 order.username(),
                                 order.usd_cost(),
                                 order.usd_amount(),
                                 order.usd_volume(),
-                                order.timestamp());
+                                order.timestamp(),
+                                static_cast<int32_t>(order.order_type()),
+                                static_cast<int32_t>(order.time_in_force()),
+                                order.stop_price(),
+                                order.peak_amount(),
+                                order.expire_time());
 
     db_transaction.commit();
     spdlog::info("Order saved to DB: {} ({})", order.order_id(), table_name);
@@ -212,6 +284,67 @@ void Database::save_qoute_to_db(const Serialize::Quote& qoute) {
                     "price = {}, timestamp={}", qoute.price(), qoute.timestamp());
 }
 
+void Database::save_candle_to_db(Serialize::CandleResolution resolution, const Serialize::Candle& candle) {
+    std::lock_guard<std::mutex> save_candle_to_db_lock_guard(mutex_);
+    pqxx::work db_transaction(connection_);
+
+    db_transaction.exec_params("INSERT INTO candles ("
+                               "resolution, open_time, open, high, low, close, usd_volume, trades_count) "
+                               "VALUES ($1, to_timestamp($2 / 1000.0), $3, $4, $5, $6, $7, $8) "
+                               "ON CONFLICT (resolution, open_time) DO UPDATE SET "
+                               "high = EXCLUDED.high, low = EXCLUDED.low, close = EXCLUDED.close, "
+                               "usd_volume = EXCLUDED.usd_volume, trades_count = EXCLUDED.trades_count",
+                                candle_resolution_to_string(resolution),
+                                candle.open_time(),
+                                candle.open(),
+                                candle.high(),
+                                candle.low(),
+                                candle.close(),
+                                candle.usd_volume(),
+                                candle.trades_count());
+
+    db_transaction.commit();
+    spdlog::debug("Candle saved to DB: resolution={}, open_time={}", candle_resolution_to_string(resolution), candle.open_time());
+}
+
+void Database::save_executions_to_db(const std::vector<Serialize::Execution>& executions) {
+    if (executions.empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> save_executions_to_db_lock_guard(mutex_);
+    pqxx::work db_transaction(connection_);
+
+    //*INFO: Rows go through prepared statements, values are never formatted into query text
+    for (const auto& execution : executions) {
+        db_transaction.exec_prepared(Database::INSERT_EXECUTION_STATEMENT,
+                                     execution.trade_id(),
+                                     execution.price(),
+                                     execution.usd_amount(),
+                                     execution.aggressor_side() == Serialize::TradeOrder::BUY ? "buy" : "sell",
+                                     execution.maker_order_id(),
+                                     execution.taker_order_id(),
+                                     execution.timestamp());
+        db_transaction.exec_prepared(Database::INSERT_QUOTE_STATEMENT,
+                                     execution.price(),
+                                     execution.timestamp());
+    }
+
+    db_transaction.commit();
+    spdlog::info("Batch of {} executions saved to DB", executions.size());
+}
+
+std::string Database::candle_resolution_to_string(Serialize::CandleResolution resolution) {
+    switch (resolution) {
+        case Serialize::SECOND_1 : return "1s";
+        case Serialize::MINUTE_1 : return "1m";
+        case Serialize::MINUTE_5 : return "5m";
+        case Serialize::HOUR_1 :   return "1h";
+        case Serialize::DAY_1 :    return "1d";
+        default :                  return "1s";
+    }
+}
+
 //                                                                                //
 //                               Extract operations                               //
 //                                                                                //
@@ -230,7 +363,9 @@ std::vector<Serialize::TradeOrder> Database::load_active_orders_from_db(Serializ
     //*INFO load all orders     
     pqxx::result result = db_transaction.exec_params(
         "SELECT order_id, username, usd_cost, usd_amount, usd_volume, " 
-        "EXTRACT(EPOCH FROM timestamp) * 1000 AS timestamp "
+        "EXTRACT(EPOCH FROM timestamp) * 1000 AS timestamp, "
+        "order_type, time_in_force, stop_price, peak_amount, "
+        "COALESCE(EXTRACT(EPOCH FROM expire_time) * 1000, 0) AS expire_time "
         "FROM " + table_name);
 
     std::vector<Serialize::TradeOrder> orders;
@@ -244,6 +379,11 @@ std::vector<Serialize::TradeOrder> Database::load_active_orders_from_db(Serializ
         int64_t timestamp_ms = static_cast<int64_t>(row["timestamp"].as<double>());
         order.set_timestamp(timestamp_ms);
         order.set_type(type);
+        order.set_order_type(static_cast<Serialize::TradeOrder::OrderType>(row["order_type"].as<int32_t>()));
+        order.set_time_in_force(static_cast<Serialize::TradeOrder::TimeInForce>(row["time_in_force"].as<int32_t>()));
+        order.set_stop_price(row["stop_price"].as<double>());
+        order.set_peak_amount(row["peak_amount"].as<int32_t>());
+        order.set_expire_time(static_cast<int64_t>(row["expire_time"].as<double>()));
         
         orders.push_back(order);
     }
@@ -365,3 +505,71 @@ std::vector<Serialize::Quote> Database::load_quote_history(int number) {
 
     return quotes;
 }
+
+std::vector<Serialize::Candle> Database::load_candles_from_db(Serialize::CandleResolution resolution, int number) {
+    std::lock_guard<std::mutex> load_candles_from_db_lock_guard(mutex_);
+    pqxx::work db_transaction(connection_);
+
+    pqxx::result result = db_transaction.exec_params(
+        "SELECT EXTRACT(EPOCH FROM open_time) * 1000 AS open_time, "
+        "open, high, low, close, usd_volume, trades_count "
+        "FROM candles "
+        "WHERE resolution = $1 "
+        "ORDER BY open_time "
+        "DESC LIMIT $2;", candle_resolution_to_string(resolution), number);
+
+    std::vector<Serialize::Candle> candles;
+    for (const auto& row : result) {
+        Serialize::Candle candle;
+
+        candle.set_open_time(static_cast<int64_t>(row["open_time"].as<double>()));
+        candle.set_open(row["open"].as<double>());
+        candle.set_high(row["high"].as<double>());
+        candle.set_low(row["low"].as<double>());
+        candle.set_close(row["close"].as<double>());
+        candle.set_usd_volume(row["usd_volume"].as<int64_t>());
+        candle.set_trades_count(row["trades_count"].as<int32_t>());
+
+        candles.push_back(candle);
+    }
+
+    db_transaction.commit();
+
+    spdlog::info("Candles {} loaded to candle_aggregator", candle_resolution_to_string(resolution));
+
+    return candles;
+}
+
+std::vector<Serialize::Execution> Database::load_last_executions(int number) {
+    std::lock_guard<std::mutex> load_last_executions_lock_guard(mutex_);
+    pqxx::work db_transaction(connection_);
+
+    pqxx::result result = db_transaction.exec_params(
+        "SELECT trade_id, price, usd_amount, aggressor_side, maker_order_id, taker_order_id, "
+        "EXTRACT(EPOCH FROM timestamp) * 1000 AS timestamp "
+        "FROM executions "
+        "ORDER BY id "
+        "DESC LIMIT $1;", number);
+
+    std::vector<Serialize::Execution> executions;
+    for (const auto& row : result) {
+        Serialize::Execution execution;
+
+        execution.set_trade_id(row["trade_id"].as<int64_t>());
+        execution.set_price(row["price"].as<double>());
+        execution.set_usd_amount(row["usd_amount"].as<int32_t>());
+        std::string aggressor_side = row["aggressor_side"].as<std::string>();
+        execution.set_aggressor_side(aggressor_side == "buy" ? Serialize::TradeOrder::BUY : Serialize::TradeOrder::SELL);
+        execution.set_maker_order_id(row["maker_order_id"].as<int64_t>());
+        execution.set_taker_order_id(row["taker_order_id"].as<int64_t>());
+        execution.set_timestamp(static_cast<int64_t>(row["timestamp"].as<double>()));
+
+        executions.push_back(execution);
+    }
+
+    db_transaction.commit();
+
+    spdlog::info("Executions loaded to client_data_manager");
+
+    return executions;
+}
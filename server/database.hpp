@@ -53,15 +53,20 @@ public:
      * @param completion_timestamp The timestamp (int64_t) when an order was completed
      * @param number The number of items to load (for completed orders and quote history) when server started
      * @param quote A Serialize::Quote message containing market quote information
+     * @param resolution Serialize::CandleResolution of saved or loaded candles
+     * @param candle A Serialize::Candle message with OHLCV of one period, saved again while period is open
+     * @param executions Serialize::Execution trade prints of one matching pass, saved in one batch
      *
      * @return 
      * - For load_active_orders_from_db: A vector of active trade orders
      * - For load_clients_balances_from_db: A vector of client balances
      * - For load_last_completed_orders: A vector of the last completed trade orders
      * - For load_quote_history: A vector of historical market quotes
+     * - For load_candles_from_db: A vector of the last candles of resolution, newest first
+     * - For load_last_executions: A vector of the last trade prints, newest first
      *
      * @note Save operations (save_active_order_to_db, update_actual_client_balance_in_db, 
-     *       save_completed_order_to_db, save_qoute_to_db) do not return values. 
+     *       save_completed_order_to_db, save_qoute_to_db, save_candle_to_db, save_executions_to_db) do not return values. 
      *       They may throw exceptions if the operation fails.
      */
     //@{
@@ -76,6 +81,12 @@ public:
 
     virtual void save_qoute_to_db(const Serialize::Quote& qoute) = 0;
     virtual std::vector<Serialize::Quote> load_quote_history(int number) = 0;
+
+    virtual void save_candle_to_db(Serialize::CandleResolution resolution, const Serialize::Candle& candle) = 0;
+    virtual std::vector<Serialize::Candle> load_candles_from_db(Serialize::CandleResolution resolution, int number) = 0;
+
+    virtual void save_executions_to_db(const std::vector<Serialize::Execution>& executions) = 0;
+    virtual std::vector<Serialize::Execution> load_last_executions(int number) = 0;
     //@}
 
     /**
@@ -122,6 +133,23 @@ public:
     std::vector<Serialize::Quote> load_quote_history(int number) override;
     //@}
 
+    /**
+     * @brief candle_aggregator operations. Candle is upserted by (resolution, open_time).
+     */
+    //@{
+    void save_candle_to_db(Serialize::CandleResolution resolution, const Serialize::Candle& candle) override;
+    std::vector<Serialize::Candle> load_candles_from_db(Serialize::CandleResolution resolution, int number) override;
+    //@}
+
+    /**
+     * @brief Trade tape. Whole batch (executions and their quotes) is written with prepared
+     *        inserts in one transaction.
+     */
+    //@{
+    void save_executions_to_db(const std::vector<Serialize::Execution>& executions) override;
+    std::vector<Serialize::Execution> load_last_executions(int number) override;
+    //@}
+
     void truncate_active_orders_table() override;
 
 private:
@@ -131,9 +159,17 @@ private:
     static const char* CREATE_USERS_TABLE;
     static const char* CREATE_ACTIVE_BUY_ORDERS_TABLE;
     static const char* CREATE_ACTIVE_SELL_ORDERS_TABLE;
+    static const char* ALTER_ACTIVE_ORDERS_TABLES;
     static const char* CREATE_CLIENTS_BALANCES_TABLE;
     static const char* CREATE_COMPLETED_ORDERS_TABLE;
     static const char* CREATE_QUOTE_HISTORY_TABLE;
+    static const char* CREATE_CANDLES_TABLE;
+    static const char* CREATE_EXECUTIONS_TABLE;
+
+    static const char* INSERT_EXECUTION_STATEMENT;
+    static const char* INSERT_QUOTE_STATEMENT;
+
+    static std::string candle_resolution_to_string(Serialize::CandleResolution resolution);
 };
 
 #endif // DATABASE_HPP
@@ -0,0 +1,112 @@
+#include "market_depth.hpp"
+#include "time_order_utils.hpp"
+#include "order_book.hpp"
+
+MarketDepth::MarketDepth() : published_snapshot_(std::make_shared<const Serialize::MarketDepth>()) {
+}
+
+void MarketDepth::add_order(Serialize::TradeOrder::TradeType type, double price, int64_t usd_amount) {
+    int64_t price_key = OrderBook::to_price_key(price);
+    PriceLevel& level = (type == Serialize::TradeOrder::BUY) ? buy_levels_[price_key] : sell_levels_[price_key];
+    level.usd_amount += usd_amount;
+    ++level.orders_count;
+    ++(type == Serialize::TradeOrder::BUY ? buy_orders_count_ : sell_orders_count_);
+    is_changed_since_publish_ = true;
+}
+
+void MarketDepth::remove_quantity(Serialize::TradeOrder::TradeType type, double price,
+                                  int64_t usd_amount, bool order_left_level) {
+    int64_t price_key = OrderBook::to_price_key(price);
+    if (type == Serialize::TradeOrder::BUY) {
+        remove_quantity_from_levels(buy_levels_, buy_orders_count_, price_key, usd_amount, order_left_level);
+    } else {
+        remove_quantity_from_levels(sell_levels_, sell_orders_count_, price_key, usd_amount, order_left_level);
+    }
+    is_changed_since_publish_ = true;
+}
+
+template<typename Levels>
+void MarketDepth::remove_quantity_from_levels(Levels& levels, int64_t& orders_count, int64_t price_key,
+                                              int64_t usd_amount, bool order_left_level) {
+    auto level_iterator = levels.find(price_key);
+    if (level_iterator == levels.end()) {
+        return;
+    }
+
+    PriceLevel& level = level_iterator->second;
+    level.usd_amount -= usd_amount;
+    if (order_left_level) {
+        --level.orders_count;
+        --orders_count;
+    }
+
+    if (level.orders_count <= 0 || level.usd_amount <= 0) {
+        orders_count -= std::max(level.orders_count, 0);
+        levels.erase(level_iterator);
+    }
+}
+
+//*INFO: Builds snapshot of top MAX_DEPTH_LEVELS and swaps it in, old one lives while readers hold it
+void MarketDepth::publish() {
+    if (!is_changed_since_publish_) {
+        return;
+    }
+
+    auto snapshot = std::make_shared<Serialize::MarketDepth>();
+    copy_top_levels(buy_levels_, snapshot->mutable_bids());
+    copy_top_levels(sell_levels_, snapshot->mutable_asks());
+    snapshot->set_timestamp(TimeOrderUtils::get_current_timestamp());
+
+    std::atomic_store(&published_snapshot_, std::shared_ptr<const Serialize::MarketDepth>(std::move(snapshot)));
+    published_buy_levels_count_.store(static_cast<int64_t>(buy_levels_.size()), std::memory_order_relaxed);
+    published_sell_levels_count_.store(static_cast<int64_t>(sell_levels_.size()), std::memory_order_relaxed);
+    published_buy_orders_count_.store(buy_orders_count_, std::memory_order_relaxed);
+    published_sell_orders_count_.store(sell_orders_count_, std::memory_order_relaxed);
+    is_changed_since_publish_ = false;
+}
+
+template<typename Levels>
+void MarketDepth::copy_top_levels(const Levels& levels,
+                                  google::protobuf::RepeatedPtrField<Serialize::PriceLevel>* destination) const {
+    int32_t copied_levels = 0;
+    for (auto level_iterator = levels.begin();
+         level_iterator != levels.end() && copied_levels < MAX_DEPTH_LEVELS; ++level_iterator, ++copied_levels) {
+        Serialize::PriceLevel* price_level = destination->Add();
+        price_level->set_price(static_cast<double>(level_iterator->first) / PRICE_KEY_SCALE);
+        price_level->set_usd_amount(level_iterator->second.usd_amount);
+        price_level->set_orders_count(level_iterator->second.orders_count);
+    }
+}
+
+Serialize::MarketDepth MarketDepth::get_snapshot(int32_t levels) const {
+    if (levels <= 0) {
+        levels = DEFAULT_DEPTH_LEVELS;
+    }
+
+    std::shared_ptr<const Serialize::MarketDepth> snapshot = std::atomic_load(&published_snapshot_);
+
+    Serialize::MarketDepth market_depth;
+    market_depth.set_timestamp(snapshot->timestamp());
+    for (int32_t i = 0; i < std::min(levels, snapshot->bids_size()); ++i) {
+        *market_depth.add_bids() = snapshot->bids(i);
+    }
+    for (int32_t i = 0; i < std::min(levels, snapshot->asks_size()); ++i) {
+        *market_depth.add_asks() = snapshot->asks(i);
+    }
+
+    return market_depth;
+}
+
+int64_t MarketDepth::get_levels_count(Serialize::TradeOrder::TradeType type) const {
+    if (type == Serialize::TradeOrder::BUY) {
+        return published_buy_levels_count_.load(std::memory_order_relaxed);
+    }
+    return published_sell_levels_count_.load(std::memory_order_relaxed);
+}
+
+int64_t MarketDepth::get_orders_count(Serialize::TradeOrder::TradeType type) const {
+    if (type == Serialize::TradeOrder::BUY) {
+        return published_buy_orders_count_.load(std::memory_order_relaxed);
+    }
+    return published_sell_orders_count_.load(std::memory_order_relaxed);
+}
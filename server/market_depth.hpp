@@ -0,0 +1,61 @@
+#ifndef MARKET_DEPTH_HPP
+#define MARKET_DEPTH_HPP
+
+#include <map>
+#include <memory>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <algorithm>
+
+#include "trade_market_protocol.pb.h"
+#include "common.hpp"
+
+#define DEFAULT_DEPTH_LEVELS 10
+
+//*INFO: Aggregated quantity per price level, maintained incrementally by matcher. Levels are keyed
+//*INFO: by OrderBook::to_price_key, so depth level is exactly one book level.
+//*INFO: Readers get last published snapshot (RCU style shared_ptr swap) and never block matcher.
+class MarketDepth {
+public:
+    MarketDepth();
+
+    //*INFO: Matcher side, called only under core_mutex_
+    void add_order(Serialize::TradeOrder::TradeType type, double price, int64_t usd_amount);
+    void remove_quantity(Serialize::TradeOrder::TradeType type, double price, int64_t usd_amount, bool order_left_level);
+    void publish();
+
+    //*INFO: Reader side, any thread
+    Serialize::MarketDepth get_snapshot(int32_t levels) const;
+    //*INFO: Whole side as of last publish, not only top levels of snapshot
+    int64_t get_levels_count(Serialize::TradeOrder::TradeType type) const;
+    int64_t get_orders_count(Serialize::TradeOrder::TradeType type) const;
+
+private:
+    struct PriceLevel {
+        int64_t usd_amount = 0;
+        int32_t orders_count = 0;
+    };
+
+    template<typename Levels>
+    void remove_quantity_from_levels(Levels& levels, int64_t& orders_count, int64_t price_key, int64_t usd_amount, bool order_left_level);
+    template<typename Levels>
+    void copy_top_levels(const Levels& levels, google::protobuf::RepeatedPtrField<Serialize::PriceLevel>* destination) const;
+
+private:
+    std::map<int64_t, PriceLevel, std::greater<int64_t>> buy_levels_;
+    std::map<int64_t, PriceLevel, std::less<int64_t>> sell_levels_;
+    int64_t buy_orders_count_ = 0;
+    int64_t sell_orders_count_ = 0;
+    bool is_changed_since_publish_ = true;
+
+    std::atomic<int64_t> published_buy_levels_count_{0};
+    std::atomic<int64_t> published_sell_levels_count_{0};
+    std::atomic<int64_t> published_buy_orders_count_{0};
+    std::atomic<int64_t> published_sell_orders_count_{0};
+
+    //*INFO: Accessed only with std::atomic_load/std::atomic_store
+    std::shared_ptr<const Serialize::MarketDepth> published_snapshot_;
+};
+
+#endif // MARKET_DEPTH_HPP
@@ -0,0 +1,23 @@
+#include "metric_counters.hpp"
+
+MetricCounters::ThreadCounters::ThreadCounters() {
+    for (auto& counter : counters) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+}
+
+const char* MetricCounters::counter_to_string(metric_counter_t counter) {
+    switch (counter) {
+        case COUNTER_ORDERS: return "orders";
+        case COUNTER_FILLS: return "fills";
+        default: return "unknown";
+    }
+}
+
+uint64_t MetricCounters::get_total(metric_counter_t counter) const {
+    uint64_t total = 0;
+    thread_counters_.for_each([counter, &total](const ThreadCounters& thread_counters) {
+        total += thread_counters.counters[counter].load(std::memory_order_relaxed);
+    });
+    return total;
+}
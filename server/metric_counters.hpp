@@ -0,0 +1,40 @@
+#ifndef METRIC_COUNTERS_HPP
+#define METRIC_COUNTERS_HPP
+
+#include <atomic>
+#include <cstdint>
+
+#include "per_thread_slots.hpp"
+
+enum metric_counter_t {
+    COUNTER_ORDERS,     //*INFO: Orders passed risk check and pushed to order queue
+    COUNTER_FILLS,      //*INFO: Executions of matcher, partial fills included
+    COUNTERS_COUNT
+};
+
+//*INFO: Monotonic counters kept per thread, increment is plain store to cache line of calling thread,
+//*INFO: totals are summed on scrape
+class MetricCounters {
+public:
+    static const char* counter_to_string(metric_counter_t counter);
+
+    void increment(metric_counter_t counter, uint64_t value = 1) {
+        std::atomic<uint64_t>& thread_counter = thread_counters_.get().counters[counter];
+        thread_counter.store(thread_counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+    //*INFO: Any thread
+    uint64_t get_total(metric_counter_t counter) const;
+
+private:
+    //*INFO: Single writer, readers may see value of previous increment
+    struct alignas(64) ThreadCounters {
+        ThreadCounters();
+
+        std::atomic<uint64_t> counters[COUNTERS_COUNT];
+    };
+
+private:
+    PerThreadSlots<ThreadCounters> thread_counters_;
+};
+
+#endif // METRIC_COUNTERS_HPP
@@ -0,0 +1,170 @@
+#include "metrics_server.hpp"
+
+#include <sstream>
+
+MetricsServer::MetricsServer(const std::string& host, short port, std::shared_ptr<SessionManager> session_manager) :
+        acceptor_(io_context_),
+        accept_retry_timer_(io_context_),
+        session_manager_(session_manager) {
+    boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::make_address(host), port);
+
+    acceptor_.open(endpoint.protocol());
+    acceptor_.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+    acceptor_.bind(endpoint);
+    acceptor_.listen();
+}
+
+void MetricsServer::start() {
+    accept_scrape();
+    metrics_thread_ = std::thread([this]() {
+        io_context_.run();
+    });
+}
+
+void MetricsServer::stop() {
+    io_context_.stop();
+    if (metrics_thread_.joinable()) {
+        metrics_thread_.join();
+    }
+}
+
+unsigned short MetricsServer::get_port() const {
+    return acceptor_.local_endpoint().port();
+}
+
+void MetricsServer::accept_scrape() {
+    auto connection = std::make_shared<ScrapeConnection>(io_context_);
+
+    acceptor_.async_accept(connection->socket, [this, connection](boost::system::error_code error_code) {
+        if (error_code == boost::asio::error::operation_aborted) {
+            return;
+        }
+        if (error_code) {
+            //*INFO: Persistent error fails every accept at once, so retry is delayed instead of spinning
+            spdlog::error("Error accepting metrics scrape {}", error_code.message());
+            accept_retry_timer_.expires_after(std::chrono::milliseconds(ACCEPT_RETRY_DELAY_MS));
+            accept_retry_timer_.async_wait([this](boost::system::error_code error_code) {
+                if (!error_code) {
+                    accept_scrape();
+                }
+            });
+            return;
+        }
+
+        read_scrape_request(connection);
+        accept_scrape();
+    });
+}
+
+void MetricsServer::read_scrape_request(std::shared_ptr<ScrapeConnection> connection) {
+    //*INFO: Client that never finishes headers is disconnected, read below then fails
+    connection->read_deadline.expires_after(std::chrono::milliseconds(SCRAPE_READ_TIMEOUT_MS));
+    connection->read_deadline.async_wait([connection](boost::system::error_code error_code) {
+        if (!error_code) {
+            boost::system::error_code close_error_code;
+            connection->socket.close(close_error_code);
+        }
+    });
+
+    boost::asio::async_read_until(connection->socket, connection->request, "\r\n\r\n",
+        [this, connection](boost::system::error_code error_code, std::size_t length) {
+            connection->read_deadline.cancel();
+            if (error_code) {
+                spdlog::info("Failed to read metrics scrape request: {}", error_code.message());
+                return;
+            }
+
+            std::istream request_stream(&connection->request);
+            std::string method;
+            std::string target;
+            request_stream >> method >> target;
+
+            if (method == "GET" && (target == "/metrics" || target == "/")) {
+                connection->response = make_http_response("200 OK", collect_metrics(*session_manager_));
+            } else {
+                connection->response = make_http_response("404 Not Found", "Only GET /metrics is served\n");
+            }
+
+            boost::asio::async_write(connection->socket, boost::asio::buffer(connection->response),
+                [connection](boost::system::error_code error_code, std::size_t length) {
+                    boost::system::error_code shutdown_error_code;
+                    connection->socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, shutdown_error_code);
+                });
+        });
+}
+
+std::string MetricsServer::make_http_response(const std::string& status, const std::string& body) {
+    return "HTTP/1.1 " + status + "\r\n"
+           "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+           "Content-Length: " + std::to_string(body.size()) + "\r\n"
+           "Connection: close\r\n\r\n" + body;
+}
+
+std::string MetricsServer::collect_metrics(SessionManager& session_manager) {
+    std::ostringstream metrics;
+
+    auto metric_counters = session_manager.get_metric_counters();
+    write_metric_header(metrics, "trade_orders_total", "counter", "Orders passed risk check and queued to matcher.");
+    metrics << "trade_orders_total " << metric_counters->get_total(COUNTER_ORDERS) << "\n";
+    write_metric_header(metrics, "trade_fills_total", "counter", "Fills executed by matcher, partial fills included.");
+    metrics << "trade_fills_total " << metric_counters->get_total(COUNTER_FILLS) << "\n";
+
+    auto client_data_manager = session_manager.get_client_data_manager();
+    if (client_data_manager) {
+        write_metric_header(metrics, "trade_order_queue_depth", "gauge", "Orders waiting in order queue of matcher.");
+        metrics << "trade_order_queue_depth{side=\"buy\"} " << client_data_manager->get_order_queue_size(BUY) << "\n";
+        metrics << "trade_order_queue_depth{side=\"sell\"} " << client_data_manager->get_order_queue_size(SELL) << "\n";
+    }
+
+    auto core = session_manager.get_core();
+    if (core) {
+        write_metric_header(metrics, "trade_book_levels", "gauge", "Price levels of order book.");
+        metrics << "trade_book_levels{side=\"buy\"} " << core->get_book_levels_count(Serialize::TradeOrder::BUY) << "\n";
+        metrics << "trade_book_levels{side=\"sell\"} " << core->get_book_levels_count(Serialize::TradeOrder::SELL) << "\n";
+        write_metric_header(metrics, "trade_book_orders", "gauge", "Orders resting in order book.");
+        metrics << "trade_book_orders{side=\"buy\"} " << core->get_book_orders_count(Serialize::TradeOrder::BUY) << "\n";
+        metrics << "trade_book_orders{side=\"sell\"} " << core->get_book_orders_count(Serialize::TradeOrder::SELL) << "\n";
+        write_metric_header(metrics, "trade_db_persist_lag_seconds", "gauge",
+                            "Time from match of oldest order of last matching pass to its executions saved in database.");
+        metrics << "trade_db_persist_lag_seconds " << core->get_last_persist_lag_ns() / 1e9 << "\n";
+    }
+
+    write_metric_header(metrics, "trade_sessions", "gauge", "Connected client sessions.");
+    metrics << "trade_sessions " << session_manager.get_sessions_count() << "\n";
+
+    auto stage_latencies = session_manager.get_stage_latencies();
+    write_metric_header(metrics, "trade_stage_latency_seconds", "summary", "Latency of order pipeline stages.");
+    for (int stage = 0; stage < STAGES_COUNT; ++stage) {
+        LatencyHistogram merged_histogram(STAGE_LATENCY_HIGHEST_NS);
+        stage_latencies->merge_stage(static_cast<latency_stage_t>(stage), merged_histogram);
+        write_latency_summary(metrics, "trade_stage_latency_seconds",
+                              std::string("stage=\"") + StageLatencies::stage_to_string(static_cast<latency_stage_t>(stage)) + "\"",
+                              merged_histogram);
+    }
+
+    write_metric_header(metrics, "trade_lock_wait_seconds", "summary", "Waits for contended locks.");
+    for (int lock_wait = 0; lock_wait < LOCK_WAITS_COUNT; ++lock_wait) {
+        LatencyHistogram merged_histogram(STAGE_LATENCY_HIGHEST_NS);
+        stage_latencies->merge_lock_wait(static_cast<lock_wait_t>(lock_wait), merged_histogram);
+        write_latency_summary(metrics, "trade_lock_wait_seconds",
+                              std::string("lock=\"") + StageLatencies::lock_wait_to_string(static_cast<lock_wait_t>(lock_wait)) + "\"",
+                              merged_histogram);
+    }
+
+    return metrics.str();
+}
+
+void MetricsServer::write_metric_header(std::ostream& metrics, const char* name, const char* type, const char* help) {
+    metrics << "# HELP " << name << " " << help << "\n";
+    metrics << "# TYPE " << name << " " << type << "\n";
+}
+
+void MetricsServer::write_latency_summary(std::ostream& metrics, const char* name, const std::string& labels,
+                                          const LatencyHistogram& histogram) {
+    for (double quantile : {0.5, 0.9, 0.99, 0.999}) {
+        metrics << name << "{" << labels << ",quantile=\"" << quantile << "\"} "
+                << histogram.get_value_at_percentile(quantile * 100.0) / 1e9 << "\n";
+    }
+    metrics << name << "_sum{" << labels << "} " << histogram.get_mean() * histogram.get_total_count() / 1e9 << "\n";
+    metrics << name << "_count{" << labels << "} " << histogram.get_total_count() << "\n";
+}
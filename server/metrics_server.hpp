@@ -0,0 +1,70 @@
+#ifndef METRICS_SERVER_HPP
+#define METRICS_SERVER_HPP
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <ostream>
+
+#include <boost/asio.hpp>
+#include <spdlog/spdlog.h>
+
+#include "session_manager.hpp"
+#include "stage_latencies.hpp"
+#include "metric_counters.hpp"
+
+//*INFO: Scrape request is only request line and headers, bigger or slower one is dropped
+#define MAX_SCRAPE_REQUEST_SIZE 8192
+#define SCRAPE_READ_TIMEOUT_MS 5000
+//*INFO: Delay before accept is retried after error other than shutdown, e.g. out of file descriptors
+#define ACCEPT_RETRY_DELAY_MS 100
+
+//*INFO: Forward declaration
+class SessionManager;
+
+//*INFO: Prometheus text format endpoint (GET /metrics) with own port, io context and thread, scrapes never run
+//*INFO: on session or matcher threads. Values are summed from per-thread counters and histograms and read
+//*INFO: from gauges published by matcher, so nothing on order path waits for scrape
+class MetricsServer {
+public:
+    MetricsServer(const std::string& host, short port, std::shared_ptr<SessionManager> session_manager);
+
+    void start();
+    void stop();
+
+    unsigned short get_port() const;
+
+    //*INFO: Whole scrape body, any thread
+    static std::string collect_metrics(SessionManager& session_manager);
+
+private:
+    struct ScrapeConnection {
+        explicit ScrapeConnection(boost::asio::io_context& io_context) : socket(io_context),
+                                                                         read_deadline(io_context),
+                                                                         request(MAX_SCRAPE_REQUEST_SIZE) {}
+
+        boost::asio::ip::tcp::socket socket;
+        boost::asio::steady_timer read_deadline;
+        boost::asio::streambuf request;
+        std::string response;
+    };
+
+    void accept_scrape();
+    void read_scrape_request(std::shared_ptr<ScrapeConnection> connection);
+    static std::string make_http_response(const std::string& status, const std::string& body);
+
+    static void write_metric_header(std::ostream& metrics, const char* name, const char* type, const char* help);
+    //*INFO: Summary of quantiles in seconds, histogram values are nanoseconds
+    static void write_latency_summary(std::ostream& metrics, const char* name, const std::string& labels,
+                                      const LatencyHistogram& histogram);
+
+private:
+    boost::asio::io_context io_context_;
+    boost::asio::ip::tcp::acceptor acceptor_;
+    boost::asio::steady_timer accept_retry_timer_;
+    std::thread metrics_thread_;
+
+    std::shared_ptr<SessionManager> session_manager_;
+};
+
+#endif // METRICS_SERVER_HPP
@@ -0,0 +1,269 @@
+#include "order_book.hpp"
+
+OrderBook::OrderBook() : next_arrival_sequence_(0) {
+}
+
+const Serialize::TradeOrder* OrderBook::add_order(const Serialize::TradeOrder& order) {
+    if (orders_index_.find(order.order_id()) != orders_index_.end()) {
+        return nullptr;
+    }
+
+    int64_t price_key = to_price_key(order.usd_cost());
+    OrdersQueue& level = (order.type() == Serialize::TradeOrder::BUY) ? buy_levels_[price_key] : sell_levels_[price_key];
+    auto order_iterator = level.insert(level.end(), order);
+
+    if (is_iceberg_order(*order_iterator) && order_iterator->displayed_amount() <= 0) {
+        order_iterator->set_displayed_amount(std::min(order_iterator->peak_amount(), order_iterator->usd_amount()));
+    }
+
+    orders_index_[order.order_id()] = OrderLocation{order.type(), price_key, order_iterator, next_arrival_sequence_++};
+    return &*order_iterator;
+}
+
+bool OrderBook::remove_order(int64_t order_id, Serialize::TradeOrder::TradeType type, Serialize::TradeOrder& removed_order) {
+    auto index_iterator = orders_index_.find(order_id);
+    if (index_iterator == orders_index_.end() || index_iterator->second.type != type) {
+        return false;
+    }
+
+    const OrderLocation& location = index_iterator->second;
+    removed_order = *location.order_iterator;
+
+    if (type == Serialize::TradeOrder::BUY) {
+        remove_from_levels(buy_levels_, location);
+    } else {
+        remove_from_levels(sell_levels_, location);
+    }
+
+    orders_index_.erase(index_iterator);
+    return true;
+}
+
+Serialize::TradeOrder* OrderBook::find_order(int64_t order_id, Serialize::TradeOrder::TradeType type) {
+    auto index_iterator = orders_index_.find(order_id);
+    if (index_iterator == orders_index_.end() || index_iterator->second.type != type) {
+        return nullptr;
+    }
+    return &*index_iterator->second.order_iterator;
+}
+
+template<typename Levels>
+void OrderBook::remove_from_levels(Levels& levels, const OrderLocation& location) {
+    auto level_iterator = levels.find(location.price_key);
+    if (level_iterator == levels.end()) {
+        return;
+    }
+
+    level_iterator->second.erase(location.order_iterator);
+    if (level_iterator->second.empty()) {
+        levels.erase(level_iterator);
+    }
+}
+
+Serialize::TradeOrder* OrderBook::get_best_order(Serialize::TradeOrder::TradeType type) {
+    return (type == Serialize::TradeOrder::BUY) ? get_best_order_from_levels(buy_levels_)
+                                                : get_best_order_from_levels(sell_levels_);
+}
+
+template<typename Levels>
+Serialize::TradeOrder* OrderBook::get_best_order_from_levels(Levels& levels) {
+    if (levels.empty()) {
+        return nullptr;
+    }
+    return &levels.begin()->second.front();
+}
+
+void OrderBook::pop_best_order(Serialize::TradeOrder::TradeType type) {
+    if (type == Serialize::TradeOrder::BUY) {
+        pop_best_order_from_levels(buy_levels_);
+    } else {
+        pop_best_order_from_levels(sell_levels_);
+    }
+}
+
+template<typename Levels>
+void OrderBook::pop_best_order_from_levels(Levels& levels) {
+    if (levels.empty()) {
+        return;
+    }
+
+    auto level_iterator = levels.begin();
+    orders_index_.erase(level_iterator->second.front().order_id());
+    level_iterator->second.pop_front();
+    if (level_iterator->second.empty()) {
+        levels.erase(level_iterator);
+    }
+}
+
+void OrderBook::requeue_best_order(Serialize::TradeOrder::TradeType type) {
+    if (type == Serialize::TradeOrder::BUY) {
+        requeue_best_order_in_levels(buy_levels_);
+    } else {
+        requeue_best_order_in_levels(sell_levels_);
+    }
+}
+
+//*INFO: splice keeps iterator in orders_index_ valid
+template<typename Levels>
+void OrderBook::requeue_best_order_in_levels(Levels& levels) {
+    if (levels.empty()) {
+        return;
+    }
+
+    OrdersQueue& level = levels.begin()->second;
+    orders_index_[level.front().order_id()].arrival_sequence = next_arrival_sequence_++;
+    level.splice(level.end(), level, level.begin());
+}
+
+bool OrderBook::is_newer_order(const Serialize::TradeOrder& order, const Serialize::TradeOrder& other_order) const {
+    auto index_iterator = orders_index_.find(order.order_id());
+    auto other_index_iterator = orders_index_.find(other_order.order_id());
+    if (index_iterator == orders_index_.end() || other_index_iterator == orders_index_.end()) {
+        return order.order_id() > other_order.order_id();
+    }
+    return index_iterator->second.arrival_sequence > other_index_iterator->second.arrival_sequence;
+}
+
+int64_t OrderBook::get_available_amount(Serialize::TradeOrder::TradeType type, double limit_price, bool is_price_limited,
+                                        int64_t needed_amount, uint32_t self_account_id, bool is_stopped_by_self_order) const {
+    int64_t limit_price_key = to_price_key(limit_price);
+    return (type == Serialize::TradeOrder::BUY)
+        ? get_available_amount_from_levels(buy_levels_, limit_price_key, is_price_limited, needed_amount,
+                                           self_account_id, is_stopped_by_self_order)
+        : get_available_amount_from_levels(sell_levels_, limit_price_key, is_price_limited, needed_amount,
+                                           self_account_id, is_stopped_by_self_order);
+}
+
+//*INFO: Levels are sorted from best, so walk stops on first level that limit price does not accept.
+//*INFO: Replenished iceberg goes behind own order, so only peaks ahead of it are reachable on its level
+template<typename Levels>
+int64_t OrderBook::get_available_amount_from_levels(const Levels& levels, int64_t limit_price_key, bool is_price_limited,
+                                                    int64_t needed_amount, uint32_t self_account_id,
+                                                    bool is_stopped_by_self_order) const {
+    int64_t available_amount = 0;
+
+    for (const auto& [price_key, level] : levels) {
+        if (is_price_limited && levels.key_comp()(limit_price_key, price_key)) {
+            break;
+        }
+
+        int64_t level_amount = 0;
+        int64_t level_displayed_amount = 0;
+        for (const auto& order : level) {
+            if (self_account_id != 0 && order.account_id() == self_account_id) {
+                if (is_stopped_by_self_order) {
+                    return available_amount + level_displayed_amount;
+                }
+                continue;
+            }
+
+            level_amount += order.usd_amount();
+            level_displayed_amount += get_displayed_amount(order);
+            //*INFO: Own order may still follow on level, until then only shown peaks are sure to fill
+            int64_t reachable_amount = is_stopped_by_self_order ? level_displayed_amount : level_amount;
+            if (available_amount + reachable_amount >= needed_amount) {
+                return available_amount + reachable_amount;
+            }
+        }
+
+        available_amount += level_amount;
+        if (available_amount >= needed_amount) {
+            return available_amount;
+        }
+    }
+
+    return available_amount;
+}
+
+//*INFO: One pass from low to high price over merged level keys. Sell supply at price grows with each sell level passed,
+//*INFO: buy demand at price is total buy amount without buy levels below it
+int64_t OrderBook::find_clearing_price(int64_t reference_price_key, int64_t& clearing_price_key) const {
+    int64_t buy_demand = 0;
+    for (const auto& [price_key, level] : buy_levels_) {
+        for (const auto& order : level) {
+            buy_demand += order.usd_amount();
+        }
+    }
+
+    int64_t sell_supply = 0;
+    int64_t best_volume = 0;
+    int64_t best_imbalance = 0;
+
+    auto sell_iterator = sell_levels_.begin();
+    auto buy_iterator = buy_levels_.rbegin();
+    while (sell_iterator != sell_levels_.end() || buy_iterator != buy_levels_.rend()) {
+        int64_t price_key = (buy_iterator == buy_levels_.rend() ||
+                             (sell_iterator != sell_levels_.end() && sell_iterator->first < buy_iterator->first))
+                            ? sell_iterator->first : buy_iterator->first;
+
+        if (sell_iterator != sell_levels_.end() && sell_iterator->first == price_key) {
+            for (const auto& order : sell_iterator->second) {
+                sell_supply += order.usd_amount();
+            }
+            ++sell_iterator;
+        }
+
+        int64_t volume = std::min(buy_demand, sell_supply);
+        int64_t imbalance = std::llabs(buy_demand - sell_supply);
+        if (volume > best_volume ||
+            (volume == best_volume && volume > 0 &&
+             (imbalance < best_imbalance ||
+              (imbalance == best_imbalance &&
+               std::llabs(price_key - reference_price_key) < std::llabs(clearing_price_key - reference_price_key))))) {
+            best_volume = volume;
+            best_imbalance = imbalance;
+            clearing_price_key = price_key;
+        }
+
+        if (buy_iterator != buy_levels_.rend() && buy_iterator->first == price_key) {
+            for (const auto& order : buy_iterator->second) {
+                buy_demand -= order.usd_amount();
+            }
+            ++buy_iterator;
+        }
+    }
+
+    return best_volume;
+}
+
+bool OrderBook::empty(Serialize::TradeOrder::TradeType type) const {
+    return (type == Serialize::TradeOrder::BUY) ? buy_levels_.empty() : sell_levels_.empty();
+}
+
+size_t OrderBook::size() const {
+    return orders_index_.size();
+}
+
+std::vector<Serialize::TradeOrder> OrderBook::get_orders(Serialize::TradeOrder::TradeType type) const {
+    std::vector<Serialize::TradeOrder> orders;
+
+    auto copy_levels = [&orders](const auto& levels) {
+        for (const auto& [price_key, level] : levels) {
+            orders.insert(orders.end(), level.begin(), level.end());
+        }
+    };
+    (type == Serialize::TradeOrder::BUY) ? copy_levels(buy_levels_) : copy_levels(sell_levels_);
+
+    return orders;
+}
+
+int64_t OrderBook::to_price_key(double price) {
+    return std::llround(price * PRICE_KEY_SCALE);
+}
+
+bool OrderBook::is_iceberg_order(const Serialize::TradeOrder& order) {
+    return order.peak_amount() > 0;
+}
+
+bool OrderBook::is_resting_order(const Serialize::TradeOrder& order) {
+    return order.order_type() == Serialize::TradeOrder::LIMIT &&
+           (order.time_in_force() == Serialize::TradeOrder::GTC || is_expiring_order(order));
+}
+
+bool OrderBook::is_expiring_order(const Serialize::TradeOrder& order) {
+    return order.time_in_force() == Serialize::TradeOrder::GTD || order.time_in_force() == Serialize::TradeOrder::DAY;
+}
+
+int32_t OrderBook::get_displayed_amount(const Serialize::TradeOrder& order) {
+    return is_iceberg_order(order) ? order.displayed_amount() : order.usd_amount();
+}
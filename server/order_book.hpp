@@ -0,0 +1,97 @@
+#ifndef ORDER_BOOK_HPP
+#define ORDER_BOOK_HPP
+
+#include <map>
+#include <list>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+#include "trade_market_protocol.pb.h"
+
+//*INFO: Orders are looked up by id and side
+using OrderKey = std::pair<int64_t, Serialize::TradeOrder::TradeType>;
+
+//*INFO: Price key = price * PRICE_KEY_SCALE, prices are compared exactly on keys
+#define PRICE_KEY_SCALE 10000
+
+//*INFO: Price-time priority book of resting limit orders. Price levels are sorted maps of FIFO lists,
+//*INFO: index by order id gives cancel without scanning the book. Used only under core_mutex_.
+//*INFO: Iceberg order keeps whole usd_amount, only displayed_amount of it is shown and matched at a time
+class OrderBook {
+public:
+    OrderBook();
+
+    //*INFO: Returns order stored in book, nullptr if order id is already there. Iceberg enters with first peak shown
+    const Serialize::TradeOrder* add_order(const Serialize::TradeOrder& order);
+    bool remove_order(int64_t order_id, Serialize::TradeOrder::TradeType type, Serialize::TradeOrder& removed_order);
+    //*INFO: Order may be changed in place only if its price stays the same
+    Serialize::TradeOrder* find_order(int64_t order_id, Serialize::TradeOrder::TradeType type);
+
+    //*INFO: Oldest order of best price level, it may be changed in place until it is popped
+    Serialize::TradeOrder* get_best_order(Serialize::TradeOrder::TradeType type);
+    void pop_best_order(Serialize::TradeOrder::TradeType type);
+    //*INFO: Best order goes to the end of its price level and loses time priority
+    void requeue_best_order(Serialize::TradeOrder::TradeType type);
+    //*INFO: Order that entered book or was requeued later. Arrival sequence is exact, timestamps
+    //*INFO: of client orders have millisecond resolution and stay unchanged when order is requeued
+    bool is_newer_order(const Serialize::TradeOrder& order, const Serialize::TradeOrder& other_order) const;
+
+    //*INFO: Amount resting on side at prices acceptable for limit_price (any price if is_price_limited is false),
+    //*INFO: counting stops as soon as needed_amount is reached. Iceberg counts with hidden reserve, taker cycles
+    //*INFO: its level until reserve is gone. Orders of self_account_id (0 - none) are not counted, with
+    //*INFO: is_stopped_by_self_order counting ends on first of them after peaks shown ahead of it on its level
+    int64_t get_available_amount(Serialize::TradeOrder::TradeType type, double limit_price, bool is_price_limited,
+                                 int64_t needed_amount, uint32_t self_account_id, bool is_stopped_by_self_order) const;
+
+    //*INFO: Call auction uncrossing. Price key executing max volume (hidden amounts included), ties go to smaller
+    //*INFO: imbalance, then to price closer to reference. Returns volume, 0 if book is not crossed
+    int64_t find_clearing_price(int64_t reference_price_key, int64_t& clearing_price_key) const;
+
+    bool empty(Serialize::TradeOrder::TradeType type) const;
+    size_t size() const;
+    std::vector<Serialize::TradeOrder> get_orders(Serialize::TradeOrder::TradeType type) const;
+
+    static int64_t to_price_key(double price);
+    static bool is_iceberg_order(const Serialize::TradeOrder& order);
+    //*INFO: Limit order with GTC, GTD or DAY time in force rests in book, others are matched on arrival only
+    static bool is_resting_order(const Serialize::TradeOrder& order);
+    static bool is_expiring_order(const Serialize::TradeOrder& order);
+    //*INFO: Part of usd_amount shown in depth and listings and matchable by one fill
+    static int32_t get_displayed_amount(const Serialize::TradeOrder& order);
+
+private:
+    using OrdersQueue = std::list<Serialize::TradeOrder>;
+
+    struct OrderLocation {
+        Serialize::TradeOrder::TradeType type;
+        int64_t price_key;
+        OrdersQueue::iterator order_iterator;
+        uint64_t arrival_sequence;
+    };
+
+    template<typename Levels>
+    Serialize::TradeOrder* get_best_order_from_levels(Levels& levels);
+    template<typename Levels>
+    void pop_best_order_from_levels(Levels& levels);
+    template<typename Levels>
+    void requeue_best_order_in_levels(Levels& levels);
+    template<typename Levels>
+    void remove_from_levels(Levels& levels, const OrderLocation& location);
+    template<typename Levels>
+    int64_t get_available_amount_from_levels(const Levels& levels, int64_t limit_price_key, bool is_price_limited,
+                                             int64_t needed_amount, uint32_t self_account_id,
+                                             bool is_stopped_by_self_order) const;
+
+private:
+    std::map<int64_t, OrdersQueue, std::greater<int64_t>> buy_levels_;
+    std::map<int64_t, OrdersQueue, std::less<int64_t>> sell_levels_;
+    std::unordered_map<int64_t, OrderLocation> orders_index_;
+    uint64_t next_arrival_sequence_;
+};
+
+#endif // ORDER_BOOK_HPP
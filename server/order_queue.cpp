@@ -3,14 +3,18 @@
 OrderQueue::OrderQueue() {
 }
 
-bool OrderQueue::push(const Serialize::TradeOrder& order) {
-    return concurrent_queue_.enqueue(order);
+bool OrderQueue::push(const QueuedOrder& queued_order) {
+    return concurrent_queue_.enqueue(queued_order);
 }
 
-bool OrderQueue::pop(Serialize::TradeOrder& order) {
-    return concurrent_queue_.try_dequeue(order);
+bool OrderQueue::pop(QueuedOrder& queued_order) {
+    return concurrent_queue_.try_dequeue(queued_order);
 }
 
 bool OrderQueue::is_empty() const {
     return concurrent_queue_.size_approx() == 0;
-}
\ No newline at end of file
+}
+
+size_t OrderQueue::get_size() const {
+    return concurrent_queue_.size_approx();
+}
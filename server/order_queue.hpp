@@ -9,15 +9,24 @@
 #include "trade_market_protocol.pb.h"
 #include <moodycamel/concurrentqueue.h>
 
+//*INFO: Order on its way from session to matcher with stage time points (StageLatencies::now_ns), they never leave server
+struct QueuedOrder {
+    Serialize::TradeOrder order;
+    int64_t receive_time = 0;
+    int64_t enqueue_time = 0;
+};
+
 class OrderQueue {
 public:
     OrderQueue();
-    bool push(const Serialize::TradeOrder& order);
-    bool pop(Serialize::TradeOrder& order);
+    bool push(const QueuedOrder& queued_order);
+    bool pop(QueuedOrder& queued_order);
     bool is_empty() const;
+    //*INFO: Approximate while other threads push and pop
+    size_t get_size() const;
 
 private:
-    moodycamel::ConcurrentQueue<Serialize::TradeOrder> concurrent_queue_;
+    moodycamel::ConcurrentQueue<QueuedOrder> concurrent_queue_;
 };
 
 #endif // ORDER_QUEUE
@@ -0,0 +1,71 @@
+#ifndef PER_THREAD_SLOTS_HPP
+#define PER_THREAD_SLOTS_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstdint>
+
+//*INFO: Ids are never reused, so thread local cache can't take new instance for destroyed one at same address
+inline uint64_t get_next_per_thread_slots_instance_id() {
+    static std::atomic<uint64_t> next_instance_id(1);
+    return next_instance_id.fetch_add(1);
+}
+
+//*INFO: One T per thread, created on first get() of the thread. Thread writes own slot without locks,
+//*INFO: for_each visits slots of all threads to aggregate them. Slots of finished threads stay
+template<typename T>
+class PerThreadSlots {
+public:
+    PerThreadSlots() : instance_id_(get_next_per_thread_slots_instance_id()) {}
+    PerThreadSlots(const PerThreadSlots&) = delete;
+    PerThreadSlots& operator=(const PerThreadSlots&) = delete;
+
+    //*INFO: Registry is locked only when thread gets slot first time or moves to another instance
+    T& get() {
+        thread_local uint64_t cached_instance_id = 0;
+        thread_local T* cached_slot = nullptr;
+        if (cached_instance_id == instance_id_) {
+            return *cached_slot;
+        }
+
+        std::lock_guard<std::mutex> slots_lock_guard(slots_mutex_);
+        T* slot = nullptr;
+        for (auto& registered_slot : slots_) {
+            if (registered_slot.thread_id == std::this_thread::get_id()) {
+                slot = registered_slot.value.get();
+                break;
+            }
+        }
+        if (slot == nullptr) {
+            slots_.push_back(Slot{std::this_thread::get_id(), std::make_unique<T>()});
+            slot = slots_.back().value.get();
+        }
+
+        cached_instance_id = instance_id_;
+        cached_slot = slot;
+        return *slot;
+    }
+
+    template<typename F>
+    void for_each(F on_slot) const {
+        std::lock_guard<std::mutex> slots_lock_guard(slots_mutex_);
+        for (const auto& slot : slots_) {
+            on_slot(static_cast<const T&>(*slot.value));
+        }
+    }
+
+private:
+    struct Slot {
+        std::thread::id thread_id;
+        std::unique_ptr<T> value;
+    };
+
+    uint64_t instance_id_;
+    mutable std::mutex slots_mutex_;
+    std::vector<Slot> slots_;
+};
+
+#endif // PER_THREAD_SLOTS_HPP
@@ -0,0 +1,102 @@
+#ifndef RING_BUFFER_HPP
+#define RING_BUFFER_HPP
+
+#include <array>
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+//*INFO: Fixed-capacity ring, newest entries overwrite oldest ones.
+//*INFO: One writer thread, any number of readers. Readers never block writer and never take locks:
+//*INFO: every slot is guarded by its own sequence (seqlock), torn or overwritten slots are skipped.
+//*INFO: Record is kept as relaxed atomic words, so reading slot that is being written is not a data race
+template<typename T, std::size_t Capacity>
+class RingBuffer {
+    static_assert(std::is_trivially_copyable_v<T>, "RingBuffer stores trivially copyable records only");
+    static_assert(Capacity > 0, "RingBuffer capacity must be positive");
+
+public:
+    RingBuffer() : head_(0) {
+        for (auto& slot : slots_) {
+            slot.sequence.store(0, std::memory_order_relaxed);
+            for (auto& word : slot.words) {
+                word.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    //*INFO: Avalible only on writer thread
+    void push(const T& value) {
+        uint64_t position = head_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[position % Capacity];
+
+        uint64_t words[SLOT_WORDS] = {};
+        std::memcpy(words, &value, sizeof(T));
+
+        slot.sequence.store(2 * position + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t word = 0; word < SLOT_WORDS; ++word) {
+            slot.words[word].store(words[word], std::memory_order_relaxed);
+        }
+        slot.sequence.store(2 * position + 2, std::memory_order_release);
+
+        head_.store(position + 1, std::memory_order_release);
+    }
+
+    //*INFO: Oldest to newest, consistent copy of every entry that was not overwritten during read
+    std::vector<T> snapshot() const {
+        std::vector<T> values;
+
+        uint64_t head = head_.load(std::memory_order_acquire);
+        uint64_t first = (head > Capacity) ? head - Capacity : 0;
+        values.reserve(head - first);
+
+        for (uint64_t position = first; position < head; ++position) {
+            const Slot& slot = slots_[position % Capacity];
+
+            uint64_t sequence_before = slot.sequence.load(std::memory_order_acquire);
+            if (sequence_before != 2 * position + 2) {
+                continue;
+            }
+            uint64_t words[SLOT_WORDS];
+            for (std::size_t word = 0; word < SLOT_WORDS; ++word) {
+                words[word] = slot.words[word].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != sequence_before) {
+                continue;
+            }
+
+            T value{};
+            std::memcpy(&value, words, sizeof(T));
+            values.push_back(value);
+        }
+
+        return values;
+    }
+
+    std::size_t size() const {
+        uint64_t head = head_.load(std::memory_order_acquire);
+        return (head > Capacity) ? Capacity : static_cast<std::size_t>(head);
+    }
+
+    static constexpr std::size_t capacity() {
+        return Capacity;
+    }
+
+private:
+    static constexpr std::size_t SLOT_WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    struct Slot {
+        std::atomic<uint64_t> sequence;
+        std::array<std::atomic<uint64_t>, SLOT_WORDS> words;
+    };
+
+    std::array<Slot, Capacity> slots_;
+    alignas(64) std::atomic<uint64_t> head_;
+};
+
+#endif // RING_BUFFER_HPP
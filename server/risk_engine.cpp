@@ -0,0 +1,193 @@
+#include "risk_engine.hpp"
+
+RiskEngine::RiskEngine(const RiskLimits& limits) : limits_(limits), last_trade_price_(0.0) {
+}
+
+void RiskEngine::set_limits(const RiskLimits& limits) {
+    limits_ = limits;
+}
+
+risk_check_result_t RiskEngine::check_and_reserve(Serialize::TradeOrder& order, AccountBalanceSlot& account_balance) {
+    const bool is_stop_order = (order.order_type() == Serialize::TradeOrder::STOP ||
+                                order.order_type() == Serialize::TradeOrder::STOP_LIMIT);
+    const bool is_market_order = (order.order_type() == Serialize::TradeOrder::MARKET ||
+                                  order.order_type() == Serialize::TradeOrder::STOP);
+    if (is_stop_order && order.stop_price() <= 0.0) {
+        return RISK_REJECTED_INVALID_ORDER;
+    }
+    const bool is_immediate_order = (order.time_in_force() == Serialize::TradeOrder::IOC ||
+                                     order.time_in_force() == Serialize::TradeOrder::FOK);
+    //*INFO: Only resting limit order may hide part of its amount
+    if (order.peak_amount() < 0 ||
+        (order.peak_amount() > 0 && (order.order_type() != Serialize::TradeOrder::LIMIT || is_immediate_order))) {
+        return RISK_REJECTED_INVALID_ORDER;
+    }
+    //*INFO: Expire time is taken from client only for GTD order
+    int64_t current_timestamp = TimeOrderUtils::get_current_timestamp();
+    if (order.time_in_force() == Serialize::TradeOrder::GTD) {
+        if (order.expire_time() <= current_timestamp) {
+            return RISK_REJECTED_INVALID_ORDER;
+        }
+    } else if (order.time_in_force() == Serialize::TradeOrder::DAY) {
+        order.set_expire_time(TimeOrderUtils::get_end_of_day_timestamp(current_timestamp));
+    } else {
+        order.clear_expire_time();
+    }
+    //*INFO: Stop order becomes market order at its stop price, so band is applied around it
+    if (is_market_order) {
+        apply_market_protection_price(order, is_stop_order ? order.stop_price() : get_last_trade_price());
+    }
+
+    if (order.usd_amount() <= 0 || (!is_market_order && order.usd_cost() <= 0.0)) {
+        return RISK_REJECTED_INVALID_ORDER;
+    }
+    //*INFO: Market buy without protection price has unknown cost and can't be reserved
+    if (is_market_order && order.type() == Serialize::TradeOrder::BUY &&
+        order.usd_cost() <= 0.0 && limits_.is_balance_check_enabled) {
+        return RISK_REJECTED_INVALID_ORDER;
+    }
+
+    if (limits_.max_order_usd_amount != 0 && order.usd_amount() > limits_.max_order_usd_amount) {
+        return RISK_REJECTED_ORDER_SIZE;
+    }
+
+    //*INFO: No band until the first trade, stop orders are checked against it only when triggered
+    double last_trade_price = get_last_trade_price();
+    if (!is_market_order && !is_stop_order && limits_.price_band_percent > 0.0 && last_trade_price > 0.0 &&
+        std::fabs(order.usd_cost() - last_trade_price) > last_trade_price * limits_.price_band_percent / 100.0) {
+        return RISK_REJECTED_PRICE_BAND;
+    }
+
+    if (!account_balance.try_open_order(limits_.max_open_orders_per_client)) {
+        return RISK_REJECTED_OPEN_ORDERS_LIMIT;
+    }
+
+    int64_t usd_reservation;
+    int64_t rub_reservation;
+    get_reservation_amounts(order.type(), order.usd_cost(), order.usd_amount(), usd_reservation, rub_reservation);
+
+    if (!account_balance.try_reserve(usd_reservation, rub_reservation,
+                                     AccountBalanceSlot::to_fixed_point(limits_.usd_credit_limit),
+                                     AccountBalanceSlot::to_fixed_point(limits_.rub_credit_limit),
+                                     limits_.is_balance_check_enabled)) {
+        account_balance.close_order();
+        return RISK_REJECTED_INSUFFICIENT_BALANCE;
+    }
+
+    return RISK_ACCEPTED;
+}
+
+risk_check_result_t RiskEngine::check_and_modify_reservation(const Serialize::TradeOrder& order, double new_usd_cost,
+                                                             int32_t new_usd_amount, AccountBalanceSlot& account_balance) {
+    if (new_usd_amount <= 0 || new_usd_cost <= 0.0) {
+        return RISK_REJECTED_INVALID_ORDER;
+    }
+
+    if (limits_.max_order_usd_amount != 0 && new_usd_amount > limits_.max_order_usd_amount) {
+        return RISK_REJECTED_ORDER_SIZE;
+    }
+
+    double last_trade_price = get_last_trade_price();
+    if (new_usd_cost != order.usd_cost() && limits_.price_band_percent > 0.0 && last_trade_price > 0.0 &&
+        std::fabs(new_usd_cost - last_trade_price) > last_trade_price * limits_.price_band_percent / 100.0) {
+        return RISK_REJECTED_PRICE_BAND;
+    }
+
+    int64_t old_usd_reservation;
+    int64_t old_rub_reservation;
+    get_reservation_amounts(order.type(), order.usd_cost(), order.usd_amount(), old_usd_reservation, old_rub_reservation);
+
+    int64_t new_usd_reservation;
+    int64_t new_rub_reservation;
+    get_reservation_amounts(order.type(), new_usd_cost, new_usd_amount, new_usd_reservation, new_rub_reservation);
+
+    //*INFO: Only one side of reservation is used by order, so deltas never have different signs
+    int64_t usd_delta = new_usd_reservation - old_usd_reservation;
+    int64_t rub_delta = new_rub_reservation - old_rub_reservation;
+    if (usd_delta > 0 || rub_delta > 0) {
+        if (!account_balance.try_reserve(std::max<int64_t>(usd_delta, 0), std::max<int64_t>(rub_delta, 0),
+                                         AccountBalanceSlot::to_fixed_point(limits_.usd_credit_limit),
+                                         AccountBalanceSlot::to_fixed_point(limits_.rub_credit_limit),
+                                         limits_.is_balance_check_enabled)) {
+            return RISK_REJECTED_INSUFFICIENT_BALANCE;
+        }
+    } else {
+        account_balance.release(-usd_delta, -rub_delta);
+    }
+
+    return RISK_ACCEPTED;
+}
+
+//*INFO: Market order may trade up to price band around reference price (last trade or stop price),
+//*INFO: band edge becomes its usd_cost. Without reference price or band usd_cost is 0, it means any price
+void RiskEngine::apply_market_protection_price(Serialize::TradeOrder& order, double reference_price) const {
+    if (reference_price <= 0.0 || limits_.price_band_percent <= 0.0) {
+        order.set_usd_cost(0.0);
+        return;
+    }
+
+    double band = reference_price * limits_.price_band_percent / 100.0;
+    double protection_price = (order.type() == Serialize::TradeOrder::BUY) ? reference_price + band : reference_price - band;
+    order.set_usd_cost(std::max(protection_price, 0.0));
+}
+
+void RiskEngine::restore_reservation(const Serialize::TradeOrder& order, AccountBalanceSlot& account_balance) {
+    int64_t usd_reservation;
+    int64_t rub_reservation;
+    get_reservation_amounts(order.type(), order.usd_cost(), order.usd_amount(), usd_reservation, rub_reservation);
+
+    account_balance.try_open_order(0);
+    account_balance.try_reserve(usd_reservation, rub_reservation, 0, 0, false);
+}
+
+void RiskEngine::release(Serialize::TradeOrder::TradeType type, double usd_cost, int32_t usd_amount,
+                         AccountBalanceSlot& account_balance) {
+    int64_t usd_reservation;
+    int64_t rub_reservation;
+    get_reservation_amounts(type, usd_cost, usd_amount, usd_reservation, rub_reservation);
+
+    account_balance.release(usd_reservation, rub_reservation);
+}
+
+void RiskEngine::close_order(AccountBalanceSlot& account_balance) {
+    account_balance.close_order();
+}
+
+void RiskEngine::update_last_trade_price(double price) {
+    last_trade_price_.store(price, std::memory_order_relaxed);
+}
+
+double RiskEngine::get_last_trade_price() const {
+    return last_trade_price_.load(std::memory_order_relaxed);
+}
+
+//*INFO: RUB reservation is price in fixed point times amount, so reservations of partial fills sum up exactly
+void RiskEngine::get_reservation_amounts(Serialize::TradeOrder::TradeType type, double usd_cost, int32_t usd_amount,
+                                         int64_t& usd_reservation, int64_t& rub_reservation) {
+    if (type == Serialize::TradeOrder::BUY) {
+        usd_reservation = 0;
+        rub_reservation = AccountBalanceSlot::to_fixed_point(usd_cost) * usd_amount;
+    } else {
+        usd_reservation = static_cast<int64_t>(usd_amount) * BALANCE_FIXED_POINT_SCALE;
+        rub_reservation = 0;
+    }
+}
+
+const char* RiskEngine::risk_check_result_to_string(risk_check_result_t risk_check_result) {
+    switch (risk_check_result) {
+        case RISK_ACCEPTED:
+            return "accepted";
+        case RISK_REJECTED_INVALID_ORDER:
+            return "order amount and price must be positive, market buy needs last trade price";
+        case RISK_REJECTED_ORDER_SIZE:
+            return "order amount exceeds max order size";
+        case RISK_REJECTED_PRICE_BAND:
+            return "order price is outside of price band around last trade";
+        case RISK_REJECTED_OPEN_ORDERS_LIMIT:
+            return "too many open orders";
+        case RISK_REJECTED_INSUFFICIENT_BALANCE:
+            return "insufficient available balance";
+        default:
+            return "unknown";
+    }
+}
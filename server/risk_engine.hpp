@@ -0,0 +1,68 @@
+#ifndef RISK_ENGINE_HPP
+#define RISK_ENGINE_HPP
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+#include "account_balance.hpp"
+#include "time_order_utils.hpp"
+#include "trade_market_protocol.pb.h"
+
+//*INFO: Limit value 0 means unlimited
+struct RiskLimits {
+    bool is_balance_check_enabled = false;  //*INFO: false - orders only reserve, never rejected for balance
+    double usd_credit_limit = 0.0;          //*INFO: how far below zero balance may go
+    double rub_credit_limit = 0.0;
+    int32_t max_order_usd_amount = 0;
+    double price_band_percent = 0.0;        //*INFO: max deviation of order price from last trade price
+    uint32_t max_open_orders_per_client = 0;
+};
+
+enum risk_check_result_t {
+    RISK_ACCEPTED,
+    RISK_REJECTED_INVALID_ORDER,
+    RISK_REJECTED_ORDER_SIZE,
+    RISK_REJECTED_PRICE_BAND,
+    RISK_REJECTED_OPEN_ORDERS_LIMIT,
+    RISK_REJECTED_INSUFFICIENT_BALANCE
+};
+
+//*INFO: Pre-trade checks on session thread before order reaches matcher queue. No locks and no DB:
+//*INFO: per-account state lives in AccountBalanceSlot atomics, last trade price is set by core thread.
+//*INFO: Buy order reserves usd_amount * usd_cost RUB, sell order reserves usd_amount USD
+class RiskEngine {
+public:
+    RiskEngine(const RiskLimits& limits = RiskLimits{});
+
+    //*INFO: Only before sessions are accepted
+    void set_limits(const RiskLimits& limits);
+
+    //*INFO: Market and stop orders get their protection price here
+    risk_check_result_t check_and_reserve(Serialize::TradeOrder& order, AccountBalanceSlot& account_balance);
+    //*INFO: Resting order gets new price and open amount, only difference of reservations is reserved or released
+    risk_check_result_t check_and_modify_reservation(const Serialize::TradeOrder& order, double new_usd_cost, int32_t new_usd_amount,
+                                                     AccountBalanceSlot& account_balance);
+    //*INFO: Order loaded from DB on startup, reserved without checks
+    void restore_reservation(const Serialize::TradeOrder& order, AccountBalanceSlot& account_balance);
+    //*INFO: On fill or cancel of usd_amount of order
+    void release(Serialize::TradeOrder::TradeType type, double usd_cost, int32_t usd_amount, AccountBalanceSlot& account_balance);
+    void close_order(AccountBalanceSlot& account_balance);
+
+    void update_last_trade_price(double price);
+    double get_last_trade_price() const;
+
+    static const char* risk_check_result_to_string(risk_check_result_t risk_check_result);
+
+private:
+    void apply_market_protection_price(Serialize::TradeOrder& order, double reference_price) const;
+    static void get_reservation_amounts(Serialize::TradeOrder::TradeType type, double usd_cost, int32_t usd_amount,
+                                        int64_t& usd_reservation, int64_t& rub_reservation);
+
+private:
+    RiskLimits limits_;
+    std::atomic<double> last_trade_price_;
+};
+
+#endif // RISK_ENGINE_HPP
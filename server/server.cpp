@@ -2,41 +2,108 @@
 
 Server::Server(boost::asio::io_context& io_context, const Config& config) :
         io_context_(io_context),
-        acceptor_(io_context, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), config.port)),
         session_manager_(std::make_shared<SessionManager>()) {
-    spdlog::info("Server launched! Listen  {} : {}", config.host, config.port);
+    open_acceptors(config);
+    spdlog::info("Server launched! Listen  {} : {}, acceptors: {}", config.host, config.port, acceptors_.size());
 
     session_manager_->init_database();
     session_manager_->init_core();
     session_manager_->init_client_data_manager();
+    session_manager_->init_risk_engine();
+    session_manager_->init_matching_rules();
     session_manager_->init_auth();
+    session_manager_->init_admission_controller();
     try {
         auto database = session_manager_->get_database();
         database->truncate_active_orders_table();
     } catch (const std::exception& e) {
         spdlog::error("Error to truncate active orders table: {}", e.what());
     }
+    open_metrics_server(config);
 
     start();
 }
 
+void Server::open_acceptors(const Config& config) {
+    boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::tcp::v4(), config.port);
+    uint32_t acceptors_count = std::max<uint32_t>(config.acceptors, 1);
+#ifndef SO_REUSEPORT
+    if (acceptors_count > 1) {
+        spdlog::warn("SO_REUSEPORT is not supported on this platform, {} acceptors requested, 1 is opened", acceptors_count);
+        acceptors_count = 1;
+    }
+#endif
+    bool reuse_port = acceptors_count > 1;
+
+    acceptors_.push_back(open_acceptor(io_context_, endpoint, reuse_port));
+
+    for (uint32_t i = 1; i < acceptors_count; ++i) {
+        acceptors_io_contexts_.push_back(std::make_unique<boost::asio::io_context>(1));
+        acceptors_.push_back(open_acceptor(*acceptors_io_contexts_.back(), endpoint, reuse_port));
+    }
+}
+
+std::unique_ptr<boost::asio::ip::tcp::acceptor> Server::open_acceptor(boost::asio::io_context& io_context,
+                                                                      const boost::asio::ip::tcp::endpoint& endpoint,
+                                                                      bool reuse_port) {
+    auto acceptor = std::make_unique<boost::asio::ip::tcp::acceptor>(io_context);
+
+    acceptor->open(endpoint.protocol());
+    acceptor->set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+#ifdef SO_REUSEPORT
+    if (reuse_port) {
+        acceptor->set_option(ReusePortOption(true));
+    }
+#endif
+    acceptor->bind(endpoint);
+    acceptor->listen();
+
+    return acceptor;
+}
+
 void Server::start() {
-    session_manager_thread_ = std::thread(&SessionManager::run, session_manager_);
     core_thread_ = std::thread(&Core::stock_loop, session_manager_->get_core()); 
-    
-    accept_new_connection();
+
+    if (metrics_server_) {
+        metrics_server_->start();
+    }
+
+    for (auto& acceptor : acceptors_) {
+        accept_new_connection(*acceptor);
+    }
+
+    //*INFO: Sessions accepted by acceptor stay on its thread for whole lifetime
+    for (auto& acceptor_io_context : acceptors_io_contexts_) {
+        acceptors_threads_.emplace_back([&acceptor_io_context]() {
+            acceptor_io_context->run();
+        });
+    }
 }
 
-//*INFO Accept new connection thread
-void Server::accept_new_connection() {
-    acceptor_.async_accept(
-        [this](boost::system::error_code ec, boost::asio::ip::tcp::socket new_connectoin_socket) {
+//*INFO: Metrics are optional, server runs without them if listener can't be opened
+void Server::open_metrics_server(const Config& config) {
+    if (config.metrics_port == 0) {
+        return;
+    }
+
+    try {
+        metrics_server_ = std::make_unique<MetricsServer>(config.metrics_host, config.metrics_port, session_manager_);
+        spdlog::info("Metrics listen  {} : {}", config.metrics_host, config.metrics_port);
+    } catch (const std::exception& e) {
+        spdlog::error("Error to open metrics listener {} : {}: {}", config.metrics_host, config.metrics_port, e.what());
+    }
+}
+
+//*INFO Accept new connection thread, session is admitted right on it
+void Server::accept_new_connection(boost::asio::ip::tcp::acceptor& acceptor) {
+    acceptor.async_accept(
+        [this, &acceptor](boost::system::error_code ec, boost::asio::ip::tcp::socket new_connectoin_socket) {
             if (!ec) {
                 session_manager_->add_new_connection(std::move(new_connectoin_socket));
             } else {
                 spdlog::error("Error accepting new connection {}", ec.message());
             }
-            accept_new_connection();
+            accept_new_connection(acceptor);
         });
 }
 
@@ -44,19 +111,31 @@ void Server::accept_new_connection() {
 void Server::stop() {
     spdlog::info("Stopping server...");
 
+    if (metrics_server_) {
+        metrics_server_->stop();
+    }
+
+    //*INFO: Stop other acceptors threads first, so sessions are closed with no handlers running
+    for (auto& acceptor_io_context : acceptors_io_contexts_) {
+        acceptor_io_context->stop();
+    }
+    for (auto& acceptor_thread : acceptors_threads_) {
+        if (acceptor_thread.joinable()) {
+            acceptor_thread.join();
+        }
+    }
+    spdlog::info("acceptors_threads_ joined");
+
     session_manager_->stop();
     spdlog::info("session_manager_ stopped...");
 
     io_context_.stop();
     spdlog::info("io_context_ stopped...");
 
-    if (session_manager_thread_.joinable()) {
-        session_manager_thread_.join();
-    }
-    spdlog::info("session_manager_thread_ joined");
     if (core_thread_.joinable()) {
         core_thread_.join();
     }
     spdlog::info("core_thread_ joined");
+    spdlog::info("Order pipeline stage latencies:\n{}", session_manager_->get_stage_latencies()->get_report());
     spdlog::info("Server stopped");
 }
@@ -4,6 +4,7 @@
 #include <iostream>
 #include <memory>
 #include <thread>
+#include <vector>
 
 #include <boost/bind/bind.hpp>
 #include <boost/asio.hpp>
@@ -12,8 +13,42 @@
 #include "common.hpp"
 #include "core.hpp"
 #include "session_manager.hpp"
+#include "metrics_server.hpp"
 #include "session_client_connection.hpp"
 
+#ifdef SO_REUSEPORT
+//*INFO: Lets several acceptors listen on same port, kernel spreads incoming connections between them.
+//*INFO: Settable socket option of asio public API, boolean options of asio itself are in detail namespace
+class ReusePortOption {
+public:
+    explicit ReusePortOption(bool is_enabled) : value_(is_enabled ? 1 : 0) {
+    }
+
+    template<typename Protocol>
+    int level(const Protocol&) const {
+        return SOL_SOCKET;
+    }
+
+    template<typename Protocol>
+    int name(const Protocol&) const {
+        return SO_REUSEPORT;
+    }
+
+    template<typename Protocol>
+    const int* data(const Protocol&) const {
+        return &value_;
+    }
+
+    template<typename Protocol>
+    std::size_t size(const Protocol&) const {
+        return sizeof(value_);
+    }
+
+private:
+    int value_;
+};
+#endif
+
 class Server {
 public:
     Server(boost::asio::io_context& io_context, const Config& config);
@@ -21,16 +56,26 @@ public:
     void stop();
 
 private:
-    void accept_new_connection();
+    void open_acceptors(const Config& config);
+    std::unique_ptr<boost::asio::ip::tcp::acceptor> open_acceptor(boost::asio::io_context& io_context,
+                                                                  const boost::asio::ip::tcp::endpoint& endpoint,
+                                                                  bool reuse_port);
+    void accept_new_connection(boost::asio::ip::tcp::acceptor& acceptor);
+    void open_metrics_server(const Config& config);
 
 private:
     boost::asio::io_context& io_context_;
-    boost::asio::ip::tcp::acceptor acceptor_;
+    //*INFO: acceptors_[0] runs on io_context_, every other acceptor owns io context and thread
+    std::vector<std::unique_ptr<boost::asio::ip::tcp::acceptor>> acceptors_;
+    std::vector<std::unique_ptr<boost::asio::io_context>> acceptors_io_contexts_;
+    std::vector<std::thread> acceptors_threads_;
 
     std::shared_ptr<SessionManager> session_manager_;
-    std::thread session_manager_thread_;
 
     std::thread core_thread_;
+
+    //*INFO: nullptr if metrics port is 0 or listener could not be opened
+    std::unique_ptr<MetricsServer> metrics_server_;
 };
 
 #endif // SERVER_HPP
@@ -2,7 +2,8 @@
 
 SessionClientConnection::SessionClientConnection(boost::asio::ip::tcp::socket socket, 
         std::shared_ptr<SessionManager> session_manager)
-        : socket_(std::move(socket)), session_manager_(session_manager) {
+        : socket_(std::move(socket)), request_receive_time_(0), is_close_after_write_(false), is_closed_(false),
+          is_cancel_on_disconnect_(false), session_manager_(session_manager) {
 }
 
 //                                                                                //
@@ -14,6 +15,11 @@ void SessionClientConnection::start () {
 }
 
 void SessionClientConnection::async_read_data_from_socket() {
+    //*INFO Closed session must not handle commands still arriving on socket
+    if (is_closed_.load(std::memory_order_acquire)) {
+        return;
+    }
+
     auto self_ptr(shared_from_this());
     //*INFO Read message length
     boost::asio::async_read(socket_,boost::asio::buffer(raw_data_length_from_socket_, sizeof(uint32_t)),
@@ -44,11 +50,18 @@ void SessionClientConnection::async_read_data_from_socket() {
                             spdlog::warn("Connection with client {} was lost", get_client_endpoint_info());
                         }
                         close_this_session();
-                    } else {
+                    } else if (!is_closed_.load(std::memory_order_acquire)) {
+                        request_receive_time_ = StageLatencies::now_ns();
                         Serialize::TradeRequest request = convert_raw_data_to_command(length);
                         Serialize::TradeResponse response = handle_received_command(request);
 
-                        async_write_data_to_socket(response);
+                        bool is_order_request = request.command() == Serialize::TradeRequest::MAKE_ORDER;
+                        async_write_data_to_socket(response, is_order_request ? request_receive_time_ : 0);
+                        //*INFO Rejected session is closed by write handler once response is sent
+                        if (is_close_after_write_) {
+                            return;
+                        }
+                        async_read_data_from_socket();
                     }
                 });
             }
@@ -61,22 +74,26 @@ Serialize::TradeRequest SessionClientConnection::convert_raw_data_to_command(std
     return request;
 }
 
-void SessionClientConnection::async_write_data_to_socket(const Serialize::TradeResponse& responce) {
-    auto self_ptr(shared_from_this());
-
+void SessionClientConnection::async_write_data_to_socket(const Serialize::TradeResponse& responce, int64_t receive_time) {
     std::string serialized_response;
     responce.SerializeToString(&serialized_response);
 
-    int32_t message_length = static_cast<int32_t>(serialized_response.length());
-    std::string message = std::to_string(message_length) + serialized_response;
-
     uint32_t msg_length = htonl(static_cast<uint32_t>(serialized_response.size()));
-    std::vector<boost::asio::const_buffer> buffers = {
-        boost::asio::buffer(&msg_length, sizeof(uint32_t)),
-        boost::asio::buffer(serialized_response)
-    };
+    std::string message(reinterpret_cast<const char*>(&msg_length), sizeof(uint32_t));
+    message += serialized_response;
 
-    boost::asio::async_write(socket_, buffers, 
+    outgoing_messages_.push_back(OutgoingMessage{std::move(message), receive_time});
+    //*INFO Write already in progress will pick up this message
+    if (outgoing_messages_.size() > 1) {
+        return;
+    }
+    async_write_next_message_to_socket();
+}
+
+void SessionClientConnection::async_write_next_message_to_socket() {
+    auto self_ptr(shared_from_this());
+
+    boost::asio::async_write(socket_, boost::asio::buffer(outgoing_messages_.front().data),
         [this, self_ptr](boost::system::error_code error_code, std::size_t length) {
             if (error_code) {
                 spdlog::error("Failed to send response to client {} : {}", get_client_endpoint_info(), error_code.message());
@@ -86,13 +103,40 @@ void SessionClientConnection::async_write_data_to_socket(const Serialize::TradeR
                 if (error_code == boost::asio::error::connection_reset) {
                     spdlog::warn("Connection with client {} was lost", get_client_endpoint_info());
                 }
+                outgoing_messages_.clear();
                 close_this_session();
-            } 
+                return;
+            }
 
-            async_read_data_from_socket();
+            session_manager_->get_stage_latencies()->record(STAGE_RESPONSE_WRITE, outgoing_messages_.front().receive_time,
+                                                            StageLatencies::now_ns());
+            outgoing_messages_.pop_front();
+            if (!outgoing_messages_.empty()) {
+                async_write_next_message_to_socket();
+                return;
+            }
+            if (is_close_after_write_ && !is_closed_.load(std::memory_order_acquire)) {
+                close_this_session();
+            }
         });
 }
 
+void SessionClientConnection::push_execution_report(const Serialize::ExecutionReport& report) {
+    auto self_ptr(shared_from_this());
+
+    Serialize::TradeResponse response;
+    response.set_response_msg(Serialize::TradeResponse::ORDER_MATCHED);
+    response.mutable_execution_report()->CopyFrom(report);
+
+    //*INFO Hand over to session io thread, core thread must not touch socket
+    boost::asio::post(socket_.get_executor(), [this, self_ptr, response = std::move(response)]() {
+        if (!socket_.is_open()) {
+            return;
+        }
+        async_write_data_to_socket(response);
+    });
+}
+
 //                                                                                //
 //                             Session client functions                           //
 //                                                                                //
@@ -111,8 +155,15 @@ std::string SessionClientConnection::get_client_username() const {
 }
 
 void SessionClientConnection::close_this_session() {
+    is_closed_.store(true, std::memory_order_release);
     std::string client_endpoint_info = get_client_endpoint_info();
 
+    //*INFO Server shutdown keeps orders, they are saved by core
+    if (is_cancel_on_disconnect_ && !username_.empty() && session_manager_->is_runnig()) {
+        is_cancel_on_disconnect_ = false;
+        session_manager_->get_client_data_manager()->cancel_all_active_orders(username_, Serialize::CancelAllOrders::BOTH);
+    }
+
     boost::system::error_code error_code;
     socket_.close(error_code);
     if (error_code) {
@@ -140,8 +191,9 @@ Serialize::TradeResponse SessionClientConnection::handle_received_command(Serial
                             username_, get_client_endpoint_info());
             response.set_response_msg(Serialize::TradeResponse::ERROR); 
 
-            async_write_data_to_socket(response);
-            close_this_session();
+            //*INFO No command handler runs for unauthenticated request
+            is_close_after_write_ = true;
+            return response;
         }
     }
     
@@ -175,13 +227,12 @@ Serialize::TradeResponse SessionClientConnection::handle_received_command(Serial
         }
 
         case Serialize::TradeRequest::MAKE_ORDER : {
-            if(!handle_make_order_comand(request)) {
-                response.set_response_msg(Serialize::TradeResponse::ERROR); 
+            if(!handle_make_order_comand(request, response)) {
                 break; 
             }
             response.set_response_msg(Serialize::TradeResponse::ORDER_SUCCESSFULLY_CREATED);
 
-            spdlog::info("New order placed: user={} cost={} amount={} type={}", request.username(),
+            spdlog::info("New order placed: user={} cost={} amount={} type={}", username_,
                  request.order().usd_cost(), request.order().usd_amount(), 
                 (request.order().type() == Serialize::TradeOrder::BUY) ? "BUY" : "SELL");
             break;
@@ -202,6 +253,15 @@ Serialize::TradeResponse SessionClientConnection::handle_received_command(Serial
             break;
         }
             
+        case Serialize::TradeRequest::VIEW_MY_ACTIVE_ORDERS : {
+            if (!handle_view_my_active_orders_command(response)) {
+                response.set_response_msg(Serialize::TradeResponse::ERROR);
+                break;
+            }
+            response.set_response_msg(Serialize::TradeResponse::SUCCESS_VIEW_MY_ACTIVE_ORDERS);
+            break;
+        }
+
         case Serialize::TradeRequest::VIEW_COMPLETED_TRADES : {
             handle_view_last_comleted_oreders_command(response);
             response.set_response_msg(Serialize::TradeResponse::SUCCESS_VIEW_COMPLETED_TRADES);
@@ -223,6 +283,38 @@ Serialize::TradeResponse SessionClientConnection::handle_received_command(Serial
             break;
         }
 
+        case Serialize::TradeRequest::CANCEL_ALL : {
+            handle_cancel_all_command(request, response);
+            response.set_response_msg(Serialize::TradeResponse::SUCCESS_CANCEL_ALL);
+            break;
+        }
+
+        case Serialize::TradeRequest::MODIFY_ORDER : {
+            if (!handle_modify_order_command(request, response)) {
+                break;
+            }
+            response.set_response_msg(Serialize::TradeResponse::SUCCESS_MODIFY_ORDER);
+            break;
+        }
+
+        case Serialize::TradeRequest::VIEW_CANDLES : {
+            handle_view_candles_command(request, response);
+            response.set_response_msg(Serialize::TradeResponse::SUCCESS_VIEW_CANDLES);
+            break;
+        }
+
+        case Serialize::TradeRequest::VIEW_TRADES : {
+            handle_view_trades_command(response);
+            response.set_response_msg(Serialize::TradeResponse::SUCCESS_VIEW_TRADES);
+            break;
+        }
+
+        case Serialize::TradeRequest::VIEW_DEPTH : {
+            handle_view_depth_command(request, response);
+            response.set_response_msg(Serialize::TradeResponse::SUCCESS_VIEW_DEPTH);
+            break;
+        }
+
         default: {
             response.set_response_msg(Serialize::TradeResponse::ERROR); 
             break;
@@ -256,7 +348,7 @@ bool SessionClientConnection::handle_sing_in_command(Serialize::TradeResponse& r
         return false;
     }
 
-    if (session_manager_->is_user_logged_in(request.sign_in_request().username())) {
+    if (!username_.empty() || session_manager_->is_user_logged_in(request.sign_in_request().username())) {
         spdlog::info("User {} is already logged in, request from: {}",
                      request.sign_in_request().username(), get_client_endpoint_info());
         response.set_response_msg(Serialize::TradeResponse::USER_ALREADY_LOGGED_IN);
@@ -264,6 +356,20 @@ bool SessionClientConnection::handle_sing_in_command(Serialize::TradeResponse& r
     }
 
     username_ = request.sign_in_request().username();
+    //*INFO Index session by username so fills can be pushed to it
+    if (!session_manager_->bind_username_to_session(username_, shared_from_this())) {
+        spdlog::info("User {} has just logged in from another session, request from: {}",
+                     username_, get_client_endpoint_info());
+        username_.clear();
+        response.set_response_msg(Serialize::TradeResponse::USER_ALREADY_LOGGED_IN);
+        return false;
+    }
+
+    auto client_data_manager = session_manager_->get_client_data_manager();
+    client_active_orders_ = client_data_manager->get_client_active_orders_index(username_);
+    account_balance_ = client_data_manager->get_risk_account_balance_slot(username_);
+    is_cancel_on_disconnect_ = request.sign_in_request().cancel_on_disconnect();
+
     //*INFO generating jwt
     auto auth = session_manager_->get_auth();
     std::string jwt_token = auth->generate_token(request.sign_in_request().username());
@@ -272,23 +378,46 @@ bool SessionClientConnection::handle_sing_in_command(Serialize::TradeResponse& r
     return true;
 }
 
-bool SessionClientConnection::handle_make_order_comand(Serialize::TradeRequest& request) {
+bool SessionClientConnection::handle_make_order_comand(Serialize::TradeRequest& request, Serialize::TradeResponse& response) {
     Serialize::TradeOrder order = request.order();
+    auto client_data_manager = session_manager_->get_client_data_manager();
 
+    //*INFO: Order always belongs to signed-in user, username sent by client is not trusted
+    order.set_username(username_);
     order.set_timestamp(TimeOrderUtils::get_current_timestamp());
     order.set_order_id(TimeOrderUtils::generate_id());
+    order.clear_displayed_amount();
 
+    if (!account_balance_) {
+        spdlog::error("Balance of user {} is not cached at sign-in, order rejected", username_);
+        response.set_response_msg(Serialize::TradeResponse::ERROR);
+        return false;
+    }
+
+    //*INFO: Pre-trade risk stage, reserves funds of order before it reaches matcher.
+    //*INFO: Checked against slot cached at sign-in without any lock
+    risk_check_result_t risk_check_result = client_data_manager->check_and_reserve_order(order, *account_balance_);
+    if (risk_check_result != RISK_ACCEPTED) {
+        spdlog::info("Order rejected by risk engine: user={} cost={} amount={} reason: {}",
+                     username_, order.usd_cost(), order.usd_amount(),
+                     RiskEngine::risk_check_result_to_string(risk_check_result));
+        response.set_response_msg(Serialize::TradeResponse::ORDER_REJECTED_BY_RISK);
+        response.set_error_response(RiskEngine::risk_check_result_to_string(risk_check_result));
+        return false;
+    }
+
+    //*INFO: Order is active before matcher can see it, so fills and cancels of unfilled rest always find it
+    push_received_from_socket_order_to_active_orders(order);
     if (!push_received_from_socket_order_to_queue(order)) {
         spdlog::info("Error to push received from socket order to orders queue : "
                      "user={} order_id={} cost={} amount={} type={}",
-                     request.username(), order.order_id(), order.usd_cost(), order.usd_amount(), 
+                     username_, order.order_id(), order.usd_cost(), order.usd_amount(), 
                      (request.order().type() == Serialize::TradeOrder::BUY) ? "BUY" : "SELL");
+        client_data_manager->release_unfilled_order(order);
+        response.set_response_msg(Serialize::TradeResponse::ERROR);
         return false;
     }
-    push_received_from_socket_order_to_active_orders(order);
 
-
-    auto client_data_manager = session_manager_->get_client_data_manager();
     client_data_manager->notify_order_received();
 
     return true;
@@ -305,15 +434,21 @@ bool SessionClientConnection::push_received_from_socket_order_to_queue(const Ser
 
     switch (order.type()) {
     case Serialize::TradeOrder::BUY :
-        return client_data_manager->push_order_to_order_queue(BUY, order);
+        return client_data_manager->push_order_to_order_queue(BUY, order, request_receive_time_);
     case Serialize::TradeOrder::SELL :
-        return client_data_manager->push_order_to_order_queue(SELL, order);
+        return client_data_manager->push_order_to_order_queue(SELL, order, request_receive_time_);
     default:
         return false;
     }
 }   
 
 bool SessionClientConnection::handle_view_balance_comand(Serialize::TradeRequest& request, Serialize::TradeResponse& responce) {
+    //*INFO: Own balance is read from slot cached at sign-in without any lock
+    if (account_balance_ && request.username() == username_) {
+        *responce.mutable_account_balance() = account_balance_->load();
+        return true;
+    }
+
     auto client_data_manager = session_manager_->get_client_data_manager();
 
     try {
@@ -333,6 +468,18 @@ void SessionClientConnection::handle_view_all_active_oreders_command(Serialize::
     responce.mutable_active_orders()->CopyFrom(all_active_orders);
 }
 
+bool SessionClientConnection::handle_view_my_active_orders_command(Serialize::TradeResponse& responce) {
+    //*INFO Index is cached at sign-in only
+    if (!client_active_orders_) {
+        spdlog::info("View my active orders before sign-in, request from: {}", get_client_endpoint_info());
+        return false;
+    }
+
+    Serialize::ActiveOrders my_active_orders = client_active_orders_->get_active_orders();
+    responce.mutable_active_orders()->CopyFrom(my_active_orders);
+    return true;
+}
+
 void SessionClientConnection::handle_view_last_comleted_oreders_command(Serialize::TradeResponse& responce) {
     auto client_data_manager = session_manager_->get_client_data_manager();
 
@@ -355,3 +502,53 @@ bool SessionClientConnection::handle_cancel_active_order_command(Serialize::Trad
 
     return client_data_manager->cancel_active_order(type, cancel_order.order_id(), username_);
 }
+
+void SessionClientConnection::handle_cancel_all_command(Serialize::TradeRequest& request, Serialize::TradeResponse& response) {
+    auto client_data_manager = session_manager_->get_client_data_manager();
+
+    size_t canceled_orders_count = client_data_manager->cancel_all_active_orders(username_, request.cancel_all().side());
+    response.set_canceled_orders_count(static_cast<int32_t>(canceled_orders_count));
+}
+
+bool SessionClientConnection::handle_modify_order_command(Serialize::TradeRequest& request, Serialize::TradeResponse& response) {
+    const Serialize::ModifyTradeOrder& modify_order = request.modify_order();
+    auto client_data_manager = session_manager_->get_client_data_manager();
+
+    risk_check_result_t risk_check_result = RISK_ACCEPTED;
+    if (!client_data_manager->modify_active_order(modify_order, username_, risk_check_result)) {
+        response.set_response_msg(Serialize::TradeResponse::ERROR_MODIFY_ORDER);
+        return false;
+    }
+
+    if (risk_check_result != RISK_ACCEPTED) {
+        spdlog::info("Order modify rejected by risk engine: user={} order_id={} cost={} amount={} reason: {}",
+                     username_, modify_order.order_id(), modify_order.usd_cost(), modify_order.usd_amount(),
+                     RiskEngine::risk_check_result_to_string(risk_check_result));
+        response.set_response_msg(Serialize::TradeResponse::ORDER_REJECTED_BY_RISK);
+        response.set_error_response(RiskEngine::risk_check_result_to_string(risk_check_result));
+        return false;
+    }
+
+    return true;
+}
+
+void SessionClientConnection::handle_view_depth_command(Serialize::TradeRequest& request, Serialize::TradeResponse& responce) {
+    auto core = session_manager_->get_core();
+
+    Serialize::MarketDepth market_depth = core->get_market_depth(request.depth_request().levels());
+    responce.mutable_market_depth()->CopyFrom(market_depth);
+}
+
+void SessionClientConnection::handle_view_candles_command(Serialize::TradeRequest& request, Serialize::TradeResponse& responce) {
+    auto core = session_manager_->get_core();
+
+    Serialize::Candles candles = core->get_candles(request.candles_request());
+    responce.mutable_candles()->CopyFrom(candles);
+}
+
+void SessionClientConnection::handle_view_trades_command(Serialize::TradeResponse& responce) {
+    auto client_data_manager = session_manager_->get_client_data_manager();
+
+    Serialize::Trades trades = client_data_manager->get_last_trades();
+    responce.mutable_trades()->CopyFrom(trades);
+}
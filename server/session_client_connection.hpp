@@ -4,6 +4,8 @@
 #include <iostream>
 #include <memory>
 #include <vector>
+#include <deque>
+#include <atomic>
 #include <string>
 
 #include <boost/bind/bind.hpp>
@@ -14,11 +16,13 @@
 #include "common.hpp"
 #include "time_order_utils.hpp"
 #include "order_queue.hpp"
+#include "account_balance.hpp"
 #include "session_manager.hpp"
 #include "trade_market_protocol.pb.h"
 
 //*INFO Forward declaration
 class SessionManager;
+class ClientActiveOrders;
 
 //*INFO Certain client connection 
 class SessionClientConnection : public  std::enable_shared_from_this<SessionClientConnection> {
@@ -33,6 +37,9 @@ public:
    
    void close_this_session();
 
+   //*INFO Thread-safe, may be called from core thread
+   void push_execution_report(const Serialize::ExecutionReport& report);
+
 private:
    void async_read_data_from_socket();
 
@@ -41,23 +48,48 @@ private:
 
    bool handle_sing_up_command(Serialize::TradeResponse& response, Serialize::TradeRequest& reqest);
    bool handle_sing_in_command(Serialize::TradeResponse& response, Serialize::TradeRequest& request);
-   bool handle_make_order_comand(Serialize::TradeRequest& request);
+   bool handle_make_order_comand(Serialize::TradeRequest& request, Serialize::TradeResponse& response);
       bool push_received_from_socket_order_to_queue(const Serialize::TradeOrder& order);
       void push_received_from_socket_order_to_active_orders(const Serialize::TradeOrder& order);
    bool handle_view_balance_comand(Serialize::TradeRequest& request, Serialize::TradeResponse& responce);
    void handle_view_all_active_oreders_command(Serialize::TradeResponse& responce);
+   bool handle_view_my_active_orders_command(Serialize::TradeResponse& responce);
    void handle_view_last_comleted_oreders_command(Serialize::TradeResponse& responce);
    void handle_view_quote_history(Serialize::TradeResponse& responce);
    bool handle_cancel_active_order_command(Serialize::TradeRequest& request);
+   void handle_cancel_all_command(Serialize::TradeRequest& request, Serialize::TradeResponse& response);
+   bool handle_modify_order_command(Serialize::TradeRequest& request, Serialize::TradeResponse& response);
+   void handle_view_depth_command(Serialize::TradeRequest& request, Serialize::TradeResponse& responce);
+   void handle_view_candles_command(Serialize::TradeRequest& request, Serialize::TradeResponse& responce);
+   void handle_view_trades_command(Serialize::TradeResponse& responce);
 
-   void async_write_data_to_socket(const Serialize::TradeResponse& response);
+   //*INFO receive_time of order request, response write stage is recorded when it is written
+   void async_write_data_to_socket(const Serialize::TradeResponse& response, int64_t receive_time = 0);
+   void async_write_next_message_to_socket();
 
 private:
    boost::asio::ip::tcp::socket socket_;
    std::vector<char> raw_data_from_socket_;
    char raw_data_length_from_socket_[sizeof(uint32_t)];
+   //*INFO Time when request being handled was read, StageLatencies::now_ns()
+   int64_t request_receive_time_;
+   struct OutgoingMessage {
+      std::string data;
+      int64_t receive_time;
+   };
+   //*INFO Responses and pushed reports share socket, so writes are serialized through this queue
+   std::deque<OutgoingMessage> outgoing_messages_;
+   //*INFO Set when request is rejected, session is closed after queued responses are sent
+   bool is_close_after_write_;
+   //*INFO Set by close_this_session, stops read loop. Atomic, server shutdown closes sessions from main thread
+   std::atomic<bool> is_closed_;
 
    std::string username_;
+   //*INFO Requested at sign-in, orders of user don't outlive this session
+   bool is_cancel_on_disconnect_;
+   //*INFO Cached at sign-in, own orders are read without global client data lock
+   std::shared_ptr<ClientActiveOrders> client_active_orders_;
+   std::shared_ptr<AccountBalanceSlot> account_balance_;
 
    std::shared_ptr<SessionManager> session_manager_;
 };
@@ -1,6 +1,9 @@
 #include "session_manager.hpp"
 
-SessionManager::SessionManager() : is_running_(true), handle_sessions_mutex_() {
+SessionManager::SessionManager() : is_running_(true), handle_sessions_mutex_(),
+                                   admission_controller_(std::make_shared<AdmissionController>(AdmissionLimits{})),
+                                   stage_latencies_(std::make_shared<StageLatencies>()),
+                                   metric_counters_(std::make_shared<MetricCounters>()) {
 }
 
 void SessionManager::init_database() {
@@ -27,6 +30,7 @@ void SessionManager::init_mockdb(std::shared_ptr<IDatabase> mock_db) {
 void SessionManager::init_core() {
     core_ = std::make_shared<Core>(shared_from_this());
     core_->load_all_active_orders_from_db();
+    core_->load_candles_from_db();
 }
 
 void SessionManager::init_client_data_manager() {
@@ -40,18 +44,45 @@ void SessionManager::init_auth() {
     auth_ = std::make_shared<Auth>(config.jwt_secret_key);
 }
 
-bool SessionManager::is_runnig() {
-    return is_running_.load(std::memory_order_acquire);
+//*INFO for testing
+void SessionManager::init_auth(const std::string& jwt_secret_key) {
+    auth_ = std::make_shared<Auth>(jwt_secret_key);
 }
 
-//*INFO: Here session_manager_thread_ 
-void SessionManager::run() {
-    while (is_running_) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+void SessionManager::init_admission_controller() {
+    Config config = read_config("server_config.ini");
+
+    AdmissionLimits limits;
+    limits.max_sessions = config.max_sessions;
+    limits.max_accept_rate = config.max_accept_rate;
+    limits.max_sessions_per_ip = config.max_sessions_per_ip;
 
-        //*INFO: Handle active sessions
-        try_to_create_new_session_client_connection();
-    }
+    admission_controller_ = std::make_shared<AdmissionController>(limits);
+}
+
+void SessionManager::init_risk_engine() {
+    Config config = read_config("server_config.ini");
+
+    RiskLimits limits;
+    limits.is_balance_check_enabled = config.risk_balance_check;
+    limits.usd_credit_limit = config.risk_usd_credit_limit;
+    limits.rub_credit_limit = config.risk_rub_credit_limit;
+    limits.max_order_usd_amount = config.risk_max_order_usd_amount;
+    limits.price_band_percent = config.risk_price_band_percent;
+    limits.max_open_orders_per_client = config.risk_max_open_orders_per_client;
+
+    client_data_manager_->set_risk_limits(limits);
+}
+
+void SessionManager::init_matching_rules() {
+    Config config = read_config("server_config.ini");
+
+    core_->set_self_trade_prevention_mode(Core::self_trade_prevention_mode_from_string(config.matching_self_trade_prevention));
+    core_->set_auction_schedule(config.matching_auction_interval_ms, config.matching_opening_auction_ms);
+}
+
+bool SessionManager::is_runnig() {
+    return is_running_.load(std::memory_order_acquire);
 }
 
 bool SessionManager::allowed_to_create_new_connection(){
@@ -62,32 +93,32 @@ bool SessionManager::allowed_to_create_new_connection(){
     return true;
 }
 
-void SessionManager::try_to_create_new_session_client_connection() {
-    if (!allowed_to_create_new_connection()) {
+void SessionManager::add_new_connection(boost::asio::ip::tcp::socket new_client_socket) {
+    boost::system::error_code error_code;
+    auto remote_endpoint = new_client_socket.remote_endpoint(error_code);
+    if (error_code) {
+        spdlog::warn("New connection dropped before admission: {}", error_code.message());
         return;
     }
+    std::string client_address = remote_endpoint.address().to_string();
 
-    std::unique_ptr<boost::asio::ip::tcp::socket> new_socket;
-
-    while (new_connections_queue_.try_dequeue(new_socket)) {
-        auto new_session_client_connection = std::make_shared<SessionClientConnection>(
-                                                    std::move(*new_socket), shared_from_this());
-
-        new_session_client_connection->start();
-
-        std::lock_guard add_new_session_lock_guard(handle_sessions_mutex_);
-        clients_sessions_.push_back(new_session_client_connection);
-
-        spdlog::info("Session added for client {}", new_session_client_connection->get_client_endpoint_info());
+    if (!allowed_to_create_new_connection()) {
+        new_client_socket.close(error_code);
+        return;
     }
-}
 
-//*INFO Avalible only in main server thread
-void SessionManager::add_new_connection(boost::asio::ip::tcp::socket new_client_socket) {
-    auto new_socket = std::make_unique<boost::asio::ip::tcp::socket>(std::move(new_client_socket));
-    if (!new_connections_queue_.enqueue(std::move(new_socket))) {
-        spdlog::error("Failed to add new_socket in new_connections_queue_");
+    if (!admission_controller_->try_admit(client_address)) {
+        spdlog::warn("Connection from {} rejected by admission controller", client_address);
+        new_client_socket.close(error_code);
+        return;
     }
+
+    auto new_session_client_connection = std::make_shared<SessionClientConnection>(
+                                                std::move(new_client_socket), shared_from_this());
+    add_session(new_session_client_connection, client_address);
+
+    spdlog::info("Session added for client {}", new_session_client_connection->get_client_endpoint_info());
+    new_session_client_connection->start();
 }
 
 std::shared_ptr<ClientDataManager> SessionManager::get_client_data_manager() const {
@@ -105,37 +136,88 @@ std::shared_ptr<Core> SessionManager::get_core() const {
     return core_;
 }
 
+std::shared_ptr<StageLatencies> SessionManager::get_stage_latencies() const {
+    return stage_latencies_;
+}
+
+std::shared_ptr<MetricCounters> SessionManager::get_metric_counters() const {
+    return metric_counters_;
+}
+
 bool SessionManager::is_user_logged_in(const std::string& username) {
     std::lock_guard<std::mutex> lock(handle_sessions_mutex_);
-    for (const auto& session : clients_sessions_) {
-        if (session->get_client_username() == username) {
-            return true;
-        }
+    return sessions_by_username_.find(username) != sessions_by_username_.end();
+}
+
+//*INFO: Atomic check-and-bind, so two concurrent sign-ins with same username can't both succeed
+void SessionManager::add_session(std::shared_ptr<SessionClientConnection> session, const std::string& client_address) {
+    std::lock_guard<std::mutex> add_session_lock_guard(handle_sessions_mutex_);
+    clients_sessions_.emplace(std::move(session), SessionIndexEntry{std::string(), client_address});
+}
+
+bool SessionManager::bind_username_to_session(const std::string& username, std::shared_ptr<SessionClientConnection> session) {
+    std::lock_guard<std::mutex> bind_username_to_session_lock_guard(handle_sessions_mutex_);
+    auto clients_sessions_iterator = clients_sessions_.find(session);
+    if (clients_sessions_iterator == clients_sessions_.end()) {
+        return false;
     }
-    return false;
+    if (!sessions_by_username_.emplace(username, session).second) {
+        return false;
+    }
+    clients_sessions_iterator->second.username = username;
+    return true;
 }
 
 std::shared_ptr<SessionClientConnection> SessionManager::get_session_by_username(const std::string& username) {
     std::lock_guard<std::mutex> get_session_by_username_lock_guard(handle_sessions_mutex_);
-    for (auto& current_session : clients_sessions_) {
-        if (current_session->get_client_username() == username) {
-            return current_session;
-        }
+
+    auto session_iterator = sessions_by_username_.find(username);
+    if (session_iterator != sessions_by_username_.end()) {
+        return session_iterator->second;
     }
 
-    spdlog::warn("Try to get session by unknown username {}");
+    spdlog::warn("Try to get session by unknown username {}", username);
     return nullptr;
 }
 
+std::size_t SessionManager::get_sessions_count() {
+    std::lock_guard<std::mutex> get_sessions_count_lock_guard(handle_sessions_mutex_);
+    return clients_sessions_.size();
+}
+
+void SessionManager::push_execution_report(const std::string& username, const Serialize::ExecutionReport& report) {
+    std::shared_ptr<SessionClientConnection> owner_session;
+    {
+        std::lock_guard<std::mutex> push_execution_report_lock_guard(handle_sessions_mutex_);
+        auto session_iterator = sessions_by_username_.find(username);
+        if (session_iterator == sessions_by_username_.end()) {
+            //*INFO: Owner is offline, report is available via VIEW_BALANCE polling
+            return;
+        }
+        owner_session = session_iterator->second;
+    }
+
+    owner_session->push_execution_report(report);
+}
 
 void SessionManager::remove_session(std::shared_ptr<SessionClientConnection> session, std::string client_endpoint_info) {
     std::lock_guard<std::mutex> remove_session_lock_guard(handle_sessions_mutex_);
 
-    auto clients_sessions_iterator = std::find(clients_sessions_.begin(), clients_sessions_.end(), session);
-    if (clients_sessions_iterator != clients_sessions_.end()) {
-        clients_sessions_.erase(clients_sessions_iterator);
-        spdlog::info("Session removed for client {}", client_endpoint_info);
+    auto clients_sessions_iterator = clients_sessions_.find(session);
+    if (clients_sessions_iterator == clients_sessions_.end()) {
+        return;
+    }
+
+    const SessionIndexEntry& session_entry = clients_sessions_iterator->second;
+    if (!session_entry.username.empty()) {
+        sessions_by_username_.erase(session_entry.username);
     }
+    if (!session_entry.client_address.empty()) {
+        admission_controller_->release(session_entry.client_address);
+    }
+
+    clients_sessions_.erase(clients_sessions_iterator);
+    spdlog::info("Session removed for client {}", client_endpoint_info);
 }
 
 void SessionManager::stop_accepting_new_sessions() {
@@ -159,7 +241,10 @@ void SessionManager::stop_all_sessions() {
      std::vector<std::shared_ptr<SessionClientConnection>> sessions_copy;
     {
         std::lock_guard<std::mutex> lock(handle_sessions_mutex_);
-        sessions_copy = clients_sessions_; //*INFO Copy to avoid iterator invalidation
+        sessions_copy.reserve(clients_sessions_.size()); //*INFO Copy to avoid iterator invalidation
+        for (const auto& [session, session_entry] : clients_sessions_) {
+            sessions_copy.push_back(session);
+        }
     }
 
     for (auto& session : sessions_copy) {
@@ -169,5 +254,6 @@ void SessionManager::stop_all_sessions() {
     {
         std::lock_guard<std::mutex> lock(handle_sessions_mutex_);
         clients_sessions_.clear(); //*INFO clear original
+        sessions_by_username_.clear();
     }
 }
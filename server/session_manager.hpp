@@ -7,6 +7,7 @@
 #include <mutex>
 #include <vector>
 #include <string>
+#include <unordered_map>
 
 #include <boost/asio.hpp>
 #include <spdlog/spdlog.h>
@@ -19,6 +20,9 @@
 #include "database.hpp"
 #include "auth.hpp"
 #include "config.hpp"
+#include "admission_controller.hpp"
+#include "stage_latencies.hpp"
+#include "metric_counters.hpp"
 
 //*INFO: Forward declaration
 class SessionClientConnection;
@@ -29,7 +33,6 @@ class SessionManager : public std::enable_shared_from_this<SessionManager> {
 public:
     SessionManager();
 
-    void run();
     bool is_runnig();
 
     void init_database();
@@ -37,19 +40,32 @@ public:
     void init_core();
     void init_client_data_manager();
     void init_auth();
+    void init_auth(const std::string& jwt_secret_key);
+    void init_admission_controller();
+    void init_risk_engine();
+    void init_matching_rules();
 
     bool allowed_to_create_new_connection();
+    //*INFO: Called on io thread that accepted socket, session starts reading immediately on same thread
     void add_new_connection(boost::asio::ip::tcp::socket new_client_socket);
-    void try_to_create_new_session_client_connection();
+    void add_session(std::shared_ptr<SessionClientConnection> session, const std::string& client_address);
     void remove_session(std::shared_ptr<SessionClientConnection> session, std::string client_endpoint_info);
 
     bool is_user_logged_in(const std::string& username);
+    //*INFO: Fails if username is already bound or session was removed meanwhile
+    bool bind_username_to_session(const std::string& username, std::shared_ptr<SessionClientConnection> session);
     std::shared_ptr<SessionClientConnection> get_session_by_username(const std::string& username);
+    std::size_t get_sessions_count();
+
+    //*INFO: Called from core thread, delivery happens on session io thread
+    void push_execution_report(const std::string& username, const Serialize::ExecutionReport& report);
     
     std::shared_ptr<ClientDataManager> get_client_data_manager() const;
     std::shared_ptr<IDatabase> get_database() const;
     std::shared_ptr<Auth> get_auth() const;
     std::shared_ptr<Core> get_core() const;
+    std::shared_ptr<StageLatencies> get_stage_latencies() const;
+    std::shared_ptr<MetricCounters> get_metric_counters() const;
 
     void stop();
     void stop_all_sessions();
@@ -64,10 +80,19 @@ private:
     std::shared_ptr<Auth> auth_;
     std::shared_ptr<ClientDataManager> client_data_manager_;
 
-    std::vector<std::shared_ptr<SessionClientConnection>> clients_sessions_;
+    struct SessionIndexEntry {
+        std::string username;           //*INFO: Empty until sign-in
+        std::string client_address;     //*INFO: Admission slot to release on removal
+    };
+
+    //*INFO: Both indexes are guarded by handle_sessions_mutex_, all lookups are O(1)
+    std::unordered_map<std::shared_ptr<SessionClientConnection>, SessionIndexEntry> clients_sessions_;
+    std::unordered_map<std::string, std::shared_ptr<SessionClientConnection>> sessions_by_username_;
     std::mutex handle_sessions_mutex_;
-    
-    moodycamel::ConcurrentQueue<std::unique_ptr<boost::asio::ip::tcp::socket>> new_connections_queue_;
+
+    std::shared_ptr<AdmissionController> admission_controller_;
+    std::shared_ptr<StageLatencies> stage_latencies_;
+    std::shared_ptr<MetricCounters> metric_counters_;
 };
 
 #endif // SESSION_MANAGER_HPP
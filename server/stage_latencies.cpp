@@ -0,0 +1,88 @@
+#include "stage_latencies.hpp"
+
+#include <cstdio>
+
+StageLatencies::ThreadHistograms::ThreadHistograms() {
+    for (auto& histogram : histograms) {
+        histogram = std::make_unique<LatencyHistogram>(STAGE_LATENCY_HIGHEST_NS);
+    }
+    for (auto& histogram : lock_wait_histograms) {
+        histogram = std::make_unique<LatencyHistogram>(STAGE_LATENCY_HIGHEST_NS);
+    }
+}
+
+const char* StageLatencies::stage_to_string(latency_stage_t stage) {
+    switch (stage) {
+        case STAGE_RECEIVE_TO_ENQUEUE: return "receive_to_enqueue";
+        case STAGE_QUEUE_WAIT: return "queue_wait";
+        case STAGE_MATCH: return "match";
+        case STAGE_PERSIST: return "persist";
+        case STAGE_RECEIVE_TO_PERSIST: return "receive_to_persist";
+        case STAGE_RESPONSE_WRITE: return "response_write";
+        default: return "unknown";
+    }
+}
+
+const char* StageLatencies::lock_wait_to_string(lock_wait_t lock_wait) {
+    switch (lock_wait) {
+        case LOCK_WAIT_CORE: return "core";
+        case LOCK_WAIT_CLIENT_SHARD: return "client_shard";
+        default: return "unknown";
+    }
+}
+
+void StageLatencies::record(latency_stage_t stage, int64_t start_time, int64_t end_time) {
+    if (start_time == 0) {
+        return;
+    }
+    threads_histograms_.get().histograms[stage]->record(end_time - start_time);
+}
+
+void StageLatencies::record_lock_wait(lock_wait_t lock_wait, int64_t start_time, int64_t end_time) {
+    threads_histograms_.get().lock_wait_histograms[lock_wait]->record(end_time - start_time);
+}
+
+void StageLatencies::merge_stage(latency_stage_t stage, LatencyHistogram& merged_histogram) const {
+    threads_histograms_.for_each([stage, &merged_histogram](const ThreadHistograms& thread_histograms) {
+        merged_histogram.merge(*thread_histograms.histograms[stage]);
+    });
+}
+
+void StageLatencies::merge_lock_wait(lock_wait_t lock_wait, LatencyHistogram& merged_histogram) const {
+    threads_histograms_.for_each([lock_wait, &merged_histogram](const ThreadHistograms& thread_histograms) {
+        merged_histogram.merge(*thread_histograms.lock_wait_histograms[lock_wait]);
+    });
+}
+
+std::string StageLatencies::get_report() const {
+    std::string report;
+    char line[160];
+
+    std::snprintf(line, sizeof(line), "%24s %10s %10s %10s %10s %10s %10s\n", "stage, us", "count", "p50", "p90", "p99", "p99.9", "max");
+    report += line;
+    for (int stage = 0; stage < STAGES_COUNT; ++stage) {
+        LatencyHistogram merged_histogram(STAGE_LATENCY_HIGHEST_NS);
+        merge_stage(static_cast<latency_stage_t>(stage), merged_histogram);
+        report += format_report_line(stage_to_string(static_cast<latency_stage_t>(stage)), merged_histogram);
+    }
+    for (int lock_wait = 0; lock_wait < LOCK_WAITS_COUNT; ++lock_wait) {
+        LatencyHistogram merged_histogram(STAGE_LATENCY_HIGHEST_NS);
+        merge_lock_wait(static_cast<lock_wait_t>(lock_wait), merged_histogram);
+        report += format_report_line((std::string(lock_wait_to_string(static_cast<lock_wait_t>(lock_wait))) + "_lock_wait").c_str(),
+                                     merged_histogram);
+    }
+    return report;
+}
+
+std::string StageLatencies::format_report_line(const char* name, const LatencyHistogram& histogram) {
+    char line[160];
+    std::snprintf(line, sizeof(line), "%24s %10lld %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+                  name,
+                  static_cast<long long>(histogram.get_total_count()),
+                  histogram.get_value_at_percentile(50.0) / 1000.0,
+                  histogram.get_value_at_percentile(90.0) / 1000.0,
+                  histogram.get_value_at_percentile(99.0) / 1000.0,
+                  histogram.get_value_at_percentile(99.9) / 1000.0,
+                  histogram.get_max() / 1000.0);
+    return line;
+}
@@ -0,0 +1,79 @@
+#ifndef STAGE_LATENCIES_HPP
+#define STAGE_LATENCIES_HPP
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <cstdint>
+
+#include "latency_histogram.hpp"
+#include "per_thread_slots.hpp"
+
+//*INFO: Longer stage durations are recorded as this one
+#define STAGE_LATENCY_HIGHEST_NS 60000000000LL
+
+//*INFO: Order pipeline stages, every one is time between two points on the way of order
+enum latency_stage_t {
+    STAGE_RECEIVE_TO_ENQUEUE,   //*INFO: Socket read done - order queue push: parse, auth, risk check
+    STAGE_QUEUE_WAIT,           //*INFO: Order queue push - pop in complement_order_books
+    STAGE_MATCH,                //*INFO: Pop - order matched or placed to book
+    STAGE_PERSIST,              //*INFO: Matched - executions of matching pass saved to database
+    STAGE_RECEIVE_TO_PERSIST,   //*INFO: Whole way of order through matcher
+    STAGE_RESPONSE_WRITE,       //*INFO: Socket read done - order response written to socket
+    STAGES_COUNT
+};
+
+//*INFO: Contended locks, wait is recorded only when lock was held by other thread
+enum lock_wait_t {
+    LOCK_WAIT_CORE,             //*INFO: Wait for core_mutex_ of matcher
+    LOCK_WAIT_CLIENT_SHARD,     //*INFO: Wait for exclusive lock of client data shard
+    LOCK_WAITS_COUNT
+};
+
+//*INFO: Per-stage HDR histograms kept per thread: record takes no locks and touches only memory of calling thread,
+//*INFO: histograms of all threads are merged on demand. Time points are steady clock nanoseconds (TSC based on Linux)
+class StageLatencies {
+public:
+    static int64_t now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    static const char* stage_to_string(latency_stage_t stage);
+    static const char* lock_wait_to_string(lock_wait_t lock_wait);
+
+    //*INFO: Start time 0 means point was not taken, nothing is recorded
+    void record(latency_stage_t stage, int64_t start_time, int64_t end_time);
+    //*INFO: Uncontended lock costs one try_lock, clock is read only when lock has to be waited for
+    template<typename Mutex>
+    std::unique_lock<Mutex> lock_and_record_wait(Mutex& mutex, lock_wait_t lock_wait) {
+        std::unique_lock<Mutex> lock(mutex, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            int64_t wait_start_time = now_ns();
+            lock.lock();
+            record_lock_wait(lock_wait, wait_start_time, now_ns());
+        }
+        return lock;
+    }
+    void record_lock_wait(lock_wait_t lock_wait, int64_t start_time, int64_t end_time);
+    //*INFO: Any thread, merged histogram must be created with STAGE_LATENCY_HIGHEST_NS
+    void merge_stage(latency_stage_t stage, LatencyHistogram& merged_histogram) const;
+    void merge_lock_wait(lock_wait_t lock_wait, LatencyHistogram& merged_histogram) const;
+    //*INFO: Count and percentiles of every stage and lock wait in microseconds, one line per each
+    std::string get_report() const;
+
+private:
+    static std::string format_report_line(const char* name, const LatencyHistogram& histogram);
+
+    struct ThreadHistograms {
+        ThreadHistograms();
+
+        std::unique_ptr<LatencyHistogram> histograms[STAGES_COUNT];
+        std::unique_ptr<LatencyHistogram> lock_wait_histograms[LOCK_WAITS_COUNT];
+    };
+
+private:
+    //*INFO: Histograms of finished threads stay, their counts are part of totals
+    PerThreadSlots<ThreadHistograms> threads_histograms_;
+};
+
+#endif // STAGE_LATENCIES_HPP
@@ -0,0 +1,99 @@
+#include "stop_order_index.hpp"
+
+bool StopOrderIndex::add_order(const Serialize::TradeOrder& order) {
+    if (orders_index_.find(order.order_id()) != orders_index_.end()) {
+        return false;
+    }
+
+    int64_t stop_price_key = OrderBook::to_price_key(order.stop_price());
+    StopOrderLocation location{order.type(), BuyStops::iterator(), SellStops::iterator()};
+
+    if (order.type() == Serialize::TradeOrder::BUY) {
+        location.buy_iterator = buy_stops_.emplace(stop_price_key, order);
+    } else {
+        location.sell_iterator = sell_stops_.emplace(stop_price_key, order);
+    }
+
+    orders_index_[order.order_id()] = location;
+    return true;
+}
+
+bool StopOrderIndex::remove_order(int64_t order_id, Serialize::TradeOrder::TradeType type, Serialize::TradeOrder& removed_order) {
+    auto index_iterator = orders_index_.find(order_id);
+    if (index_iterator == orders_index_.end() || index_iterator->second.type != type) {
+        return false;
+    }
+
+    if (type == Serialize::TradeOrder::BUY) {
+        removed_order = index_iterator->second.buy_iterator->second;
+        buy_stops_.erase(index_iterator->second.buy_iterator);
+    } else {
+        removed_order = index_iterator->second.sell_iterator->second;
+        sell_stops_.erase(index_iterator->second.sell_iterator);
+    }
+
+    orders_index_.erase(index_iterator);
+    return true;
+}
+
+const Serialize::TradeOrder* StopOrderIndex::find_order(int64_t order_id, Serialize::TradeOrder::TradeType type) const {
+    auto index_iterator = orders_index_.find(order_id);
+    if (index_iterator == orders_index_.end() || index_iterator->second.type != type) {
+        return nullptr;
+    }
+
+    return (type == Serialize::TradeOrder::BUY) ? &index_iterator->second.buy_iterator->second
+                                                : &index_iterator->second.sell_iterator->second;
+}
+
+bool StopOrderIndex::pop_triggered_orders(double low_trade_price, double high_trade_price,
+                                          std::vector<Serialize::TradeOrder>& triggered_orders) {
+    size_t triggered_before = triggered_orders.size();
+
+    pop_triggered_from_stops(buy_stops_, OrderBook::to_price_key(high_trade_price), triggered_orders);
+    pop_triggered_from_stops(sell_stops_, OrderBook::to_price_key(low_trade_price), triggered_orders);
+
+    return triggered_orders.size() != triggered_before;
+}
+
+//*INFO: upper_bound is first stop not reached by trade price in map order
+template<typename Stops>
+void StopOrderIndex::pop_triggered_from_stops(Stops& stops, int64_t trade_price_key,
+                                              std::vector<Serialize::TradeOrder>& triggered_orders) {
+    auto triggered_end = stops.upper_bound(trade_price_key);
+
+    for (auto stop_iterator = stops.begin(); stop_iterator != triggered_end; ++stop_iterator) {
+        orders_index_.erase(stop_iterator->second.order_id());
+        triggered_orders.push_back(std::move(stop_iterator->second));
+    }
+    stops.erase(stops.begin(), triggered_end);
+}
+
+size_t StopOrderIndex::size() const {
+    return orders_index_.size();
+}
+
+std::vector<Serialize::TradeOrder> StopOrderIndex::get_orders(Serialize::TradeOrder::TradeType type) const {
+    std::vector<Serialize::TradeOrder> orders;
+
+    if (type == Serialize::TradeOrder::BUY) {
+        for (const auto& [stop_price_key, order] : buy_stops_) {
+            orders.push_back(order);
+        }
+    } else {
+        for (const auto& [stop_price_key, order] : sell_stops_) {
+            orders.push_back(order);
+        }
+    }
+    return orders;
+}
+
+bool StopOrderIndex::is_stop_order(const Serialize::TradeOrder& order) {
+    return order.order_type() == Serialize::TradeOrder::STOP || order.order_type() == Serialize::TradeOrder::STOP_LIMIT;
+}
+
+void StopOrderIndex::activate_order(Serialize::TradeOrder& order, int64_t timestamp) {
+    order.set_order_type((order.order_type() == Serialize::TradeOrder::STOP) ? Serialize::TradeOrder::MARKET
+                                                                             : Serialize::TradeOrder::LIMIT);
+    order.set_timestamp(timestamp);
+}
@@ -0,0 +1,51 @@
+#ifndef STOP_ORDER_INDEX_HPP
+#define STOP_ORDER_INDEX_HPP
+
+#include <map>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+#include "order_book.hpp"
+#include "trade_market_protocol.pb.h"
+
+//*INFO: Stop and stop-limit orders waiting for trigger, keyed by stop price key.
+//*INFO: Buy stops are sorted up, sell stops down, so triggered orders are always a prefix of the map
+//*INFO: and each trade touches only them. Orders with same stop price trigger in arrival order. Used only under core_mutex_
+class StopOrderIndex {
+public:
+    bool add_order(const Serialize::TradeOrder& order);
+    bool remove_order(int64_t order_id, Serialize::TradeOrder::TradeType type, Serialize::TradeOrder& removed_order);
+    const Serialize::TradeOrder* find_order(int64_t order_id, Serialize::TradeOrder::TradeType type) const;
+
+    //*INFO: Moves out buy stops with stop_price <= high_trade_price and sell stops with stop_price >= low_trade_price
+    bool pop_triggered_orders(double low_trade_price, double high_trade_price, std::vector<Serialize::TradeOrder>& triggered_orders);
+
+    size_t size() const;
+    std::vector<Serialize::TradeOrder> get_orders(Serialize::TradeOrder::TradeType type) const;
+
+    static bool is_stop_order(const Serialize::TradeOrder& order);
+    //*INFO: STOP becomes MARKET and STOP_LIMIT becomes LIMIT, time priority starts at trigger
+    static void activate_order(Serialize::TradeOrder& order, int64_t timestamp);
+
+private:
+    using BuyStops = std::multimap<int64_t, Serialize::TradeOrder, std::less<int64_t>>;
+    using SellStops = std::multimap<int64_t, Serialize::TradeOrder, std::greater<int64_t>>;
+
+    struct StopOrderLocation {
+        Serialize::TradeOrder::TradeType type;
+        BuyStops::iterator buy_iterator;
+        SellStops::iterator sell_iterator;
+    };
+
+    template<typename Stops>
+    void pop_triggered_from_stops(Stops& stops, int64_t trade_price_key, std::vector<Serialize::TradeOrder>& triggered_orders);
+
+private:
+    BuyStops buy_stops_;
+    SellStops sell_stops_;
+    std::unordered_map<int64_t, StopOrderLocation> orders_index_;
+};
+
+#endif // STOP_ORDER_INDEX_HPP
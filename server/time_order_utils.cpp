@@ -15,4 +15,9 @@ int64_t TimeOrderUtils::get_current_timestamp() {
     auto epoch = now_ms.time_since_epoch();
     int64_t timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(epoch).count();
     return timestamp;
-}
\ No newline at end of file
+}
+
+int64_t TimeOrderUtils::get_end_of_day_timestamp(int64_t timestamp) {
+    constexpr int64_t day_ms = 24 * 60 * 60 * 1000;
+    return (timestamp / day_ms + 1) * day_ms;
+}
@@ -8,4 +8,6 @@ class TimeOrderUtils {
 public:
     static int64_t generate_id();
     static int64_t get_current_timestamp();
+    //*INFO: Start of next UTC day after timestamp, expiry of DAY orders
+    static int64_t get_end_of_day_timestamp(int64_t timestamp);
 };
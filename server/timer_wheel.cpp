@@ -0,0 +1,104 @@
+#include "timer_wheel.hpp"
+
+TimerWheel::TimerWheel(int64_t tick_ms, int64_t start_time) : tick_ms_(tick_ms),
+                                                              current_tick_(static_cast<uint64_t>(start_time / tick_ms)),
+                                                              size_(0) {
+}
+
+void TimerWheel::schedule(int64_t order_id, Serialize::TradeOrder::TradeType type, int64_t expire_time) {
+    uint64_t expire_tick = static_cast<uint64_t>((expire_time + tick_ms_ - 1) / tick_ms_);
+    insert(Timer{order_id, type, std::max(expire_tick, current_tick_)});
+    ++size_;
+}
+
+void TimerWheel::advance(int64_t current_time, std::vector<Timer>& expired_timers) {
+    uint64_t last_tick = static_cast<uint64_t>(current_time / tick_ms_);
+
+    while (current_tick_ <= last_tick) {
+        //*INFO: Nothing scheduled, no reason to walk empty slots
+        if (size_ == 0) {
+            current_tick_ = last_tick + 1;
+            return;
+        }
+
+        //*INFO: Start of level 0 round cascades slot of level 1, start of its round cascades level 2 and so on
+        for (size_t level = 1; level < LEVELS; ++level) {
+            if ((current_tick_ & ((uint64_t(1) << (LEVEL_BITS * level)) - 1)) != 0) {
+                break;
+            }
+            cascade(level);
+        }
+
+        auto& slot = levels_[0][current_tick_ & SLOT_MASK];
+        size_ -= slot.size();
+        expired_timers.insert(expired_timers.end(), slot.begin(), slot.end());
+        slot.clear();
+
+        ++current_tick_;
+    }
+}
+
+int64_t TimerWheel::get_next_tick_time() const {
+    return static_cast<int64_t>(current_tick_) * tick_ms_;
+}
+
+//*INFO: Level 0 slots hold next SLOTS_PER_LEVEL ticks in order. Slot of upper level is cascaded at start
+//*INFO: of its block, blocks after current one are checked in order, so each level gives its nearest slot
+int64_t TimerWheel::get_next_expiry_time() const {
+    if (size_ == 0) {
+        return std::numeric_limits<int64_t>::max();
+    }
+
+    uint64_t next_tick = std::numeric_limits<uint64_t>::max();
+    for (uint64_t tick = current_tick_; tick < current_tick_ + SLOTS_PER_LEVEL; ++tick) {
+        if (!levels_[0][tick & SLOT_MASK].empty()) {
+            next_tick = tick;
+            break;
+        }
+    }
+
+    for (size_t level = 1; level < LEVELS; ++level) {
+        uint64_t current_block = current_tick_ >> (LEVEL_BITS * level);
+        for (uint64_t block = current_block + 1; block <= current_block + SLOTS_PER_LEVEL; ++block) {
+            if (!levels_[level][block & SLOT_MASK].empty()) {
+                next_tick = std::min(next_tick, block << (LEVEL_BITS * level));
+                break;
+            }
+        }
+    }
+
+    return static_cast<int64_t>(next_tick) * tick_ms_;
+}
+
+size_t TimerWheel::size() const {
+    return size_;
+}
+
+bool TimerWheel::empty() const {
+    return size_ == 0;
+}
+
+//*INFO: Level is picked by distance to expire tick, slot by expire tick bits of that level.
+//*INFO: Timer beyond wheel range waits in farthest slot and is placed again on cascade
+void TimerWheel::insert(const Timer& timer) {
+    uint64_t delta_ticks = timer.expire_tick - current_tick_;
+    uint64_t placement_tick = (delta_ticks > MAX_DELTA_TICKS) ? current_tick_ + MAX_DELTA_TICKS : timer.expire_tick;
+    delta_ticks = placement_tick - current_tick_;
+
+    size_t level = 0;
+    while (level + 1 < LEVELS && delta_ticks >= (uint64_t(1) << (LEVEL_BITS * (level + 1)))) {
+        ++level;
+    }
+
+    levels_[level][(placement_tick >> (LEVEL_BITS * level)) & SLOT_MASK].push_back(timer);
+}
+
+void TimerWheel::cascade(size_t level) {
+    auto& slot = levels_[level][(current_tick_ >> (LEVEL_BITS * level)) & SLOT_MASK];
+
+    std::vector<Timer> timers;
+    timers.swap(slot);
+    for (const auto& timer : timers) {
+        insert(timer);
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+
+#include <array>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+#include "trade_market_protocol.pb.h"
+
+//*INFO: Hierarchical timer wheel of order expiry times. Level 0 slot is one tick, every next level slot covers
+//*INFO: whole previous level and is cascaded down when time reaches it, so schedule and tick cost O(1).
+//*INFO: Timers are never removed: owner checks on expiry that order is still there. Used only under core_mutex_
+class TimerWheel {
+public:
+    struct Timer {
+        int64_t order_id;
+        Serialize::TradeOrder::TradeType type;
+        uint64_t expire_tick;
+    };
+
+    TimerWheel(int64_t tick_ms, int64_t start_time);
+
+    //*INFO: Timer fires at first tick not earlier than expire_time, already passed time fires on next tick
+    void schedule(int64_t order_id, Serialize::TradeOrder::TradeType type, int64_t expire_time);
+    //*INFO: Runs all ticks up to current_time and appends fired timers
+    void advance(int64_t current_time, std::vector<Timer>& expired_timers);
+
+    //*INFO: Time of next tick to run
+    int64_t get_next_tick_time() const;
+    //*INFO: Time of first tick that fires or cascades non-empty slot, for wake up of matching thread.
+    //*INFO: Cascade tick may fire nothing, then next call gives nearer time. Max time if wheel is empty
+    int64_t get_next_expiry_time() const;
+    size_t size() const;
+    bool empty() const;
+
+private:
+    static constexpr size_t LEVEL_BITS = 6;
+    static constexpr size_t SLOTS_PER_LEVEL = 1 << LEVEL_BITS;
+    static constexpr size_t LEVELS = 4;
+    static constexpr uint64_t SLOT_MASK = SLOTS_PER_LEVEL - 1;
+    static constexpr uint64_t MAX_DELTA_TICKS = (uint64_t(1) << (LEVEL_BITS * LEVELS)) - 1;
+
+    void insert(const Timer& timer);
+    void cascade(size_t level);
+
+private:
+    int64_t tick_ms_;
+    uint64_t current_tick_;  //*INFO: Next tick to run
+    size_t size_;
+    std::array<std::array<std::vector<Timer>, SLOTS_PER_LEVEL>, LEVELS> levels_;
+};
+
+#endif // TIMER_WHEEL_HPP
@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <atomic>
+
+#include "account_balance.hpp"
+
+TEST(AccountBalanceSlotTest, StoresBalancesInFixedPoint) {
+    AccountBalanceSlot account_balance(10.5, -700.25);
+
+    account_balance.add(-0.5, 70.1234);
+
+    auto balance = account_balance.load();
+    EXPECT_DOUBLE_EQ(balance.usd_balance(), 10.0);
+    EXPECT_DOUBLE_EQ(balance.rub_balance(), -630.1266);
+}
+
+TEST(AccountBalanceSlotTest, ConcurrentReaderSeesConsistentBalances) {
+    AccountBalanceSlot account_balance(0.0, 0.0);
+    std::atomic<bool> is_writing(true);
+
+    std::thread writer([&account_balance, &is_writing]() {
+        for (int i = 0; i < 200000; ++i) {
+            account_balance.add(1.0, -70.0);
+        }
+        is_writing.store(false);
+    });
+
+    while (is_writing.load()) {
+        auto balance = account_balance.load();
+        ASSERT_DOUBLE_EQ(balance.rub_balance(), -70.0 * balance.usd_balance());
+    }
+    writer.join();
+
+    EXPECT_DOUBLE_EQ(account_balance.load().usd_balance(), 200000.0);
+}
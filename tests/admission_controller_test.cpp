@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include "admission_controller.hpp"
+
+TEST(AdmissionControllerTest, UnlimitedByDefault) {
+    AdmissionController admission_controller(AdmissionLimits{});
+
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(admission_controller.try_admit("10.0.0.1"));
+    }
+    EXPECT_EQ(admission_controller.get_admitted_sessions_count(), 1000);
+}
+
+TEST(AdmissionControllerTest, MaxSessionsLimit) {
+    AdmissionLimits limits;
+    limits.max_sessions = 2;
+    AdmissionController admission_controller(limits);
+
+    EXPECT_TRUE(admission_controller.try_admit("10.0.0.1"));
+    EXPECT_TRUE(admission_controller.try_admit("10.0.0.2"));
+    EXPECT_FALSE(admission_controller.try_admit("10.0.0.3"));
+
+    admission_controller.release("10.0.0.1");
+    EXPECT_TRUE(admission_controller.try_admit("10.0.0.3"));
+}
+
+TEST(AdmissionControllerTest, PerAddressLimit) {
+    AdmissionLimits limits;
+    limits.max_sessions_per_ip = 1;
+    AdmissionController admission_controller(limits);
+
+    EXPECT_TRUE(admission_controller.try_admit("10.0.0.1"));
+    EXPECT_FALSE(admission_controller.try_admit("10.0.0.1"));
+    EXPECT_TRUE(admission_controller.try_admit("10.0.0.2"));
+
+    admission_controller.release("10.0.0.1");
+    EXPECT_TRUE(admission_controller.try_admit("10.0.0.1"));
+}
+
+TEST(AdmissionControllerTest, AcceptRateLimit) {
+    AdmissionLimits limits;
+    limits.max_accept_rate = 3;
+    AdmissionController admission_controller(limits);
+
+    EXPECT_TRUE(admission_controller.try_admit("10.0.0.1"));
+    EXPECT_TRUE(admission_controller.try_admit("10.0.0.1"));
+    EXPECT_TRUE(admission_controller.try_admit("10.0.0.1"));
+    EXPECT_FALSE(admission_controller.try_admit("10.0.0.1"));
+    EXPECT_EQ(admission_controller.get_admitted_sessions_count(), 3);
+}
@@ -17,14 +17,7 @@ protected:
         session_manager_ = std::make_shared<SessionManager>();
         session_manager_->init_mockdb(mock_database_);
 
-        EXPECT_CALL(*mock_database_, load_active_orders_from_db(::testing::_))
-            .WillRepeatedly(Return(std::vector<Serialize::TradeOrder>()));
-        EXPECT_CALL(*mock_database_, load_clients_balances_from_db())
-            .WillRepeatedly(Return(std::vector<Serialize::ClientBalance>()));
-        EXPECT_CALL(*mock_database_, load_last_completed_orders(::testing::_))
-            .WillRepeatedly(Return(std::vector<Serialize::TradeOrder>()));
-        EXPECT_CALL(*mock_database_, load_quote_history(::testing::_))
-            .WillRepeatedly(Return(std::vector<Serialize::Quote>()));
+        mock_database_->expect_empty_database();
 
         session_manager_->init_core();
         session_manager_->init_client_data_manager();
@@ -53,10 +46,27 @@ protected:
         return order;
     }
 
-    void add_order_to_containers(const Serialize::TradeOrder& order) {
-        client_data_manager_->create_new_client_fund_data(order.username());
+    void create_client_if_missing(const std::string& username) {
+        if (!client_data_manager_->get_account_balance_slot(username)) {
+            client_data_manager_->create_new_client_fund_data(username);
+        }
+    }
+
+    void add_order_to_containers(Serialize::TradeOrder order) {
+        create_client_if_missing(order.username());
+        ASSERT_EQ(client_data_manager_->check_and_reserve_order(order), RISK_ACCEPTED);
+        client_data_manager_->push_order_to_active_orders(order);
+        core_->place_order_to_book(order);
+    }
+
+    //*INFO: Same path as order popped from order queue by stock loop, risk checked on slot cached like in session
+    void submit_incoming_order(Serialize::TradeOrder order) {
+        create_client_if_missing(order.username());
+        auto account_balance = client_data_manager_->get_risk_account_balance_slot(order.username());
+        ASSERT_EQ(client_data_manager_->check_and_reserve_order(order, *account_balance), RISK_ACCEPTED);
         client_data_manager_->push_order_to_active_orders(order);
-        core_->place_order_to_priority_queue(order);
+        core_->accept_incoming_order(order);
+        core_->process_orders();
     }
 
     void verify_client_balance(const std::string& username, double expected_usd, double expectred_rub) {
@@ -65,6 +75,12 @@ protected:
         EXPECT_NEAR(balance.rub_balance(), expectred_rub, EPSILON);
     }
 
+    //*INFO: Core befriends fixture only, so TEST_F bodies read expiry wheel through it
+    size_t get_expiry_timers_count() const {
+        std::lock_guard<std::mutex> get_expiry_timers_count_lock_guard(core_->core_mutex_);
+        return core_->expiry_wheel_.size();
+    }
+
     std::shared_ptr<MockDatabase> mock_database_;
     std::shared_ptr<SessionManager> session_manager_;
     std::shared_ptr<ClientDataManager> client_data_manager_;
@@ -153,3 +169,588 @@ TEST_F(CoreTest, MultipleOrderExecution) {
     EXPECT_EQ(active_orders.active_buy_orders_size(), 1);
     EXPECT_EQ(active_orders.active_sell_orders_size(), 1);
 }
+
+TEST_F(CoreTest, MarketDepthAggregatesPriceLevels) {
+    add_order_to_containers(create_test_order(Serialize::TradeOrder::BUY, 60.0, 10, "Buyer1"));
+    add_order_to_containers(create_test_order(Serialize::TradeOrder::BUY, 60.0, 5, "Buyer2"));
+    add_order_to_containers(create_test_order(Serialize::TradeOrder::BUY, 59.0, 7, "Buyer3"));
+    add_order_to_containers(create_test_order(Serialize::TradeOrder::SELL, 61.0, 4, "Seller1"));
+    auto sell_order = create_test_order(Serialize::TradeOrder::SELL, 60.0, 12, "Seller2");
+    add_order_to_containers(sell_order);
+
+    core_->process_orders();
+
+    auto market_depth = core_->get_market_depth(10);
+    ASSERT_EQ(market_depth.bids_size(), 2);
+    EXPECT_NEAR(market_depth.bids(0).price(), 60.0, EPSILON);
+    EXPECT_EQ(market_depth.bids(0).usd_amount(), 3);
+    EXPECT_EQ(market_depth.bids(0).orders_count(), 1);
+    EXPECT_NEAR(market_depth.bids(1).price(), 59.0, EPSILON);
+    EXPECT_EQ(market_depth.bids(1).usd_amount(), 7);
+    ASSERT_EQ(market_depth.asks_size(), 1);
+    EXPECT_NEAR(market_depth.asks(0).price(), 61.0, EPSILON);
+
+    auto top_of_book = core_->get_market_depth(1);
+    EXPECT_EQ(top_of_book.bids_size(), 1);
+    EXPECT_EQ(top_of_book.asks_size(), 1);
+}
+
+TEST_F(CoreTest, MarketDepthLevelsFollowBookPriceKeys) {
+    //*INFO: Both prices round to one book level
+    auto first_buy_order = create_test_order(Serialize::TradeOrder::BUY, 60.00001, 4, "Buyer1");
+    auto second_buy_order = create_test_order(Serialize::TradeOrder::BUY, 60.00002, 6, "Buyer2");
+    submit_incoming_order(first_buy_order);
+    submit_incoming_order(second_buy_order);
+
+    auto market_depth = core_->get_market_depth(10);
+    ASSERT_EQ(market_depth.bids_size(), 1);
+    EXPECT_NEAR(market_depth.bids(0).price(), 60.0, EPSILON);
+    EXPECT_EQ(market_depth.bids(0).usd_amount(), 10);
+    EXPECT_EQ(market_depth.bids(0).orders_count(), 2);
+
+    EXPECT_TRUE(client_data_manager_->cancel_active_order(BUY, first_buy_order.order_id(), "Buyer1"));
+    EXPECT_TRUE(client_data_manager_->cancel_active_order(BUY, second_buy_order.order_id(), "Buyer2"));
+
+    EXPECT_EQ(core_->get_market_depth(10).bids_size(), 0);
+    EXPECT_EQ(core_->get_book_levels_count(Serialize::TradeOrder::BUY), 0);
+}
+
+TEST_F(CoreTest, ClientActiveOrdersIndexFollowsFills) {
+    auto buy_order = create_test_order(Serialize::TradeOrder::BUY, 70.0, 10, "Buyer");
+    auto other_buy_order = create_test_order(Serialize::TradeOrder::BUY, 69.0, 10, "Other");
+    auto sell_order = create_test_order(Serialize::TradeOrder::SELL, 70.0, 4, "Seller");
+
+    add_order_to_containers(buy_order);
+    add_order_to_containers(other_buy_order);
+    add_order_to_containers(sell_order);
+
+    core_->process_orders();
+
+    auto buyer_orders = client_data_manager_->get_client_active_orders_index("Buyer")->get_active_orders();
+    ASSERT_EQ(buyer_orders.active_buy_orders_size(), 1);
+    EXPECT_EQ(buyer_orders.active_buy_orders(0).usd_amount(), 6);
+    EXPECT_EQ(buyer_orders.active_sell_orders_size(), 0);
+
+    auto seller_orders = client_data_manager_->get_client_active_orders_index("Seller")->get_active_orders();
+    EXPECT_EQ(seller_orders.active_sell_orders_size(), 0);
+
+    EXPECT_FALSE(client_data_manager_->cancel_active_order(BUY, other_buy_order.order_id(), "Buyer"));
+    EXPECT_TRUE(client_data_manager_->cancel_active_order(BUY, other_buy_order.order_id(), "Other"));
+    EXPECT_EQ(client_data_manager_->get_client_active_orders_index("Other")->get_active_orders().active_buy_orders_size(), 0);
+}
+
+TEST_F(CoreTest, PartialFillIsRecordedAsTradePrint) {
+    auto buy_order = create_test_order(Serialize::TradeOrder::BUY, 71.0, 10, "Buyer");
+    auto sell_order = create_test_order(Serialize::TradeOrder::SELL, 70.0, 4, "Seller");
+    sell_order.set_timestamp(buy_order.timestamp() + 1);
+
+    add_order_to_containers(buy_order);
+    add_order_to_containers(sell_order);
+
+    core_->process_orders();
+
+    auto trades = client_data_manager_->get_last_trades();
+    ASSERT_EQ(trades.executions_size(), 1);
+    EXPECT_NEAR(trades.executions(0).price(), 71.0, EPSILON);
+    EXPECT_EQ(trades.executions(0).usd_amount(), 4);
+    EXPECT_EQ(trades.executions(0).aggressor_side(), Serialize::TradeOrder::SELL);
+    EXPECT_EQ(trades.executions(0).maker_order_id(), buy_order.order_id());
+    EXPECT_EQ(trades.executions(0).taker_order_id(), sell_order.order_id());
+
+    auto quote_history = client_data_manager_->get_quote_history();
+    ASSERT_EQ(quote_history.quotes_size(), 1);
+    EXPECT_NEAR(quote_history.quotes(0).price(), 71.0, EPSILON);
+}
+
+TEST_F(CoreTest, ReservationsAreReleasedOnFillAndCancel) {
+    auto buy_order = create_test_order(Serialize::TradeOrder::BUY, 70.5, 10, "Buyer");
+    auto sell_order = create_test_order(Serialize::TradeOrder::SELL, 70.0, 4, "Seller");
+
+    add_order_to_containers(buy_order);
+    add_order_to_containers(sell_order);
+
+    auto buyer_balance = client_data_manager_->get_client_balance("Buyer");
+    EXPECT_NEAR(buyer_balance.rub_reserved(), 705.0, EPSILON);
+
+    core_->process_orders();
+
+    buyer_balance = client_data_manager_->get_client_balance("Buyer");
+    EXPECT_NEAR(buyer_balance.rub_reserved(), 6 * 70.5, EPSILON);
+    EXPECT_NEAR(client_data_manager_->get_client_balance("Seller").usd_reserved(), 0.0, EPSILON);
+
+    EXPECT_TRUE(client_data_manager_->cancel_active_order(BUY, buy_order.order_id(), "Buyer"));
+    EXPECT_NEAR(client_data_manager_->get_client_balance("Buyer").rub_reserved(), 0.0, EPSILON);
+    EXPECT_EQ(client_data_manager_->get_account_balance_slot("Buyer")->get_open_orders_count(), 0);
+}
+
+TEST_F(CoreTest, IocOrderCancelsUnfilledRest) {
+    auto sell_order = create_test_order(Serialize::TradeOrder::SELL, 70.0, 4, "Seller");
+    add_order_to_containers(sell_order);
+
+    auto buy_order = create_test_order(Serialize::TradeOrder::BUY, 71.0, 10, "Buyer");
+    buy_order.set_time_in_force(Serialize::TradeOrder::IOC);
+    submit_incoming_order(buy_order);
+
+    auto trades = client_data_manager_->get_last_trades();
+    ASSERT_EQ(trades.executions_size(), 1);
+    EXPECT_NEAR(trades.executions(0).price(), 70.0, EPSILON);
+    EXPECT_EQ(trades.executions(0).usd_amount(), 4);
+
+    verify_client_balance("Buyer", 4, -280.0);
+    EXPECT_EQ(core_->get_market_depth(10).bids_size(), 0);
+    EXPECT_EQ(client_data_manager_->get_client_active_orders_index("Buyer")->get_active_orders().active_buy_orders_size(), 0);
+
+    auto buyer_balance = client_data_manager_->get_client_balance("Buyer");
+    EXPECT_NEAR(buyer_balance.rub_reserved(), 0.0, EPSILON);
+    EXPECT_EQ(client_data_manager_->get_account_balance_slot("Buyer")->get_open_orders_count(), 0);
+}
+
+TEST_F(CoreTest, FokOrderIsKilledWithoutEnoughLiquidity) {
+    auto sell_order = create_test_order(Serialize::TradeOrder::SELL, 70.0, 4, "Seller");
+    add_order_to_containers(sell_order);
+
+    auto buy_order = create_test_order(Serialize::TradeOrder::BUY, 71.0, 5, "Buyer");
+    buy_order.set_time_in_force(Serialize::TradeOrder::FOK);
+    submit_incoming_order(buy_order);
+
+    EXPECT_EQ(client_data_manager_->get_last_trades().executions_size(), 0);
+    verify_client_balance("Buyer", 0, 0);
+    verify_client_balance("Seller", 0, 0);
+    EXPECT_NEAR(client_data_manager_->get_client_balance("Buyer").rub_reserved(), 0.0, EPSILON);
+
+    auto market_depth = core_->get_market_depth(10);
+    ASSERT_EQ(market_depth.asks_size(), 1);
+    EXPECT_EQ(market_depth.asks(0).usd_amount(), 4);
+    EXPECT_EQ(market_depth.bids_size(), 0);
+}
+
+TEST_F(CoreTest, MarketOrderSweepsLevelsAtMakerPrices) {
+    add_order_to_containers(create_test_order(Serialize::TradeOrder::SELL, 70.0, 3, "Seller1"));
+    add_order_to_containers(create_test_order(Serialize::TradeOrder::SELL, 71.0, 3, "Seller2"));
+    add_order_to_containers(create_test_order(Serialize::TradeOrder::SELL, 75.0, 3, "Seller3"));
+
+    auto buy_order = create_test_order(Serialize::TradeOrder::BUY, 0.0, 7, "Buyer");
+    buy_order.set_order_type(Serialize::TradeOrder::MARKET);
+    submit_incoming_order(buy_order);
+
+    auto trades = client_data_manager_->get_last_trades();
+    ASSERT_EQ(trades.executions_size(), 3);
+    verify_client_balance("Buyer", 7, -(3 * 70.0 + 3 * 71.0 + 1 * 75.0));
+    verify_client_balance("Seller3", -1, 75.0);
+
+    auto market_depth = core_->get_market_depth(10);
+    ASSERT_EQ(market_depth.asks_size(), 1);
+    EXPECT_NEAR(market_depth.asks(0).price(), 75.0, EPSILON);
+    EXPECT_EQ(market_depth.asks(0).usd_amount(), 2);
+    EXPECT_EQ(market_depth.bids_size(), 0);
+}
+
+TEST_F(CoreTest, StopOrdersAreTriggeredByTradePrice) {
+    add_order_to_containers(create_test_order(Serialize::TradeOrder::SELL, 70.0, 2, "Seller1"));
+    add_order_to_containers(create_test_order(Serialize::TradeOrder::SELL, 72.0, 5, "Seller2"));
+
+    auto buy_stop_order = create_test_order(Serialize::TradeOrder::BUY, 0.0, 3, "StopBuyer");
+    buy_stop_order.set_order_type(Serialize::TradeOrder::STOP);
+    buy_stop_order.set_stop_price(70.0);
+
+    auto far_buy_stop_order = create_test_order(Serialize::TradeOrder::BUY, 75.0, 3, "StopBuyer");
+    far_buy_stop_order.set_order_type(Serialize::TradeOrder::STOP_LIMIT);
+    far_buy_stop_order.set_stop_price(73.0);
+
+    //*INFO: No trades yet, stops wait
+    submit_incoming_order(buy_stop_order);
+    submit_incoming_order(far_buy_stop_order);
+    EXPECT_EQ(client_data_manager_->get_last_trades().executions_size(), 0);
+
+    //*INFO: Trade at 70 triggers first stop, it buys at 72 and doesn't reach second stop
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::BUY, 70.0, 1, "Buyer"));
+
+    auto trades = client_data_manager_->get_last_trades();
+    ASSERT_EQ(trades.executions_size(), 3);
+    verify_client_balance("StopBuyer", 3, -(1 * 70.0 + 2 * 72.0));
+
+    auto market_depth = core_->get_market_depth(10);
+    ASSERT_EQ(market_depth.asks_size(), 1);
+    EXPECT_EQ(market_depth.asks(0).usd_amount(), 3);
+    EXPECT_EQ(market_depth.bids_size(), 0);
+
+    //*INFO: Waiting stop is cancelled like active order and frees its reservation
+    EXPECT_TRUE(client_data_manager_->cancel_active_order(BUY, far_buy_stop_order.order_id(), "StopBuyer"));
+    EXPECT_NEAR(client_data_manager_->get_client_balance("StopBuyer").rub_reserved(), 0.0, EPSILON);
+}
+
+TEST_F(CoreTest, StopLimitOrderRestsAfterTrigger) {
+    add_order_to_containers(create_test_order(Serialize::TradeOrder::BUY, 70.0, 2, "Buyer"));
+
+    auto sell_stop_order = create_test_order(Serialize::TradeOrder::SELL, 68.0, 4, "StopSeller");
+    sell_stop_order.set_order_type(Serialize::TradeOrder::STOP_LIMIT);
+    sell_stop_order.set_stop_price(69.0);
+    submit_incoming_order(sell_stop_order);
+
+    //*INFO: Trade at 70 doesn't reach sell stop
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::SELL, 70.0, 1, "Seller"));
+    EXPECT_EQ(core_->get_market_depth(10).asks_size(), 0);
+
+    add_order_to_containers(create_test_order(Serialize::TradeOrder::BUY, 69.0, 1, "Buyer"));
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::SELL, 69.0, 2, "Seller"));
+
+    //*INFO: Trade at 69 triggers stop-limit, bids are already taken and it rests at 68
+    verify_client_balance("StopSeller", 0.0, 0.0);
+    auto market_depth = core_->get_market_depth(10);
+    ASSERT_EQ(market_depth.asks_size(), 1);
+    EXPECT_NEAR(market_depth.asks(0).price(), 68.0, EPSILON);
+    EXPECT_EQ(market_depth.asks(0).usd_amount(), 4);
+}
+
+TEST_F(CoreTest, IcebergShowsPeakAndLosesPriorityOnReplenish) {
+    auto iceberg_order = create_test_order(Serialize::TradeOrder::SELL, 70.0, 10, "IcebergSeller");
+    iceberg_order.set_peak_amount(3);
+    auto plain_order = create_test_order(Serialize::TradeOrder::SELL, 70.0, 2, "Seller");
+    plain_order.set_timestamp(iceberg_order.timestamp() + 1);
+
+    add_order_to_containers(iceberg_order);
+    add_order_to_containers(plain_order);
+    core_->process_orders();
+
+    auto market_depth = core_->get_market_depth(10);
+    ASSERT_EQ(market_depth.asks_size(), 1);
+    EXPECT_EQ(market_depth.asks(0).usd_amount(), 5);
+
+    //*INFO: Peak of 3 is filled first, replenished peak goes behind plain order
+    auto buy_order = create_test_order(Serialize::TradeOrder::BUY, 70.0, 4, "Buyer");
+    buy_order.set_time_in_force(Serialize::TradeOrder::IOC);
+    submit_incoming_order(buy_order);
+
+    auto trades = client_data_manager_->get_last_trades();
+    ASSERT_EQ(trades.executions_size(), 2);
+    verify_client_balance("IcebergSeller", -3, 210.0);
+    verify_client_balance("Seller", -1, 70.0);
+
+    market_depth = core_->get_market_depth(10);
+    ASSERT_EQ(market_depth.asks_size(), 1);
+    EXPECT_EQ(market_depth.asks(0).usd_amount(), 4);
+    EXPECT_EQ(market_depth.asks(0).orders_count(), 2);
+
+    auto all_active_orders = client_data_manager_->get_all_active_oreders();
+    ASSERT_EQ(all_active_orders.active_sell_orders_size(), 2);
+    for (const auto& order : all_active_orders.active_sell_orders()) {
+        if (order.order_id() == iceberg_order.order_id()) {
+            EXPECT_EQ(order.usd_amount(), 3);
+            EXPECT_EQ(order.peak_amount(), 0);
+        }
+    }
+
+    auto other_buy_order = create_test_order(Serialize::TradeOrder::BUY, 70.0, 3, "Buyer");
+    other_buy_order.set_time_in_force(Serialize::TradeOrder::IOC);
+    submit_incoming_order(other_buy_order);
+
+    verify_client_balance("Seller", -2, 140.0);
+    verify_client_balance("IcebergSeller", -5, 350.0);
+}
+
+TEST_F(CoreTest, ModifyKeepsPriorityOnDecreaseAndRequeuesOnPriceChange) {
+    auto first_sell_order = create_test_order(Serialize::TradeOrder::SELL, 70.0, 5, "Seller1");
+    auto second_sell_order = create_test_order(Serialize::TradeOrder::SELL, 70.0, 5, "Seller2");
+    second_sell_order.set_timestamp(first_sell_order.timestamp() + 1);
+    add_order_to_containers(first_sell_order);
+    add_order_to_containers(second_sell_order);
+    core_->process_orders();
+
+    Serialize::ModifyTradeOrder modify_order;
+    modify_order.set_type(Serialize::TradeOrder::SELL);
+    modify_order.set_order_id(first_sell_order.order_id());
+    modify_order.set_usd_cost(70.0);
+    modify_order.set_usd_amount(2);
+
+    risk_check_result_t risk_check_result = RISK_ACCEPTED;
+    EXPECT_FALSE(client_data_manager_->modify_active_order(modify_order, "Seller2", risk_check_result));
+    ASSERT_TRUE(client_data_manager_->modify_active_order(modify_order, "Seller1", risk_check_result));
+    EXPECT_EQ(risk_check_result, RISK_ACCEPTED);
+    EXPECT_NEAR(client_data_manager_->get_client_balance("Seller1").usd_reserved(), 2.0, EPSILON);
+
+    auto market_depth = core_->get_market_depth(10);
+    ASSERT_EQ(market_depth.asks_size(), 1);
+    EXPECT_EQ(market_depth.asks(0).usd_amount(), 7);
+
+    //*INFO: Decreased order is still first in queue
+    auto buy_order = create_test_order(Serialize::TradeOrder::BUY, 70.0, 2, "Buyer");
+    buy_order.set_time_in_force(Serialize::TradeOrder::IOC);
+    submit_incoming_order(buy_order);
+    verify_client_balance("Seller1", -2, 140.0);
+    verify_client_balance("Seller2", 0, 0);
+
+    //*INFO: Repriced order crosses resting bid and trades at bid price
+    add_order_to_containers(create_test_order(Serialize::TradeOrder::BUY, 69.0, 3, "Buyer"));
+    core_->process_orders();
+
+    modify_order.set_order_id(second_sell_order.order_id());
+    modify_order.set_usd_cost(69.0);
+    modify_order.set_usd_amount(5);
+    ASSERT_TRUE(client_data_manager_->modify_active_order(modify_order, "Seller2", risk_check_result));
+    EXPECT_EQ(risk_check_result, RISK_ACCEPTED);
+
+    //*INFO: Modify only changes book, crossing is matched by pass of stock loop
+    verify_client_balance("Seller2", 0, 0);
+    EXPECT_EQ(core_->get_market_depth(10).bids_size(), 1);
+    core_->process_orders();
+
+    verify_client_balance("Seller2", -3, 207.0);
+    market_depth = core_->get_market_depth(10);
+    ASSERT_EQ(market_depth.asks_size(), 1);
+    EXPECT_NEAR(market_depth.asks(0).price(), 69.0, EPSILON);
+    EXPECT_EQ(market_depth.asks(0).usd_amount(), 2);
+    EXPECT_EQ(market_depth.bids_size(), 0);
+}
+
+TEST_F(CoreTest, RequeuedOrderIsAggressorEvenWithOlderOrderId) {
+    auto sell_order = create_test_order(Serialize::TradeOrder::SELL, 72.0, 5, "Seller");
+    auto buy_order = create_test_order(Serialize::TradeOrder::BUY, 70.0, 5, "Buyer");
+    ASSERT_LT(sell_order.order_id(), buy_order.order_id());
+    add_order_to_containers(sell_order);
+    add_order_to_containers(buy_order);
+    core_->process_orders();
+
+    Serialize::ModifyTradeOrder modify_order;
+    modify_order.set_type(Serialize::TradeOrder::SELL);
+    modify_order.set_order_id(sell_order.order_id());
+    modify_order.set_usd_cost(68.0);
+    modify_order.set_usd_amount(5);
+    risk_check_result_t risk_check_result = RISK_ACCEPTED;
+    ASSERT_TRUE(client_data_manager_->modify_active_order(modify_order, "Seller", risk_check_result));
+    core_->process_orders();
+
+    //*INFO: Requeued sell arrived in book last, so it takes resting bid at bid price
+    auto trades = client_data_manager_->get_last_trades();
+    ASSERT_EQ(trades.executions_size(), 1);
+    EXPECT_NEAR(trades.executions(0).price(), 70.0, EPSILON);
+    EXPECT_EQ(trades.executions(0).aggressor_side(), Serialize::TradeOrder::SELL);
+    EXPECT_EQ(trades.executions(0).taker_order_id(), sell_order.order_id());
+    verify_client_balance("Seller", -5, 350.0);
+    verify_client_balance("Buyer", 5, -350.0);
+}
+
+TEST_F(CoreTest, SelfTradePreventionCancelNewest) {
+    core_->set_self_trade_prevention_mode(STP_CANCEL_NEWEST);
+
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::SELL, 70.0, 5, "Trader"));
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::SELL, 71.0, 5, "Seller"));
+
+    auto buy_order = create_test_order(Serialize::TradeOrder::BUY, 71.0, 5, "Trader");
+    submit_incoming_order(buy_order);
+
+    EXPECT_EQ(client_data_manager_->get_last_trades().executions_size(), 0);
+    verify_client_balance("Trader", 0, 0);
+    EXPECT_NEAR(client_data_manager_->get_client_balance("Trader").rub_reserved(), 0.0, EPSILON);
+    EXPECT_EQ(client_data_manager_->get_account_balance_slot("Trader")->get_open_orders_count(), 1);
+
+    auto market_depth = core_->get_market_depth(10);
+    EXPECT_EQ(market_depth.bids_size(), 0);
+    ASSERT_EQ(market_depth.asks_size(), 2);
+    EXPECT_EQ(market_depth.asks(0).usd_amount(), 5);
+}
+
+TEST_F(CoreTest, SelfTradePreventionCancelOldestAndDecrementBoth) {
+    core_->set_self_trade_prevention_mode(STP_CANCEL_OLDEST);
+
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::SELL, 70.0, 5, "Trader"));
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::SELL, 71.0, 5, "Seller"));
+
+    //*INFO: Own resting sell is cancelled, buy goes on to next level
+    auto buy_order = create_test_order(Serialize::TradeOrder::BUY, 71.0, 3, "Trader");
+    buy_order.set_time_in_force(Serialize::TradeOrder::IOC);
+    submit_incoming_order(buy_order);
+
+    verify_client_balance("Trader", 3, -213.0);
+    EXPECT_NEAR(client_data_manager_->get_client_balance("Trader").usd_reserved(), 0.0, EPSILON);
+    ASSERT_EQ(core_->get_market_depth(10).asks_size(), 1);
+
+    core_->set_self_trade_prevention_mode(STP_DECREMENT_BOTH);
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::BUY, 70.0, 4, "Seller"));
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::SELL, 70.0, 6, "Seller"));
+
+    //*INFO: 4 USD are taken off both orders, rest of sell rests without trade
+    EXPECT_EQ(client_data_manager_->get_last_trades().executions_size(), 1);
+    auto market_depth = core_->get_market_depth(10);
+    EXPECT_EQ(market_depth.bids_size(), 0);
+    ASSERT_EQ(market_depth.asks_size(), 2);
+    EXPECT_NEAR(market_depth.asks(0).price(), 70.0, EPSILON);
+    EXPECT_EQ(market_depth.asks(0).usd_amount(), 2);
+    EXPECT_NEAR(client_data_manager_->get_client_balance("Seller").rub_reserved(), 0.0, EPSILON);
+    EXPECT_NEAR(client_data_manager_->get_client_balance("Seller").usd_reserved(), 2.0 + 2.0, EPSILON);
+}
+
+TEST_F(CoreTest, CallAuctionUncrossesAtSingleClearingPrice) {
+    core_->set_auction_schedule(60000, 0);
+
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::BUY, 72.0, 5, "Buyer"));
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::BUY, 71.0, 5, "Buyer"));
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::BUY, 70.0, 5, "Buyer"));
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::SELL, 69.0, 4, "Seller"));
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::SELL, 70.0, 6, "Seller"));
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::SELL, 71.0, 10, "Seller"));
+
+    //*INFO: Crossed book waits for uncross
+    EXPECT_EQ(client_data_manager_->get_last_trades().executions_size(), 0);
+    EXPECT_EQ(core_->get_market_depth(10).bids_size(), 3);
+
+    //*INFO: 70 and 71 both clear 10 USD, 70 leaves smaller imbalance
+    core_->uncross_auction();
+
+    auto last_trades = client_data_manager_->get_last_trades();
+    ASSERT_GT(last_trades.executions_size(), 0);
+    for (const auto& execution : last_trades.executions()) {
+        EXPECT_NEAR(execution.price(), 70.0, EPSILON);
+    }
+    verify_client_balance("Buyer", 10, -700.0);
+    verify_client_balance("Seller", -10, 700.0);
+    EXPECT_NEAR(client_data_manager_->get_client_balance("Buyer").rub_reserved(), 350.0, EPSILON);
+
+    auto market_depth = core_->get_market_depth(10);
+    ASSERT_EQ(market_depth.bids_size(), 1);
+    EXPECT_NEAR(market_depth.bids(0).price(), 70.0, EPSILON);
+    EXPECT_EQ(market_depth.bids(0).usd_amount(), 5);
+    ASSERT_EQ(market_depth.asks_size(), 1);
+    EXPECT_NEAR(market_depth.asks(0).price(), 71.0, EPSILON);
+    EXPECT_EQ(market_depth.asks(0).usd_amount(), 10);
+}
+
+TEST_F(CoreTest, ExpiredOrdersAreCancelled) {
+    int64_t current_timestamp = TimeOrderUtils::get_current_timestamp();
+
+    auto short_buy_order = create_test_order(Serialize::TradeOrder::BUY, 70.0, 5, "Buyer");
+    short_buy_order.set_time_in_force(Serialize::TradeOrder::GTD);
+    short_buy_order.set_expire_time(current_timestamp + 60000);
+    submit_incoming_order(short_buy_order);
+
+    auto long_buy_order = create_test_order(Serialize::TradeOrder::BUY, 69.0, 3, "Buyer");
+    long_buy_order.set_time_in_force(Serialize::TradeOrder::GTD);
+    long_buy_order.set_expire_time(current_timestamp + 120000);
+    submit_incoming_order(long_buy_order);
+
+    core_->expire_orders(current_timestamp + 30000);
+    EXPECT_EQ(core_->get_market_depth(10).bids_size(), 2);
+
+    core_->expire_orders(current_timestamp + 61000);
+    auto market_depth = core_->get_market_depth(10);
+    ASSERT_EQ(market_depth.bids_size(), 1);
+    EXPECT_NEAR(market_depth.bids(0).price(), 69.0, EPSILON);
+    EXPECT_NEAR(client_data_manager_->get_client_balance("Buyer").rub_reserved(), 207.0, EPSILON);
+    EXPECT_EQ(client_data_manager_->get_account_balance_slot("Buyer")->get_open_orders_count(), 1);
+
+    core_->expire_orders(current_timestamp + 121000);
+    EXPECT_EQ(core_->get_market_depth(10).bids_size(), 0);
+    EXPECT_NEAR(client_data_manager_->get_client_balance("Buyer").rub_reserved(), 0.0, EPSILON);
+    EXPECT_EQ(client_data_manager_->get_account_balance_slot("Buyer")->get_open_orders_count(), 0);
+}
+
+TEST_F(CoreTest, ModifiedOrderKeepsSingleExpiryTimer) {
+    int64_t current_timestamp = TimeOrderUtils::get_current_timestamp();
+
+    auto buy_order = create_test_order(Serialize::TradeOrder::BUY, 70.0, 5, "Buyer");
+    buy_order.set_time_in_force(Serialize::TradeOrder::GTD);
+    buy_order.set_expire_time(current_timestamp + 60000);
+    submit_incoming_order(buy_order);
+    EXPECT_EQ(get_expiry_timers_count(), 1);
+
+    Serialize::ModifyTradeOrder modify_order;
+    modify_order.set_type(Serialize::TradeOrder::BUY);
+    modify_order.set_order_id(buy_order.order_id());
+    modify_order.set_usd_amount(5);
+    for (double usd_cost : {69.0, 68.0, 67.0}) {
+        modify_order.set_usd_cost(usd_cost);
+        risk_check_result_t risk_check_result = RISK_ACCEPTED;
+        ASSERT_TRUE(client_data_manager_->modify_active_order(modify_order, "Buyer", risk_check_result));
+        EXPECT_EQ(risk_check_result, RISK_ACCEPTED);
+    }
+    EXPECT_EQ(get_expiry_timers_count(), 1);
+
+    core_->expire_orders(current_timestamp + 61000);
+    EXPECT_EQ(core_->get_market_depth(10).bids_size(), 0);
+    EXPECT_EQ(get_expiry_timers_count(), 0);
+    EXPECT_NEAR(client_data_manager_->get_client_balance("Buyer").rub_reserved(), 0.0, EPSILON);
+}
+
+TEST_F(CoreTest, CancelAllRemovesOnlyOwnOrdersOfSide) {
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::BUY, 70.0, 2, "Trader"));
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::BUY, 69.0, 3, "Trader"));
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::SELL, 75.0, 1, "Trader"));
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::BUY, 68.0, 1, "Other"));
+
+    EXPECT_EQ(client_data_manager_->cancel_all_active_orders("Trader", Serialize::CancelAllOrders::BUY), 2);
+
+    auto market_depth = core_->get_market_depth(10);
+    ASSERT_EQ(market_depth.bids_size(), 1);
+    EXPECT_NEAR(market_depth.bids(0).price(), 68.0, EPSILON);
+    EXPECT_EQ(market_depth.asks_size(), 1);
+    EXPECT_NEAR(client_data_manager_->get_client_balance("Trader").rub_reserved(), 0.0, EPSILON);
+    EXPECT_EQ(client_data_manager_->get_account_balance_slot("Trader")->get_open_orders_count(), 1);
+
+    EXPECT_EQ(client_data_manager_->cancel_all_active_orders("Trader", Serialize::CancelAllOrders::BOTH), 1);
+    EXPECT_EQ(core_->get_market_depth(10).asks_size(), 0);
+    EXPECT_EQ(client_data_manager_->get_client_active_orders_index("Trader")->get_active_orders().active_sell_orders_size(), 0);
+    EXPECT_EQ(client_data_manager_->get_account_balance_slot("Other")->get_open_orders_count(), 1);
+}
+
+TEST_F(CoreTest, FailedActiveOrderSaveDoesNotStopShutdownSave) {
+    auto buy_order = create_test_order(Serialize::TradeOrder::BUY, 70.0, 5, "Buyer");
+    auto sell_order = create_test_order(Serialize::TradeOrder::SELL, 75.0, 3, "Seller");
+    add_order_to_containers(buy_order);
+    add_order_to_containers(sell_order);
+
+    EXPECT_CALL(*mock_database_, save_active_order_to_db(::testing::_))
+        .WillOnce(::testing::Throw(std::runtime_error("value out of range")))
+        .WillOnce(Return());
+
+    EXPECT_NO_THROW(core_->save_all_active_orders_to_db());
+}
+
+TEST_F(CoreTest, FokOrderCountsOnlyLiquidityReachableUnderSelfTradePrevention) {
+    core_->set_self_trade_prevention_mode(STP_CANCEL_NEWEST);
+
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::SELL, 70.0, 3, "Seller"));
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::SELL, 71.0, 5, "Trader"));
+    submit_incoming_order(create_test_order(Serialize::TradeOrder::SELL, 72.0, 5, "Seller"));
+
+    //*INFO: Own sell cuts buy off after 3 USD, so FOK is killed before anything trades
+    auto fok_buy_order = create_test_order(Serialize::TradeOrder::BUY, 72.0, 6, "Trader");
+    fok_buy_order.set_time_in_force(Serialize::TradeOrder::FOK);
+    submit_incoming_order(fok_buy_order);
+
+    EXPECT_EQ(client_data_manager_->get_last_trades().executions_size(), 0);
+    EXPECT_EQ(core_->get_market_depth(10).asks_size(), 3);
+
+    //*INFO: Own sell is cancelled and skipped, other sells are enough
+    core_->set_self_trade_prevention_mode(STP_CANCEL_OLDEST);
+    auto other_fok_buy_order = create_test_order(Serialize::TradeOrder::BUY, 72.0, 6, "Trader");
+    other_fok_buy_order.set_time_in_force(Serialize::TradeOrder::FOK);
+    submit_incoming_order(other_fok_buy_order);
+
+    verify_client_balance("Trader", 6, -(3 * 70.0 + 3 * 72.0));
+    auto market_depth = core_->get_market_depth(10);
+    ASSERT_EQ(market_depth.asks_size(), 1);
+    EXPECT_NEAR(market_depth.asks(0).price(), 72.0, EPSILON);
+    EXPECT_EQ(market_depth.asks(0).usd_amount(), 2);
+}
+
+TEST_F(CoreTest, FokOrderIsFilledFromIcebergHiddenReserve) {
+    auto iceberg_order = create_test_order(Serialize::TradeOrder::SELL, 70.0, 10, "IcebergSeller");
+    iceberg_order.set_peak_amount(2);
+    submit_incoming_order(iceberg_order);
+    EXPECT_EQ(core_->get_market_depth(10).asks(0).usd_amount(), 2);
+
+    auto fok_buy_order = create_test_order(Serialize::TradeOrder::BUY, 70.0, 7, "Buyer");
+    fok_buy_order.set_time_in_force(Serialize::TradeOrder::FOK);
+    submit_incoming_order(fok_buy_order);
+
+    verify_client_balance("Buyer", 7, -490.0);
+    verify_client_balance("IcebergSeller", -7, 490.0);
+    EXPECT_NEAR(client_data_manager_->get_client_balance("Buyer").rub_reserved(), 0.0, EPSILON);
+
+    //*INFO: Whole iceberg is still less than this FOK
+    auto big_fok_buy_order = create_test_order(Serialize::TradeOrder::BUY, 70.0, 4, "Buyer");
+    big_fok_buy_order.set_time_in_force(Serialize::TradeOrder::FOK);
+    submit_incoming_order(big_fok_buy_order);
+
+    verify_client_balance("Buyer", 7, -490.0);
+    EXPECT_EQ(client_data_manager_->get_account_balance_slot("IcebergSeller")->get_open_orders_count(), 1);
+}
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "latency_histogram.hpp"
+
+TEST(LatencyHistogramTest, PercentilesStayWithinPrecision) {
+    LatencyHistogram histogram;
+
+    for (int64_t value = 1; value <= 100000; ++value) {
+        histogram.record(value);
+    }
+
+    EXPECT_EQ(histogram.get_total_count(), 100000);
+    EXPECT_EQ(histogram.get_min(), 1);
+    EXPECT_EQ(histogram.get_max(), 100000);
+    EXPECT_NEAR(histogram.get_mean(), 50000.5, 0.001);
+
+    //*INFO: 3 significant digits - relative error is below 0.1%
+    EXPECT_NEAR(histogram.get_value_at_percentile(50.0), 50000, 50);
+    EXPECT_NEAR(histogram.get_value_at_percentile(99.0), 99000, 99);
+    EXPECT_NEAR(histogram.get_value_at_percentile(99.9), 99900, 100);
+    EXPECT_EQ(histogram.get_value_at_percentile(100.0), 100000);
+
+    //*INFO: Small values are counted exactly
+    LatencyHistogram small_values_histogram;
+    small_values_histogram.record(7);
+    small_values_histogram.record(1500);
+    EXPECT_EQ(small_values_histogram.get_value_at_percentile(50.0), 7);
+    EXPECT_EQ(small_values_histogram.get_value_at_percentile(100.0), 1500);
+}
+
+TEST(LatencyHistogramTest, MergeAddsCountsAndExtremes) {
+    LatencyHistogram first_histogram;
+    LatencyHistogram second_histogram;
+    for (int value_num = 0; value_num < 90; ++value_num) {
+        first_histogram.record(1000);
+    }
+    for (int value_num = 0; value_num < 10; ++value_num) {
+        second_histogram.record(1000000);
+    }
+    second_histogram.record(5);
+
+    LatencyHistogram merged_histogram;
+    merged_histogram.merge(first_histogram);
+    merged_histogram.merge(second_histogram);
+
+    EXPECT_EQ(merged_histogram.get_total_count(), 101);
+    EXPECT_EQ(merged_histogram.get_min(), 5);
+    EXPECT_EQ(merged_histogram.get_max(), 1000000);
+    EXPECT_EQ(merged_histogram.get_value_at_percentile(50.0), 1000);
+    EXPECT_NEAR(merged_histogram.get_value_at_percentile(95.0), 1000000, 1000);
+
+    std::ostringstream distribution;
+    merged_histogram.print_percentile_distribution(distribution, 1000.0);
+    EXPECT_NE(distribution.str().find("#[Max     =     1000.000, Total count    =          101]"), std::string::npos);
+
+    merged_histogram.reset();
+    EXPECT_EQ(merged_histogram.get_total_count(), 0);
+    EXPECT_EQ(merged_histogram.get_value_at_percentile(99.0), 0);
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <thread>
+
+#include "mock_database.hpp"
+#include "session_manager.hpp"
+#include "client_data_manager.hpp"
+#include "metric_counters.hpp"
+#include "metrics_server.hpp"
+#include "time_order_utils.hpp"
+
+using ::testing::Return;
+using ::testing::HasSubstr;
+
+class MetricsServerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        mock_database_ = std::make_shared<MockDatabase>();
+        session_manager_ = std::make_shared<SessionManager>();
+        session_manager_->init_mockdb(mock_database_);
+
+        mock_database_->expect_empty_database();
+
+        session_manager_->init_core();
+        session_manager_->init_client_data_manager();
+    }
+
+    void TearDown() override {
+        session_manager_.reset();
+
+        testing::Mock::AllowLeak(mock_database_.get());
+        mock_database_.reset();
+    }
+
+    std::shared_ptr<MockDatabase> mock_database_;
+    std::shared_ptr<SessionManager> session_manager_;
+};
+
+TEST(MetricCountersTest, CountersOfAllThreadsAreSummed) {
+    MetricCounters metric_counters;
+
+    metric_counters.increment(COUNTER_ORDERS);
+    std::thread session_thread([&metric_counters] {
+        for (int order_num = 0; order_num < 1000; ++order_num) {
+            metric_counters.increment(COUNTER_ORDERS);
+        }
+        metric_counters.increment(COUNTER_FILLS, 5);
+    });
+    session_thread.join();
+
+    EXPECT_EQ(metric_counters.get_total(COUNTER_ORDERS), 1001);
+    EXPECT_EQ(metric_counters.get_total(COUNTER_FILLS), 5);
+}
+
+TEST_F(MetricsServerTest, ScrapeHasQueuedOrdersAndStageSummaries) {
+    Serialize::TradeOrder order;
+    order.set_type(Serialize::TradeOrder::BUY);
+    order.set_order_id(TimeOrderUtils::generate_id());
+    order.set_usd_cost(90.0);
+    order.set_usd_amount(10);
+    order.set_username("metrics_user");
+    session_manager_->get_client_data_manager()->push_order_to_order_queue(BUY, order, StageLatencies::now_ns());
+
+    std::string metrics = MetricsServer::collect_metrics(*session_manager_);
+
+    EXPECT_THAT(metrics, HasSubstr("# TYPE trade_orders_total counter\ntrade_orders_total 1\n"));
+    EXPECT_THAT(metrics, HasSubstr("trade_fills_total 0\n"));
+    EXPECT_THAT(metrics, HasSubstr("trade_order_queue_depth{side=\"buy\"} 1\n"));
+    EXPECT_THAT(metrics, HasSubstr("trade_order_queue_depth{side=\"sell\"} 0\n"));
+    EXPECT_THAT(metrics, HasSubstr("trade_book_orders{side=\"buy\"} 0\n"));
+    EXPECT_THAT(metrics, HasSubstr("trade_sessions 0\n"));
+    EXPECT_THAT(metrics, HasSubstr("trade_stage_latency_seconds_count{stage=\"receive_to_enqueue\"} 1\n"));
+    EXPECT_THAT(metrics, HasSubstr("trade_stage_latency_seconds{stage=\"match\",quantile=\"0.99\"} 0\n"));
+    EXPECT_THAT(metrics, HasSubstr("trade_lock_wait_seconds_count{lock=\"core\"} 0\n"));
+}
+
+TEST_F(MetricsServerTest, OversizedScrapeRequestIsDropped) {
+    MetricsServer metrics_server("127.0.0.1", 0, session_manager_);
+    metrics_server.start();
+
+    boost::asio::io_context io_context;
+    boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::address_v4::loopback(), metrics_server.get_port());
+
+    //*INFO: Headers never end, server stops reading at MAX_SCRAPE_REQUEST_SIZE
+    boost::asio::ip::tcp::socket flooding_socket(io_context);
+    flooding_socket.connect(endpoint);
+    std::string endless_header(MAX_SCRAPE_REQUEST_SIZE * 2, 'a');
+    boost::system::error_code error_code;
+    boost::asio::write(flooding_socket, boost::asio::buffer(endless_header), error_code);
+    char byte;
+    boost::asio::read(flooding_socket, boost::asio::buffer(&byte, 1), error_code);
+    EXPECT_TRUE(error_code == boost::asio::error::eof || error_code == boost::asio::error::connection_reset);
+
+    boost::asio::ip::tcp::socket scrape_socket(io_context);
+    scrape_socket.connect(endpoint);
+    boost::asio::write(scrape_socket, boost::asio::buffer(std::string("GET /metrics HTTP/1.1\r\n\r\n")));
+    std::string response;
+    boost::asio::read(scrape_socket, boost::asio::dynamic_buffer(response), error_code);
+    EXPECT_THAT(response, HasSubstr("HTTP/1.1 200 OK"));
+    EXPECT_THAT(response, HasSubstr("trade_orders_total"));
+
+    metrics_server.stop();
+}
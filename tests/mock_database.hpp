@@ -2,6 +2,7 @@
 #define MOCK_DATABASE_HPP
 
 #include <cstdint>
+#include <vector>
 #include <gmock/gmock.h>
 
 #include "database.hpp"
@@ -15,11 +16,15 @@ public:
     void update_actual_client_balance_in_db(const Serialize::ClientBalance& client_balance) override {return;}
     void save_completed_order_to_db(const Serialize::TradeOrder& order, int64_t completion_timestamp) override {return;}
     void save_qoute_to_db(const Serialize::Quote& quote) override {return;}
+    void save_executions_to_db(const std::vector<Serialize::Execution>& executions) override {return;}
 
     MOCK_METHOD(std::vector<Serialize::TradeOrder>, load_active_orders_from_db, (Serialize::TradeOrder::TradeType type), (override));
     MOCK_METHOD(std::vector<Serialize::ClientBalance>, load_clients_balances_from_db, (), (override));
     MOCK_METHOD(std::vector<Serialize::TradeOrder>, load_last_completed_orders, (int number), (override));
     MOCK_METHOD(std::vector<Serialize::Quote>, load_quote_history, (int number), (override));
+    MOCK_METHOD(void, save_candle_to_db, (Serialize::CandleResolution resolution, const Serialize::Candle& candle), (override));
+    MOCK_METHOD(std::vector<Serialize::Candle>, load_candles_from_db, (Serialize::CandleResolution resolution, int number), (override));
+    MOCK_METHOD(std::vector<Serialize::Execution>, load_last_executions, (int number), (override));
 
     MOCK_METHOD(bool, is_user_exists, (const std::string& username), (override));
     MOCK_METHOD(void, add_user, (const std::string& username, const std::string& password), (override));
@@ -27,6 +32,23 @@ public:
     MOCK_METHOD(void, save_active_order_to_db, (const Serialize::TradeOrder& order), (override));
     MOCK_METHOD(void, truncate_active_orders_table, (), (override));
 
+    //*INFO: Server starts with nothing stored, for fixtures that run init_core and init_client_data_manager
+    void expect_empty_database() {
+        EXPECT_CALL(*this, load_active_orders_from_db(::testing::_))
+            .WillRepeatedly(::testing::Return(std::vector<Serialize::TradeOrder>()));
+        EXPECT_CALL(*this, load_clients_balances_from_db())
+            .WillRepeatedly(::testing::Return(std::vector<Serialize::ClientBalance>()));
+        EXPECT_CALL(*this, load_last_completed_orders(::testing::_))
+            .WillRepeatedly(::testing::Return(std::vector<Serialize::TradeOrder>()));
+        EXPECT_CALL(*this, load_quote_history(::testing::_))
+            .WillRepeatedly(::testing::Return(std::vector<Serialize::Quote>()));
+        EXPECT_CALL(*this, load_last_executions(::testing::_))
+            .WillRepeatedly(::testing::Return(std::vector<Serialize::Execution>()));
+        EXPECT_CALL(*this, load_candles_from_db(::testing::_, ::testing::_))
+            .WillRepeatedly(::testing::Return(std::vector<Serialize::Candle>()));
+        EXPECT_CALL(*this, save_candle_to_db(::testing::_, ::testing::_))
+            .Times(::testing::AnyNumber());
+    }
 };
 
 #endif // MOCK_DATABASE_HPP
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <atomic>
+
+#include "ring_buffer.hpp"
+
+struct TestRecord {
+    int64_t first;
+    int64_t second;
+};
+
+TEST(RingBufferTest, KeepsNewestEntriesInOrder) {
+    RingBuffer<int64_t, 4> ring_buffer;
+    EXPECT_TRUE(ring_buffer.snapshot().empty());
+
+    for (int64_t i = 1; i <= 6; ++i) {
+        ring_buffer.push(i);
+    }
+
+    EXPECT_EQ(ring_buffer.size(), 4);
+    EXPECT_EQ(ring_buffer.snapshot(), (std::vector<int64_t>{3, 4, 5, 6}));
+}
+
+TEST(RingBufferTest, ConcurrentReaderSeesConsistentRecords) {
+    RingBuffer<TestRecord, 64> ring_buffer;
+    std::atomic<bool> is_writing(true);
+
+    std::thread writer([&ring_buffer, &is_writing]() {
+        for (int64_t i = 0; i < 200000; ++i) {
+            ring_buffer.push(TestRecord{i, -i});
+        }
+        is_writing.store(false);
+    });
+
+    while (is_writing.load()) {
+        auto records = ring_buffer.snapshot();
+        for (std::size_t i = 0; i < records.size(); ++i) {
+            ASSERT_EQ(records[i].first, -records[i].second);
+            if (i > 0) {
+                ASSERT_LT(records[i - 1].first, records[i].first);
+            }
+        }
+    }
+    writer.join();
+
+    auto records = ring_buffer.snapshot();
+    ASSERT_EQ(records.size(), 64);
+    EXPECT_EQ(records.back().first, 199999);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include "risk_engine.hpp"
+
+class RiskEngineTest : public ::testing::Test {
+protected:
+    Serialize::TradeOrder create_test_order(Serialize::TradeOrder::TradeType type, double usd_cost, int32_t usd_amount) {
+        Serialize::TradeOrder order;
+        order.set_type(type);
+        order.set_usd_cost(usd_cost);
+        order.set_usd_amount(usd_amount);
+        return order;
+    }
+
+    //*INFO: Risk engine may adjust checked order, so temporary orders are checked through copy
+    risk_check_result_t check_new_order(RiskEngine& risk_engine, Serialize::TradeOrder order, AccountBalanceSlot& account_balance) {
+        return risk_engine.check_and_reserve(order, account_balance);
+    }
+
+    RiskLimits create_test_limits() {
+        RiskLimits limits;
+        limits.is_balance_check_enabled = true;
+        limits.rub_credit_limit = 0.0;
+        limits.usd_credit_limit = 5.0;
+        limits.max_order_usd_amount = 100;
+        limits.price_band_percent = 10.0;
+        limits.max_open_orders_per_client = 2;
+        return limits;
+    }
+};
+
+TEST_F(RiskEngineTest, ReservesAgainstAvailableBalance) {
+    RiskEngine risk_engine(create_test_limits());
+    AccountBalanceSlot account_balance(0.0, 1000.0);
+
+    auto buy_order = create_test_order(Serialize::TradeOrder::BUY, 70.0, 10);
+    EXPECT_EQ(risk_engine.check_and_reserve(buy_order, account_balance), RISK_ACCEPTED);
+    EXPECT_DOUBLE_EQ(account_balance.load().rub_reserved(), 700.0);
+
+    //*INFO: Only 300 RUB left available
+    EXPECT_EQ(check_new_order(risk_engine, create_test_order(Serialize::TradeOrder::BUY, 70.0, 5), account_balance),
+              RISK_REJECTED_INSUFFICIENT_BALANCE);
+    EXPECT_EQ(account_balance.get_open_orders_count(), 1);
+
+    //*INFO: USD credit limit allows selling 5 USD without USD balance
+    EXPECT_EQ(check_new_order(risk_engine, create_test_order(Serialize::TradeOrder::SELL, 70.0, 6), account_balance),
+              RISK_REJECTED_INSUFFICIENT_BALANCE);
+    EXPECT_EQ(check_new_order(risk_engine, create_test_order(Serialize::TradeOrder::SELL, 70.0, 5), account_balance),
+              RISK_ACCEPTED);
+
+    //*INFO: Fill of 4 USD at order price and cancel of the rest free the whole reservation
+    account_balance.add(4.0, -280.0);
+    risk_engine.release(Serialize::TradeOrder::BUY, 70.0, 4, account_balance);
+    risk_engine.release(Serialize::TradeOrder::BUY, 70.0, 6, account_balance);
+    risk_engine.close_order(account_balance);
+
+    EXPECT_DOUBLE_EQ(account_balance.load().rub_reserved(), 0.0);
+    EXPECT_DOUBLE_EQ(account_balance.load().rub_balance(), 720.0);
+    EXPECT_EQ(account_balance.get_open_orders_count(), 1);
+}
+
+TEST_F(RiskEngineTest, RejectsByOrderLimits) {
+    RiskEngine risk_engine(create_test_limits());
+    AccountBalanceSlot account_balance(1000.0, 100000.0);
+
+    EXPECT_EQ(check_new_order(risk_engine, create_test_order(Serialize::TradeOrder::BUY, 70.0, 0), account_balance),
+              RISK_REJECTED_INVALID_ORDER);
+    EXPECT_EQ(check_new_order(risk_engine, create_test_order(Serialize::TradeOrder::BUY, 70.0, 101), account_balance),
+              RISK_REJECTED_ORDER_SIZE);
+
+    //*INFO: No price band before first trade
+    EXPECT_EQ(check_new_order(risk_engine, create_test_order(Serialize::TradeOrder::BUY, 90.0, 1), account_balance),
+              RISK_ACCEPTED);
+    risk_engine.update_last_trade_price(70.0);
+    EXPECT_EQ(check_new_order(risk_engine, create_test_order(Serialize::TradeOrder::BUY, 78.0, 1), account_balance),
+              RISK_REJECTED_PRICE_BAND);
+
+    EXPECT_EQ(check_new_order(risk_engine, create_test_order(Serialize::TradeOrder::SELL, 75.0, 1), account_balance),
+              RISK_ACCEPTED);
+    EXPECT_EQ(check_new_order(risk_engine, create_test_order(Serialize::TradeOrder::SELL, 75.0, 1), account_balance),
+              RISK_REJECTED_OPEN_ORDERS_LIMIT);
+}
+
+TEST_F(RiskEngineTest, MarketOrderGetsProtectionPrice) {
+    RiskEngine risk_engine(create_test_limits());
+    AccountBalanceSlot account_balance(1000.0, 100000.0);
+
+    //*INFO: Market buy cost is unknown before first trade
+    auto market_buy_order = create_test_order(Serialize::TradeOrder::BUY, 0.0, 10);
+    market_buy_order.set_order_type(Serialize::TradeOrder::MARKET);
+    EXPECT_EQ(risk_engine.check_and_reserve(market_buy_order, account_balance), RISK_REJECTED_INVALID_ORDER);
+
+    risk_engine.update_last_trade_price(70.0);
+    EXPECT_EQ(risk_engine.check_and_reserve(market_buy_order, account_balance), RISK_ACCEPTED);
+    EXPECT_DOUBLE_EQ(market_buy_order.usd_cost(), 77.0);
+    EXPECT_DOUBLE_EQ(account_balance.load().rub_reserved(), 770.0);
+
+    auto market_sell_order = create_test_order(Serialize::TradeOrder::SELL, 0.0, 10);
+    market_sell_order.set_order_type(Serialize::TradeOrder::MARKET);
+    EXPECT_EQ(risk_engine.check_and_reserve(market_sell_order, account_balance), RISK_ACCEPTED);
+    EXPECT_DOUBLE_EQ(market_sell_order.usd_cost(), 63.0);
+}
+
+TEST_F(RiskEngineTest, ExpiringOrdersGetValidExpireTime) {
+    RiskEngine risk_engine(create_test_limits());
+    AccountBalanceSlot account_balance(1000.0, 100000.0);
+    int64_t current_timestamp = TimeOrderUtils::get_current_timestamp();
+
+    auto expired_order = create_test_order(Serialize::TradeOrder::BUY, 70.0, 1);
+    expired_order.set_time_in_force(Serialize::TradeOrder::GTD);
+    expired_order.set_expire_time(current_timestamp - 1000);
+    EXPECT_EQ(risk_engine.check_and_reserve(expired_order, account_balance), RISK_REJECTED_INVALID_ORDER);
+
+    auto day_order = create_test_order(Serialize::TradeOrder::BUY, 70.0, 1);
+    day_order.set_time_in_force(Serialize::TradeOrder::DAY);
+    EXPECT_EQ(risk_engine.check_and_reserve(day_order, account_balance), RISK_ACCEPTED);
+    EXPECT_GT(day_order.expire_time(), current_timestamp);
+    EXPECT_EQ(day_order.expire_time() % (24 * 60 * 60 * 1000), 0);
+
+    //*INFO: Client expire time is ignored for order without expiry
+    auto gtc_order = create_test_order(Serialize::TradeOrder::BUY, 70.0, 1);
+    gtc_order.set_expire_time(current_timestamp);
+    EXPECT_EQ(risk_engine.check_and_reserve(gtc_order, account_balance), RISK_ACCEPTED);
+    EXPECT_EQ(gtc_order.expire_time(), 0);
+}
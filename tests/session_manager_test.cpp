@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <thread>
+
+#include <boost/asio.hpp>
+
+#include "mock_database.hpp"
+#include "client_data_manager.hpp"
+#include "session_manager.hpp"
+#include "session_client_connection.hpp"
+
+class SessionManagerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        session_manager_ = std::make_shared<SessionManager>();
+    }
+
+    void TearDown() override {
+        session_manager_.reset();
+
+        if (mock_database_) {
+            testing::Mock::AllowLeak(mock_database_.get());
+            mock_database_.reset();
+        }
+    }
+
+    std::shared_ptr<SessionClientConnection> create_test_session() {
+        boost::asio::ip::tcp::socket socket(io_context_);
+        auto session = std::make_shared<SessionClientConnection>(std::move(socket), session_manager_);
+        session_manager_->add_session(session, std::string());
+        return session;
+    }
+
+    void init_trading() {
+        mock_database_ = std::make_shared<MockDatabase>();
+        session_manager_->init_mockdb(mock_database_);
+
+        mock_database_->expect_empty_database();
+
+        session_manager_->init_core();
+        session_manager_->init_client_data_manager();
+        session_manager_->init_auth("test_secret_key");
+    }
+
+    Serialize::TradeResponse send_request(boost::asio::ip::tcp::socket& client_socket, const Serialize::TradeRequest& request) {
+        std::string serialized_request;
+        request.SerializeToString(&serialized_request);
+        uint32_t msg_length = htonl(static_cast<uint32_t>(serialized_request.size()));
+        boost::asio::write(client_socket, boost::asio::buffer(&msg_length, sizeof(uint32_t)));
+        boost::asio::write(client_socket, boost::asio::buffer(serialized_request));
+
+        boost::asio::read(client_socket, boost::asio::buffer(&msg_length, sizeof(uint32_t)));
+        std::string serialized_response(ntohl(msg_length), '\0');
+        boost::asio::read(client_socket, boost::asio::buffer(serialized_response));
+
+        Serialize::TradeResponse response;
+        response.ParseFromString(serialized_response);
+        return response;
+    }
+
+    boost::asio::io_context io_context_;
+    std::shared_ptr<SessionManager> session_manager_;
+    std::shared_ptr<MockDatabase> mock_database_;
+};
+
+TEST_F(SessionManagerTest, BindUsernameToSession) {
+    auto session = create_test_session();
+
+    EXPECT_FALSE(session_manager_->is_user_logged_in("User1"));
+    EXPECT_TRUE(session_manager_->bind_username_to_session("User1", session));
+    EXPECT_TRUE(session_manager_->is_user_logged_in("User1"));
+    EXPECT_EQ(session_manager_->get_session_by_username("User1"), session);
+}
+
+TEST_F(SessionManagerTest, SecondSessionWithSameUsernameRejected) {
+    auto first_session = create_test_session();
+    auto second_session = create_test_session();
+
+    EXPECT_TRUE(session_manager_->bind_username_to_session("User1", first_session));
+    EXPECT_FALSE(session_manager_->bind_username_to_session("User1", second_session));
+    EXPECT_EQ(session_manager_->get_session_by_username("User1"), first_session);
+}
+
+TEST_F(SessionManagerTest, BindAfterRemoveSessionRejected) {
+    auto session = create_test_session();
+
+    session_manager_->remove_session(session, "test");
+    EXPECT_FALSE(session_manager_->bind_username_to_session("User1", session));
+    EXPECT_FALSE(session_manager_->is_user_logged_in("User1"));
+    EXPECT_EQ(session_manager_->get_sessions_count(), 0);
+}
+
+TEST_F(SessionManagerTest, PushExecutionReportToOfflineUserIgnored) {
+    Serialize::ExecutionReport report;
+    report.set_order_id(1);
+    report.set_fill_amount(10);
+
+    session_manager_->push_execution_report("Offline", report);
+    EXPECT_EQ(session_manager_->get_session_by_username("Offline"), nullptr);
+}
+
+TEST_F(SessionManagerTest, RemoveSessionReleasesUsername) {
+    auto session = create_test_session();
+
+    EXPECT_TRUE(session_manager_->bind_username_to_session("User1", session));
+    EXPECT_EQ(session_manager_->get_sessions_count(), 1);
+
+    session_manager_->remove_session(session, "test");
+    EXPECT_FALSE(session_manager_->is_user_logged_in("User1"));
+    EXPECT_EQ(session_manager_->get_sessions_count(), 0);
+
+    auto new_session = create_test_session();
+    EXPECT_TRUE(session_manager_->bind_username_to_session("User1", new_session));
+}
+
+TEST_F(SessionManagerTest, ViewMyActiveOrdersWithoutSignInClosesSession) {
+    session_manager_->init_auth("test_secret_key");
+
+    boost::asio::ip::tcp::acceptor acceptor(io_context_,
+        boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    boost::asio::ip::tcp::socket client_socket(io_context_);
+    client_socket.connect(acceptor.local_endpoint());
+    boost::asio::ip::tcp::socket server_socket(io_context_);
+    acceptor.accept(server_socket);
+    session_manager_->add_new_connection(std::move(server_socket));
+
+    std::thread io_thread([this] { io_context_.run(); });
+
+    Serialize::TradeRequest request;
+    request.set_command(Serialize::TradeRequest::VIEW_MY_ACTIVE_ORDERS);
+    Serialize::TradeResponse response = send_request(client_socket, request);
+    EXPECT_EQ(response.response_msg(), Serialize::TradeResponse::ERROR);
+
+    //*INFO: Server closes session right after error response
+    char byte;
+    boost::system::error_code error_code;
+    boost::asio::read(client_socket, boost::asio::buffer(&byte, 1), error_code);
+    EXPECT_EQ(error_code, boost::asio::error::eof);
+
+    io_thread.join();
+    EXPECT_EQ(session_manager_->get_sessions_count(), 0);
+}
+
+TEST_F(SessionManagerTest, OrderIsPlacedForSignedInUserOnly) {
+    init_trading();
+    auto client_data_manager = session_manager_->get_client_data_manager();
+    client_data_manager->create_new_client_fund_data("Attacker");
+    client_data_manager->create_new_client_fund_data("Victim");
+    EXPECT_CALL(*mock_database_, authenticate_user("Attacker", ::testing::_)).WillOnce(::testing::Return(true));
+
+    boost::asio::ip::tcp::acceptor acceptor(io_context_,
+        boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    boost::asio::ip::tcp::socket client_socket(io_context_);
+    client_socket.connect(acceptor.local_endpoint());
+    boost::asio::ip::tcp::socket server_socket(io_context_);
+    acceptor.accept(server_socket);
+    session_manager_->add_new_connection(std::move(server_socket));
+
+    std::thread io_thread([this] { io_context_.run(); });
+
+    Serialize::TradeRequest sign_in_request;
+    sign_in_request.set_command(Serialize::TradeRequest::SIGN_IN);
+    sign_in_request.mutable_sign_in_request()->set_username("Attacker");
+    sign_in_request.mutable_sign_in_request()->set_password("password");
+    Serialize::TradeResponse sign_in_response = send_request(client_socket, sign_in_request);
+    ASSERT_EQ(sign_in_response.response_msg(), Serialize::TradeResponse::SIGN_IN_SUCCESSFUL);
+
+    //*INFO: Order names other account, it must reserve funds of signed-in user
+    Serialize::TradeRequest order_request;
+    order_request.set_command(Serialize::TradeRequest::MAKE_ORDER);
+    order_request.set_jwt(sign_in_response.jwt());
+    order_request.set_username("Victim");
+    order_request.mutable_order()->set_type(Serialize::TradeOrder::BUY);
+    order_request.mutable_order()->set_usd_cost(70.0);
+    order_request.mutable_order()->set_usd_amount(5);
+    order_request.mutable_order()->set_username("Victim");
+    Serialize::TradeResponse order_response = send_request(client_socket, order_request);
+    EXPECT_EQ(order_response.response_msg(), Serialize::TradeResponse::ORDER_SUCCESSFULLY_CREATED);
+
+    EXPECT_NEAR(client_data_manager->get_client_balance("Victim").rub_reserved(), 0.0, 1e-6);
+    EXPECT_NEAR(client_data_manager->get_client_balance("Attacker").rub_reserved(), 350.0, 1e-6);
+    EXPECT_EQ(client_data_manager->get_client_active_orders_index("Victim")->get_active_orders().active_buy_orders_size(), 0);
+    EXPECT_EQ(client_data_manager->get_client_active_orders_index("Attacker")->get_active_orders().active_buy_orders_size(), 1);
+
+    client_socket.close();
+    io_thread.join();
+}
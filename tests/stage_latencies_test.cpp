@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "stage_latencies.hpp"
+
+namespace {
+
+int64_t get_stage_count(const StageLatencies& stage_latencies, latency_stage_t stage) {
+    LatencyHistogram merged_histogram(STAGE_LATENCY_HIGHEST_NS);
+    stage_latencies.merge_stage(stage, merged_histogram);
+    return merged_histogram.get_total_count();
+}
+
+} // namespace
+
+TEST(StageLatenciesTest, HistogramsOfAllThreadsAreMerged) {
+    StageLatencies stage_latencies;
+
+    stage_latencies.record(STAGE_QUEUE_WAIT, 1000, 3000);
+    std::thread session_thread([&stage_latencies] {
+        for (int order_num = 0; order_num < 99; ++order_num) {
+            stage_latencies.record(STAGE_QUEUE_WAIT, 1000, 501000);
+        }
+        stage_latencies.record(STAGE_MATCH, 1000, 2000);
+    });
+    session_thread.join();
+
+    LatencyHistogram queue_wait_histogram(STAGE_LATENCY_HIGHEST_NS);
+    stage_latencies.merge_stage(STAGE_QUEUE_WAIT, queue_wait_histogram);
+    EXPECT_EQ(queue_wait_histogram.get_total_count(), 100);
+    EXPECT_EQ(queue_wait_histogram.get_min(), 2000);
+    EXPECT_NEAR(queue_wait_histogram.get_value_at_percentile(50.0), 500000, 500);
+
+    EXPECT_EQ(get_stage_count(stage_latencies, STAGE_MATCH), 1);
+    EXPECT_EQ(get_stage_count(stage_latencies, STAGE_PERSIST), 0);
+    EXPECT_NE(stage_latencies.get_report().find("queue_wait"), std::string::npos);
+}
+
+TEST(StageLatenciesTest, MissingStartPointIsNotRecorded) {
+    StageLatencies stage_latencies;
+    StageLatencies other_stage_latencies;
+
+    stage_latencies.record(STAGE_RESPONSE_WRITE, 0, StageLatencies::now_ns());
+    other_stage_latencies.record(STAGE_RESPONSE_WRITE, 1, 2);
+    stage_latencies.record(STAGE_RESPONSE_WRITE, 1, 3);
+
+    //*INFO: Same thread records to two instances, each one keeps own counts
+    EXPECT_EQ(get_stage_count(stage_latencies, STAGE_RESPONSE_WRITE), 1);
+    EXPECT_EQ(get_stage_count(other_stage_latencies, STAGE_RESPONSE_WRITE), 1);
+}
+
+TEST(StageLatenciesTest, LockWaitsAreKeptApartFromStages) {
+    StageLatencies stage_latencies;
+
+    stage_latencies.record_lock_wait(LOCK_WAIT_CLIENT_SHARD, 1000, 4000);
+
+    LatencyHistogram lock_wait_histogram(STAGE_LATENCY_HIGHEST_NS);
+    stage_latencies.merge_lock_wait(LOCK_WAIT_CLIENT_SHARD, lock_wait_histogram);
+    EXPECT_EQ(lock_wait_histogram.get_total_count(), 1);
+    for (int stage = 0; stage < STAGES_COUNT; ++stage) {
+        EXPECT_EQ(get_stage_count(stage_latencies, static_cast<latency_stage_t>(stage)), 0);
+    }
+    EXPECT_NE(stage_latencies.get_report().find("client_shard_lock_wait"), std::string::npos);
+}
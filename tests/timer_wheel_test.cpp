@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+#include "timer_wheel.hpp"
+
+namespace {
+
+std::vector<int64_t> advance_to(TimerWheel& timer_wheel, int64_t current_time) {
+    std::vector<TimerWheel::Timer> expired_timers;
+    timer_wheel.advance(current_time, expired_timers);
+
+    std::vector<int64_t> order_ids;
+    for (const auto& timer : expired_timers) {
+        order_ids.push_back(timer.order_id);
+    }
+    return order_ids;
+}
+
+} // namespace
+
+TEST(TimerWheelTest, FiresTimersAtTheirTick) {
+    TimerWheel timer_wheel(100, 0);
+
+    timer_wheel.schedule(1, Serialize::TradeOrder::BUY, 250);
+    timer_wheel.schedule(2, Serialize::TradeOrder::SELL, 150);
+    timer_wheel.schedule(3, Serialize::TradeOrder::BUY, 300);
+    EXPECT_EQ(timer_wheel.size(), 3);
+
+    //*INFO: Timer is never fired before its expire time
+    EXPECT_TRUE(advance_to(timer_wheel, 199).empty());
+    EXPECT_EQ(advance_to(timer_wheel, 200), (std::vector<int64_t>{2}));
+    EXPECT_EQ(advance_to(timer_wheel, 300), (std::vector<int64_t>{1, 3}));
+    EXPECT_TRUE(timer_wheel.empty());
+}
+
+TEST(TimerWheelTest, CascadesFarTimersDownLevels) {
+    TimerWheel timer_wheel(1, 0);
+
+    //*INFO: Level 1, level 2, level 3 and beyond whole wheel range
+    timer_wheel.schedule(1, Serialize::TradeOrder::BUY, 100);
+    timer_wheel.schedule(2, Serialize::TradeOrder::BUY, 5000);
+    timer_wheel.schedule(3, Serialize::TradeOrder::BUY, 300000);
+    timer_wheel.schedule(4, Serialize::TradeOrder::BUY, 20000000);
+
+    EXPECT_TRUE(advance_to(timer_wheel, 99).empty());
+    EXPECT_EQ(advance_to(timer_wheel, 100), (std::vector<int64_t>{1}));
+    EXPECT_TRUE(advance_to(timer_wheel, 4999).empty());
+    EXPECT_EQ(advance_to(timer_wheel, 5000), (std::vector<int64_t>{2}));
+    EXPECT_TRUE(advance_to(timer_wheel, 299999).empty());
+    EXPECT_EQ(advance_to(timer_wheel, 300000), (std::vector<int64_t>{3}));
+    EXPECT_TRUE(advance_to(timer_wheel, 19999999).empty());
+    EXPECT_EQ(advance_to(timer_wheel, 20000000), (std::vector<int64_t>{4}));
+}
+
+TEST(TimerWheelTest, NextExpiryTimeSkipsEmptySlots) {
+    TimerWheel timer_wheel(100, 0);
+    EXPECT_EQ(timer_wheel.get_next_expiry_time(), std::numeric_limits<int64_t>::max());
+
+    timer_wheel.schedule(1, Serialize::TradeOrder::BUY, 2000);
+    EXPECT_EQ(timer_wheel.get_next_expiry_time(), 2000);
+
+    //*INFO: Level 1 timer wakes at cascade of its slot, which then gives exact tick
+    timer_wheel.schedule(2, Serialize::TradeOrder::BUY, 10050);
+    EXPECT_EQ(advance_to(timer_wheel, 2000), (std::vector<int64_t>{1}));
+    EXPECT_EQ(timer_wheel.get_next_expiry_time(), 6400);
+    EXPECT_TRUE(advance_to(timer_wheel, 6400).empty());
+    EXPECT_EQ(timer_wheel.get_next_expiry_time(), 10100);
+    EXPECT_EQ(advance_to(timer_wheel, 10100), (std::vector<int64_t>{2}));
+    EXPECT_EQ(timer_wheel.get_next_expiry_time(), std::numeric_limits<int64_t>::max());
+}
+
+TEST(TimerWheelTest, PassedExpireTimeFiresOnNextAdvance) {
+    TimerWheel timer_wheel(100, 1000);
+
+    timer_wheel.schedule(1, Serialize::TradeOrder::SELL, 500);
+    EXPECT_EQ(advance_to(timer_wheel, 1000), (std::vector<int64_t>{1}));
+
+    //*INFO: Empty wheel jumps straight to current time
+    EXPECT_TRUE(advance_to(timer_wheel, 1000000).empty());
+    EXPECT_EQ(timer_wheel.get_next_tick_time(), 1000100);
+}